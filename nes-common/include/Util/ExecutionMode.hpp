@@ -23,6 +23,8 @@ enum class ExecutionMode : uint8_t
     /// Uses the interpretation based execution mode.
     INTERPRETER,
     /// Uses the compilation based execution mode.
-    COMPILER
+    COMPILER,
+    /// Starts executing interpreted, while the pipelines are compiled in the background, and switches to the compiled code once ready.
+    TIERED
 };
 }
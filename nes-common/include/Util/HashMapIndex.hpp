@@ -0,0 +1,29 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace NES
+{
+/// How a hash map finds the entries of a hash. Both variants store the entries themselves on the same pages.
+enum class HashMapIndex : uint8_t
+{
+    /// An array of chains, one linked list of entries per bucket.
+    CHAINED,
+    /// Open addressing over groups of 16 control bytes holding 7 bits of the hash each, probed with one SIMD compare per group.
+    SWISS
+};
+}
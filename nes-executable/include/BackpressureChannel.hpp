@@ -66,4 +66,7 @@ class BackpressureListener
 
 public:
     void wait(const std::stop_token& stopToken) const;
+
+    /// Non-blocking alternative to `wait` for callers that multiplex many sources on one thread.
+    [[nodiscard]] bool hasBackpressure() const;
 };
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <variant>
 #include <vector>
@@ -61,6 +62,15 @@ struct CompiledQueryPlan
         std::vector<std::variant<OperatorId, std::weak_ptr<ExecutablePipeline>>> predecessor;
     };
 
+    struct PipelineCompilation
+    {
+        PipelineId pipelineId;
+        std::chrono::system_clock::time_point start;
+        std::chrono::nanoseconds duration;
+        /// The code of a structurally equal pipeline was reused, the duration covers only its lookup.
+        bool reusedCompiledCode;
+    };
+
     static std::unique_ptr<CompiledQueryPlan> create(
         QueryId queryId, std::vector<std::shared_ptr<ExecutablePipeline>> pipelines, std::vector<Sink> sinks, std::vector<Source> sources);
 
@@ -68,5 +78,7 @@ struct CompiledQueryPlan
     std::vector<std::shared_ptr<ExecutablePipeline>> pipelines;
     std::vector<Sink> sinks;
     std::vector<Source> sources;
+    /// Pipelines that were compiled before the query starts, empty if all pipelines compile when they are started.
+    std::vector<PipelineCompilation> pipelineCompilations;
 };
 }
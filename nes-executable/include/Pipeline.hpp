@@ -23,6 +23,7 @@
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <PhysicalOperator.hpp>
+#include <PipelineFingerprint.hpp>
 #include <SinkPhysicalOperator.hpp>
 #include <SourceDescriptorPhysicalOperator.hpp>
 
@@ -70,6 +71,10 @@ struct Pipeline
     [[nodiscard]] const std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() const;
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers();
 
+    /// The pipelining phase records the fingerprint alongside the operators it adds to the pipeline.
+    [[nodiscard]] const PipelineFingerprint& getFingerprint() const;
+    PipelineFingerprint& getFingerprint();
+
     void addSuccessor(const std::shared_ptr<Pipeline>& successor, const std::weak_ptr<Pipeline>& self);
 
     void removePredecessor(const Pipeline& pipeline);
@@ -84,6 +89,7 @@ private:
     PhysicalOperator rootOperator;
     const PipelineId pipelineId;
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    PipelineFingerprint fingerprint;
     std::vector<std::shared_ptr<Pipeline>> successorPipelines;
     std::vector<std::weak_ptr<Pipeline>> predecessorPipelines;
 };
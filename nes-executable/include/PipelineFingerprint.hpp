@@ -0,0 +1,75 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+#include <DataTypes/UnboundField.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <Schema/Schema.hpp>
+
+namespace NES
+{
+
+/// Structural identity of the operator chain of a pipeline, which is recorded by the pipelining phase.
+/// Two pipelines with equal fingerprints, compiled under the same QueryExecutionConfiguration, trace to the same code, except for the
+/// ids of their operator handlers, which the traced code looks up at runtime. Equality therefore ignores the values of the handler ids,
+/// and only compares at which positions they occur.
+struct PipelineFingerprint
+{
+    struct Operator
+    {
+        /// Name of the physical operator type.
+        std::string physicalOperator;
+        /// The logical operator the physical operator was lowered from. Compared structurally, i.e., ignoring its id and children.
+        /// Not set for the scans and emits inserted by the pipelining phase.
+        std::optional<LogicalOperator> loweredFrom;
+        std::optional<Schema<QualifiedUnboundField, Ordered>> inputSchema;
+        std::optional<Schema<QualifiedUnboundField, Ordered>> outputSchema;
+        std::optional<MemoryLayoutType> inputMemoryLayoutType;
+        std::optional<MemoryLayoutType> outputMemoryLayoutType;
+        /// Any further parameter of the physical operator that is neither part of the logical operator nor of the configuration,
+        /// e.g., the input or output format of a formatting scan or emit.
+        std::string parameters;
+        std::optional<OperatorHandlerId> operatorHandlerId;
+    };
+
+    void prepend(Operator op);
+    void append(Operator op);
+
+    [[nodiscard]] const std::vector<Operator>& getOperators() const { return operators; }
+
+    /// Ids of the operator handlers of all operators, in the order of the operators.
+    [[nodiscard]] std::vector<OperatorHandlerId> getOperatorHandlerIds() const;
+
+    [[nodiscard]] size_t hash() const;
+
+    friend bool operator==(const PipelineFingerprint& lhs, const PipelineFingerprint& rhs);
+
+private:
+    std::vector<Operator> operators;
+};
+
+}
+
+template <>
+struct std::hash<NES::PipelineFingerprint>
+{
+    size_t operator()(const NES::PipelineFingerprint& fingerprint) const noexcept { return fingerprint.hash(); }
+};
@@ -97,6 +97,13 @@ void BackpressureListener::wait(const std::stop_token& stopToken) const
     INVARIANT(!destroyed, "Backpressure Controller was destroyed before the BackpressureListener");
 }
 
+bool BackpressureListener::hasBackpressure() const
+{
+    const auto state = *channel->stateMtx.lock();
+    INVARIANT(state != Channel::DESTROYED, "Backpressure Controller was destroyed before the BackpressureListener");
+    return state == Channel::CLOSED;
+}
+
 std::pair<BackpressureController, BackpressureListener> createBackpressureChannel()
 {
     const auto channel = std::make_shared<Channel>();
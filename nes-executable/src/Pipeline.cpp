@@ -224,6 +224,16 @@ std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& Pipelin
     return operatorHandlers;
 }
 
+const PipelineFingerprint& Pipeline::getFingerprint() const
+{
+    return fingerprint;
+}
+
+PipelineFingerprint& Pipeline::getFingerprint()
+{
+    return fingerprint;
+}
+
 void Pipeline::setExecutionMode(ExecutionMode mode)
 {
     executionMode = mode;
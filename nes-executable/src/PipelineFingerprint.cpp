@@ -0,0 +1,99 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <PipelineFingerprint.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Operators/LogicalOperator.hpp>
+#include <folly/hash/Hash.h>
+
+namespace NES
+{
+
+namespace
+{
+bool structurallyEqual(const PipelineFingerprint::Operator& lhs, const PipelineFingerprint::Operator& rhs)
+{
+    const auto sameLogicalOperator = lhs.loweredFrom.has_value() == rhs.loweredFrom.has_value()
+        and (not lhs.loweredFrom.has_value() or StructuralOperatorEqual{}(*lhs.loweredFrom, *rhs.loweredFrom));
+    return lhs.physicalOperator == rhs.physicalOperator and sameLogicalOperator and lhs.inputSchema == rhs.inputSchema
+        and lhs.outputSchema == rhs.outputSchema and lhs.inputMemoryLayoutType == rhs.inputMemoryLayoutType
+        and lhs.outputMemoryLayoutType == rhs.outputMemoryLayoutType and lhs.parameters == rhs.parameters
+        and lhs.operatorHandlerId.has_value() == rhs.operatorHandlerId.has_value();
+}
+
+/// Maps every id of one side to exactly one id of the other side. Operators may share an operator handler, e.g., the build and the
+/// probe of a join, and must do so on both sides.
+bool consistentOperatorHandlerIds(const PipelineFingerprint& lhs, const PipelineFingerprint& rhs)
+{
+    std::unordered_map<OperatorHandlerId, OperatorHandlerId> lhsToRhs;
+    std::unordered_map<OperatorHandlerId, OperatorHandlerId> rhsToLhs;
+    for (const auto& [lhsId, rhsId] : std::views::zip(lhs.getOperatorHandlerIds(), rhs.getOperatorHandlerIds()))
+    {
+        const auto [lhsEntry, lhsInserted] = lhsToRhs.try_emplace(lhsId, rhsId);
+        const auto [rhsEntry, rhsInserted] = rhsToLhs.try_emplace(rhsId, lhsId);
+        if (lhsEntry->second != rhsId or rhsEntry->second != lhsId)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+void PipelineFingerprint::prepend(Operator op)
+{
+    operators.insert(operators.begin(), std::move(op));
+}
+
+void PipelineFingerprint::append(Operator op)
+{
+    operators.emplace_back(std::move(op));
+}
+
+std::vector<OperatorHandlerId> PipelineFingerprint::getOperatorHandlerIds() const
+{
+    return operators | std::views::filter([](const Operator& op) { return op.operatorHandlerId.has_value(); })
+        | std::views::transform([](const Operator& op) { return *op.operatorHandlerId; }) | std::ranges::to<std::vector>();
+}
+
+size_t PipelineFingerprint::hash() const
+{
+    size_t result = 0;
+    for (const auto& op : operators)
+    {
+        result = folly::hash::hash_combine(
+            result,
+            op.physicalOperator,
+            op.loweredFrom.has_value() ? StructuralOperatorHash{}(*op.loweredFrom) : 0,
+            op.inputSchema.has_value() ? std::hash<Schema<QualifiedUnboundField, Ordered>>{}(*op.inputSchema) : 0,
+            op.outputSchema.has_value() ? std::hash<Schema<QualifiedUnboundField, Ordered>>{}(*op.outputSchema) : 0,
+            op.parameters);
+    }
+    return result;
+}
+
+bool operator==(const PipelineFingerprint& lhs, const PipelineFingerprint& rhs)
+{
+    return std::ranges::equal(lhs.operators, rhs.operators, structurallyEqual) and consistentOperatorHandlerIds(lhs, rhs);
+}
+
+}
@@ -15,9 +15,17 @@
 #pragma once
 
 
+#include <bit>
+#include <charconv>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <vector>
 
 #include <DataTypes/DataType.hpp>
@@ -63,6 +71,129 @@ void parseRawValueIntoRecord(
 /// We expect a pointer and the size so that we can use this method from the nautilus runtime
 bool checkIsNullProxy(const int8_t* fieldAddress, uint64_t fieldSize, const std::vector<std::string>* nullValues) noexcept;
 
+/// The parseFieldValue functions parse a trimmed field directly from the raw bytes. In contrast to `from_chars_with_exception`, they
+/// neither allocate nor throw and only report whether the field is a valid value of the requested type. They accept the same inputs as
+/// `from_chars_with_exception`, which remains the (slow) path to produce a meaningful error message for malformed fields.
+bool parseFieldValue(std::string_view field, bool& value) noexcept;
+bool parseFieldValue(std::string_view field, char& value) noexcept;
+bool parseFieldValue(std::string_view field, float& value) noexcept;
+bool parseFieldValue(std::string_view field, double& value) noexcept;
+
+namespace detail
+{
+/// Decimal digits that are guaranteed to fit into an uint64_t, longer inputs are handed to std::from_chars
+constexpr size_t MAX_SWAR_DIGITS = 19;
+
+/// Checks if all eight bytes of the little-endian word are ASCII digits
+inline bool isEightDigits(const uint64_t word) noexcept
+{
+    constexpr uint64_t highNibbles = 0xF0F0F0F0F0F0F0F0;
+    constexpr uint64_t digitHighNibbles = 0x3030303030303030;
+    /// Adding 6 moves the bytes ':' to '?' out of the digit range, while '0' to '9' keep their high nibble
+    return ((word & highNibbles) == digitHighNibbles) and (((word + 0x0606060606060606) & highNibbles) == digitHighNibbles);
+}
+
+/// Converts eight ASCII digits of a little-endian word into their value using SIMD-within-a-register arithmetic, i.e., by combining
+/// neighbouring digits into pairs, pairs into quadruples and quadruples into the final value with three multiplications.
+inline uint32_t parseEightDigits(uint64_t word) noexcept
+{
+    word -= 0x3030303030303030;
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) + (((word >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32))))
+        >> 32;
+    return static_cast<uint32_t>(word);
+}
+
+/// Accumulates the decimal digits in [begin, end) into magnitude. Returns false if a non-digit is encountered.
+inline bool parseDecimalDigits(const char* begin, const char* end, uint64_t& magnitude) noexcept
+{
+    magnitude = 0;
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        while (end - begin >= 8)
+        {
+            uint64_t word{};
+            std::memcpy(&word, begin, sizeof(word));
+            if (not isEightDigits(word))
+            {
+                return false;
+            }
+            magnitude = (magnitude * 100000000) + parseEightDigits(word);
+            begin += 8;
+        }
+    }
+    for (; begin != end; ++begin)
+    {
+        const auto digit = static_cast<uint8_t>(*begin - '0');
+        if (digit > 9)
+        {
+            return false;
+        }
+        magnitude = (magnitude * 10) + digit;
+    }
+    return true;
+}
+}
+
+template <std::integral T>
+requires(not(std::is_same_v<T, bool> || std::is_same_v<T, char>))
+bool parseFieldValue(const std::string_view field, T& value) noexcept
+{
+    /// Hexadecimal values are rare, thus we do not bother to provide a fast path for them
+    if (field.size() > 2 and field[0] == '0' and (field[1] == 'x' or field[1] == 'X'))
+    {
+        const auto [parsedTillPtr, errorCode] = std::from_chars(field.data() + 2, field.data() + field.size(), value, 16);
+        return errorCode == std::errc() and parsedTillPtr == field.data() + field.size();
+    }
+
+    const char* begin = field.data();
+    const char* end = field.data() + field.size();
+    bool negative = false;
+    if constexpr (std::is_signed_v<T>)
+    {
+        if (begin != end and *begin == '-')
+        {
+            negative = true;
+            ++begin;
+        }
+    }
+
+    if (begin == end)
+    {
+        return false;
+    }
+    if (static_cast<size_t>(end - begin) > detail::MAX_SWAR_DIGITS)
+    {
+        const auto [parsedTillPtr, errorCode] = std::from_chars(field.data(), end, value);
+        return errorCode == std::errc() and parsedTillPtr == end;
+    }
+
+    uint64_t magnitude = 0;
+    if (not detail::parseDecimalDigits(begin, end, magnitude))
+    {
+        return false;
+    }
+
+    using Unsigned = std::make_unsigned_t<T>;
+    if (negative)
+    {
+        /// The magnitude of the smallest value of a signed type is one larger than the largest value
+        constexpr auto smallestMagnitude = static_cast<uint64_t>(static_cast<Unsigned>(std::numeric_limits<T>::max())) + 1;
+        if (magnitude > smallestMagnitude)
+        {
+            return false;
+        }
+        value = static_cast<T>(static_cast<Unsigned>(0) - static_cast<Unsigned>(magnitude));
+        return true;
+    }
+    if (magnitude > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+    {
+        return false;
+    }
+    value = static_cast<T>(magnitude);
+    return true;
+}
+
 template <typename T, bool Nullable>
 requires(
     not(std::is_same_v<T, int8_t*> || std::is_same_v<T, uint8_t*> || std::is_same_v<T, std::byte*> || std::is_same_v<T, char*>
@@ -87,22 +218,21 @@ ParseResult<T>* parseIntoVarValProxy(int8_t* fieldAddress, const uint64_t fieldS
         }
     }
 
-    try
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the raw buffer contains characters
+    const auto field = trimWhiteSpaces(std::string_view{reinterpret_cast<const char*>(fieldAddress), fieldSize});
+    if (parseFieldValue(field, result.value)) [[likely]]
     {
-        const std::string fieldAsString{fieldAddress, fieldAddress + fieldSize};
-        const auto trimmedFieldAsString = trimWhiteSpaces(fieldAsString);
-        result.value = NES::from_chars_with_exception<T>(trimmedFieldAsString);
+        return &result;
     }
-    catch (const Exception& ex)
+
+    /// If the field is nullable, we return a null value, otherwise we throw an exception that describes why the field is malformed
+    if constexpr (not Nullable)
     {
-        /// If the field is nullable, we return a null value, otherwise we throw an exception
-        if constexpr (not Nullable)
-        {
-            throw;
-        }
-        result.isNull = true;
-        result.value = T{0};
+        result.value = NES::from_chars_with_exception<T>(field);
+        return &result;
     }
+    result.isNull = true;
+    result.value = T{0};
     return &result;
 }
 
@@ -68,6 +68,11 @@ public:
 
     void emplaceFieldOffset(FieldIndex offset) { this->indexValues.emplace_back(offset); }
 
+    [[nodiscard]] size_t getNumberOfFieldOffsets() const { return this->indexValues.size(); }
+
+    /// Discards all field offsets after the first numberOfFieldOffsets, e.g., offsets of a tuple that is not terminated by a delimiter
+    void truncateFieldOffsets(const size_t numberOfFieldOffsets) { this->indexValues.resize(numberOfFieldOffsets); }
+
     /// Sets offsetOfFirstTuple and offsetOfLastTuple to 'max' values, indicating that none were found
     void markNoTupleDelimiters();
 
@@ -14,7 +14,11 @@
 
 #include <CSVInputFormatIndexer.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -31,9 +35,142 @@
 #include <RawBufferIndex.hpp>
 #include <RawTupleBuffer.hpp>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 namespace
 {
 
+/// The structural indexer classifies blocks of 64 bytes at once, so that every byte of a block maps to one bit of a 64-bit mask
+constexpr size_t BLOCK_SIZE = 64;
+
+/// Bit i of a mask is set if byte i of the block is a tuple delimiter, a field delimiter or a double quote, respectively
+struct StructuralMasks
+{
+    uint64_t tupleDelimiters;
+    uint64_t fieldDelimiters;
+    uint64_t quotes;
+};
+
+StructuralMasks classifyBlock(const char* block, const char tupleDelimiter, const char fieldDelimiter)
+{
+    StructuralMasks masks{.tupleDelimiters = 0, .fieldDelimiters = 0, .quotes = 0};
+#if defined(__SSE2__)
+    constexpr size_t bytesPerVector = sizeof(__m128i);
+    const auto tupleDelimiters = _mm_set1_epi8(tupleDelimiter);
+    const auto fieldDelimiters = _mm_set1_epi8(fieldDelimiter);
+    const auto quotes = _mm_set1_epi8('"');
+    for (size_t offset = 0; offset < BLOCK_SIZE; offset += bytesPerVector)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) unaligned load of the next 16 bytes of the block
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+        const auto toMask = [](const __m128i matches) { return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches))); };
+        masks.tupleDelimiters |= toMask(_mm_cmpeq_epi8(bytes, tupleDelimiters)) << offset;
+        masks.fieldDelimiters |= toMask(_mm_cmpeq_epi8(bytes, fieldDelimiters)) << offset;
+        masks.quotes |= toMask(_mm_cmpeq_epi8(bytes, quotes)) << offset;
+    }
+#else
+    for (size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        const uint64_t bit = 1ULL << i;
+        masks.tupleDelimiters |= (block[i] == tupleDelimiter) ? bit : 0;
+        masks.fieldDelimiters |= (block[i] == fieldDelimiter) ? bit : 0;
+        masks.quotes |= (block[i] == '"') ? bit : 0;
+    }
+#endif
+    return masks;
+}
+
+/// Bit i of the result is the parity of the set bits 0 to i of the input, i.e., it is set for all bytes between an opening (inclusive)
+/// and a closing (exclusive) quote.
+uint64_t prefixXor(uint64_t bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/// Indexes all tuples after the first tuple delimiter block-at-a-time and returns the offset of the last tuple delimiter.
+/// As in the scalar indexing functions, tuple delimiters are never quoted and the quotation state is reset at the start of every tuple.
+/// A field delimiter is quoted, if an odd number of quotes precede it within its tuple. Thus, we compare the quote parity of the
+/// field delimiter with the quote parity of the tuple delimiter that started its tuple.
+NES::FieldIndex indexTuplesInBlocks(
+    NES::FieldOffsetRawBufferIndex& fieldOffsetRawBufferIndex,
+    const std::string_view rawBuffer,
+    const NES::FieldIndex offsetOfFirstTupleDelimiter,
+    const char tupleDelimiter,
+    const char fieldDelimiter,
+    const bool allowCommasInStrings,
+    const size_t numberOfFields)
+{
+    const size_t startIdxOfFirstTuple = offsetOfFirstTupleDelimiter + NES::CSVInputFormatIndexer::SIZE_OF_TUPLE_DELIMITER;
+    NES::FieldIndex offsetOfLastTupleDelimiter = offsetOfFirstTupleDelimiter;
+    size_t numberOfFieldOffsetsOfCompleteTuples = fieldOffsetRawBufferIndex.getNumberOfFieldOffsets();
+
+    /// The start of the tuple is the offset of the first field of the tuple
+    fieldOffsetRawBufferIndex.emplaceFieldOffset(startIdxOfFirstTuple);
+    size_t fieldIdx = 1;
+    uint64_t quoteParityAtStartOfTuple = 0;
+    uint64_t quoteParityOfPreviousBlocks = 0;
+
+    std::array<char, BLOCK_SIZE> paddedLastBlock{};
+    for (size_t blockStart = startIdxOfFirstTuple; blockStart < rawBuffer.size(); blockStart += BLOCK_SIZE)
+    {
+        const size_t bytesInBlock = std::min(BLOCK_SIZE, rawBuffer.size() - blockStart);
+        const char* block = rawBuffer.data() + blockStart;
+        uint64_t validBytes = ~0ULL;
+        if (bytesInBlock < BLOCK_SIZE)
+        {
+            /// Avoid reading past the end of the buffer, bits of the padding bytes are masked out
+            std::copy_n(block, bytesInBlock, paddedLastBlock.begin());
+            block = paddedLastBlock.data();
+            validBytes = (1ULL << bytesInBlock) - 1;
+        }
+
+        const auto [tupleDelimiters, fieldDelimiters, quotes] = classifyBlock(block, tupleDelimiter, fieldDelimiter);
+        const uint64_t quoteParity = allowCommasInStrings ? prefixXor(quotes & validBytes) ^ (0 - quoteParityOfPreviousBlocks) : 0;
+        for (uint64_t structurals = (tupleDelimiters | fieldDelimiters) & validBytes; structurals != 0; structurals &= structurals - 1)
+        {
+            const auto position = static_cast<size_t>(std::countr_zero(structurals));
+            const auto offset = static_cast<NES::FieldIndex>(blockStart + position);
+            const uint64_t quoteParityAtPosition = (quoteParity >> position) & 1;
+            if (((tupleDelimiters >> position) & 1) != 0)
+            {
+                /// The offset of the tuple delimiter marks the end of the last field of the tuple
+                fieldOffsetRawBufferIndex.emplaceFieldOffset(offset);
+                if (fieldIdx != numberOfFields)
+                {
+                    throw NES::CannotFormatSourceData(
+                        "Number of parsed fields does not match number of fields in schema (parsed {} vs {} schema",
+                        fieldIdx,
+                        numberOfFields);
+                }
+                numberOfFieldOffsetsOfCompleteTuples = fieldOffsetRawBufferIndex.getNumberOfFieldOffsets();
+                offsetOfLastTupleDelimiter = offset;
+
+                fieldOffsetRawBufferIndex.emplaceFieldOffset(offset + NES::CSVInputFormatIndexer::SIZE_OF_TUPLE_DELIMITER);
+                fieldIdx = 1;
+                quoteParityAtStartOfTuple = quoteParityAtPosition;
+            }
+            else if (quoteParityAtPosition == quoteParityAtStartOfTuple)
+            {
+                fieldOffsetRawBufferIndex.emplaceFieldOffset(offset + NES::CSVInputFormatIndexer::SIZE_OF_FIELD_DELIMITER);
+                ++fieldIdx;
+            }
+        }
+        quoteParityOfPreviousBlocks = quoteParity >> (BLOCK_SIZE - 1);
+    }
+
+    /// The bytes after the last tuple delimiter belong to a tuple that spans into the next buffer and is not indexed here
+    fieldOffsetRawBufferIndex.truncateFieldOffsets(numberOfFieldOffsetsOfCompleteTuples);
+    return offsetOfLastTupleDelimiter;
+}
+
 
 void initializeIndexFunctionForTupleWithCommasInStrings(
     NES::FieldOffsetRawBufferIndex& fieldOffsetRawBufferIndex,
@@ -115,6 +252,22 @@ std::unique_ptr<RawBufferIndex> CSVInputFormatIndexer::indexRawBuffer(const std:
         return fieldOffsets;
     }
 
+    /// The scalar indexing functions check for a field delimiter before toggling the quotation state. If the field delimiter is a quote,
+    /// the structural indexer cannot reproduce this order, thus we fall back to the scalar indexing functions.
+    if (not(this->allowCommasInStrings and this->fieldDelimiter == '"'))
+    {
+        const auto offsetOfLastTupleDelimiter = indexTuplesInBlocks(
+            *fieldOffsets,
+            rawBuffer,
+            offsetOfFirstTupleDelimiter,
+            this->tupleDelimiter,
+            this->fieldDelimiter,
+            this->allowCommasInStrings,
+            this->numberOfFields);
+        fieldOffsets->markWithTupleDelimiters(offsetOfFirstTupleDelimiter, offsetOfLastTupleDelimiter);
+        return fieldOffsets;
+    }
+
     /// If the buffer contains at least one delimiter, check if it contains more and index all tuples between the tuple delimiters
     auto startIdxOfNextTuple = offsetOfFirstTupleDelimiter + SIZE_OF_TUPLE_DELIMITER;
     size_t endIdxOfNextTuple = rawBuffer.find(this->tupleDelimiter, startIdxOfNextTuple);
@@ -15,11 +15,18 @@
 #include <RawValueParser.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -28,6 +35,7 @@
 #include <DataTypes/VariableSizedData.hpp>
 #include <Identifiers/QualifiedIdentifier.hpp>
 #include <Interface/Record.hpp>
+#include <Util/Strings.hpp>
 #include <std/cstring.h>
 #include <Arena.hpp>
 #include <ErrorHandling.hpp>
@@ -44,8 +52,98 @@ namespace NES
 bool checkIsNullProxy(const int8_t* fieldAddress, const uint64_t fieldSize, const std::vector<std::string>* nullValues) noexcept
 {
     PRECONDITION(nullValues != nullptr, "NullValues is expected to be not null!");
-    const std::string fieldAsString{fieldAddress, fieldAddress + fieldSize};
-    return std::ranges::any_of(*nullValues, [fieldAsString](const std::string& nullValue) { return nullValue == fieldAsString; });
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the raw buffer contains characters
+    const std::string_view field{reinterpret_cast<const char*>(fieldAddress), fieldSize};
+    return std::ranges::any_of(*nullValues, [field](const std::string& nullValue) { return nullValue == field; });
+}
+
+namespace
+{
+bool equalsIgnoreCase(const std::string_view field, const std::string_view lowerCaseExpected) noexcept
+{
+    return std::ranges::equal(
+        field, lowerCaseExpected, [](const char lhs, const char rhs) { return std::tolower(static_cast<unsigned char>(lhs)) == rhs; });
+}
+
+/// Parses floating point values via std::strtof/strtod on a stack copy of the field, as the raw field is not null-terminated.
+/// Accepts the same inputs as `from_chars<float>`/`from_chars<double>`, e.g., a leading '+' or hexadecimal floats.
+template <typename T>
+bool parseFloatingPointWithStrtod(const std::string_view field, T& value) noexcept
+{
+    constexpr size_t maxFieldLength = 127;
+    if (field.empty() or field.size() > maxFieldLength)
+    {
+        if (const auto parsed = from_chars<T>(field))
+        {
+            value = *parsed;
+            return true;
+        }
+        return false;
+    }
+
+    std::array<char, maxFieldLength + 1> nullTerminated{};
+    std::ranges::copy(field, nullTerminated.begin());
+    char* parsedTill = nullptr;
+    errno = 0;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        value = std::strtof(nullTerminated.data(), &parsedTill);
+    }
+    else
+    {
+        value = std::strtod(nullTerminated.data(), &parsedTill);
+    }
+    return errno != ERANGE and parsedTill == nullTerminated.data() + field.size();
+}
+
+template <typename T>
+bool parseFloatingPoint(const std::string_view field, T& value) noexcept
+{
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    /// std::from_chars is the fast path, as it is locale-independent and does not require a null-terminated input
+    const auto [parsedTillPtr, errorCode] = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (errorCode == std::errc() and parsedTillPtr == field.data() + field.size()) [[likely]]
+    {
+        return true;
+    }
+#endif
+    return parseFloatingPointWithStrtod(field, value);
+}
+}
+
+bool parseFieldValue(const std::string_view field, bool& value) noexcept
+{
+    if (field == "1" or equalsIgnoreCase(field, "true"))
+    {
+        value = true;
+        return true;
+    }
+    if (field == "0" or equalsIgnoreCase(field, "false"))
+    {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+bool parseFieldValue(const std::string_view field, char& value) noexcept
+{
+    if (field.size() != 1)
+    {
+        return false;
+    }
+    value = field.front();
+    return true;
+}
+
+bool parseFieldValue(const std::string_view field, float& value) noexcept
+{
+    return parseFloatingPoint(field, value);
+}
+
+bool parseFieldValue(const std::string_view field, double& value) noexcept
+{
+    return parseFloatingPoint(field, value);
 }
 
 void parseRawValueIntoRecord(
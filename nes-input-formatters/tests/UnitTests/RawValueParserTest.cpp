@@ -0,0 +1,160 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <RawValueParser.hpp>
+
+/// NOLINTBEGIN(readability-magic-numbers)
+namespace NES
+{
+
+/// Verifies that the allocation- and exception-free parseFieldValue accepts exactly the inputs that from_chars_with_exception accepts
+/// and produces the same values.
+class RawValueParserTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("RawValueParserTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup RawValueParserTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    void TearDown() override { BaseUnitTest::TearDown(); }
+
+    template <typename T>
+    static std::optional<T> parseWithException(const std::string_view field)
+    {
+        try
+        {
+            return from_chars_with_exception<T>(field);
+        }
+        catch (const Exception&)
+        {
+            return std::nullopt;
+        }
+    }
+
+    template <typename T>
+    static void expectSameAsFromChars(const std::string_view field)
+    {
+        T value{};
+        const bool parsed = parseFieldValue(field, value);
+        const auto expected = parseWithException<T>(field);
+        ASSERT_EQ(parsed, expected.has_value()) << "field '" << field << "'";
+        if (parsed)
+        {
+            EXPECT_EQ(value, *expected) << "field '" << field << "'";
+        }
+    }
+
+    template <typename T>
+    static void expectSameAsFromCharsForIntegers()
+    {
+        const std::vector<std::string> fields{
+            "0",
+            "7",
+            "-7",
+            "12345678",
+            "-12345678",
+            "123456789",
+            "0000000000000000000000042",
+            "-0000000000000000000000042",
+            fmt::format("{}", std::numeric_limits<T>::max()),
+            fmt::format("{}", std::numeric_limits<T>::min()),
+            fmt::format("{}0", std::numeric_limits<T>::max()),
+            fmt::format("{}1", std::numeric_limits<T>::min()),
+            "18446744073709551616",
+            "99999999999999999999",
+            "0x1F",
+            "0XfF",
+            "0x",
+            "-0x1",
+            "",
+            "-",
+            "+1",
+            "12a4",
+            "1234567a",
+            "123456789:",
+            "1.5",
+            "--1"};
+        for (const auto& field : fields)
+        {
+            expectSameAsFromChars<T>(field);
+        }
+
+        std::mt19937_64 rng(42);
+        /// uniform_int_distribution does not support 8-bit types, thus we draw from the 64-bit type of the same signedness
+        using Wide = std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>;
+        std::uniform_int_distribution<Wide> distribution(std::numeric_limits<T>::min(), std::numeric_limits<T>::max());
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            expectSameAsFromChars<T>(fmt::format("{}", distribution(rng)));
+        }
+    }
+};
+
+TEST_F(RawValueParserTest, integersMatchFromChars)
+{
+    expectSameAsFromCharsForIntegers<int8_t>();
+    expectSameAsFromCharsForIntegers<int16_t>();
+    expectSameAsFromCharsForIntegers<int32_t>();
+    expectSameAsFromCharsForIntegers<int64_t>();
+    expectSameAsFromCharsForIntegers<uint8_t>();
+    expectSameAsFromCharsForIntegers<uint16_t>();
+    expectSameAsFromCharsForIntegers<uint32_t>();
+    expectSameAsFromCharsForIntegers<uint64_t>();
+}
+
+TEST_F(RawValueParserTest, floatingPointsMatchFromChars)
+{
+    const std::vector<std::string> fields{
+        "0", "1.5", "-1.5", "+1.5", "3.4028235e38", "1e39", "1e-50", "1e400", ".5", "5.", "inf", "1.5a", "", "-", "1e", "0x1p3"};
+    for (const auto& field : fields)
+    {
+        expectSameAsFromChars<float>(field);
+        expectSameAsFromChars<double>(field);
+    }
+}
+
+TEST_F(RawValueParserTest, booleansAndCharsMatchFromChars)
+{
+    for (const auto* field : {"true", "TRUE", "True", "false", "FALSE", "1", "0", "2", "yes", "", "truee"})
+    {
+        expectSameAsFromChars<bool>(field);
+    }
+    for (const auto* field : {"a", "1", "", "ab"})
+    {
+        expectSameAsFromChars<char>(field);
+    }
+}
+
+}
+/// NOLINTEND(readability-magic-numbers)
@@ -13,6 +13,7 @@
 */
 
 #include <cstdint>
+#include <string>
 #include <tuple>
 
 #include <Identifiers/Identifiers.hpp>
@@ -142,6 +143,58 @@ TEST_F(SpecificSequenceTest, testMultipleTuplesInOneBuffer)
            /* buffer 2 */ {.sequenceNumber = SequenceNumber(2), .rawBytes = "1234\n5678\n1001\n"}}});
 }
 
+/// The raw buffer spans more than one 64-byte block of the structural indexer, with a tuple crossing the block boundary.
+TEST_F(SpecificSequenceTest, testTuplesSpanningIndexerBlocks)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 32, /// 1 buffer for raw data, 3 formatted buffers and their index buffers
+        .sizeOfRawBuffers = 100,
+        .sizeOfFormattedBuffers = 16, /// size of formatted tuple: 4 bytes
+        .parserConfig = InputFormatterValidationProvider::provide("CSV", {{"TUPLE_DELIMITER", "\n"}, {"FIELD_DELIMITER", ","}}).value(),
+        .testSchema = {INT32},
+        .memoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+        .expectedResults = {WorkerThreadResults<TestTuple>{
+            {{TestTuple{123456789}, TestTuple{1000002}, TestTuple{1000003}, TestTuple{1000004}},
+             {TestTuple{1000005}, TestTuple{1000006}, TestTuple{1000007}, TestTuple{1000008}},
+             {TestTuple{1000009}, TestTuple{1000010}, TestTuple{1000011}, TestTuple{1000012}}}}},
+        .rawBytesPerThread = {/* buffer 1 */ {
+            .sequenceNumber = SequenceNumber(1),
+            .rawBytes = "123456789\n1000002\n1000003\n1000004\n1000005\n1000006\n1000007\n"
+                        "1000008\n1000009\n1000010\n1000011\n1000012\n"}}});
+}
+
+/// Quoted fields with field delimiters cross both boundaries between the three 64-byte blocks of the structural indexer, so the
+/// quote parity has to be carried from one block into the next. Tuple delimiters are never quoted, thus the fields hold no newlines.
+TEST_F(SpecificSequenceTest, testQuotedFieldsSpanningIndexerBlocks)
+{
+    using namespace InputFormatterTestUtil;
+    using enum TestDataTypes;
+    using TestTuple = std::tuple<std::string, int32_t>;
+    runTest<TestTuple>(TestConfig<TestTuple>{
+        .numRequiredBuffers = 32, /// 1 buffer for raw data, the formatted buffer and its index and varsized buffers
+        .sizeOfRawBuffers = 192,
+        .sizeOfFormattedBuffers = 128,
+        .parserConfig = InputFormatterValidationProvider::provide(
+                            "CSV", {{"TUPLE_DELIMITER", "\n"}, {"FIELD_DELIMITER", ","}, {"ALLOW_COMMAS_IN_STRINGS", "true"}})
+                            .value(),
+        .testSchema = {VARSIZED, INT32},
+        .memoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+        .expectedResults = {WorkerThreadResults<TestTuple>{
+            {{TestTuple{"\"x,y\"", 1},
+              TestTuple{"\"a quoted field, with commas, that starts in the first block, and ends in the second\"", 2},
+              TestTuple{"\"short,one\"", 3},
+              TestTuple{"\"another quoted field, opened in the second block, closed in the third,\"", 4}}}}},
+        .rawBytesPerThread = {/* buffer 1 */ {
+            .sequenceNumber = SequenceNumber(1),
+            .rawBytes = "\"x,y\",1\n"
+                        "\"a quoted field, with commas, that starts in the first block, and ends in the second\",2\n"
+                        "\"short,one\",3\n"
+                        "\"another quoted field, opened in the second block, closed in the third,\",4\n"}}});
+}
+
 /// The third buffer has sequence number 2, connecting the first buffer (implicit delimiter) and the third (explicit delimiter)
 /// [TD][NTD][TD] (TD: TupleDelimiter, NTD: No TupleDelimiter)
 TEST_F(SpecificSequenceTest, triggerSpanningTupleWithThirdBufferWithoutDelimiter)
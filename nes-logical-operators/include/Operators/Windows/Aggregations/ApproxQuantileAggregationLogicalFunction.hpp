@@ -0,0 +1,82 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Schema/Field.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Reflection.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Estimates a quantile, e.g., 0.5 for the median or 0.99 for the 99th percentile, with a fixed-size sketch.
+/// In contrast to the MedianAggregationLogicalFunction, its memory does not grow with the number of values in a window.
+class ApproxQuantileAggregationLogicalFunction
+{
+public:
+    ApproxQuantileAggregationLogicalFunction(AggregationFieldAccess inputFunction, double quantile);
+
+    [[nodiscard]] ApproxQuantileAggregationLogicalFunction withInferredType(const Schema<Field, Unordered>& schema) const;
+    [[nodiscard]] static std::string_view getName() noexcept;
+    [[nodiscard]] DataType getAggregateType() const;
+    [[nodiscard]] static bool shallIncludeNullValues() noexcept;
+    [[nodiscard]] AggregationFieldAccess getInputFunction() const;
+    [[nodiscard]] double getQuantile() const;
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const;
+    [[nodiscard]] bool operator==(const ApproxQuantileAggregationLogicalFunction& other) const;
+
+    /// The registry only provides the input field, so this creates an approximate median
+    static AggregationLogicalFunctionRegistryReturnType create(AggregationLogicalFunctionRegistryArguments arguments);
+
+private:
+    AggregationFieldAccess inputFunction;
+    double quantile;
+    bool nullable{};
+    static constexpr std::string_view NAME = "ApproxQuantile";
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::FLOAT64;
+};
+
+template <>
+struct Reflector<ApproxQuantileAggregationLogicalFunction>
+{
+    Reflected operator()(const ApproxQuantileAggregationLogicalFunction& function, const ReflectionContext& context) const;
+};
+
+template <>
+struct Unreflector<ApproxQuantileAggregationLogicalFunction>
+{
+    ApproxQuantileAggregationLogicalFunction operator()(const Reflected& reflected, const ReflectionContext& context) const;
+};
+}
+
+template <>
+struct std::hash<NES::ApproxQuantileAggregationLogicalFunction>
+{
+    size_t operator()(const NES::ApproxQuantileAggregationLogicalFunction& aggregationFunction) const noexcept;
+};
+
+static_assert(NES::WindowAggregationFunctionConcept<NES::ApproxQuantileAggregationLogicalFunction>);
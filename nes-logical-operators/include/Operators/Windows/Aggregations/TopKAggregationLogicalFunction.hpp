@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <DataTypes/DataType.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Schema/Field.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Reflection.hpp>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <SerializableVariantDescriptor.pb.h>
+
+namespace NES
+{
+
+/// Reports the k most frequent values of a window together with their estimated counts, e.g., the most requested URLs.
+/// The counts are tracked by a fixed number of counters per k, so the memory of a window does not grow with the number of distinct values.
+/// The result is a VARSIZED text that lists the values and their counts by descending count, e.g., "/home:42;/login:17".
+/// Text values that contain a separator or a quote are quoted, e.g., "a;b":3.
+class TopKAggregationLogicalFunction
+{
+public:
+    TopKAggregationLogicalFunction(AggregationFieldAccess inputFunction, uint64_t k);
+
+    [[nodiscard]] TopKAggregationLogicalFunction withInferredType(const Schema<Field, Unordered>& schema) const;
+    [[nodiscard]] static std::string_view getName() noexcept;
+    [[nodiscard]] static DataType getAggregateType();
+    [[nodiscard]] static bool shallIncludeNullValues() noexcept;
+    [[nodiscard]] AggregationFieldAccess getInputFunction() const;
+    [[nodiscard]] uint64_t getK() const;
+    [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const;
+    [[nodiscard]] bool operator==(const TopKAggregationLogicalFunction& other) const;
+
+    /// The registry only provides the input field, so this reports the DEFAULT_K most frequent values
+    static AggregationLogicalFunctionRegistryReturnType create(AggregationLogicalFunctionRegistryArguments arguments);
+
+    static constexpr uint64_t DEFAULT_K = 10;
+
+private:
+    AggregationFieldAccess inputFunction;
+    uint64_t k;
+    static constexpr std::string_view NAME = "TopK";
+    static constexpr DataType::Type finalAggregateStampType = DataType::Type::VARSIZED;
+};
+
+template <>
+struct Reflector<TopKAggregationLogicalFunction>
+{
+    Reflected operator()(const TopKAggregationLogicalFunction& function, const ReflectionContext& context) const;
+};
+
+template <>
+struct Unreflector<TopKAggregationLogicalFunction>
+{
+    TopKAggregationLogicalFunction operator()(const Reflected& reflected, const ReflectionContext& context) const;
+};
+}
+
+template <>
+struct std::hash<NES::TopKAggregationLogicalFunction>
+{
+    size_t operator()(const NES::TopKAggregationLogicalFunction& aggregationFunction) const noexcept;
+};
+
+static_assert(NES::WindowAggregationFunctionConcept<NES::TopKAggregationLogicalFunction>);
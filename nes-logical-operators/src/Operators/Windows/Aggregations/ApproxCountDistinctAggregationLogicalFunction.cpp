@@ -0,0 +1,116 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/ApproxCountDistinctAggregationLogicalFunction.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Schema/Field.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Serialization/LogicalFunctionReflection.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Reflection.hpp>
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+ApproxCountDistinctAggregationLogicalFunction::ApproxCountDistinctAggregationLogicalFunction(AggregationFieldAccess inputFunction)
+    : inputFunction(std::move(inputFunction))
+{
+}
+
+std::string_view ApproxCountDistinctAggregationLogicalFunction::getName() noexcept
+{
+    return NAME;
+}
+
+DataType ApproxCountDistinctAggregationLogicalFunction::getAggregateType()
+{
+    /// Like COUNT(field), the result is never NULL: a window without non-null values has zero distinct values
+    return DataTypeProvider::provideDataType(finalAggregateStampType);
+}
+
+bool ApproxCountDistinctAggregationLogicalFunction::shallIncludeNullValues() noexcept
+{
+    return false;
+}
+
+AggregationFieldAccess ApproxCountDistinctAggregationLogicalFunction::getInputFunction() const
+{
+    return inputFunction;
+}
+
+std::string ApproxCountDistinctAggregationLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    if (verbosity == ExplainVerbosity::Short)
+    {
+        return fmt::format("{}()", NAME);
+    }
+    auto inputExplain = std::visit([verbosity](const auto& input) { return input->explain(verbosity); }, inputFunction);
+    return fmt::format("{}({})", NAME, inputExplain);
+}
+
+bool ApproxCountDistinctAggregationLogicalFunction::operator==(const ApproxCountDistinctAggregationLogicalFunction& other) const
+{
+    return inputFunction == other.inputFunction;
+}
+
+ApproxCountDistinctAggregationLogicalFunction
+ApproxCountDistinctAggregationLogicalFunction::withInferredType(const Schema<Field, Unordered>& schema) const
+{
+    /// Values of any type can be hashed, so there is no restriction on the input type
+    return ApproxCountDistinctAggregationLogicalFunction{inferFieldAccess(inputFunction, schema)};
+}
+
+Reflected Reflector<ApproxCountDistinctAggregationLogicalFunction>::operator()(
+    const ApproxCountDistinctAggregationLogicalFunction& function, const ReflectionContext& context) const
+{
+    return context.reflect(function.getInputFunction());
+}
+
+ApproxCountDistinctAggregationLogicalFunction
+Unreflector<ApproxCountDistinctAggregationLogicalFunction>::operator()(const Reflected& reflected, const ReflectionContext& context) const
+{
+    return ApproxCountDistinctAggregationLogicalFunction{context.unreflect<AggregationFieldAccess>(reflected)};
+}
+
+AggregationLogicalFunctionRegistryReturnType
+ApproxCountDistinctAggregationLogicalFunction::create(AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.on.size() != 1)
+    {
+        throw CannotDeserialize(
+            "ApproxCountDistinctAggregationLogicalFunction requires exactly one field, but got {}", arguments.on.size());
+    }
+    return ApproxCountDistinctAggregationLogicalFunction{arguments.on.at(0)};
+}
+}
+
+size_t std::hash<NES::ApproxCountDistinctAggregationLogicalFunction>::operator()(
+    const NES::ApproxCountDistinctAggregationLogicalFunction& aggregationFunction) const noexcept
+{
+    return folly::hash::hash_combine(aggregationFunction.getInputFunction(), NES::ApproxCountDistinctAggregationLogicalFunction::getName());
+}
@@ -0,0 +1,142 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Schema/Field.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Serialization/LogicalFunctionReflection.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Reflection.hpp>
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+ApproxQuantileAggregationLogicalFunction::ApproxQuantileAggregationLogicalFunction(
+    AggregationFieldAccess inputFunction, const double quantile)
+    : inputFunction(std::move(inputFunction)), quantile(quantile)
+{
+    PRECONDITION(quantile >= 0 and quantile <= 1, "The quantile must lie in [0, 1] but is {}", quantile);
+}
+
+std::string_view ApproxQuantileAggregationLogicalFunction::getName() noexcept
+{
+    return NAME;
+}
+
+DataType ApproxQuantileAggregationLogicalFunction::getAggregateType() const
+{
+    return DataTypeProvider::provideDataType(
+        finalAggregateStampType, nullable ? DataType::NULLABLE::IS_NULLABLE : DataType::NULLABLE::NOT_NULLABLE);
+}
+
+bool ApproxQuantileAggregationLogicalFunction::shallIncludeNullValues() noexcept
+{
+    return true;
+}
+
+AggregationFieldAccess ApproxQuantileAggregationLogicalFunction::getInputFunction() const
+{
+    return inputFunction;
+}
+
+double ApproxQuantileAggregationLogicalFunction::getQuantile() const
+{
+    return quantile;
+}
+
+std::string ApproxQuantileAggregationLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    if (verbosity == ExplainVerbosity::Short)
+    {
+        return fmt::format("{}({})", NAME, quantile);
+    }
+    auto inputExplain = std::visit([verbosity](const auto& input) { return input->explain(verbosity); }, inputFunction);
+    return fmt::format("{}({}, {})", NAME, inputExplain, quantile);
+}
+
+bool ApproxQuantileAggregationLogicalFunction::operator==(const ApproxQuantileAggregationLogicalFunction& other) const
+{
+    return inputFunction == other.inputFunction and quantile == other.quantile;
+}
+
+ApproxQuantileAggregationLogicalFunction
+ApproxQuantileAggregationLogicalFunction::withInferredType(const Schema<Field, Unordered>& schema) const
+{
+    auto newInputFunction = inferFieldAccess(inputFunction, schema);
+    if (!newInputFunction->getDataType().isNumeric())
+    {
+        throw CannotInferStamp("Cannot calculate a quantile over non numeric field (got {}).", newInputFunction->getDataType());
+    }
+    ApproxQuantileAggregationLogicalFunction newAgg{newInputFunction, quantile};
+    newAgg.nullable = newInputFunction->getDataType().nullable;
+    return newAgg;
+}
+
+namespace detail
+{
+struct ReflectedApproxQuantileAggregationLogicalFunction
+{
+    AggregationFieldAccess inputFunction;
+    double quantile;
+};
+}
+
+Reflected Reflector<ApproxQuantileAggregationLogicalFunction>::operator()(
+    const ApproxQuantileAggregationLogicalFunction& function, const ReflectionContext& context) const
+{
+    return context.reflect(detail::ReflectedApproxQuantileAggregationLogicalFunction{
+        .inputFunction = function.getInputFunction(), .quantile = function.getQuantile()});
+}
+
+ApproxQuantileAggregationLogicalFunction
+Unreflector<ApproxQuantileAggregationLogicalFunction>::operator()(const Reflected& reflected, const ReflectionContext& context) const
+{
+    auto [inputFunction, quantile] = context.unreflect<detail::ReflectedApproxQuantileAggregationLogicalFunction>(reflected);
+    return ApproxQuantileAggregationLogicalFunction{std::move(inputFunction), quantile};
+}
+
+AggregationLogicalFunctionRegistryReturnType
+ApproxQuantileAggregationLogicalFunction::create(AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.on.size() != 1)
+    {
+        throw CannotDeserialize("ApproxQuantileAggregationLogicalFunction requires exactly one field, but got {}", arguments.on.size());
+    }
+    return ApproxQuantileAggregationLogicalFunction{arguments.on.at(0), 0.5};
+}
+}
+
+size_t std::hash<NES::ApproxQuantileAggregationLogicalFunction>::operator()(
+    const NES::ApproxQuantileAggregationLogicalFunction& aggregationFunction) const noexcept
+{
+    return folly::hash::hash_combine(
+        aggregationFunction.getInputFunction(),
+        NES::ApproxQuantileAggregationLogicalFunction::getName(),
+        aggregationFunction.getQuantile());
+}
@@ -0,0 +1,137 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Operators/Windows/Aggregations/TopKAggregationLogicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
+#include <Schema/Field.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Serialization/LogicalFunctionReflection.hpp>
+#include <Util/PlanRenderer.hpp>
+#include <Util/Reflection.hpp>
+#include <fmt/format.h>
+#include <folly/hash/Hash.h>
+#include <AggregationLogicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+TopKAggregationLogicalFunction::TopKAggregationLogicalFunction(AggregationFieldAccess inputFunction, const uint64_t k)
+    : inputFunction(std::move(inputFunction)), k(k)
+{
+    PRECONDITION(k > 0, "TopK must report at least one value");
+}
+
+std::string_view TopKAggregationLogicalFunction::getName() noexcept
+{
+    return NAME;
+}
+
+DataType TopKAggregationLogicalFunction::getAggregateType()
+{
+    /// The result is never NULL: a window without non-null values has no frequent values and results in an empty text
+    return DataTypeProvider::provideDataType(finalAggregateStampType);
+}
+
+bool TopKAggregationLogicalFunction::shallIncludeNullValues() noexcept
+{
+    return false;
+}
+
+AggregationFieldAccess TopKAggregationLogicalFunction::getInputFunction() const
+{
+    return inputFunction;
+}
+
+uint64_t TopKAggregationLogicalFunction::getK() const
+{
+    return k;
+}
+
+std::string TopKAggregationLogicalFunction::explain(ExplainVerbosity verbosity) const
+{
+    if (verbosity == ExplainVerbosity::Short)
+    {
+        return fmt::format("{}({})", NAME, k);
+    }
+    auto inputExplain = std::visit([verbosity](const auto& input) { return input->explain(verbosity); }, inputFunction);
+    return fmt::format("{}({}, {})", NAME, inputExplain, k);
+}
+
+bool TopKAggregationLogicalFunction::operator==(const TopKAggregationLogicalFunction& other) const
+{
+    return inputFunction == other.inputFunction and k == other.k;
+}
+
+TopKAggregationLogicalFunction TopKAggregationLogicalFunction::withInferredType(const Schema<Field, Unordered>& schema) const
+{
+    auto newInputFunction = inferFieldAccess(inputFunction, schema);
+    const auto& inputType = newInputFunction->getDataType();
+    if (not inputType.isNumeric() and not inputType.isType(DataType::Type::VARSIZED))
+    {
+        throw CannotInferStamp("Cannot calculate the most frequent values of a non numeric and non text field (got {}).", inputType);
+    }
+    return TopKAggregationLogicalFunction{newInputFunction, k};
+}
+
+namespace detail
+{
+struct ReflectedTopKAggregationLogicalFunction
+{
+    AggregationFieldAccess inputFunction;
+    uint64_t k;
+};
+}
+
+Reflected Reflector<TopKAggregationLogicalFunction>::operator()(
+    const TopKAggregationLogicalFunction& function, const ReflectionContext& context) const
+{
+    return context.reflect(
+        detail::ReflectedTopKAggregationLogicalFunction{.inputFunction = function.getInputFunction(), .k = function.getK()});
+}
+
+TopKAggregationLogicalFunction
+Unreflector<TopKAggregationLogicalFunction>::operator()(const Reflected& reflected, const ReflectionContext& context) const
+{
+    auto [inputFunction, k] = context.unreflect<detail::ReflectedTopKAggregationLogicalFunction>(reflected);
+    return TopKAggregationLogicalFunction{std::move(inputFunction), k};
+}
+
+AggregationLogicalFunctionRegistryReturnType TopKAggregationLogicalFunction::create(AggregationLogicalFunctionRegistryArguments arguments)
+{
+    if (arguments.on.size() != 1)
+    {
+        throw CannotDeserialize("TopKAggregationLogicalFunction requires exactly one field, but got {}", arguments.on.size());
+    }
+    return TopKAggregationLogicalFunction{arguments.on.at(0), DEFAULT_K};
+}
+}
+
+size_t
+std::hash<NES::TopKAggregationLogicalFunction>::operator()(const NES::TopKAggregationLogicalFunction& aggregationFunction) const noexcept
+{
+    return folly::hash::hash_combine(
+        aggregationFunction.getInputFunction(), NES::TopKAggregationLogicalFunction::getName(), aggregationFunction.getK());
+}
@@ -27,9 +27,12 @@
 #include <memory_resource>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <unistd.h>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
 #include <Runtime/BufferRecycler.hpp>
 #include <Runtime/MemoryUtils.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -41,21 +44,69 @@
 namespace NES
 {
 
+namespace
+{
+/// While blocking for a buffer of the preferred pool, other pools and thread caches are checked in this interval.
+constexpr std::chrono::milliseconds POOL_SWEEP_INTERVAL{1};
+
+/// Keys start at 1, so that an unused ThreadCacheSlot never matches a BufferManager.
+std::atomic<uint64_t> nextThreadCacheKey{1};
+
+/// The cache slot a thread got assigned by one BufferManager. A thread remembers the slots of the last few managers it used,
+/// which is usually a single one.
+struct ThreadCacheSlot
+{
+    uint64_t managerKey = 0;
+    size_t slot = 0;
+};
+constexpr size_t REMEMBERED_THREAD_CACHE_SLOTS = 4;
+}
+
 BufferManager::BufferManager(
     Private,
     const uint32_t bufferSize,
     const uint32_t numOfBuffers,
     std::shared_ptr<std::pmr::memory_resource> memoryResource,
     const size_t unpooledMemoryLimitInBytes,
-    const uint32_t alignment)
-    : availableBuffers(numOfBuffers)
-    , unpooledChunksManager(std::make_shared<UnpooledChunksManager>(memoryResource, unpooledMemoryLimitInBytes))
+    const uint32_t alignment,
+    std::vector<NumaNodeMemoryResource> pooledMemoryResources,
+    const size_t threadCacheCapacity,
+    std::shared_ptr<std::pmr::memory_resource> spillMemoryResource)
+    : threadCaches(threadCacheCapacity > 0 ? std::max(std::thread::hardware_concurrency(), 1U) : 0)
+    , threadCacheCapacity(threadCacheCapacity)
+    , threadCacheKey(nextThreadCacheKey.fetch_add(1, std::memory_order::relaxed))
+    , unpooledChunksManager(
+          std::make_shared<UnpooledChunksManager>(memoryResource, unpooledMemoryLimitInBytes, std::move(spillMemoryResource)))
     , bufferSize(bufferSize)
     , numOfBuffers(numOfBuffers)
     , alignment(alignment)
     , memoryResource(std::move(memoryResource))
 {
     PRECONDITION(numOfBuffers > 0, "BufferManager requires at least one pooled buffer, but the configured budget yields {}", numOfBuffers);
+    if (pooledMemoryResources.empty())
+    {
+        pooledMemoryResources.emplace_back(0, this->memoryResource);
+    }
+    PRECONDITION(
+        numOfBuffers >= pooledMemoryResources.size(),
+        "BufferManager requires at least one pooled buffer per numa node, but has {} buffers for {} nodes",
+        numOfBuffers,
+        pooledMemoryResources.size());
+
+    /// Buffers are split evenly across the nodes, the first nodes receive the remainder
+    const size_t numberOfNodes = pooledMemoryResources.size();
+    size_t firstBuffer = 0;
+    for (size_t i = 0; i < numberOfNodes; ++i)
+    {
+        const size_t buffersOfNode = (numOfBuffers / numberOfNodes) + (i < numOfBuffers % numberOfNodes ? 1 : 0);
+        nodePools.emplace_back(std::make_unique<NodePool>(
+            pooledMemoryResources[i].numaNode, std::move(pooledMemoryResources[i].memoryResource), firstBuffer, buffersOfNode));
+        firstBuffer += buffersOfNode;
+    }
+    for (auto& cache : threadCaches)
+    {
+        cache.segments.reserve(threadCacheCapacity);
+    }
     initialize();
 }
 
@@ -64,7 +115,10 @@ std::shared_ptr<BufferManager> BufferManager::create(
     const double unpooledMemoryFraction,
     const BufferAlignment alignment,
     const uint32_t bufferSize,
-    const std::shared_ptr<std::pmr::memory_resource>& memoryResource)
+    const std::shared_ptr<std::pmr::memory_resource>& memoryResource,
+    std::vector<NumaNodeMemoryResource> pooledMemoryResources,
+    const size_t threadCacheCapacity,
+    std::shared_ptr<std::pmr::memory_resource> spillMemoryResource)
 {
     PRECONDITION(
         unpooledMemoryFraction >= 0.0 and unpooledMemoryFraction <= 1.0,
@@ -80,7 +134,15 @@ std::shared_ptr<BufferManager> BufferManager::create(
         pooledMemoryInBytes / bufferSize);
     const auto numOfBuffers = static_cast<uint32_t>(pooledMemoryInBytes / bufferSize);
     return std::make_shared<BufferManager>(
-        Private{}, bufferSize, numOfBuffers, memoryResource, unpooledMemoryLimitInBytes, alignment.getRawValue());
+        Private{},
+        bufferSize,
+        numOfBuffers,
+        memoryResource,
+        unpooledMemoryLimitInBytes,
+        alignment.getRawValue(),
+        std::move(pooledMemoryResources),
+        threadCacheCapacity,
+        std::move(spillMemoryResource));
 }
 
 BufferManager::~BufferManager()
@@ -119,10 +181,18 @@ void BufferManager::destroy()
         /// RAII takes care of deallocating memory here
         allBuffers.clear();
 
-        availableBuffers = decltype(availableBuffers)();
+        for (auto& cache : threadCaches)
+        {
+            const std::scoped_lock lock(cache.mutex);
+            cache.segments.clear();
+        }
+        for (const auto& pool : nodePools)
+        {
+            pool->availableBuffers = decltype(pool->availableBuffers)();
+            pool->memoryResource->deallocate(pool->basePointer, pool->allocatedAreaSize, alignment);
+            pool->allocatedAreaSize = 0;
+        }
         NES_DEBUG("Shutting down Buffer Manager completed");
-        memoryResource->deallocate(basePointer, allocatedAreaSize, alignment);
-        allocatedAreaSize = 0;
 
         /// Destroying the unpooled chunks
         unpooledChunksManager.reset();
@@ -158,45 +228,160 @@ void BufferManager::initialize()
         "Requested alignment is too small, must be at least {}",
         alignof(detail::BufferControlBlock));
 
+    /// Reserving all buffers upfront keeps the addresses of the segments stable, as the pools store pointers into allBuffers
     allBuffers.reserve(numOfBuffers);
     auto controlBlockSize = alignBufferSize(sizeof(detail::BufferControlBlock), withAlignment);
     auto alignedBufferSize = alignBufferSize(bufferSize, withAlignment);
-    allocatedAreaSize = alignBufferSize(controlBlockSize + alignedBufferSize, withAlignment);
-    const size_t offsetBetweenBuffers = allocatedAreaSize;
-    allocatedAreaSize *= numOfBuffers;
-    basePointer = static_cast<uint8_t*>(memoryResource->allocate(allocatedAreaSize, withAlignment));
+    const size_t offsetBetweenBuffers = alignBufferSize(controlBlockSize + alignedBufferSize, withAlignment);
+    for (const auto& pool : nodePools)
+    {
+        pool->allocatedAreaSize = offsetBetweenBuffers * pool->numOfBuffers;
+        pool->basePointer = static_cast<uint8_t*>(pool->memoryResource->allocate(pool->allocatedAreaSize, withAlignment));
 
 #ifndef NDEBUG
-    constexpr std::array marker{'N', 'E', 'B', 'U', 'S', 'T', 'R', 'M'};
-    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): basePointer is freshly allocated raw storage aligned to >= alignof(uint64_t).
-    std::fill_n(reinterpret_cast<uint64_t*>(basePointer), allocatedAreaSize / sizeof(uint64_t), std::bit_cast<uint64_t>(marker));
+        constexpr std::array marker{'N', 'E', 'B', 'U', 'S', 'T', 'R', 'M'};
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): basePointer is freshly allocated raw storage aligned to >= 8 bytes.
+        std::fill_n(
+            reinterpret_cast<uint64_t*>(pool->basePointer), pool->allocatedAreaSize / sizeof(uint64_t), std::bit_cast<uint64_t>(marker));
 #endif
 
-    NES_TRACE(
-        "Allocated {} bytes with alignment {} buffer size {} num buffer {} controlBlockSize {} {}",
-        allocatedAreaSize,
-        withAlignment,
-        alignedBufferSize,
-        numOfBuffers,
-        controlBlockSize,
-        alignof(detail::BufferControlBlock));
+        NES_TRACE(
+            "Allocated {} bytes on numa node {} with alignment {} buffer size {} num buffer {} controlBlockSize {} {}",
+            pool->allocatedAreaSize,
+            pool->numaNode,
+            withAlignment,
+            alignedBufferSize,
+            pool->numOfBuffers,
+            controlBlockSize,
+            alignof(detail::BufferControlBlock));
+
+        INVARIANT(pool->basePointer, "memory allocation failed, because 'basePointer' was a nullptr");
+        uint8_t* ptr = pool->basePointer;
+        for (size_t i = 0; i < pool->numOfBuffers; ++i)
+        {
+            uint8_t* controlBlock = ptr;
+            uint8_t* payload = ptr + controlBlockSize;
+            allBuffers.emplace_back(
+                payload,
+                bufferSize,
+                [](detail::MemorySegment* segment, BufferRecycler* recycler) { recycler->recyclePooledBuffer(segment); },
+                controlBlock);
+
+            pool->availableBuffers.write(&allBuffers.back());
+            ptr += offsetBetweenBuffers;
+        }
+    }
+    NES_DEBUG(
+        "BufferManager configuration bufferSize={} numOfBuffers={} numaNodes={} threadCacheCapacity={}",
+        this->bufferSize,
+        this->numOfBuffers,
+        nodePools.size(),
+        threadCacheCapacity);
+}
+
+BufferManager::NodePool& BufferManager::getPreferredPool()
+{
+    if (nodePools.size() == 1)
+    {
+        return *nodePools.front();
+    }
+
+    /// Threads are expected to stay on their numa node, thus the node is only looked up once per thread
+    thread_local const std::optional<size_t> currentNumaNode = NumaMemoryAllocator::getCurrentNumaNode();
+    if (currentNumaNode)
+    {
+        for (const auto& pool : nodePools)
+        {
+            if (pool->numaNode == *currentNumaNode)
+            {
+                return *pool;
+            }
+        }
+    }
+    return *nodePools.front();
+}
+
+BufferManager::NodePool& BufferManager::getHomePool(const detail::MemorySegment* segment)
+{
+    const auto index = static_cast<size_t>(segment - allBuffers.data());
+    for (const auto& pool : nodePools)
+    {
+        if (index < pool->firstBuffer + pool->numOfBuffers)
+        {
+            return *pool;
+        }
+    }
+    INVARIANT(false, "Segment {} does not belong to any pool of the BufferManager", index);
+    return *nodePools.back();
+}
 
-    INVARIANT(basePointer, "memory allocation failed, because 'basePointer' was a nullptr");
-    uint8_t* ptr = basePointer;
-    for (size_t i = 0; i < numOfBuffers; ++i)
+BufferManager::ThreadCache& BufferManager::getThreadCache()
+{
+    thread_local std::array<ThreadCacheSlot, REMEMBERED_THREAD_CACHE_SLOTS> rememberedSlots{};
+    thread_local size_t nextReplacedSlot = 0;
+    for (const auto& [managerKey, slot] : rememberedSlots)
     {
-        uint8_t* controlBlock = ptr;
-        uint8_t* payload = ptr + controlBlockSize;
-        allBuffers.emplace_back(
-            payload,
-            bufferSize,
-            [](detail::MemorySegment* segment, BufferRecycler* recycler) { recycler->recyclePooledBuffer(segment); },
-            controlBlock);
-
-        availableBuffers.write(&allBuffers.back());
-        ptr += offsetBetweenBuffers;
+        if (managerKey == threadCacheKey)
+        {
+            return threadCaches[slot % threadCaches.size()];
+        }
     }
-    NES_DEBUG("BufferManager configuration bufferSize={} numOfBuffers={}", this->bufferSize, this->numOfBuffers);
+
+    /// Forgetting the slot of another manager only costs balance: the thread gets a fresh slot once it uses that manager again.
+    auto& replacedSlot = rememberedSlots[nextReplacedSlot++ % rememberedSlots.size()];
+    replacedSlot = {threadCacheKey, nextThreadCacheSlot.fetch_add(1, std::memory_order::relaxed)};
+    return threadCaches[replacedSlot.slot % threadCaches.size()];
+}
+
+detail::MemorySegment* BufferManager::tryGetSegment()
+{
+    detail::MemorySegment* memSegment = nullptr;
+    if (!threadCaches.empty())
+    {
+        auto& cache = getThreadCache();
+        const std::scoped_lock lock(cache.mutex);
+        if (!cache.segments.empty())
+        {
+            memSegment = cache.segments.back();
+            cache.segments.pop_back();
+            return memSegment;
+        }
+    }
+
+    auto& preferredPool = getPreferredPool();
+    if (preferredPool.availableBuffers.read(memSegment))
+    {
+        return memSegment;
+    }
+    for (const auto& pool : nodePools)
+    {
+        if (pool.get() != &preferredPool and pool->availableBuffers.read(memSegment))
+        {
+            return memSegment;
+        }
+    }
+
+    /// The last available buffers might be held by the caches of other threads
+    for (auto& cache : threadCaches)
+    {
+        const std::unique_lock lock(cache.mutex, std::try_to_lock);
+        if (lock.owns_lock() and !cache.segments.empty())
+        {
+            memSegment = cache.segments.back();
+            cache.segments.pop_back();
+            return memSegment;
+        }
+    }
+    return nullptr;
+}
+
+TupleBuffer BufferManager::prepareBuffer(detail::MemorySegment* memSegment)
+{
+    if (memSegment->controlBlock->prepare(shared_from_this()))
+    {
+        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+    }
+    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
 }
 
 TupleBuffer BufferManager::getBufferBlocking()
@@ -212,31 +397,38 @@ TupleBuffer BufferManager::getBufferBlocking()
 
 std::optional<TupleBuffer> BufferManager::getBufferNoBlocking()
 {
-    detail::MemorySegment* memSegment = nullptr;
-    if (!availableBuffers.read(memSegment))
+    if (auto* memSegment = tryGetSegment())
     {
-        return std::nullopt;
-    }
-    if (memSegment->controlBlock->prepare(shared_from_this()))
-    {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        return prepareBuffer(memSegment);
     }
-    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
+    return std::nullopt;
 }
 
 std::optional<TupleBuffer> BufferManager::getBufferWithTimeout(const std::chrono::milliseconds timeoutMs)
 {
-    detail::MemorySegment* memSegment = nullptr;
     const auto deadline = std::chrono::steady_clock::now() + timeoutMs;
-    if (!availableBuffers.tryReadUntil(deadline, memSegment))
+    /// With a single pool and without thread caches every buffer is recycled into the queue we are blocking on. Otherwise, the
+    /// blocking read is interrupted regularly to check the remote pools and thread caches.
+    const bool sweep = nodePools.size() > 1 or !threadCaches.empty();
+    while (true)
     {
-        return std::nullopt;
-    }
-    if (memSegment->controlBlock->prepare(shared_from_this()))
-    {
-        return TupleBuffer(memSegment->controlBlock.get(), memSegment->ptr, memSegment->size);
+        if (auto* memSegment = tryGetSegment())
+        {
+            return prepareBuffer(memSegment);
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            return std::nullopt;
+        }
+
+        detail::MemorySegment* memSegment = nullptr;
+        if (getPreferredPool().availableBuffers.tryReadUntil(sweep ? std::min(deadline, now + POOL_SWEEP_INTERVAL) : deadline, memSegment))
+        {
+            return prepareBuffer(memSegment);
+        }
     }
-    throw InvalidRefCountForBuffer("[BufferManager] got buffer with invalid reference counter");
 }
 
 std::optional<TupleBuffer> BufferManager::getUnpooledBuffer(const size_t bufferSize)
@@ -249,7 +441,22 @@ void BufferManager::recyclePooledBuffer(detail::MemorySegment* segment)
     INVARIANT(segment->isAvailable(), "Recycling buffer callback invoked on used memory segment");
     INVARIANT(
         segment->controlBlock->owningBufferRecycler == nullptr, "Buffer should not retain a reference to its parent while not in use");
-    USED_IN_DEBUG const auto couldRecycleBuffer = availableBuffers.writeIfNotFull(segment);
+    auto& homePool = getHomePool(segment);
+
+    /// The thread cache only keeps buffers of the local numa node and only as long as no other thread is waiting for a buffer,
+    /// which is indicated by a non-positive queue size.
+    if (!threadCaches.empty() and &homePool == &getPreferredPool() and homePool.availableBuffers.size() > 0)
+    {
+        auto& cache = getThreadCache();
+        const std::unique_lock lock(cache.mutex, std::try_to_lock);
+        if (lock.owns_lock() and cache.segments.size() < threadCacheCapacity)
+        {
+            cache.segments.emplace_back(segment);
+            return;
+        }
+    }
+
+    USED_IN_DEBUG const auto couldRecycleBuffer = homePool.availableBuffers.writeIfNotFull(segment);
     INVARIANT(couldRecycleBuffer, "should always succeed");
 }
 
@@ -275,8 +482,46 @@ size_t BufferManager::getNumOfUnpooledBuffers() const
 
 size_t BufferManager::getNumberOfAvailableBuffers() const
 {
-    /// If there are pending reads the queue may report negative values. This effectivly means its empty.
-    return static_cast<size_t>(std::max(availableBuffers.size(), static_cast<ssize_t>(0)));
+    size_t numberOfAvailableBuffers = 0;
+    for (const auto& pool : nodePools)
+    {
+        /// If there are pending reads the queue may report negative values. This effectivly means its empty.
+        numberOfAvailableBuffers += static_cast<size_t>(std::max(pool->availableBuffers.size(), static_cast<ssize_t>(0)));
+    }
+    for (const auto& cache : threadCaches)
+    {
+        const std::scoped_lock lock(cache.mutex);
+        numberOfAvailableBuffers += cache.segments.size();
+    }
+    return numberOfAvailableBuffers;
+}
+
+std::vector<BufferPoolStatistics> BufferManager::getPoolStatistics() const
+{
+    std::vector<BufferPoolStatistics> statistics;
+    statistics.reserve(nodePools.size());
+    for (const auto& pool : nodePools)
+    {
+        statistics.emplace_back(
+            pool->numaNode, pool->numOfBuffers, static_cast<size_t>(std::max(pool->availableBuffers.size(), static_cast<ssize_t>(0))));
+    }
+    for (const auto& cache : threadCaches)
+    {
+        const std::scoped_lock lock(cache.mutex);
+        for (const auto* segment : cache.segments)
+        {
+            const auto index = static_cast<size_t>(segment - allBuffers.data());
+            for (size_t pool = 0; pool < nodePools.size(); ++pool)
+            {
+                if (index < nodePools[pool]->firstBuffer + nodePools[pool]->numOfBuffers)
+                {
+                    ++statistics[pool].numberOfAvailableBuffers;
+                    break;
+                }
+            }
+        }
+    }
+    return statistics;
 }
 
 BufferManagerType BufferManager::getBufferManagerType() const
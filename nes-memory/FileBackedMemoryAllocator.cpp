@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/Allocator/FileBackedMemoryAllocator.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+size_t roundUpToPageSize(const size_t bytes)
+{
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+    return (bytes + pageSize - 1) / pageSize * pageSize;
+}
+}
+
+FileBackedMemoryAllocator::FileBackedMemoryAllocator(std::filesystem::path spillDirectory, const size_t capacityInBytes)
+    : spillDirectory(std::move(spillDirectory)), capacityInBytes(capacityInBytes)
+{
+    std::error_code error;
+    std::filesystem::create_directories(this->spillDirectory, error);
+    if (error)
+    {
+        throw InvalidConfigParameter("Cannot create the spill directory {}: {}", this->spillDirectory.string(), error.message());
+    }
+}
+
+int FileBackedMemoryAllocator::createUnnamedFile() const
+{
+    if (const auto fileDescriptor = open(spillDirectory.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR); fileDescriptor >= 0)
+    {
+        return fileDescriptor;
+    }
+    /// Not every file system supports O_TMPFILE, so we fall back to a named file that is unlinked right away
+    auto path = (spillDirectory / "nes-spill-XXXXXX").string();
+    const auto fileDescriptor = mkostemp(path.data(), O_CLOEXEC);
+    if (fileDescriptor >= 0)
+    {
+        unlink(path.c_str());
+    }
+    return fileDescriptor;
+}
+
+void* FileBackedMemoryAllocator::do_allocate(const size_t bytes, const size_t alignment)
+{
+    PRECONDITION(
+        alignment <= static_cast<size_t>(sysconf(_SC_PAGE_SIZE)), "FileBackedMemoryAllocator only supports alignments up to the page size");
+    const auto fileBytes = roundUpToPageSize(bytes);
+    const auto mappedBytesBefore = mappedBytes.fetch_add(fileBytes, std::memory_order_relaxed);
+    if (mappedBytesBefore >= capacityInBytes or fileBytes > capacityInBytes - mappedBytesBefore)
+    {
+        mappedBytes.fetch_sub(fileBytes, std::memory_order_relaxed);
+        NES_WARNING(
+            "Spill capacity of {}B would be exceeded by {}B ({}B already spilled); refusing allocation.",
+            capacityInBytes,
+            fileBytes,
+            mappedBytesBefore);
+        return nullptr;
+    }
+
+    const auto fileDescriptor = createUnnamedFile();
+    if (fileDescriptor < 0)
+    {
+        mappedBytes.fetch_sub(fileBytes, std::memory_order_relaxed);
+        NES_WARNING("Could not create a spill file in {}: {}", spillDirectory.string(), std::strerror(errno));
+        return nullptr;
+    }
+    /// Reserving the blocks up front turns a full file system into a failed allocation instead of a SIGBUS on the first write
+    if (const auto error = posix_fallocate(fileDescriptor, 0, static_cast<off_t>(fileBytes)); error != 0)
+    {
+        close(fileDescriptor);
+        mappedBytes.fetch_sub(fileBytes, std::memory_order_relaxed);
+        NES_WARNING("Could not reserve {}B for a spill file in {}: {}", fileBytes, spillDirectory.string(), std::strerror(error));
+        return nullptr;
+    }
+    void* memory = mmap(nullptr, fileBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    /// The mapping keeps the file alive, which is removed by the file system once the mapping is released
+    close(fileDescriptor);
+    if (memory == MAP_FAILED)
+    {
+        mappedBytes.fetch_sub(fileBytes, std::memory_order_relaxed);
+        NES_WARNING("Could not map a spill file of {}B: {}", fileBytes, std::strerror(errno));
+        return nullptr;
+    }
+    return memory;
+}
+
+void FileBackedMemoryAllocator::do_deallocate(void* p, const size_t bytes, size_t)
+{
+    const auto fileBytes = roundUpToPageSize(bytes);
+    munmap(p, fileBytes);
+    mappedBytes.fetch_sub(fileBytes, std::memory_order_relaxed);
+}
+
+}
@@ -0,0 +1,149 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <Util/Files.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Mirrors the mempolicy constants of <linux/mempolicy.h> to avoid a dependency on libnuma.
+constexpr int MPOL_PREFERRED_POLICY = 1;
+constexpr size_t MAX_SUPPORTED_NUMA_NODES = 64;
+
+size_t roundUpToPageSize(const size_t bytes)
+{
+    const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGE_SIZE));
+    return (bytes + pageSize - 1) / pageSize * pageSize;
+}
+
+/// Parses a node id that has to span all of text.
+std::optional<size_t> parseNumaNode(const std::string_view text)
+{
+    size_t node = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), node);
+    if (error != std::errc{} or end != text.data() + text.size())
+    {
+        return std::nullopt;
+    }
+    return node;
+}
+}
+
+std::vector<size_t> NumaMemoryAllocator::getOnlineNumaNodes()
+{
+    /// The kernel exposes the online nodes as a comma separated list of ranges, e.g., `0-1` or `0,2-3`.
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string ranges;
+    if (!online or !std::getline(online, ranges) or ranges.empty())
+    {
+        return {0};
+    }
+
+    auto nodes = parseNumaNodeList(ranges);
+    if (not nodes)
+    {
+        NES_WARNING("Could not parse the online numa nodes '{}'. Falling back to a single numa node.", ranges);
+        return {0};
+    }
+    return nodes->empty() ? std::vector<size_t>{0} : *nodes;
+}
+
+std::optional<std::vector<size_t>> NumaMemoryAllocator::parseNumaNodeList(const std::string_view nodeList)
+{
+    std::vector<size_t> nodes;
+    size_t position = 0;
+    while (position < nodeList.size())
+    {
+        auto end = nodeList.find(',', position);
+        if (end == std::string_view::npos)
+        {
+            end = nodeList.size();
+        }
+        const auto range = nodeList.substr(position, end - position);
+        const auto dash = range.find('-');
+        const auto first = parseNumaNode(range.substr(0, dash));
+        const auto last = dash == std::string_view::npos ? first : parseNumaNode(range.substr(dash + 1));
+        if (not first or not last or *first > *last)
+        {
+            return std::nullopt;
+        }
+        for (size_t node = *first; node <= *last; ++node)
+        {
+            nodes.emplace_back(node);
+        }
+        position = end + 1;
+    }
+    return nodes;
+}
+
+std::optional<size_t> NumaMemoryAllocator::getCurrentNumaNode()
+{
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+    {
+        return std::nullopt;
+    }
+    return node;
+}
+
+void* NumaMemoryAllocator::do_allocate(const size_t bytes, const size_t alignment)
+{
+    const auto mappedBytes = roundUpToPageSize(bytes);
+    PRECONDITION(
+        alignment <= static_cast<size_t>(sysconf(_SC_PAGE_SIZE)), "NumaMemoryAllocator only supports alignments up to the page size");
+    void* memory = mmap(nullptr, mappedBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    INVARIANT(memory != MAP_FAILED, "memory allocation of {} bytes on numa node {} failed", mappedBytes, numaNode);
+
+    if (numaNode < MAX_SUPPORTED_NUMA_NODES)
+    {
+        /// Pages are only placed on first touch, thus binding the mapping before it is touched is sufficient.
+        std::array<unsigned long, 1> nodeMask{1UL << numaNode};
+        if (syscall(SYS_mbind, memory, mappedBytes, MPOL_PREFERRED_POLICY, nodeMask.data(), MAX_SUPPORTED_NUMA_NODES + 1, 0) != 0)
+        {
+            NES_WARNING("Could not bind {} bytes to numa node {}. Memory is placed by the default policy.", mappedBytes, numaNode);
+        }
+    }
+    return memory;
+}
+
+void NumaMemoryAllocator::do_deallocate(void* p, const size_t bytes, size_t)
+{
+    /// munmap only fails for arguments do_allocate never hands out, so a failure means the caller passed a foreign pointer or size.
+    if (munmap(p, roundUpToPageSize(bytes)) != 0)
+    {
+        NES_ERROR("Could not unmap {} bytes on numa node {}: {}", roundUpToPageSize(bytes), numaNode, getErrorMessageFromERRNO());
+    }
+}
+
+}
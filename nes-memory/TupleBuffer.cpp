@@ -14,7 +14,10 @@
 
 #include <Runtime/TupleBuffer.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -29,6 +32,28 @@
 namespace NES
 {
 
+TupleBuffer TupleBuffer::wrapMemory(uint8_t* ptr, const size_t size, std::function<void(uint8_t*, size_t)>&& releaseFunction)
+{
+    PRECONDITION(size <= std::numeric_limits<uint32_t>::max(), "Cannot wrap {} bytes into a single TupleBuffer", size);
+    /// The memory segment of a wrapped buffer owns its control block. Both are deleted by the recycle callback, which is why the
+    /// callback moves everything it needs onto its stack before deleting the segment.
+    /// NOLINTNEXTLINE(cppcoreguidelines-owning-memory) ownership is transferred to the recycle callback
+    auto* memorySegment = new detail::MemorySegment(
+        ptr,
+        static_cast<uint32_t>(size),
+        [releaseFunction = std::move(releaseFunction)](detail::MemorySegment* segment, BufferRecycler*) mutable
+        {
+            auto release = std::move(releaseFunction);
+            auto* const memory = segment->ptr;
+            const size_t bytes = segment->size;
+            delete segment; /// NOLINT(cppcoreguidelines-owning-memory)
+            release(memory, bytes);
+        });
+    const auto prepared = memorySegment->controlBlock->prepare(nullptr);
+    INVARIANT(prepared, "A freshly wrapped memory segment must not be referenced");
+    return TupleBuffer(memorySegment->controlBlock.get(), memorySegment->ptr, memorySegment->size);
+}
+
 TupleBuffer::TupleBuffer(const TupleBuffer& other) noexcept : controlBlock(other.controlBlock), ptr(other.ptr), size(other.size)
 {
     if (controlBlock != nullptr)
@@ -183,6 +208,15 @@ ChildBufferIndex TupleBuffer::storeChildBuffer(TupleBuffer& buffer) noexcept
     return index;
 }
 
+void TupleBuffer::replaceChildBuffer(const ChildBufferIndex bufferIndex, TupleBuffer& buffer) noexcept
+{
+    TupleBuffer empty;
+    auto* control = buffer.controlBlock;
+    INVARIANT(controlBlock != control, "Cannot attach buffer to self");
+    controlBlock->replaceChildBuffer(bufferIndex, control);
+    std::swap(empty, buffer);
+}
+
 TupleBuffer TupleBuffer::loadChildBuffer(ChildBufferIndex bufferIndex) const noexcept
 {
     TupleBuffer childBuffer;
@@ -309,6 +309,16 @@ ChildBufferIndex BufferControlBlock::storeChildBuffer(BufferControlBlock* contro
     return ChildBufferIndex{static_cast<uint32_t>(children.size() - 1)};
 }
 
+void BufferControlBlock::replaceChildBuffer(const ChildBufferIndex index, BufferControlBlock* control)
+{
+    PRECONDITION(index.getRawValue() < children.size(), "Index={} is out of range={}", index, children.size());
+
+    control->retain();
+    auto*& child = children[index.getRawValue()];
+    child->controlBlock->release();
+    child = control->owner;
+}
+
 bool BufferControlBlock::loadChildBuffer(const ChildBufferIndex index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const
 {
     PRECONDITION(index.getRawValue() < children.size(), "Index={} is out of range={}", index, children.size());
@@ -99,6 +99,7 @@ public:
     void setCreationTimestamp(Timestamp timestamp);
     [[nodiscard]] Timestamp getCreationTimestamp() const noexcept;
     [[nodiscard]] ChildBufferIndex storeChildBuffer(BufferControlBlock* control);
+    void replaceChildBuffer(ChildBufferIndex index, BufferControlBlock* control);
     [[nodiscard]] bool loadChildBuffer(ChildBufferIndex index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const;
 
     [[nodiscard]] uint32_t getNumberOfChildBuffers() const noexcept { return children.size(); }
@@ -37,8 +37,12 @@
 namespace NES
 {
 UnpooledChunksManager::UnpooledChunksManager(
-    std::shared_ptr<std::pmr::memory_resource> memoryResource, const size_t unpooledMemoryBudgetInBytes)
-    : memoryResource(std::move(memoryResource)), unpooledMemoryBudgetInBytes(unpooledMemoryBudgetInBytes)
+    std::shared_ptr<std::pmr::memory_resource> memoryResource,
+    const size_t unpooledMemoryBudgetInBytes,
+    std::shared_ptr<std::pmr::memory_resource> spillMemoryResource)
+    : memoryResource(std::move(memoryResource))
+    , unpooledMemoryBudgetInBytes(unpooledMemoryBudgetInBytes)
+    , spillMemoryResource(std::move(spillMemoryResource))
 {
 }
 
@@ -124,21 +128,36 @@ UnpooledChunksManager::allocateSpace(const std::thread::id threadId, const size_
     const auto bytesInUseBefore = currentlyAllocatedUnpooledBytes->fetch_add(newAllocationSize, std::memory_order_relaxed);
     /// Underflow-safe budget check: bytesInUseBefore + newAllocationSize can wrap size_t (and SIZE_MAX is the
     /// unbounded sentinel), and concurrent fetch_adds can transiently push bytesInUseBefore past the budget.
+    auto isSpilled = false;
     if (bytesInUseBefore >= unpooledMemoryBudgetInBytes || newAllocationSize > unpooledMemoryBudgetInBytes - bytesInUseBefore)
     {
         currentlyAllocatedUnpooledBytes->fetch_sub(newAllocationSize, std::memory_order_relaxed);
-        NES_WARNING(
-            "Unpooled memory budget of {}B would be exceeded by a {}B chunk ({}B already in use); refusing allocation.",
+        if (spillMemoryResource == nullptr)
+        {
+            NES_WARNING(
+                "Unpooled memory budget of {}B would be exceeded by a {}B chunk ({}B already in use); refusing allocation.",
+                unpooledMemoryBudgetInBytes,
+                newAllocationSize,
+                bytesInUseBefore);
+            return {};
+        }
+        /// Instead of failing the query, the chunk spills to disk. The spill memory resource enforces its own capacity.
+        NES_DEBUG(
+            "Unpooled memory budget of {}B would be exceeded by a {}B chunk ({}B already in use); spilling the chunk.",
             unpooledMemoryBudgetInBytes,
             newAllocationSize,
             bytesInUseBefore);
-        return {};
+        isSpilled = true;
     }
 
-    auto* const newlyAllocatedMemory = static_cast<uint8_t*>(memoryResource->allocate(newAllocationSize, alignment));
+    const auto& chunkMemoryResource = isSpilled ? spillMemoryResource : memoryResource;
+    auto* const newlyAllocatedMemory = static_cast<uint8_t*>(chunkMemoryResource->allocate(newAllocationSize, alignment));
     if (newlyAllocatedMemory == nullptr)
     {
-        currentlyAllocatedUnpooledBytes->fetch_sub(newAllocationSize, std::memory_order_relaxed);
+        if (not isSpilled)
+        {
+            currentlyAllocatedUnpooledBytes->fetch_sub(newAllocationSize, std::memory_order_relaxed);
+        }
         NES_WARNING("Could not allocate {} bytes for unpooled chunk!", newAllocationSize);
         return {};
     }
@@ -150,6 +169,7 @@ UnpooledChunksManager::allocateSpace(const std::thread::id threadId, const size_
     auto& currentAllocatedChunk = localUnpooledBufferChunkStorage[localKeyForUnpooledBufferChunk];
     currentAllocatedChunk.startOfChunk = newlyAllocatedMemory;
     currentAllocatedChunk.totalSize = newAllocationSize;
+    currentAllocatedChunk.isSpilled = isSpilled;
     currentAllocatedChunk.usedSize += neededSize;
     currentAllocatedChunk.activeMemorySegments += 1;
     NES_TRACE("Created new chunk {} for tuple buffer {} of {}B", currentAllocatedChunk, fmt::ptr(localMemoryForNewTupleBuffer), neededSize);
@@ -184,6 +204,7 @@ UnpooledChunksManager::getUnpooledBuffer(const size_t neededSize, size_t alignme
         localMemoryForNewTupleBuffer + controlBlockSize,
         alignedBufferSize,
         [copyOfMemoryResource = this->memoryResource,
+         copyOfSpillMemoryResource = this->spillMemoryResource,
          copyOLastChunkPtr = localKeyForUnpooledBufferChunk,
          copyOfChunk = chunk,
          copyOfAlignment = alignment,
@@ -204,6 +225,12 @@ UnpooledChunksManager::getUnpooledBuffer(const size_t neededSize, size_t alignme
                 const auto& extractedChunkControlBlock = extractedChunk.mapped();
                 lockedLocalUnpooledBufferData->lastAllocateChunkKey = nullptr;
                 lockedLocalUnpooledBufferData.unlock();
+                if (extractedChunkControlBlock.isSpilled)
+                {
+                    copyOfSpillMemoryResource->deallocate(
+                        extractedChunkControlBlock.startOfChunk, extractedChunkControlBlock.totalSize, copyOfAlignment);
+                    return;
+                }
                 copyOfMemoryResource->deallocate(
                     extractedChunkControlBlock.startOfChunk, extractedChunkControlBlock.totalSize, copyOfAlignment);
                 copyOfAllocatedBytes->fetch_sub(extractedChunkControlBlock.totalSize, std::memory_order_relaxed);
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory_resource>
+
+namespace NES
+{
+/**
+ * @brief Memory resource that backs its allocations with files instead of anonymous memory, which lets operator state spill to disk.
+ * Every allocation maps an unnamed temporary file in the spill directory. The kernel writes dirty pages of the mapping back to the file
+ * asynchronously and in large sequential batches, and evicts cold pages under memory pressure without needing swap space. Accessing an
+ * evicted page faults it back in from the file. Thus, state that outgrows the memory budget slows down instead of failing.
+ * The files are unlinked from the start, so they vanish once their mapping is released, even if the worker crashes.
+ * Allocations return nullptr once the mapped bytes would exceed the capacity or the file system is full.
+ */
+class FileBackedMemoryAllocator : public std::pmr::memory_resource
+{
+public:
+    FileBackedMemoryAllocator(std::filesystem::path spillDirectory, size_t capacityInBytes);
+    ~FileBackedMemoryAllocator() override = default;
+
+    [[nodiscard]] size_t getCapacityInBytes() const { return capacityInBytes; }
+
+    [[nodiscard]] size_t getMappedBytes() const { return mappedBytes.load(std::memory_order_relaxed); }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+    /// Returns the descriptor of an unnamed file in the spill directory, or -1 if no file can be created
+    [[nodiscard]] int createUnnamedFile() const;
+
+    std::filesystem::path spillDirectory;
+    size_t capacityInBytes;
+    std::atomic<size_t> mappedBytes{0};
+};
+}
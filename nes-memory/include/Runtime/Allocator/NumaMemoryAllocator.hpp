@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace NES
+{
+/**
+ * @brief Memory resource that places its allocations on a single NUMA node. Memory is mapped anonymously and bound to the node via
+ * `mbind`, preferring the node without failing the allocation if the node runs out of memory. On systems without NUMA support the
+ * binding is skipped and the allocator behaves like a page-aligned default allocator.
+ */
+class NumaMemoryAllocator : public std::pmr::memory_resource
+{
+public:
+    explicit NumaMemoryAllocator(size_t numaNode) : numaNode(numaNode) { }
+    ~NumaMemoryAllocator() override = default;
+
+    [[nodiscard]] size_t getNumaNode() const { return numaNode; }
+
+    /// Returns the ids of all online NUMA nodes. Returns a single node 0 if the system does not expose NUMA information.
+    static std::vector<size_t> getOnlineNumaNodes();
+
+    /// Parses a kernel node list, i.e., comma separated ids and ranges such as `0,2-3`. Returns nullopt if the list is malformed.
+    static std::optional<std::vector<size_t>> parseNumaNodeList(std::string_view nodeList);
+
+    /// Returns the NUMA node of the cpu the calling thread is currently running on, if the system exposes it.
+    static std::optional<size_t> getCurrentNumaNode();
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+    bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+    size_t numaNode;
+};
+}
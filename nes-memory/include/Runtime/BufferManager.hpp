@@ -22,7 +22,9 @@
 #include <memory>
 #include <memory_resource>
 #include <mutex>
+#include <new>
 #include <optional>
+#include <utility>
 #include <vector>
 #include <Identifiers/NESStrongType.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -37,6 +39,21 @@ namespace NES
 /// readability-suspicious-call-argument on every call site
 using BufferAlignment = NESStrongType<uint32_t, struct BufferAlignment_, 0, 0>;
 
+/// Memory resource used to allocate the pooled buffers of a single NUMA node.
+struct NumaNodeMemoryResource
+{
+    size_t numaNode;
+    std::shared_ptr<std::pmr::memory_resource> memoryResource;
+};
+
+/// Occupancy of the pooled buffers allocated on a single NUMA node. Buffers held by thread-local caches count as available.
+struct BufferPoolStatistics
+{
+    size_t numaNode;
+    size_t numberOfPooledBuffers;
+    size_t numberOfAvailableBuffers;
+};
+
 /**
  * @brief The BufferManager is responsible for:
  * 1. Pooled Buffers: preallocated fixed-size buffers of memory that must be reference counted
@@ -56,6 +73,12 @@ using BufferAlignment = NESStrongType<uint32_t, struct BufferAlignment_, 0, 0>;
  * Unpooled buffers are either allocated on the spot or served via a previously allocated, unpooled buffer that has
  * been returned to the BufferManager by some component.
  *
+ * NUMA awareness: the pooled buffers can be split into one sub-pool per NUMA node, each allocated via a node-bound memory resource.
+ * Threads prefer buffers from the sub-pool of the node they are running on and only fall back to remote sub-pools if their local
+ * sub-pool is exhausted. Additionally, a small per-thread cache of recycled buffers sits in front of the sub-pools, which avoids the
+ * shared queue for threads that repeatedly request and release buffers. Cached buffers are handed back to the shared sub-pool as
+ * soon as other threads wait for buffers.
+ *
  * Debug-only marker fill: in debug builds the pooled memory area is prefilled with the ASCII pattern "NEBUSTRM"
  * (repeated). This turns code paths that rely on freshly-allocated buffers being zeroed into visible bugs
  * (e.g. a sink that forgets to trim by the formatted byte count will emit "NEBUSTRM..." trailing garbage
@@ -81,7 +104,10 @@ public:
         uint32_t numOfBuffers,
         std::shared_ptr<std::pmr::memory_resource> memoryResource,
         size_t unpooledMemoryLimitInBytes,
-        uint32_t alignment);
+        uint32_t alignment,
+        std::vector<NumaNodeMemoryResource> pooledMemoryResources,
+        size_t threadCacheCapacity,
+        std::shared_ptr<std::pmr::memory_resource> spillMemoryResource);
 
     /// Creates a new global buffer manager from a total memory budget. The pooled buffer count and the unpooled
     /// memory limit are derived: unpooledLimit = totalMemoryInBytes * unpooledMemoryFraction, the remaining
@@ -91,12 +117,20 @@ public:
     /// @param alignment byte alignment of every buffer; must be a power of two <= page size (a cache line is 64 bytes)
     /// @param bufferSize the size of each pooled buffer in bytes
     /// @param memoryResource resource for allocating and deallocating memory
+    /// @param pooledMemoryResources one resource per NUMA node the pooled buffers are split across; if empty, all pooled buffers are
+    /// allocated via memoryResource in a single pool
+    /// @param threadCacheCapacity number of recycled buffers each thread keeps in its local cache; zero disables the caches
+    /// @param spillMemoryResource resource for unpooled buffers that exceed the unpooled memory limit, e.g., a FileBackedMemoryAllocator;
+    /// if nullptr, such unpooled buffers are refused
     static std::shared_ptr<BufferManager> create(
         size_t totalMemoryInBytes,
         double unpooledMemoryFraction,
         BufferAlignment alignment,
         uint32_t bufferSize,
-        const std::shared_ptr<std::pmr::memory_resource>& memoryResource);
+        const std::shared_ptr<std::pmr::memory_resource>& memoryResource,
+        std::vector<NumaNodeMemoryResource> pooledMemoryResources = {},
+        size_t threadCacheCapacity = 0,
+        std::shared_ptr<std::pmr::memory_resource> spillMemoryResource = nullptr);
 
     BufferManager(const BufferManager&) = delete;
     BufferManager& operator=(const BufferManager&) = delete;
@@ -134,6 +168,9 @@ public:
     size_t getNumOfUnpooledBuffers() const override;
     size_t getNumberOfAvailableBuffers() const;
 
+    /// Returns the occupancy of every NUMA node sub-pool
+    std::vector<BufferPoolStatistics> getPoolStatistics() const;
+
     /// Explicitly shuts down the buffer manager: checks for leaked buffers (fires INVARIANT on leaks),
     /// deallocates all memory, and marks the manager as destroyed. The destructor calls this automatically
     /// if it has not already been called.
@@ -152,9 +189,51 @@ public:
     void recycleUnpooledBuffer(NES::detail::MemorySegment* segment, const AllocationThreadInfo&) override;
 
 private:
+    /// Pooled buffers allocated on a single NUMA node. The pool owns the segments allBuffers[firstBuffer, firstBuffer + numOfBuffers).
+    struct NodePool
+    {
+        NodePool(size_t numaNode, std::shared_ptr<std::pmr::memory_resource> memoryResource, size_t firstBuffer, size_t numOfBuffers)
+            : numaNode(numaNode)
+            , memoryResource(std::move(memoryResource))
+            , firstBuffer(firstBuffer)
+            , numOfBuffers(numOfBuffers)
+            , availableBuffers(numOfBuffers)
+        {
+        }
+
+        size_t numaNode;
+        std::shared_ptr<std::pmr::memory_resource> memoryResource;
+        size_t firstBuffer;
+        size_t numOfBuffers;
+        folly::MPMCQueue<NES::detail::MemorySegment*> availableBuffers;
+        uint8_t* basePointer{nullptr};
+        size_t allocatedAreaSize{0};
+    };
+
+    /// Small cache of recycled buffers in front of the node pools. Each thread is assigned to one cache, which is placed on its own
+    /// cache line. The mutex is only contended if more threads than caches request buffers.
+    struct alignas(std::hardware_destructive_interference_size) ThreadCache
+    {
+        mutable std::mutex mutex;
+        std::vector<NES::detail::MemorySegment*> segments;
+    };
+
+    NodePool& getPreferredPool();
+    NodePool& getHomePool(const NES::detail::MemorySegment* segment);
+    ThreadCache& getThreadCache();
+    /// Retrieves a segment from the thread cache, the preferred pool, remote pools or other thread caches without blocking
+    NES::detail::MemorySegment* tryGetSegment();
+    TupleBuffer prepareBuffer(NES::detail::MemorySegment* segment);
+
     std::vector<NES::detail::MemorySegment> allBuffers;
 
-    folly::MPMCQueue<NES::detail::MemorySegment*> availableBuffers;
+    std::vector<std::unique_ptr<NodePool>> nodePools;
+    std::vector<ThreadCache> threadCaches;
+    size_t threadCacheCapacity;
+    /// Identifies this manager in the cache slots a thread remembers, as one thread may request buffers from several managers.
+    uint64_t threadCacheKey;
+    /// Threads are assigned to the caches of this manager in the order they first request or recycle one of its buffers.
+    std::atomic<size_t> nextThreadCacheSlot{0};
 
     std::shared_ptr<NES::UnpooledChunksManager> unpooledChunksManager;
 
@@ -162,9 +241,6 @@ private:
     size_t numOfBuffers;
     uint32_t alignment;
 
-    uint8_t* basePointer{nullptr};
-    size_t allocatedAreaSize;
-
     std::shared_ptr<std::pmr::memory_resource> memoryResource;
     std::atomic<bool> isDestroyed{false};
 };
@@ -92,6 +92,11 @@ public:
     /// @brief Default constructor creates an empty wrapper around nullptr without controlBlock (nullptr) and size 0.
     [[nodiscard]] TupleBuffer() noexcept = default;
 
+    /// @brief Wraps externally managed memory, e.g., a region of a memory-mapped file, into an unpooled TupleBuffer.
+    /// The buffer does not belong to any BufferManager. `releaseFunction` is called with the wrapped region once the last
+    /// reference to the buffer is released, and must return the memory to its owner.
+    [[nodiscard]] static TupleBuffer wrapMemory(uint8_t* ptr, size_t size, std::function<void(uint8_t*, size_t)>&& releaseFunction);
+
 
     /// @brief Copy constructor: Increase the reference count associated to the control buffer.
     [[nodiscard]] TupleBuffer(const TupleBuffer& other) noexcept;
@@ -181,6 +186,9 @@ public:
     ///@brief attach a child tuple buffer to the parent. the child tuple buffer is then identified via NestedTupleBufferKey
     [[nodiscard]] ChildBufferIndex storeChildBuffer(TupleBuffer& buffer) noexcept;
 
+    ///@brief swap the child tuple buffer at bufferIndex for buffer, releasing the previous child. The index stays valid.
+    void replaceChildBuffer(ChildBufferIndex bufferIndex, TupleBuffer& buffer) noexcept;
+
     ///@brief retrieve a child tuple buffer via its NestedTupleBufferKey
     [[nodiscard]] TupleBuffer loadChildBuffer(ChildBufferIndex bufferIndex) const noexcept;
 
@@ -55,6 +55,10 @@ class UnpooledChunksManager
     /// callback can decrement it even if this manager has been destroyed in the meantime.
     std::shared_ptr<std::atomic<size_t>> currentlyAllocatedUnpooledBytes = std::make_shared<std::atomic<size_t>>(0);
 
+    /// Optional spill tier, e.g., a FileBackedMemoryAllocator. Once the budget is exhausted, new chunks are allocated from this resource
+    /// instead of failing, until it returns nullptr. Spilled chunks do not count against the budget. nullptr disables spilling.
+    std::shared_ptr<std::pmr::memory_resource> spillMemoryResource;
+
     /// Helper struct that stores necessary information for accessing unpooled chunks
     /// Instead of allocating the exact needed space, we allocate a chunk of a space calculated by a rolling average of the last n sizes.
     /// Thus, we (pre-)allocate potentially multiple buffers. At least, there is a high chance that one chunk contains multiple tuple buffers
@@ -67,14 +71,17 @@ class UnpooledChunksManager
             uint8_t* startOfChunk = nullptr;
             std::vector<std::unique_ptr<NES::detail::MemorySegment>> unpooledMemorySegments;
             uint64_t activeMemorySegments = 0;
+            /// Spilled chunks are allocated from the spill memory resource and have to be deallocated there
+            bool isSpilled = false;
 
             friend std::ostream& operator<<(std::ostream& os, const ChunkControlBlock& chunkControlBlock)
             {
                 return os << fmt::format(
-                           "CCB {} ({}/{}B) with {} activeMemorySegments",
+                           "CCB {} ({}/{}B{}) with {} activeMemorySegments",
                            fmt::ptr(chunkControlBlock.startOfChunk),
                            chunkControlBlock.usedSize,
                            chunkControlBlock.totalSize,
+                           chunkControlBlock.isSpilled ? ", spilled" : "",
                            chunkControlBlock.activeMemorySegments);
             }
         };
@@ -97,10 +104,14 @@ class UnpooledChunksManager
     std::shared_ptr<folly::Synchronized<UnpooledChunk>> getChunk(std::thread::id threadId);
 
 public:
-    explicit UnpooledChunksManager(std::shared_ptr<std::pmr::memory_resource> memoryResource, size_t unpooledMemoryBudgetInBytes);
+    UnpooledChunksManager(
+        std::shared_ptr<std::pmr::memory_resource> memoryResource,
+        size_t unpooledMemoryBudgetInBytes,
+        std::shared_ptr<std::pmr::memory_resource> spillMemoryResource = nullptr);
     size_t getNumberOfUnpooledBuffers() const;
 
-    /// Returns std::nullopt if the unpooled memory budget would be exceeded or the underlying allocation fails.
+    /// Returns std::nullopt if the unpooled memory budget would be exceeded and the chunk can not be spilled, or the underlying
+    /// allocation fails.
     std::optional<TupleBuffer>
     getUnpooledBuffer(size_t neededSize, size_t alignment, const std::shared_ptr<BufferRecycler>& bufferRecycler);
 };
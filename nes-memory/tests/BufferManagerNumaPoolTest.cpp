@@ -0,0 +1,190 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+class BufferManagerNumaPoolTest : public ::testing::Test
+{
+protected:
+    static constexpr uint32_t BUFFER_SIZE = 4096;
+    static constexpr uint32_t NUM_BUFFERS = 9;
+    static constexpr NES::BufferAlignment BUFFER_ALIGNMENT{64};
+    static constexpr double UNPOOLED_MEMORY_FRACTION = 0.5;
+    static constexpr size_t TOTAL_MEMORY_IN_BYTES = 2 * static_cast<size_t>(NUM_BUFFERS) * BUFFER_SIZE;
+    static constexpr size_t THREAD_CACHE_CAPACITY = 4;
+
+    /// Two sub-pools backed by independent resources emulate a dual-socket machine on any host
+    static std::shared_ptr<BufferManager> createTwoNodeBufferManager(const size_t threadCacheCapacity)
+    {
+        return BufferManager::create(
+            TOTAL_MEMORY_IN_BYTES,
+            UNPOOLED_MEMORY_FRACTION,
+            BUFFER_ALIGNMENT,
+            BUFFER_SIZE,
+            std::make_shared<NesDefaultMemoryAllocator>(),
+            {{0, std::make_shared<NesDefaultMemoryAllocator>()}, {1, std::make_shared<NesDefaultMemoryAllocator>()}},
+            threadCacheCapacity);
+    }
+};
+
+/// The pooled buffers are split evenly across the nodes and every buffer can be acquired, regardless of the node of the calling thread.
+TEST_F(BufferManagerNumaPoolTest, AllBuffersOfAllNodesAreAvailable)
+{
+    auto bm = createTwoNodeBufferManager(THREAD_CACHE_CAPACITY);
+    const auto statistics = bm->getPoolStatistics();
+    ASSERT_EQ(statistics.size(), 2);
+    EXPECT_EQ(statistics[0].numberOfPooledBuffers, 5);
+    EXPECT_EQ(statistics[1].numberOfPooledBuffers, 4);
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < NUM_BUFFERS; ++i)
+    {
+        auto buffer = bm->getBufferNoBlocking();
+        ASSERT_TRUE(buffer.has_value());
+        buffers.emplace_back(std::move(*buffer));
+    }
+    EXPECT_FALSE(bm->getBufferNoBlocking().has_value());
+    EXPECT_EQ(bm->getNumberOfAvailableBuffers(), 0);
+    for (const auto& [numaNode, pooled, available] : bm->getPoolStatistics())
+    {
+        EXPECT_EQ(available, 0) << "numa node " << numaNode;
+    }
+
+    buffers.clear();
+    EXPECT_EQ(bm->getNumberOfAvailableBuffers(), NUM_BUFFERS);
+    size_t availableInStatistics = 0;
+    for (const auto& [numaNode, pooled, available] : bm->getPoolStatistics())
+    {
+        EXPECT_EQ(available, pooled) << "numa node " << numaNode;
+        availableInStatistics += available;
+    }
+    EXPECT_EQ(availableInStatistics, NUM_BUFFERS);
+    EXPECT_NO_FATAL_FAILURE(bm->destroy());
+}
+
+/// Buffers which are parked in the cache of one thread must still be reachable by other threads once the pools are exhausted.
+TEST_F(BufferManagerNumaPoolTest, CachedBuffersAreReachableFromOtherThreads)
+{
+    auto bm = createTwoNodeBufferManager(THREAD_CACHE_CAPACITY);
+    std::thread(
+        [&]
+        {
+            std::vector<TupleBuffer> buffers;
+            for (size_t i = 0; i < THREAD_CACHE_CAPACITY; ++i)
+            {
+                buffers.emplace_back(bm->getBufferBlocking());
+            }
+            /// Releasing the buffers moves them into the cache of this thread
+        })
+        .join();
+
+    std::vector<TupleBuffer> buffers;
+    for (size_t i = 0; i < NUM_BUFFERS; ++i)
+    {
+        auto buffer = bm->getBufferWithTimeout(std::chrono::milliseconds(100));
+        ASSERT_TRUE(buffer.has_value());
+        buffers.emplace_back(std::move(*buffer));
+    }
+    buffers.clear();
+    EXPECT_NO_FATAL_FAILURE(bm->destroy());
+}
+
+/// Many threads concurrently acquire and release buffers to stress the interaction between thread caches and node pools.
+TEST_F(BufferManagerNumaPoolTest, ConcurrentAcquireAndRelease)
+{
+    constexpr size_t numberOfThreads = 8;
+    constexpr size_t iterations = 10000;
+    auto bm = createTwoNodeBufferManager(THREAD_CACHE_CAPACITY);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t thread = 0; thread < numberOfThreads; ++thread)
+        {
+            threads.emplace_back(
+                [&]
+                {
+                    for (size_t i = 0; i < iterations; ++i)
+                    {
+                        auto buffer = bm->getBufferBlocking();
+                        buffer.setNumberOfTuples(i);
+                    }
+                });
+        }
+    }
+    EXPECT_EQ(bm->getNumberOfAvailableBuffers(), NUM_BUFFERS);
+    EXPECT_NO_FATAL_FAILURE(bm->destroy());
+}
+
+/// Memory of the numa allocator is usable on any machine, even if it does not expose numa information.
+TEST_F(BufferManagerNumaPoolTest, NumaMemoryAllocatorProvidesUsableMemory)
+{
+    const auto numaNodes = NumaMemoryAllocator::getOnlineNumaNodes();
+    ASSERT_FALSE(numaNodes.empty());
+
+    NumaMemoryAllocator allocator(numaNodes.front());
+    constexpr size_t bytes = 3 * BUFFER_SIZE + 1;
+    auto* memory = static_cast<std::byte*>(allocator.allocate(bytes, BUFFER_ALIGNMENT.getRawValue()));
+    ASSERT_NE(memory, nullptr);
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) only inspects the address
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(memory) % BUFFER_ALIGNMENT.getRawValue(), 0);
+    std::memset(memory, 1, bytes);
+    allocator.deallocate(memory, bytes, BUFFER_ALIGNMENT.getRawValue());
+}
+
+/// The node list is parsed from sysfs, which must not take the worker down if its content is not what the kernel usually writes.
+TEST_F(BufferManagerNumaPoolTest, NumaNodeListParsing)
+{
+    EXPECT_EQ(NumaMemoryAllocator::parseNumaNodeList("0"), std::vector<size_t>({0}));
+    EXPECT_EQ(NumaMemoryAllocator::parseNumaNodeList("0-1"), std::vector<size_t>({0, 1}));
+    EXPECT_EQ(NumaMemoryAllocator::parseNumaNodeList("0,2-3"), std::vector<size_t>({0, 2, 3}));
+    EXPECT_FALSE(NumaMemoryAllocator::parseNumaNodeList("node0").has_value());
+    EXPECT_FALSE(NumaMemoryAllocator::parseNumaNodeList("0-").has_value());
+    EXPECT_FALSE(NumaMemoryAllocator::parseNumaNodeList("3-1").has_value());
+    EXPECT_FALSE(NumaMemoryAllocator::parseNumaNodeList("0,,1").has_value());
+    EXPECT_FALSE(NumaMemoryAllocator::parseNumaNodeList("99999999999999999999999").has_value());
+}
+
+/// A thread that alternates between two managers keeps a cache slot in each of them, and every buffer returns to its own manager.
+TEST_F(BufferManagerNumaPoolTest, ThreadCachesArePerBufferManager)
+{
+    auto first = createTwoNodeBufferManager(THREAD_CACHE_CAPACITY);
+    auto second = createTwoNodeBufferManager(THREAD_CACHE_CAPACITY);
+    for (size_t i = 0; i < 2 * THREAD_CACHE_CAPACITY; ++i)
+    {
+        auto firstBuffer = first->getBufferBlocking();
+        auto secondBuffer = second->getBufferBlocking();
+        EXPECT_EQ(first->getNumberOfAvailableBuffers(), NUM_BUFFERS - 1);
+        EXPECT_EQ(second->getNumberOfAvailableBuffers(), NUM_BUFFERS - 1);
+    }
+    EXPECT_EQ(first->getNumberOfAvailableBuffers(), NUM_BUFFERS);
+    EXPECT_EQ(second->getNumberOfAvailableBuffers(), NUM_BUFFERS);
+    EXPECT_NO_FATAL_FAILURE(first->destroy());
+    EXPECT_NO_FATAL_FAILURE(second->destroy());
+}
+
+}
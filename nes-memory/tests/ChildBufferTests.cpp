@@ -129,3 +129,28 @@ TEST(ChildBufferTests, StoreAndLoadChildBufferRandomSizes)
         EXPECT_EQ(loadedBuffer.getBufferSize(), bufferSizeBeforeStore);
     }
 }
+
+/// Testing that replacing a child keeps its index and hands the previous child back to the pool right away
+TEST(ChildBufferTests, ReplaceChildBufferReleasesPreviousChild)
+{
+    auto bufferManager = NES::BufferManager::create(
+        TOTAL_MEMORY_IN_BYTES,
+        UNPOOLED_MEMORY_FRACTION,
+        BUFFER_ALIGNMENT,
+        POOLED_BUFFER_SIZE,
+        std::make_shared<NES::NesDefaultMemoryAllocator>());
+    auto baseBuffer = bufferManager->getBufferBlocking();
+
+    auto firstChild = bufferManager->getBufferBlocking();
+    const auto bufferIndex = baseBuffer.storeChildBuffer(firstChild);
+    const auto availableWithFirstChild = bufferManager->getNumberOfAvailableBuffers();
+
+    auto secondChild = bufferManager->getUnpooledBuffer(POOLED_BUFFER_SIZE * 2);
+    ASSERT_TRUE(secondChild.has_value());
+    const auto secondChildSize = secondChild->getBufferSize();
+    baseBuffer.replaceChildBuffer(bufferIndex, secondChild.value());
+
+    EXPECT_EQ(baseBuffer.getNumberOfChildBuffers(), 1);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableWithFirstChild + 1);
+    EXPECT_EQ(baseBuffer.loadChildBuffer(bufferIndex).getBufferSize(), secondChildSize);
+}
@@ -12,15 +12,18 @@
     limitations under the License.
 */
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <random>
 #include <thread>
 #include <utility>
 #include <vector>
+#include <Runtime/Allocator/FileBackedMemoryAllocator.hpp>
 #include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -203,4 +206,81 @@ TEST(UnpooledBufferTests, UnpooledMemoryBudgetIsEnforcedAndReleased)
     ASSERT_TRUE(bufferAfterRelease.has_value());
 }
 
+/// With a spill memory resource, unpooled buffers beyond the budget are backed by files instead of being refused. Their content must
+/// survive like in memory, and releasing them must unmap the files again.
+TEST(UnpooledBufferTests, UnpooledBuffersBeyondBudgetSpillToDisk)
+{
+    constexpr size_t unpooledBudgetInBytes = 1024 * 1024; /// 1 MiB
+    constexpr size_t spillCapacityInBytes = 16 * 1024 * 1024; /// 16 MiB
+    constexpr uint32_t poolBufferSize = 4096;
+    constexpr NES::BufferAlignment bufferAlignment{64};
+    constexpr size_t totalMemoryInBytes = unpooledBudgetInBytes + poolBufferSize;
+    const double unpooledMemoryFraction = static_cast<double>(unpooledBudgetInBytes) / static_cast<double>(totalMemoryInBytes);
+    const auto spillDirectory = std::filesystem::temp_directory_path() / "nes-unpooled-buffer-spill-test";
+    const auto spillMemoryResource = std::make_shared<FileBackedMemoryAllocator>(spillDirectory, spillCapacityInBytes);
+    const auto bufferManager = BufferManager::create(
+        totalMemoryInBytes,
+        unpooledMemoryFraction,
+        bufferAlignment,
+        poolBufferSize,
+        std::make_shared<NesDefaultMemoryAllocator>(),
+        {},
+        0,
+        spillMemoryResource);
+
+    /// Four times the budget, which would be refused without spilling
+    constexpr size_t allocationSize = 64 * 1024; /// 64 KiB
+    constexpr size_t numberOfAllocations = 4 * unpooledBudgetInBytes / allocationSize;
+    std::vector<TupleBuffer> heldBuffers;
+    for (size_t i = 0; i < numberOfAllocations; ++i)
+    {
+        auto buffer = bufferManager->getUnpooledBuffer(allocationSize);
+        ASSERT_TRUE(buffer.has_value());
+        std::ranges::fill(buffer->getAvailableMemoryArea<uint8_t>().first(allocationSize), static_cast<uint8_t>(i));
+        heldBuffers.emplace_back(std::move(buffer.value()));
+    }
+    ASSERT_GT(spillMemoryResource->getMappedBytes(), 0);
+    ASSERT_LE(spillMemoryResource->getMappedBytes(), spillCapacityInBytes);
+    for (size_t i = 0; i < heldBuffers.size(); ++i)
+    {
+        const auto content = heldBuffers[i].getAvailableMemoryArea<uint8_t>().first(allocationSize);
+        ASSERT_TRUE(std::ranges::all_of(content, [i](const uint8_t value) { return value == static_cast<uint8_t>(i); }));
+    }
+
+    heldBuffers.clear();
+    ASSERT_EQ(spillMemoryResource->getMappedBytes(), 0);
+    std::filesystem::remove_all(spillDirectory);
+}
+
+/// Wrapped buffers do not belong to a BufferManager. The release function must run exactly once, after the last copy is gone.
+TEST(UnpooledBufferTests, WrappedMemoryIsReleasedByLastReference)
+{
+    std::vector<uint8_t> memory(128, 42);
+    size_t numberOfReleases = 0;
+    uint8_t* releasedMemory = nullptr;
+    size_t releasedSize = 0;
+    {
+        auto buffer = TupleBuffer::wrapMemory(
+            memory.data(),
+            memory.size(),
+            [&](uint8_t* ptr, const size_t size)
+            {
+                ++numberOfReleases;
+                releasedMemory = ptr;
+                releasedSize = size;
+            });
+        ASSERT_EQ(buffer.getBufferSize(), memory.size());
+        ASSERT_EQ(buffer.getAvailableMemoryArea<uint8_t>()[0], 42);
+        buffer.setNumberOfTuples(memory.size());
+
+        const auto copy = buffer; /// NOLINT(performance-unnecessary-copy-initialization)
+        buffer.release();
+        ASSERT_EQ(numberOfReleases, 0);
+        ASSERT_EQ(copy.getNumberOfTuples(), memory.size());
+    }
+    ASSERT_EQ(numberOfReleases, 1);
+    ASSERT_EQ(releasedMemory, memory.data());
+    ASSERT_EQ(releasedSize, memory.size());
+}
+
 }
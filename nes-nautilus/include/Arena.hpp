@@ -32,20 +32,35 @@ namespace NES
 /// The arena is a memory management system that provides memory to the operators during a pipeline invocation.
 /// As the memory is destroyed / returned to the arena after the pipeline invocation, the memory is not persistent and thus, it is not
 /// suitable for storing state across pipeline invocations. For storing state across pipeline invocations, the operator handler should be used.
+/// An arena may be reused across pipeline invocations via reset(), which keeps some of its buffers and thereby saves the round trips to
+/// the buffer provider.
 struct Arena
 {
-    explicit Arena(std::shared_ptr<AbstractBufferProvider> bufferProvider) : bufferProvider(std::move(bufferProvider)) { }
+    /// Fixed-size buffers that reset() keeps by default. Every retained buffer is missing from the buffer provider's pool.
+    static constexpr size_t DEFAULT_MAX_RETAINED_BUFFERS = 2;
+
+    explicit Arena(std::shared_ptr<AbstractBufferProvider> bufferProvider, size_t maxRetainedBuffers = DEFAULT_MAX_RETAINED_BUFFERS)
+        : bufferProvider(std::move(bufferProvider)), maxRetainedBuffers(maxRetainedBuffers)
+    {
+    }
 
     /// Allocating memory by the buffer provider. There are three cases:
     /// 1. The required size is larger than the buffer provider's buffer size. In this case, we allocate an unpooled buffer.
-    /// 2. The required size is larger than the last buffer size. In this case, we allocate a new buffer of fixed size.
-    /// 3. The required size is smaller than the last buffer size. In this case, we return the pointer to the address in the last buffer.
+    /// 2. The required size is larger than the space left in the current buffer. In this case, we continue in the next fixed-size
+    ///    buffer, which is either a buffer retained by reset() or a new buffer from the buffer provider.
+    /// 3. The required size fits into the current buffer. In this case, we return the pointer to the address in the current buffer.
     std::span<std::byte> allocateMemory(size_t sizeInBytes);
 
+    /// Invalidates all memory allocated so far and rewinds the arena to its first fixed-size buffer. Keeps up to maxRetainedBuffers
+    /// fixed-size buffers for the following allocations, and returns all other buffers to the buffer provider.
+    void reset();
+
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
     std::vector<TupleBuffer> fixedSizeBuffers;
     std::vector<TupleBuffer> unpooledBuffers;
-    size_t lastAllocationSize{0};
+    size_t maxRetainedBuffers;
+    /// The fixed-size buffers in use since the last reset(), the last of which is the current buffer.
+    size_t usedFixedSizeBuffers{0};
     size_t currentOffset{0};
 };
 
@@ -27,6 +27,7 @@
 #include <Interface/HashMap/HashMap.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <ErrorHandling.hpp>
 
 namespace NES
@@ -60,14 +61,21 @@ public:
 /// Storage Space:
 /// The storage space contains individual key-value pairs. It does not support variable length keys or values for now.
 /// For keys, one could project them beforehand to a fixed length representation, e.g., uin64_t, and then use the newly mapped key.
+/// With more than one radix partition, every partition of the top hash bits has pages of its own, so that the entries of one
+/// partition can be iterated without touching the others.
 ///
 /// IMPORTANT — differences from std::unordered_map:
 /// 1. This hash map is *NOT* thread safe and allows for no concurrent accesses, as it does not use any locking, atomics or synchronization primitives.
 /// 2. This hash map does not clear the content of the entry. So it is up to the user to initialize values correctly.
 /// 3. There is no erase()/element removal: once inserted, an entry cannot be removed from the map.
-/// 4. There is no automatic rehashing: the number of buckets is fixed at query-compilation time and never grows to bound the load
-///    factor, unlike std::unordered_map's max_load_factor-triggered rehash. Callers must size numberOfBuckets for the expected
-///    cardinality upfront. A map may therefore hold far more entries than it has buckets; the chains simply get longer.
+/// 4. Rehashing is opt-in: by default the number of buckets is fixed at query-compilation time and never grows to bound the load
+///    factor, so callers must size numberOfBuckets for the expected cardinality upfront and the chains simply get longer. With
+///    ChainedHashMapConfig::maxLoadFactor set, the map doubles its chains array once that many records per chain are exceeded.
+///    Unlike std::unordered_map, the rehash is incremental: the old chains are split into the new array
+///    CHAINS_MIGRATED_PER_INSERT at a time on the following inserts, so no single insert pays for the whole table.
+///    Entries never move, only their next pointers are relinked, so entry pointers stay valid across a growth.
+///    With ChainedHashMapConfig::index set to SWISS, the chains are not used at all. Lookups go through an open-addressing
+///    index instead, which doubles and is rebuilt from the stored hashes whenever it is 7/8 full.
 /// 5. findOrCreateEntry() (see {@refitem HashMapRef.hpp}) is first-write-wins: on a colliding key, the existing entry is returned
 ///    unmodified rather than overwritten as std::unordered_map::operator[]/insert_or_assign would. Use insertOrUpdateEntry() for
 ///    update-on-collision semantics.
@@ -84,7 +92,9 @@ public:
     static void init(
         TupleBuffer& tupleBuffer IF_PRECONDITION(, uint64_t entrySize),
         uint64_t numberOfBuckets IF_PRECONDITION(, uint64_t pageSize),
-        uint64_t bloomBytes);
+        uint64_t bloomBytes,
+        uint64_t numberOfRadixPartitions,
+        HashMapIndex index);
     static void init(TupleBuffer& tupleBuffer, const ChainedHashMapConfig& config);
 
     /// Power of two >= numberOfBuckets / ChainedHashMapConfig::assumedLoadFactor: the real size of the chains
@@ -94,9 +104,17 @@ public:
     /// Mask applied to a hash to pick a chain. Always calculateNumberOfChains() - 1, since that is a power of 2.
     [[nodiscard]] static uint64_t calculateMask(uint64_t numberOfBuckets);
 
+    /// Bytes of the inline chains array, including its sentinel. A SWISS map never walks a chain, so it has none.
+    [[nodiscard]] static uint64_t calculateChainsArraySize(uint64_t numberOfBuckets, HashMapIndex index);
+
     /// Bytes the TupleBuffer backing a map with this sizing must provide: header, chains array and the
     /// BloomFilter bit area.
-    [[nodiscard]] static uint64_t calculateBufferSize(uint64_t numberOfBuckets, uint64_t bloomBytes);
+    [[nodiscard]] static uint64_t calculateBufferSize(uint64_t numberOfBuckets, uint64_t bloomBytes, HashMapIndex index);
+    [[nodiscard]] static uint64_t calculateBufferSize(const ChainedHashMapConfig& config);
+
+    /// The radix partition an entry with this hash is stored in: the top log2(numberOfRadixPartitions) bits of the hash.
+    /// The chains use the low bits, so the entries of one chain still spread over all partitions.
+    [[nodiscard]] static uint64_t calculateRadixPartition(HashFunction::HashValue::raw_type hash, uint64_t numberOfRadixPartitions);
 
 
     /// @brief Loads a ChainedHashMap view from a pre-filled TupleBuffer
@@ -115,12 +133,60 @@ public:
         uint64_t pageSize,
         uint64_t mask);
 
+    /// Growable counterpart of insertEntry(). The chain is picked from the map's current chain count instead of a
+    /// compile-time mask, a pending growth advances by CHAINS_MIGRATED_PER_INSERT chains, and the chains array is
+    /// doubled once the records per chain exceed maxLoadFactor. The remaining sizing has the same contract as above.
+    AbstractHashMapEntry* insertEntryGrowable(
+        HashFunction::HashValue::raw_type hash,
+        AbstractBufferProvider* bufferProvider,
+        uint64_t entrySize,
+        uint64_t entriesPerPage,
+        uint64_t pageSize,
+        double maxLoadFactor);
+
+    /// Counterpart of insertEntry() for a map with a SWISS index. The entry is not linked into any chain but gets a slot in
+    /// the index, which is allocated on the first insert and doubled before it fills up. Same sizing contract as above.
+    AbstractHashMapEntry* insertEntrySwiss(
+        HashFunction::HashValue::raw_type hash,
+        AbstractBufferProvider* bufferProvider,
+        uint64_t entrySize,
+        uint64_t entriesPerPage,
+        uint64_t pageSize);
+
+    /// Where a walk over the SWISS candidates of one hash stands: the probed group and the next slot within it.
+    struct SwissProbeCursor
+    {
+        uint64_t probe = 0;
+        uint64_t slotInGroup = 0;
+    };
+
+    /// Next entry whose control byte matches the hash, or nullptr once the probe sequence reached a group with an empty
+    /// slot. Matching 7 bits of the hash is no key match, so the caller compares the keys and calls again on a mismatch.
+    [[nodiscard]] ChainedHashMapEntry* findNextSwissCandidate(HashFunction::HashValue::raw_type hash, SwissProbeCursor& cursor);
+
+    /// Current number of slots in the SWISS index. 0 until the first insert.
+    [[nodiscard]] uint64_t getSwissCapacity() const { return header().swissCapacity; }
+
     [[nodiscard]] uint64_t getTotalNumberOfRecords() const override { return header().numRecords; }
 
+    /// The current length of the chains array. Only differs from calculateNumberOfChains() once a growable map grew, and is 0 for
+    /// a SWISS map.
+    [[nodiscard]] uint64_t getNumberOfChains() const { return header().numberOfChains; }
+
+    /// True while the chains of a previous, smaller chains array are still being migrated.
+    [[nodiscard]] bool isGrowing() const { return header().oldChains != nullptr; }
+
     [[nodiscard]] TupleBuffer getPage(uint64_t pageIndex) const;
     [[nodiscard]] TupleBuffer getVarSizedPage(uint64_t pageIndex) const;
 
     [[nodiscard]] uint64_t getNumberOfPages() const;
+
+    /// The pages and records of a single radix partition. An unpartitioned map has its one partition 0, which is all of it.
+    [[nodiscard]] uint64_t getNumberOfRadixPartitions() const { return header().numberOfRadixPartitions; }
+    [[nodiscard]] uint64_t getNumberOfRecords(uint64_t partition) const;
+    [[nodiscard]] uint64_t getNumberOfPages(uint64_t partition) const;
+    [[nodiscard]] TupleBuffer getPage(uint64_t partition, uint64_t pageIndex) const;
+
     [[nodiscard]] uint64_t getNumberOfVarSizedPages() const;
 
     [[nodiscard]] ChildBufferIndex getStorageBufferIdx() const;
@@ -130,11 +196,16 @@ public:
     /// query-compile-time constant and folds into an immediate in the traced probe path.
     [[nodiscard]] ChainedHashMapEntry* getChain(uint64_t pos);
 
+    /// The chain head for a hash in a growable map, whose mask is only known at runtime. While a growth is pending,
+    /// a hash whose old chain has not been migrated yet still lives in that old chain.
+    [[nodiscard]] ChainedHashMapEntry* getChainForHash(HashFunction::HashValue::raw_type hash);
+
     /// Pointer to the in-map BloomFilter bit area, consulted by ChainedHashMapRef::findChain to short-circuit
-    /// chain traversal. The area lives inline in this buffer right behind the chains array and is zeroed by
-    /// init(), so it is valid from construction on. Raw pointer rather than the span below, because the sole
-    /// caller is a traced invoke proxy. Requires a non-zero bloomBytes: a disabled filter has no area.
-    [[nodiscard]] uint64_t* getBloomFilterMemArea(uint64_t numberOfChains, uint64_t bloomBytes);
+    /// chain traversal. The area lives inline in this buffer right behind the chains array, whose size in bytes
+    /// calculateChainsArraySize() yields, and is zeroed by init(), so it is valid from construction on. Raw pointer
+    /// rather than the span below, because the sole caller is a traced invoke proxy. Requires a non-zero bloomBytes:
+    /// a disabled filter has no area.
+    [[nodiscard]] uint64_t* getBloomFilterMemArea(uint64_t chainsArraySize, uint64_t bloomBytes);
 
     /// @warning Be super careful with this. Sometimes you need a pointer to the TupleBuffer but you should never alter it outside of this
     /// view and without using its access methods
@@ -144,30 +215,100 @@ public:
     static constexpr auto VALID_CHM = 82543427462775423;
     static constexpr auto FIXED_STORAGE_SPACE_BUFFER_SIZE = 4;
     static constexpr auto VARSIZED_STORAGE_SPACE_BUFFER_SIZE = 4;
+    /// Chains a growable map migrates into its new chains array per insert. Growing from N to 2N chains is only
+    /// triggered after N * maxLoadFactor records, so a migration finishes long before the next one is due.
+    static constexpr uint64_t CHAINS_MIGRATED_PER_INSERT = 8;
+    /// Control bytes compared at once by the SWISS index, one SSE2 register.
+    static constexpr uint64_t SWISS_GROUP_WIDTH = 16;
+    /// Marks a free SWISS slot. A used slot holds the top 7 bits of its hash, so its high bit is never set.
+    static constexpr uint8_t SWISS_EMPTY = 0x80;
 
 protected:
     void appendPage(AbstractBufferProvider* bufferProvider, uint64_t pageSize);
+    [[nodiscard]] static TupleBuffer allocatePage(AbstractBufferProvider* bufferProvider, uint64_t pageSize);
     void allocateNewVarSizedPage(AbstractBufferProvider* bufferProvider, size_t neededSize);
 
+    /// Places a new, unlinked entry on the last storage page, appending a page if the last one is full.
+    ChainedHashMapEntry* allocateEntry(
+        HashFunction::HashValue::raw_type hash,
+        AbstractBufferProvider* bufferProvider,
+        uint64_t entrySize,
+        uint64_t entriesPerPage,
+        uint64_t pageSize);
+
+    /// allocateEntry() for a map with several radix partitions. The storage buffer then holds one buffer per partition,
+    /// which holds that partition's pages and counts its records in its number of tuples.
+    ChainedHashMapEntry* allocatePartitionedEntry(
+        HashFunction::HashValue::raw_type hash,
+        AbstractBufferProvider* bufferProvider,
+        uint64_t entrySize,
+        uint64_t entriesPerPage,
+        uint64_t pageSize);
+
+    /// The buffer holding the pages of one partition of a partitioned map. The map must have stored an entry already.
+    [[nodiscard]] TupleBuffer loadPartitionStorage(uint64_t partition) const;
+
+    /// Doubles the chains array of a growable map and marks all old chains as pending migration.
+    void grow(AbstractBufferProvider* bufferProvider);
+
+    /// Moves up to numberOfChainsToMigrate pending old chains into the current chains array.
+    void migrateChains(uint64_t numberOfChainsToMigrate);
+
+    /// The chain slot a hash belongs to right now, taking a pending migration into account.
+    [[nodiscard]] ChainedHashMapEntry*& chainForHash(HashFunction::HashValue::raw_type hash);
+
+    /// Replaces the SWISS index by an empty one with newCapacity slots and re-inserts every entry from the storage pages.
+    /// The new index takes over the child buffer slot of the old one, which is released right away.
+    void rebuildSwissIndex(AbstractBufferProvider* bufferProvider, uint64_t newCapacity, uint64_t entrySize);
+
+    /// Claims the first empty slot along the probe sequence of the entry's hash. The index must have one left.
+    void placeInSwissIndex(ChainedHashMapEntry* entry);
+
 private:
     /// private constructor that takes a pre-filled buffer
     explicit ChainedHashMap(TupleBuffer buffer) : buffer(std::move(buffer)) { }
 
     friend class ChainedHashMapRef;
 
-    /// Header structure stored at the beginning of the buffer. It holds only state that genuinely changes
-    /// while the query runs — all sizing lives in the ChainedHashMapConfig the caller passes in.
+    /// Header structure stored at the beginning of the buffer. Besides the counters and child buffer indexes that change
+    /// while the query runs, it stores the sizing that init() derives from the ChainedHashMapConfig and that the map
+    /// needs without a config at hand: the current numberOfChains, which doubles with every growth, the
+    /// swissInitialCapacity of the first SWISS index, and the numberOfRadixPartitions the storage pages are split into.
+    /// Entry and page sizes and the BloomFilter size are not stored, as every caller passes the config in.
     ///
-    /// The chains array starts immediately after this header, followed by the BloomFilter bit area. Both are
-    /// sized from the config, so nothing about them is stored here. Conceptually:
-    /// ChainedHashMapEntry* chains[numberOfChains + 1];
+    /// The inline chains array starts immediately after this header, followed by the BloomFilter bit area. Conceptually:
+    /// ChainedHashMapEntry* chains[numberOfChains + 1]; /// absent for a SWISS map
     /// uint64_t bloomBits[bloomFilterMemAreaSize / sizeof(uint64_t)];
+    ///
+    /// The chains pointer refers to the inline array only until the first growth. Each growth allocates a twice as large
+    /// chains array as a child buffer of this map and redirects chains to it, while oldChains keeps the previous array
+    /// until its chains are migrated. The inline array stays where it is, so the BloomFilter bit area keeps its
+    /// config-derived offset. Superseded arrays are only released with the map, which costs at most as much again as
+    /// the current array.
     struct Header
     {
         uint64_t status = VALID_CHM;
         uint64_t numRecords = 0;
         ChildBufferIndex storageSpaceIndex = TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE;
         ChildBufferIndex varSizedSpaceIndex = TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE;
+        /// The chains array lookups and inserts go to. Points at the inline array until the first growth.
+        ChainedHashMapEntry** chains = nullptr;
+        uint64_t numberOfChains = 0;
+        /// The previous chains array during an incremental growth, nullptr otherwise. Its chains below
+        /// migratedChains have already been split into chains.
+        ChainedHashMapEntry** oldChains = nullptr;
+        uint64_t oldNumberOfChains = 0;
+        uint64_t migratedChains = 0;
+        /// The SWISS index, a child buffer of swissCapacity control bytes followed by as many entry pointers.
+        /// Both are nullptr/0 for a CHAINED map and for a SWISS map that saw no insert yet. Every rebuild stores its
+        /// index at swissIndexBufferIdx, so a superseded index is released as soon as it is replaced.
+        uint8_t* swissControl = nullptr;
+        ChainedHashMapEntry** swissSlots = nullptr;
+        uint64_t swissCapacity = 0;
+        /// Slots of the first SWISS index, derived from numberOfBuckets by init().
+        uint64_t swissInitialCapacity = 0;
+        ChildBufferIndex swissIndexBufferIdx = TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE;
+        uint64_t numberOfRadixPartitions = 1;
     };
 
     static_assert(std::is_trivially_destructible_v<Header>, "Header must be trivially destructible");
@@ -191,12 +332,12 @@ private:
     /// The in-map BloomFilter bit area, sitting inline right behind the chains array. Empty when the filter is
     /// disabled, where data() is one past the end of the buffer — hence a span, which a caller cannot walk off.
     /// allocationByteCount() rounds to whole words, so the area is always word-aligned in size.
-    [[nodiscard]] std::span<uint64_t> bloomBits(const uint64_t numberOfChains, const uint64_t bloomBytes)
+    [[nodiscard]] std::span<uint64_t> bloomBits(const uint64_t chainsArraySize, const uint64_t bloomBytes)
     {
         auto* data = buffer.getAvailableMemoryArea<uint8_t>().data();
 
         /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        auto* bits = reinterpret_cast<uint64_t*>(data + sizeof(Header) + ((numberOfChains + 1) * sizeof(ChainedHashMapEntry*)));
+        auto* bits = reinterpret_cast<uint64_t*>(data + sizeof(Header) + chainsArraySize);
         return {bits, bloomBytes / sizeof(uint64_t)};
     }
 
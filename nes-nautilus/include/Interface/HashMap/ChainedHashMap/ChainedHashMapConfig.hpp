@@ -21,6 +21,7 @@
 #include <Interface/Hash/BloomFilterRef.hpp>
 #include <Interface/Hash/HashFunction.hpp>
 #include <Interface/HashMap/ChainedHashMap/FieldOffsets.hpp>
+#include <Util/HashMapIndex.hpp>
 
 namespace NES
 {
@@ -44,6 +45,17 @@ struct ChainedHashMapConfig
     uint64_t entrySize = 0;
     uint64_t numberOfBuckets = 0;
     uint64_t pageSize = 0;
+    /// Records per chain above which the map doubles its chains array, migrating the old chains a few at a
+    /// time on the following inserts. Empty keeps the chain count fixed at what numberOfBuckets yields, so
+    /// numberOfBuckets then has to be sized for the expected cardinality upfront.
+    std::optional<double> maxLoadFactor;
+    /// How lookups find the entries of a hash. The SWISS index sizes itself at runtime and ignores maxLoadFactor,
+    /// as an open-addressing table has to grow before it fills up anyway.
+    HashMapIndex index = HashMapIndex::CHAINED;
+    /// Power of two. With more than one, the entries are stored on separate pages per partition of the top hash bits, so
+    /// the entries of one partition can be iterated on their own, e.g. to merge the partitions of several maps in parallel.
+    /// Lookups are unaffected: the chains or the SWISS index still span all partitions.
+    uint64_t numberOfRadixPartitions = 1;
     /// Empty when this map runs without an in-map BloomFilter.
     std::optional<Nautilus::Interface::BloomFilterParams> bloomFilterParams;
     std::vector<FieldOffsets> fieldKeys;
@@ -55,6 +67,11 @@ struct ChainedHashMapConfig
     /// derivations that need nothing but this struct stay here.
     [[nodiscard]] uint64_t entriesPerPage() const { return pageSize / entrySize; }
 
+    /// A growable map cannot fold its mask into the traced code, as the chain count changes at runtime.
+    [[nodiscard]] bool isGrowable() const { return index == HashMapIndex::CHAINED and maxLoadFactor.has_value(); }
+
+    [[nodiscard]] bool usesSwissIndex() const { return index == HashMapIndex::SWISS; }
+
     /// Bytes reserved inline for the BloomFilter bit area. 0 when the filter is disabled.
     [[nodiscard]] uint64_t bloomFilterMemAreaSize() const { return bloomFilterParams ? bloomFilterParams->allocationByteCount() : 0; }
 };
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <vector>
 #include <DataTypes/VarVal.hpp>
@@ -92,7 +93,8 @@ public:
             const nautilus::val<uint64_t>& indexOnPage,
             const nautilus::val<uint64_t>& numberOfTuplesInCurrentPage,
             const nautilus::val<uint64_t>& pageIndex,
-            const nautilus::val<uint64_t>& numberOfPages);
+            const nautilus::val<uint64_t>& numberOfPages,
+            const nautilus::val<uint64_t>& partition);
 
         struct DynamicArgsWrapper
         {
@@ -114,8 +116,13 @@ public:
         nautilus::val<uint64_t> numberOfTuplesInCurrentPage;
         nautilus::val<uint64_t> pageIndex;
         nautilus::val<uint64_t> numberOfPages;
+        /// The radix partition whose pages are iterated, or ALL_PARTITIONS.
+        nautilus::val<uint64_t> partition;
     };
 
+    /// Iterating over ALL_PARTITIONS visits every entry, whether the map is partitioned or not.
+    static constexpr uint64_t ALL_PARTITIONS = std::numeric_limits<uint64_t>::max();
+
     /// The config must be the one the underlying map was init()ed with — nothing can verify that any more,
     /// since the map no longer carries its sizing.
     ChainedHashMapRef(const nautilus::val<TupleBuffer*>& buffer, ChainedHashMapConfig config);
@@ -135,6 +142,9 @@ public:
     nautilus::val<AbstractHashMapEntry*> findEntry(const nautilus::val<AbstractHashMapEntry*>& otherEntry) override;
     [[nodiscard]] EntryIterator begin() const;
     [[nodiscard]] EntryIterator end() const;
+    /// Iterates the entries of one radix partition only, see ChainedHashMapConfig::numberOfRadixPartitions.
+    [[nodiscard]] EntryIterator beginPartition(const nautilus::val<uint64_t>& partition) const;
+    [[nodiscard]] EntryIterator endPartition(const nautilus::val<uint64_t>& partition) const;
 
 private:
     /// Finds the chain for the given hash value. If no chain exists, it returns nullptr.
@@ -143,6 +153,8 @@ private:
     insert(const HashFunction::HashValue& hash, const nautilus::val<AbstractBufferProvider*>& bufferProvider);
     [[nodiscard]] nautilus::val<bool> compareKeys(const ChainedEntryRef& entryRef, const Record& keys) const;
     [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findKey(const Record& recordKey, const HashFunction::HashValue& hash) const;
+    /// findKey() for a map with a SWISS index: walks the entries whose control byte matches the hash instead of a chain.
+    [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findKeySwiss(const Record& recordKey, const HashFunction::HashValue& hash) const;
     [[nodiscard]] nautilus::val<ChainedHashMapEntry*> findEntry(const ChainedEntryRef& otherEntryRef) const;
 
     /// Plain host data, not nautilus::val: every option is fixed at query-compilation time, so each use of it
@@ -40,33 +40,38 @@ std::span<std::byte> Arena::allocateMemory(const size_t sizeInBytes)
             throw CannotAllocateBuffer("Cannot allocate unpooled buffer of size " + std::to_string(sizeInBytes));
         }
         unpooledBuffers.emplace_back(unpooledBufferOpt.value());
-        lastAllocationSize = sizeInBytes;
         return unpooledBuffers.back().getAvailableMemoryArea().subspan(0, sizeInBytes);
     }
 
-    if (fixedSizeBuffers.empty())
-    {
-        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
-        lastAllocationSize = bufferProvider->getBufferSize();
-        currentOffset += sizeInBytes;
-        return fixedSizeBuffers.back().getAvailableMemoryArea().subspan(0, sizeInBytes);
-    }
-
     /// Case 2
-    if (lastAllocationSize < currentOffset + sizeInBytes)
+    if (usedFixedSizeBuffers == 0 or fixedSizeBuffers[usedFixedSizeBuffers - 1].getBufferSize() < currentOffset + sizeInBytes)
     {
-        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
-        this->currentOffset = 0;
+        if (usedFixedSizeBuffers == fixedSizeBuffers.size())
+        {
+            fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
+        }
+        ++usedFixedSizeBuffers;
+        currentOffset = 0;
     }
 
     /// Case 3
-    auto& lastBuffer = fixedSizeBuffers.back();
-    lastAllocationSize = lastBuffer.getBufferSize();
-    const auto result = lastBuffer.getAvailableMemoryArea().subspan(currentOffset, sizeInBytes);
+    auto& currentBuffer = fixedSizeBuffers[usedFixedSizeBuffers - 1];
+    const auto result = currentBuffer.getAvailableMemoryArea().subspan(currentOffset, sizeInBytes);
     currentOffset += sizeInBytes;
     return result;
 }
 
+void Arena::reset()
+{
+    unpooledBuffers.clear();
+    if (fixedSizeBuffers.size() > maxRetainedBuffers)
+    {
+        fixedSizeBuffers.erase(fixedSizeBuffers.begin() + static_cast<std::ptrdiff_t>(maxRetainedBuffers), fixedSizeBuffers.end());
+    }
+    usedFixedSizeBuffers = 0;
+    currentOffset = 0;
+}
+
 nautilus::val<int8_t*> ArenaRef::allocateMemory(const nautilus::val<size_t>& sizeInBytes) const
 {
     /// If the available space for the pointer is smaller than the required size, we allocate a new buffer from the arena.
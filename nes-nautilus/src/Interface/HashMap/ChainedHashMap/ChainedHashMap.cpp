@@ -30,11 +30,50 @@
 #include <Interface/HashMap/HashMap.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <ErrorHandling.hpp>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 namespace NES
 {
 
+namespace
+{
+/// Bitmask of the slots in the SWISS group starting at control whose control byte equals byte, bit i for slot i.
+uint32_t matchSwissGroup(const uint8_t* control, const uint8_t byte)
+{
+#if defined(__SSE2__)
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(byte)))));
+#else
+    uint32_t matches = 0;
+    for (uint64_t slot = 0; slot < ChainedHashMap::SWISS_GROUP_WIDTH; ++slot)
+    {
+        matches |= static_cast<uint32_t>(control[slot] == byte) << slot; /// NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return matches;
+#endif
+}
+
+/// The top 7 bits of the hash go into the control byte, the bits above the lowest 7 pick the first group to probe.
+/// Taking them from disjoint bits keeps the entries that share a group from also sharing their tag.
+uint8_t swissTag(const HashFunction::HashValue::raw_type hash)
+{
+    return static_cast<uint8_t>(hash >> 57U);
+}
+
+/// Triangular probing: the n-th probe lands n * (n + 1) / 2 groups after the first one, which visits every group of a
+/// power-of-two sized index exactly once.
+uint64_t swissGroup(const HashFunction::HashValue::raw_type hash, const uint64_t probe, const uint64_t groupMask)
+{
+    return ((hash >> 7U) + ((probe * (probe + 1)) / 2)) & groupMask;
+}
+}
+
 /// Taken from https://github.com/TimoKersten/db-engine-paradigms/blob/ae3286b279ad26ab294224d630d650bc2f2f3519/include/common/runtime/Hashmap.hpp#L193
 /// Calculates the capacity of the hash map for the expected number of keys
 /// This method assures that the capacity is a power of 2 that is greater or equal to the number of keys
@@ -66,9 +105,32 @@ uint64_t ChainedHashMap::calculateMask(const uint64_t numberOfBuckets)
     return calculateNumberOfChains(numberOfBuckets) - 1;
 }
 
-uint64_t ChainedHashMap::calculateBufferSize(const uint64_t numberOfBuckets, const uint64_t bloomBytes)
+uint64_t ChainedHashMap::calculateChainsArraySize(const uint64_t numberOfBuckets, const HashMapIndex index)
 {
-    return sizeof(Header) + ((calculateNumberOfChains(numberOfBuckets) + 1) * sizeof(ChainedHashMapEntry*)) + bloomBytes;
+    if (index == HashMapIndex::SWISS)
+    {
+        return 0;
+    }
+    return (calculateNumberOfChains(numberOfBuckets) + 1) * sizeof(ChainedHashMapEntry*);
+}
+
+uint64_t ChainedHashMap::calculateBufferSize(const uint64_t numberOfBuckets, const uint64_t bloomBytes, const HashMapIndex index)
+{
+    return sizeof(Header) + calculateChainsArraySize(numberOfBuckets, index) + bloomBytes;
+}
+
+uint64_t ChainedHashMap::calculateBufferSize(const ChainedHashMapConfig& config)
+{
+    return calculateBufferSize(config.numberOfBuckets, config.bloomFilterMemAreaSize(), config.index);
+}
+
+uint64_t ChainedHashMap::calculateRadixPartition(const HashFunction::HashValue::raw_type hash, const uint64_t numberOfRadixPartitions)
+{
+    if (numberOfRadixPartitions <= 1)
+    {
+        return 0;
+    }
+    return hash >> static_cast<uint64_t>(std::countl_zero(numberOfRadixPartitions) + 1);
 }
 
 void ChainedHashMap::init(TupleBuffer& tupleBuffer, const ChainedHashMapConfig& config)
@@ -76,13 +138,17 @@ void ChainedHashMap::init(TupleBuffer& tupleBuffer, const ChainedHashMapConfig&
     init(
         tupleBuffer IF_PRECONDITION(, config.entrySize),
         config.numberOfBuckets IF_PRECONDITION(, config.pageSize),
-        config.bloomFilterMemAreaSize());
+        config.bloomFilterMemAreaSize(),
+        config.numberOfRadixPartitions,
+        config.index);
 }
 
 void ChainedHashMap::init(
     TupleBuffer& tupleBuffer IF_PRECONDITION(, const uint64_t entrySize),
     const uint64_t numberOfBuckets IF_PRECONDITION(, const uint64_t pageSize),
-    const uint64_t bloomBytes)
+    const uint64_t bloomBytes,
+    const uint64_t numberOfRadixPartitions,
+    const HashMapIndex index)
 {
     PRECONDITION(entrySize > 0, "Entry size has to be greater than 0. Entry size is set to small for entry size {}", entrySize);
     const uint64_t numberOfChains = calculateNumberOfChains(numberOfBuckets);
@@ -100,30 +166,43 @@ void ChainedHashMap::init(
         "Number of chains has to be a power of 2. Number of chains is set to small for number of chains {}",
         numberOfChains);
     PRECONDITION(
-        tupleBuffer.getBufferSize() >= calculateBufferSize(numberOfBuckets, bloomBytes),
-        "Buffer of size {} is not big enough to hold the header ({} bytes) plus {} chain pointers ({} bytes each) plus {} bytes of "
+        numberOfRadixPartitions > 0 and (numberOfRadixPartitions & (numberOfRadixPartitions - 1)) == 0,
+        "Number of radix partitions has to be a power of 2, got {}",
+        numberOfRadixPartitions);
+    PRECONDITION(
+        tupleBuffer.getBufferSize() >= calculateBufferSize(numberOfBuckets, bloomBytes, index),
+        "Buffer of size {} is not big enough to hold the header ({} bytes) plus {} bytes of chain pointers plus {} bytes of "
         "BloomFilter bits",
         tupleBuffer.getBufferSize(),
         sizeof(Header),
-        numberOfChains + 1,
-        sizeof(ChainedHashMapEntry*),
+        calculateChainsArraySize(numberOfBuckets, index),
         bloomBytes);
 
     /// Create object
     ChainedHashMap chm{tupleBuffer};
 
     /// Initialize header
-    new (tupleBuffer.getAvailableMemoryArea<Header>().data()) Header{};
+    auto* mapHeader = new (tupleBuffer.getAvailableMemoryArea<Header>().data()) Header{};
+    mapHeader->numberOfRadixPartitions = numberOfRadixPartitions;
 
-    /// Initialize chains array
-    auto* chainsArray = chm.chainsBegin();
-    std::fill_n(chainsArray, numberOfChains, nullptr);
-    chainsArray[numberOfChains]
-        = reinterpret_cast<ChainedHashMapEntry*>(&chainsArray[numberOfChains]); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    /// Initialize chains array. A SWISS map has none and sizes its first index from the chain count instead.
+    if (index == HashMapIndex::SWISS)
+    {
+        mapHeader->swissInitialCapacity = std::max(SWISS_GROUP_WIDTH, numberOfChains);
+    }
+    else
+    {
+        auto* chainsArray = chm.chainsBegin();
+        mapHeader->chains = chainsArray;
+        mapHeader->numberOfChains = numberOfChains;
+        std::fill_n(chainsArray, numberOfChains, nullptr);
+        chainsArray[numberOfChains]
+            = reinterpret_cast<ChainedHashMapEntry*>(&chainsArray[numberOfChains]); /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
 
     /// Zero the inline BloomFilter bit area so no spurious bits are seen before the first add().
     /// A disabled filter yields an empty span, making this a no-op rather than a write past the buffer.
-    std::ranges::fill(chm.bloomBits(numberOfChains, bloomBytes), uint64_t{0});
+    std::ranges::fill(chm.bloomBits(calculateChainsArraySize(numberOfBuckets, index), bloomBytes), uint64_t{0});
 }
 
 ChainedHashMap ChainedHashMap::load(const TupleBuffer& tupleBuffer)
@@ -209,26 +288,24 @@ std::span<std::byte> ChainedHashMap::allocateSpaceForVarSized(AbstractBufferProv
     return lastPage.getAvailableMemoryArea().subspan(allocationOffset);
 }
 
-void ChainedHashMap::appendPage(AbstractBufferProvider* bufferProvider, const uint64_t pageSize)
+TupleBuffer ChainedHashMap::allocatePage(AbstractBufferProvider* bufferProvider, const uint64_t pageSize)
 {
-    /// create and initialize new page
-    TupleBuffer newPage;
     if (bufferProvider->getBufferSize() == pageSize)
     {
-        newPage = bufferProvider->getBufferBlocking();
+        return bufferProvider->getBufferBlocking();
     }
-    else
+    if (auto newPageUnpooled = bufferProvider->getUnpooledBuffer(pageSize))
     {
-        if (auto newPageUnpooled = bufferProvider->getUnpooledBuffer(pageSize))
-        {
-            newPage = newPageUnpooled.value();
-        }
-        else
-        {
-            throw CannotAllocateBuffer(
-                "Could not allocate memory for unpooled storage space page of ChainedHashMap of size {}", std::to_string(pageSize));
-        }
+        return newPageUnpooled.value();
     }
+    throw CannotAllocateBuffer(
+        "Could not allocate memory for unpooled storage space page of ChainedHashMap of size {}", std::to_string(pageSize));
+}
+
+void ChainedHashMap::appendPage(AbstractBufferProvider* bufferProvider, const uint64_t pageSize)
+{
+    /// create and initialize new page
+    const auto newPage = allocatePage(bufferProvider, pageSize);
 
     /// get or create storage buffer
     auto storageBufferIdx = getStorageBufferIdx();
@@ -256,19 +333,22 @@ void ChainedHashMap::appendPage(AbstractBufferProvider* bufferProvider, const ui
     }
 }
 
-AbstractHashMapEntry* ChainedHashMap::insertEntry(
+ChainedHashMapEntry* ChainedHashMap::allocateEntry(
     const HashFunction::HashValue::raw_type hash,
     AbstractBufferProvider* bufferProvider,
     const uint64_t entrySize,
     const uint64_t entriesPerPage,
-    const uint64_t pageSize,
-    const uint64_t mask)
+    const uint64_t pageSize)
 {
     PRECONDITION(
         entrySize > 0 and entriesPerPage > 0,
         "Malformed ChainedHashMap sizing with entry size {} and entries per page {}",
         entrySize,
         entriesPerPage);
+    if (header().numberOfRadixPartitions > 1)
+    {
+        return allocatePartitionedEntry(hash, bufferProvider, entrySize, entriesPerPage, pageSize);
+    }
 
     /// 1. Check if we need to allocate a new page
     if (getTotalNumberOfRecords() % entriesPerPage == 0)
@@ -287,30 +367,311 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(
     auto currPage = getPage(pageIndex);
     currPage.setNumberOfTuples(currPage.getNumberOfTuples() + 1);
     const auto entryOffsetInBuffer = (getTotalNumberOfRecords() - (pageIndex * entriesPerPage)) * entrySize;
+    return new (currPage.getAvailableMemoryArea().subspan(entryOffsetInBuffer).data()) ChainedHashMapEntry(hash);
+}
+
+ChainedHashMapEntry* ChainedHashMap::allocatePartitionedEntry(
+    const HashFunction::HashValue::raw_type hash,
+    AbstractBufferProvider* bufferProvider,
+    const uint64_t entrySize,
+    const uint64_t entriesPerPage,
+    const uint64_t pageSize)
+{
+    /// All partition buffers are created together, so that partition i is always child i of the storage buffer.
+    const auto numberOfRadixPartitions = header().numberOfRadixPartitions;
+    if (getStorageBufferIdx() == TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
+    {
+        auto newStorageBuffer = bufferProvider->getUnpooledBuffer(FIXED_STORAGE_SPACE_BUFFER_SIZE);
+        if (not newStorageBuffer)
+        {
+            throw CannotAllocateBuffer(
+                "Could not allocate memory for storage space of ChainedHashMap of size {}",
+                std::to_string(FIXED_STORAGE_SPACE_BUFFER_SIZE));
+        }
+        auto storageBuffer = std::move(newStorageBuffer.value());
+        for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
+        {
+            auto newPartitionBuffer = bufferProvider->getUnpooledBuffer(FIXED_STORAGE_SPACE_BUFFER_SIZE);
+            if (not newPartitionBuffer)
+            {
+                throw CannotAllocateBuffer(
+                    "Could not allocate memory for radix partition {} of ChainedHashMap of size {}",
+                    partition,
+                    std::to_string(FIXED_STORAGE_SPACE_BUFFER_SIZE));
+            }
+            newPartitionBuffer->setNumberOfTuples(0);
+            std::ignore = storageBuffer.storeChildBuffer(newPartitionBuffer.value());
+        }
+        header().storageSpaceIndex = buffer.storeChildBuffer(storageBuffer);
+    }
+
+    auto partitionStorage = loadPartitionStorage(calculateRadixPartition(hash, numberOfRadixPartitions));
+    const auto recordsInPartition = partitionStorage.getNumberOfTuples();
+    if (recordsInPartition % entriesPerPage == 0)
+    {
+        auto newPage = allocatePage(bufferProvider, pageSize);
+        std::ignore = partitionStorage.storeChildBuffer(newPage);
+    }
+    auto currPage = partitionStorage.loadChildBuffer(ChildBufferIndex{static_cast<uint32_t>(recordsInPartition / entriesPerPage)});
+    currPage.setNumberOfTuples(currPage.getNumberOfTuples() + 1);
+    partitionStorage.setNumberOfTuples(recordsInPartition + 1);
+    const auto entryOffsetInBuffer = (recordsInPartition % entriesPerPage) * entrySize;
+    return new (currPage.getAvailableMemoryArea().subspan(entryOffsetInBuffer).data()) ChainedHashMapEntry(hash);
+}
+
+TupleBuffer ChainedHashMap::loadPartitionStorage(const uint64_t partition) const
+{
+    const auto storageBufferIdx = getStorageBufferIdx();
+    PRECONDITION(storageBufferIdx != TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE, "Storage space not initialized");
+    PRECONDITION(
+        partition < header().numberOfRadixPartitions,
+        "Radix partition {} out of range for {} partitions",
+        partition,
+        header().numberOfRadixPartitions);
+    return buffer.loadChildBuffer(storageBufferIdx).loadChildBuffer(ChildBufferIndex{static_cast<uint32_t>(partition)});
+}
+
+AbstractHashMapEntry* ChainedHashMap::insertEntry(
+    const HashFunction::HashValue::raw_type hash,
+    AbstractBufferProvider* bufferProvider,
+    const uint64_t entrySize,
+    const uint64_t entriesPerPage,
+    const uint64_t pageSize,
+    const uint64_t mask)
+{
+    auto* const newEntry = allocateEntry(hash, bufferProvider, entrySize, entriesPerPage, pageSize);
 
     /// 3. Inserting the new entry
     const auto entryPos = hash & mask;
     INVARIANT(entryPos <= mask, "Invalid entry position, as pos {} is greater than mask {}", entryPos, mask);
 
-    auto* chainsArray = chainsBegin();
-    auto* const newEntry = new (currPage.getAvailableMemoryArea().subspan(entryOffsetInBuffer).data()) ChainedHashMapEntry(hash);
-
     /// 4. Updating the chain and the current size
-    auto& chainPtr = chainsArray[entryPos];
-    if (chainPtr == nullptr)
+    auto& chainPtr = chainsBegin()[entryPos]; /// NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    newEntry->next = chainPtr;
+    chainPtr = newEntry;
+    header().numRecords++;
+
+    return newEntry;
+}
+
+AbstractHashMapEntry* ChainedHashMap::insertEntryGrowable(
+    const HashFunction::HashValue::raw_type hash,
+    AbstractBufferProvider* bufferProvider,
+    const uint64_t entrySize,
+    const uint64_t entriesPerPage,
+    const uint64_t pageSize,
+    const double maxLoadFactor)
+{
+    PRECONDITION(maxLoadFactor > 0, "A growable ChainedHashMap needs a positive maximum load factor, got {}", maxLoadFactor);
+    auto* const newEntry = allocateEntry(hash, bufferProvider, entrySize, entriesPerPage, pageSize);
+
+    /// The entry goes to the chain a lookup for its hash would walk, which is the old chain as long as that is not migrated yet.
+    /// It then moves along with the rest of that chain.
+    auto& chainPtr = chainForHash(hash);
+    newEntry->next = chainPtr;
+    chainPtr = newEntry;
+    auto& mapHeader = header();
+    mapHeader.numRecords++;
+
+    /// A pending growth always finishes before the next one starts, so at most two chains arrays are ever live.
+    if (mapHeader.oldChains != nullptr)
     {
-        chainPtr = newEntry;
+        migrateChains(CHAINS_MIGRATED_PER_INSERT);
     }
-    else
+    else if (static_cast<double>(mapHeader.numRecords) > maxLoadFactor * static_cast<double>(mapHeader.numberOfChains))
     {
-        newEntry->next = chainPtr;
-        chainPtr = newEntry;
+        grow(bufferProvider);
     }
-    header().numRecords++;
+    return newEntry;
+}
+
+void ChainedHashMap::grow(AbstractBufferProvider* bufferProvider)
+{
+    auto& mapHeader = header();
+    INVARIANT(mapHeader.oldChains == nullptr, "Cannot grow a ChainedHashMap while a previous growth is still pending");
+    const uint64_t newNumberOfChains = mapHeader.numberOfChains << 1UL;
+    INVARIANT(newNumberOfChains > mapHeader.numberOfChains, "ChainedHashMap cannot grow beyond {} chains", mapHeader.numberOfChains);
+
+    const auto newChainsSize = newNumberOfChains * sizeof(ChainedHashMapEntry*);
+    auto newChainsBuffer = bufferProvider->getUnpooledBuffer(newChainsSize);
+    if (not newChainsBuffer)
+    {
+        throw CannotAllocateBuffer(
+            "Could not allocate memory for grown chains array of ChainedHashMap of size {}", std::to_string(newChainsSize));
+    }
+    auto* newChains = newChainsBuffer->getAvailableMemoryArea<ChainedHashMapEntry*>().data();
+    std::fill_n(newChains, newNumberOfChains, nullptr);
+    /// Stored as a child so the array lives as long as the map. The header keeps the raw address, as the entries' next pointers do.
+    std::ignore = buffer.storeChildBuffer(newChainsBuffer.value());
+
+    mapHeader.oldChains = mapHeader.chains;
+    mapHeader.oldNumberOfChains = mapHeader.numberOfChains;
+    mapHeader.migratedChains = 0;
+    mapHeader.chains = newChains;
+    mapHeader.numberOfChains = newNumberOfChains;
+}
+
+void ChainedHashMap::migrateChains(const uint64_t numberOfChainsToMigrate)
+{
+    auto& mapHeader = header();
+    const auto newMask = mapHeader.numberOfChains - 1;
+    const auto lastChain = std::min(mapHeader.migratedChains + numberOfChainsToMigrate, mapHeader.oldNumberOfChains);
+
+    /// Doubling splits old chain i into new chains i and i + oldNumberOfChains. Relinking reverses the order within a chain,
+    /// which does not matter, as keys are unique.
+    /// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; mapHeader.migratedChains < lastChain; ++mapHeader.migratedChains)
+    {
+        auto* entry = mapHeader.oldChains[mapHeader.migratedChains];
+        while (entry != nullptr)
+        {
+            auto* next = entry->next;
+            auto& newChain = mapHeader.chains[entry->hash & newMask];
+            entry->next = newChain;
+            newChain = entry;
+            entry = next;
+        }
+        mapHeader.oldChains[mapHeader.migratedChains] = nullptr;
+    }
+    /// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
+    if (mapHeader.migratedChains == mapHeader.oldNumberOfChains)
+    {
+        mapHeader.oldChains = nullptr;
+        mapHeader.oldNumberOfChains = 0;
+        mapHeader.migratedChains = 0;
+    }
+}
+
+AbstractHashMapEntry* ChainedHashMap::insertEntrySwiss(
+    const HashFunction::HashValue::raw_type hash,
+    AbstractBufferProvider* bufferProvider,
+    const uint64_t entrySize,
+    const uint64_t entriesPerPage,
+    const uint64_t pageSize)
+{
+    /// Doubling at 7/8 keeps an empty slot in most groups, so a lookup for an absent key usually stops at its first group.
+    auto& mapHeader = header();
+    if ((mapHeader.numRecords + 1) * 8 > mapHeader.swissCapacity * 7)
+    {
+        const auto newCapacity = mapHeader.swissCapacity == 0 ? mapHeader.swissInitialCapacity : mapHeader.swissCapacity << 1UL;
+        rebuildSwissIndex(bufferProvider, newCapacity, entrySize);
+    }
+
+    auto* const newEntry = allocateEntry(hash, bufferProvider, entrySize, entriesPerPage, pageSize);
+    placeInSwissIndex(newEntry);
+    mapHeader.numRecords++;
     return newEntry;
 }
 
+ChainedHashMapEntry* ChainedHashMap::findNextSwissCandidate(const HashFunction::HashValue::raw_type hash, SwissProbeCursor& cursor)
+{
+    const auto& mapHeader = header();
+    if (mapHeader.swissCapacity == 0)
+    {
+        return nullptr;
+    }
+
+    const auto groupMask = (mapHeader.swissCapacity / SWISS_GROUP_WIDTH) - 1;
+    const auto tag = swissTag(hash);
+    /// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; cursor.probe <= groupMask; ++cursor.probe, cursor.slotInGroup = 0)
+    {
+        const auto groupStart = swissGroup(hash, cursor.probe, groupMask) * SWISS_GROUP_WIDTH;
+        const auto* control = mapHeader.swissControl + groupStart;
+        if (const auto matches = matchSwissGroup(control, tag) & (~0U << cursor.slotInGroup); matches != 0)
+        {
+            const auto slot = static_cast<uint64_t>(std::countr_zero(matches));
+            cursor.slotInGroup = slot + 1;
+            return mapHeader.swissSlots[groupStart + slot];
+        }
+        /// Nothing is ever removed, so an insert only moves on to the next group if this one was full. A free slot here
+        /// means the hash was never placed any further along.
+        if (matchSwissGroup(control, SWISS_EMPTY) != 0)
+        {
+            return nullptr;
+        }
+    }
+    /// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return nullptr;
+}
+
+void ChainedHashMap::rebuildSwissIndex(AbstractBufferProvider* bufferProvider, const uint64_t newCapacity, const uint64_t entrySize)
+{
+    PRECONDITION(
+        newCapacity % SWISS_GROUP_WIDTH == 0 and (newCapacity & (newCapacity - 1)) == 0,
+        "The SWISS index needs a power-of-two capacity of whole groups, got {}",
+        newCapacity);
+    const auto indexSize = newCapacity * (sizeof(uint8_t) + sizeof(ChainedHashMapEntry*));
+    auto newIndexBuffer = bufferProvider->getUnpooledBuffer(indexSize);
+    if (not newIndexBuffer)
+    {
+        throw CannotAllocateBuffer("Could not allocate memory for SWISS index of ChainedHashMap of size {}", std::to_string(indexSize));
+    }
+    auto indexArea = newIndexBuffer->getAvailableMemoryArea<uint8_t>();
+    std::fill_n(indexArea.data(), newCapacity, SWISS_EMPTY);
+
+    /// Nothing but the header points into the index, so the old one can go as soon as the new one takes its place.
+    auto& mapHeader = header();
+    if (mapHeader.swissIndexBufferIdx == TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
+    {
+        mapHeader.swissIndexBufferIdx = buffer.storeChildBuffer(newIndexBuffer.value());
+    }
+    else
+    {
+        buffer.replaceChildBuffer(mapHeader.swissIndexBufferIdx, newIndexBuffer.value());
+    }
+    mapHeader.swissControl = indexArea.data();
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    mapHeader.swissSlots = reinterpret_cast<ChainedHashMapEntry**>(indexArea.subspan(newCapacity).data());
+    mapHeader.swissCapacity = newCapacity;
+
+    /// The entries carry their hash, so the index is rebuilt from the storage pages without touching any key.
+    /// The pages are walked per partition buffer, as getPage(pageIndex) would search the partitions again for every page.
+    const auto storageBufferIdx = getStorageBufferIdx();
+    if (storageBufferIdx == TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
+    {
+        return;
+    }
+    const auto storageBuffer = buffer.loadChildBuffer(storageBufferIdx);
+    for (uint64_t partition = 0; partition < mapHeader.numberOfRadixPartitions; ++partition)
+    {
+        const auto pages = mapHeader.numberOfRadixPartitions > 1
+            ? storageBuffer.loadChildBuffer(ChildBufferIndex{static_cast<uint32_t>(partition)})
+            : storageBuffer;
+        for (uint32_t pageIndex = 0; pageIndex < pages.getNumberOfChildBuffers(); ++pageIndex)
+        {
+            const auto page = pages.loadChildBuffer(ChildBufferIndex{pageIndex});
+            for (uint64_t entryIndex = 0; entryIndex < page.getNumberOfTuples(); ++entryIndex)
+            {
+                placeInSwissIndex(
+                    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                    reinterpret_cast<ChainedHashMapEntry*>(page.getAvailableMemoryArea().subspan(entryIndex * entrySize).data()));
+            }
+        }
+    }
+}
+
+void ChainedHashMap::placeInSwissIndex(ChainedHashMapEntry* entry)
+{
+    auto& mapHeader = header();
+    const auto groupMask = (mapHeader.swissCapacity / SWISS_GROUP_WIDTH) - 1;
+    /// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (uint64_t probe = 0; probe <= groupMask; ++probe)
+    {
+        const auto groupStart = swissGroup(entry->hash, probe, groupMask) * SWISS_GROUP_WIDTH;
+        if (const auto empty = matchSwissGroup(mapHeader.swissControl + groupStart, SWISS_EMPTY); empty != 0)
+        {
+            const auto slot = groupStart + static_cast<uint64_t>(std::countr_zero(empty));
+            mapHeader.swissControl[slot] = swissTag(entry->hash);
+            mapHeader.swissSlots[slot] = entry;
+            return;
+        }
+    }
+    /// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    INVARIANT(false, "SWISS index of capacity {} has no free slot left", mapHeader.swissCapacity);
+}
+
 [[nodiscard]] ChildBufferIndex ChainedHashMap::getStorageBufferIdx() const
 {
     return header().storageSpaceIndex;
@@ -321,14 +682,30 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(
     return header().varSizedSpaceIndex;
 }
 
-uint64_t* ChainedHashMap::getBloomFilterMemArea(const uint64_t numberOfChains, const uint64_t bloomBytes)
+uint64_t* ChainedHashMap::getBloomFilterMemArea(const uint64_t chainsArraySize, const uint64_t bloomBytes)
 {
     PRECONDITION(bloomBytes > 0, "A map without an in-map BloomFilter has no bit area to hand out");
-    return bloomBits(numberOfChains, bloomBytes).data();
+    return bloomBits(chainsArraySize, bloomBytes).data();
 }
 
 TupleBuffer ChainedHashMap::getPage(const uint64_t pageIndex) const
 {
+    /// Across all partitions, the pages are numbered partition by partition.
+    if (header().numberOfRadixPartitions > 1)
+    {
+        auto remainingPages = pageIndex;
+        for (uint64_t partition = 0; partition < header().numberOfRadixPartitions; ++partition)
+        {
+            const auto pagesInPartition = getNumberOfPages(partition);
+            if (remainingPages < pagesInPartition)
+            {
+                return getPage(partition, remainingPages);
+            }
+            remainingPages -= pagesInPartition;
+        }
+        PRECONDITION(false, "Page index {} is greater than the number of pages {}", pageIndex, getNumberOfPages());
+        return {};
+    }
     auto storageBufferIdx = getStorageBufferIdx();
     PRECONDITION(storageBufferIdx != TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE, "Storage space not initialized during getPage()");
     auto storageBuffer = buffer.loadChildBuffer(storageBufferIdx);
@@ -354,6 +731,15 @@ TupleBuffer ChainedHashMap::getVarSizedPage(const uint64_t pageIndex) const
 
 [[nodiscard]] uint64_t ChainedHashMap::getNumberOfPages() const
 {
+    if (header().numberOfRadixPartitions > 1)
+    {
+        uint64_t numberOfPages = 0;
+        for (uint64_t partition = 0; partition < header().numberOfRadixPartitions; ++partition)
+        {
+            numberOfPages += getNumberOfPages(partition);
+        }
+        return numberOfPages;
+    }
     auto storageBufferIdx = getStorageBufferIdx();
     if (storageBufferIdx != TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
     {
@@ -363,6 +749,47 @@ TupleBuffer ChainedHashMap::getVarSizedPage(const uint64_t pageIndex) const
     return 0;
 }
 
+uint64_t ChainedHashMap::getNumberOfRecords(const uint64_t partition) const
+{
+    if (header().numberOfRadixPartitions == 1)
+    {
+        PRECONDITION(partition == 0, "An unpartitioned ChainedHashMap only has partition 0, got {}", partition);
+        return getTotalNumberOfRecords();
+    }
+    if (getStorageBufferIdx() == TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
+    {
+        return 0;
+    }
+    return loadPartitionStorage(partition).getNumberOfTuples();
+}
+
+uint64_t ChainedHashMap::getNumberOfPages(const uint64_t partition) const
+{
+    if (header().numberOfRadixPartitions == 1)
+    {
+        PRECONDITION(partition == 0, "An unpartitioned ChainedHashMap only has partition 0, got {}", partition);
+        return getNumberOfPages();
+    }
+    if (getStorageBufferIdx() == TupleBuffer::INVALID_CHILD_BUFFER_INDEX_VALUE)
+    {
+        return 0;
+    }
+    return loadPartitionStorage(partition).getNumberOfChildBuffers();
+}
+
+TupleBuffer ChainedHashMap::getPage(const uint64_t partition, const uint64_t pageIndex) const
+{
+    if (header().numberOfRadixPartitions == 1)
+    {
+        PRECONDITION(partition == 0, "An unpartitioned ChainedHashMap only has partition 0, got {}", partition);
+        return getPage(pageIndex);
+    }
+    const auto partitionStorage = loadPartitionStorage(partition);
+    const auto numberOfPages = partitionStorage.getNumberOfChildBuffers();
+    PRECONDITION(pageIndex < numberOfPages, "Page index {} is greater than the number of pages {}", pageIndex, numberOfPages);
+    return partitionStorage.loadChildBuffer(ChildBufferIndex{static_cast<uint32_t>(pageIndex)});
+}
+
 [[nodiscard]] uint64_t ChainedHashMap::getNumberOfVarSizedPages() const
 {
     auto varSizedBufferIdx = getVarSizedBufferIdx();
@@ -379,4 +806,24 @@ ChainedHashMapEntry* ChainedHashMap::getChain(const uint64_t pos)
     return chainsBegin()[pos]; /// NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 }
 
+ChainedHashMapEntry* ChainedHashMap::getChainForHash(const HashFunction::HashValue::raw_type hash)
+{
+    return chainForHash(hash);
+}
+
+ChainedHashMapEntry*& ChainedHashMap::chainForHash(const HashFunction::HashValue::raw_type hash)
+{
+    /// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto& mapHeader = header();
+    if (mapHeader.oldChains != nullptr)
+    {
+        if (const auto oldPos = hash & (mapHeader.oldNumberOfChains - 1); oldPos >= mapHeader.migratedChains)
+        {
+            return mapHeader.oldChains[oldPos];
+        }
+    }
+    return mapHeader.chains[hash & (mapHeader.numberOfChains - 1)];
+    /// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
 }
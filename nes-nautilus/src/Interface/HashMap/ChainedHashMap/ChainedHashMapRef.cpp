@@ -43,6 +43,20 @@
 
 namespace NES
 {
+namespace
+{
+/// The page accessors of ChainedHashMap for one partition, or for the whole map with ALL_PARTITIONS.
+uint64_t getNumberOfPagesIn(const ChainedHashMap& chm, const uint64_t partition)
+{
+    return partition == ChainedHashMapRef::ALL_PARTITIONS ? chm.getNumberOfPages() : chm.getNumberOfPages(partition);
+}
+
+TupleBuffer getPageIn(const ChainedHashMap& chm, const uint64_t partition, const uint64_t pageIndex)
+{
+    return partition == ChainedHashMapRef::ALL_PARTITIONS ? chm.getPage(pageIndex) : chm.getPage(partition, pageIndex);
+}
+}
+
 void ChainedHashMapRef::ChainedEntryRef::copyKeysToEntry(
     const Record& keys, const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
 {
@@ -165,6 +179,11 @@ ChainedHashMapRef::ChainedEntryRef::ChainedEntryRef(ChainedEntryRef&& other) noe
 
 nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findKey(const Record& recordKey, const HashFunction::HashValue& hash) const
 {
+    if (config.usesSwissIndex())
+    {
+        return findKeySwiss(recordKey, hash);
+    }
+
     auto entry = findChain(hash);
     while (entry != nullptr)
     {
@@ -178,6 +197,44 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findKey(const Record& rec
     return nullptr;
 }
 
+nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findKeySwiss(const Record& recordKey, const HashFunction::HashValue& hash) const
+{
+    if (bloomFilter and not bloomFilter->mightContain(hash))
+    {
+        return nullptr;
+    }
+
+    /// The cursor lives on the stack of the compiled code, so walking the candidates of one hash needs no state in the map.
+    /// Each call hands out the next slot whose control byte matches, and the keys are compared out here in traced code.
+    nautilus::val<ChainedHashMap::SwissProbeCursor> cursor;
+    const auto nextCandidate = [this, &hash, &cursor]
+    {
+        return nautilus::invoke(
+            +[](TupleBuffer* buffer, const HashFunction::HashValue::raw_type hashValue, ChainedHashMap::SwissProbeCursor* cursorVal)
+                -> ChainedHashMapEntry*
+            {
+                auto chm = ChainedHashMap::load(*buffer);
+                return chm.findNextSwissCandidate(hashValue, *cursorVal);
+            },
+            buffer,
+            hash,
+            &cursor);
+    };
+
+    nautilus::invoke(+[](ChainedHashMap::SwissProbeCursor* cursorVal) { *cursorVal = {}; }, &cursor);
+    auto entry = nextCandidate();
+    while (entry != nullptr)
+    {
+        const ChainedEntryRef entryRef{entry, buffer, config.fieldKeys, config.fieldValues};
+        if (compareKeys(entryRef, recordKey))
+        {
+            return entry;
+        }
+        entry = nextCandidate();
+    }
+    return nullptr;
+}
+
 nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findEntry(const ChainedEntryRef& otherEntryRef) const
 {
     return findKey(otherEntryRef.getKey(), otherEntryRef.getHash());
@@ -260,29 +317,44 @@ void ChainedHashMapRef::insertOrUpdateEntry(
 }
 
 ChainedHashMapRef::EntryIterator ChainedHashMapRef::begin() const
+{
+    return beginPartition(nautilus::val<uint64_t>{ALL_PARTITIONS});
+}
+
+ChainedHashMapRef::EntryIterator ChainedHashMapRef::end() const
+{
+    return endPartition(nautilus::val<uint64_t>{ALL_PARTITIONS});
+}
+
+ChainedHashMapRef::EntryIterator ChainedHashMapRef::beginPartition(const nautilus::val<uint64_t>& partition) const
 {
     const nautilus::val<uint64_t> tupleIndex = 0;
     const nautilus::val<uint64_t> indexOnPage = 0;
     const nautilus::val<uint64_t> pageIndex = 0;
     nautilus::val<EntryIterator::DynamicArgsWrapper> args;
     const auto currentEntry = nautilus::invoke(
-        +[](TupleBuffer* buffer, const uint64_t pageIndexVal, const uint64_t indexOnPageVal, EntryIterator::DynamicArgsWrapper* args)
+        +[](TupleBuffer* buffer,
+            const uint64_t partitionVal,
+            const uint64_t pageIndexVal,
+            const uint64_t indexOnPageVal,
+            EntryIterator::DynamicArgsWrapper* args)
         {
             const auto chm = ChainedHashMap::load(*buffer);
             /// get number of pages in chained hash map
-            args->numPages = chm.getNumberOfPages();
+            args->numPages = getNumberOfPagesIn(chm, partitionVal);
             if (args->numPages == 0)
             {
                 return static_cast<const std::byte*>(nullptr);
             }
             /// get first page
-            const auto& page = chm.getPage(pageIndexVal);
+            const auto& page = getPageIn(chm, partitionVal, pageIndexVal);
             /// get number of tuples in page
-            args->numTuplesInPage = chm.getPage(pageIndexVal).getNumberOfTuples();
+            args->numTuplesInPage = page.getNumberOfTuples();
             /// get entry
             return page.getAvailableMemoryArea().subspan(indexOnPageVal * sizeof(ChainedHashMapEntry)).data();
         },
         buffer,
+        partition,
         pageIndex,
         indexOnPage,
         &args);
@@ -298,23 +370,25 @@ ChainedHashMapRef::EntryIterator ChainedHashMapRef::begin() const
             indexOnPage,
             args.get(&EntryIterator::DynamicArgsWrapper::numTuplesInPage),
             pageIndex,
-            args.get(&EntryIterator::DynamicArgsWrapper::numPages)};
+            args.get(&EntryIterator::DynamicArgsWrapper::numPages),
+            partition};
     }
-    /// Empty hash map, return the end() iterator.
-    return end();
+    /// Empty hash map or partition, return the end() iterator.
+    return endPartition(partition);
 }
 
-ChainedHashMapRef::EntryIterator ChainedHashMapRef::end() const
+ChainedHashMapRef::EntryIterator ChainedHashMapRef::endPartition(const nautilus::val<uint64_t>& partition) const
 {
     /// The iterator pointing to the end() should NEVER be advanced. Therefore, we do not need to set a lot of its members
     const auto numberOfTuples = invoke(
-        +[](TupleBuffer* buffer)
+        +[](TupleBuffer* buffer, const uint64_t partitionVal)
         {
             const auto chm = ChainedHashMap::load(*buffer);
-            return chm.getTotalNumberOfRecords();
+            return partitionVal == ALL_PARTITIONS ? chm.getTotalNumberOfRecords() : chm.getNumberOfRecords(partitionVal);
         },
-        buffer);
-    return {buffer, nullptr, nautilus::val<uint64_t>{config.entrySize}, numberOfTuples, -1, -1, -1, -1};
+        buffer,
+        partition);
+    return {buffer, nullptr, nautilus::val<uint64_t>{config.entrySize}, numberOfTuples, -1, -1, -1, -1, partition};
 }
 
 nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunction::HashValue& hash) const
@@ -325,6 +399,18 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunct
     {
         return nullptr;
     }
+    /// A growable map changes its chain count at runtime, so its mask has to be read from the map's header.
+    if (config.isGrowable())
+    {
+        return nautilus::invoke(
+            +[](const TupleBuffer* buffer, const HashFunction::HashValue::raw_type hashValue) -> ChainedHashMapEntry*
+            {
+                ChainedHashMap chm = ChainedHashMap::load(*buffer);
+                return chm.getChainForHash(hashValue);
+            },
+            buffer,
+            hash);
+    }
     /// Masking happens out here rather than inside the proxy: the mask is a query-compile-time constant, so
     /// it folds into an immediate instead of costing a load from the map's header on every probe.
     const auto entryPos = hash & nautilus::val<uint64_t>{ChainedHashMap::calculateMask(config.numberOfBuckets)};
@@ -349,6 +435,64 @@ ChainedHashMapRef::insert(const HashFunction::HashValue& hash, const nautilus::v
     /// numbers insertEntry needs are passed individually. They are all derived from this object's config, and
     /// each becomes a constant in the compiled code. Passing a pointer to the config instead would bake a
     /// host address into the trace, which would dangle if the operator holding it is moved after tracing.
+    /// A growable map takes the load factor instead of the mask, as it picks the chain from its current size.
+    /// A SWISS map needs neither, its index sizes itself.
+    if (config.usesSwissIndex())
+    {
+        const auto newEntry = invoke(
+            +[](TupleBuffer* buffer,
+                const HashFunction::HashValue::raw_type hashValue,
+                AbstractBufferProvider* bufferProviderVal,
+                const uint64_t entrySize,
+                const uint64_t entriesPerPage,
+                const uint64_t pageSize)
+            {
+                auto chm = ChainedHashMap::load(*buffer);
+                return chm.insertEntrySwiss(hashValue, bufferProviderVal, entrySize, entriesPerPage, pageSize);
+            },
+            buffer,
+            hash,
+            bufferProvider,
+            nautilus::val<uint64_t>{config.entrySize},
+            nautilus::val<uint64_t>{config.entriesPerPage()},
+            nautilus::val<uint64_t>{config.pageSize});
+
+        if (bloomFilter)
+        {
+            bloomFilter->add(hash);
+        }
+        return static_cast<nautilus::val<ChainedHashMapEntry*>>(newEntry);
+    }
+
+    if (config.isGrowable())
+    {
+        const auto newEntry = invoke(
+            +[](TupleBuffer* buffer,
+                const HashFunction::HashValue::raw_type hashValue,
+                AbstractBufferProvider* bufferProviderVal,
+                const uint64_t entrySize,
+                const uint64_t entriesPerPage,
+                const uint64_t pageSize,
+                const double maxLoadFactor)
+            {
+                auto chm = ChainedHashMap::load(*buffer);
+                return chm.insertEntryGrowable(hashValue, bufferProviderVal, entrySize, entriesPerPage, pageSize, maxLoadFactor);
+            },
+            buffer,
+            hash,
+            bufferProvider,
+            nautilus::val<uint64_t>{config.entrySize},
+            nautilus::val<uint64_t>{config.entriesPerPage()},
+            nautilus::val<uint64_t>{config.pageSize},
+            nautilus::val<double>{*config.maxLoadFactor});
+
+        if (bloomFilter)
+        {
+            bloomFilter->add(hash);
+        }
+        return static_cast<nautilus::val<ChainedHashMapEntry*>>(newEntry);
+    }
+
     const auto newEntry = invoke(
         +[](TupleBuffer* buffer,
             const HashFunction::HashValue::raw_type hashValue,
@@ -414,19 +558,19 @@ ChainedHashMapRef::ChainedHashMapRef(const nautilus::val<TupleBuffer*>& buffer,
 
     /// The bit area lives inline in the map's buffer and is zeroed by init(), so its address is stable and
     /// valid from here on. Resolving it once keeps the traced lookup path free of a per-call invoke. Its
-    /// offset follows from the chain count, which is a query-compile-time constant like the rest of the
+    /// offset follows from the size of the chains array, which is a query-compile-time constant like the rest of the
     /// sizing — so a view built from a different config than the map would silently address the wrong words.
     if (this->config.bloomFilterParams)
     {
         bloomFilter.emplace(
             invoke(
-                +[](TupleBuffer* buffer, const uint64_t numberOfChains, const uint64_t bloomBytes)
+                +[](TupleBuffer* buffer, const uint64_t chainsArraySize, const uint64_t bloomBytes)
                 {
                     auto chm = ChainedHashMap::load(*buffer);
-                    return chm.getBloomFilterMemArea(numberOfChains, bloomBytes);
+                    return chm.getBloomFilterMemArea(chainsArraySize, bloomBytes);
                 },
                 buffer,
-                nautilus::val<uint64_t>{ChainedHashMap::calculateNumberOfChains(this->config.numberOfBuckets)},
+                nautilus::val<uint64_t>{ChainedHashMap::calculateChainsArraySize(this->config.numberOfBuckets, this->config.index)},
                 nautilus::val<uint64_t>{this->config.bloomFilterMemAreaSize()}),
             *this->config.bloomFilterParams);
     }
@@ -455,7 +599,8 @@ ChainedHashMapRef::EntryIterator::EntryIterator(
     const nautilus::val<uint64_t>& indexOnPage,
     const nautilus::val<uint64_t>& numberOfTuplesInCurrentPage,
     const nautilus::val<uint64_t>& pageIndex,
-    const nautilus::val<uint64_t>& numberOfPages)
+    const nautilus::val<uint64_t>& numberOfPages,
+    const nautilus::val<uint64_t>& partition)
     : buffer(buffer)
     , currentEntry(currentEntry)
     , entrySize(entrySize)
@@ -464,6 +609,7 @@ ChainedHashMapRef::EntryIterator::EntryIterator(
     , numberOfTuplesInCurrentPage(numberOfTuplesInCurrentPage)
     , pageIndex(pageIndex)
     , numberOfPages(numberOfPages)
+    , partition(partition)
 {
 }
 
@@ -482,19 +628,24 @@ ChainedHashMapRef::EntryIterator& ChainedHashMapRef::EntryIterator::operator++()
         ++pageIndex;
         nautilus::val<DynamicArgsWrapper> args;
         currentEntry = nautilus::invoke(
-            +[](TupleBuffer* buffer, const uint64_t pageIndexVal, const uint64_t indexOnPageVal, DynamicArgsWrapper* args)
+            +[](TupleBuffer* buffer,
+                const uint64_t partitionVal,
+                const uint64_t pageIndexVal,
+                const uint64_t indexOnPageVal,
+                DynamicArgsWrapper* args)
             {
                 const auto chm = ChainedHashMap::load(*buffer);
                 /// get number of pages in chained hash map
-                args->numPages = chm.getNumberOfPages();
+                args->numPages = getNumberOfPagesIn(chm, partitionVal);
                 /// get first page
-                const auto& page = chm.getPage(pageIndexVal);
+                const auto& page = getPageIn(chm, partitionVal, pageIndexVal);
                 /// get number of tuples in page
-                args->numTuplesInPage = chm.getPage(pageIndexVal).getNumberOfTuples();
+                args->numTuplesInPage = page.getNumberOfTuples();
                 /// get entry
                 return page.getAvailableMemoryArea().subspan(indexOnPageVal * sizeof(ChainedHashMapEntry)).data();
             },
             buffer,
+            partition,
             pageIndex,
             indexOnPage,
             &args);
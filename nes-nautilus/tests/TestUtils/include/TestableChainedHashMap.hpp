@@ -28,6 +28,7 @@
 #include <Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <nautilus/Engine.hpp>
 #include <DataStructureTestUtils.hpp>
 
@@ -47,7 +48,13 @@ public:
         size_t numKeyFields,
         uint64_t numEntriesPerPage,
         /// NOLINTNEXTLINE(fuchsia-default-arguments-declarations): matches the pre-existing default here.
-        const std::optional<Nautilus::Interface::BloomFilterParams>& bloomFilterParams = std::nullopt);
+        const std::optional<Nautilus::Interface::BloomFilterParams>& bloomFilterParams = std::nullopt,
+        /// NOLINTNEXTLINE(fuchsia-default-arguments-declarations): nullopt keeps the chain count fixed, as before.
+        std::optional<double> maxLoadFactor = std::nullopt,
+        /// NOLINTNEXTLINE(fuchsia-default-arguments-declarations): the chains every map used before the SWISS index existed.
+        HashMapIndex index = HashMapIndex::CHAINED,
+        /// NOLINTNEXTLINE(fuchsia-default-arguments-declarations): a single partition stores all entries together, as before.
+        uint64_t numberOfRadixPartitions = 1);
 
     ~TestableChainedHashMap() = default;
     TestableChainedHashMap(const TestableChainedHashMap&) = delete;
@@ -69,6 +76,8 @@ public:
 
     ChainedHashMap raw();
 
+    [[nodiscard]] uint64_t getEntrySize() const;
+
     [[nodiscard]] size_t numKeyFields() const;
 
     [[nodiscard]] const std::vector<DataType>& getKeyDataTypes() const;
@@ -35,6 +35,7 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Schema/Schema.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <nautilus/Engine.hpp>
 #include <DataStructureTestUtils.hpp>
 #include <ErrorHandling.hpp>
@@ -73,7 +74,10 @@ TestableChainedHashMap::TestableChainedHashMap(
     uint64_t numberOfBuckets,
     size_t numKeyFields,
     uint64_t numEntriesPerPage,
-    const std::optional<Nautilus::Interface::BloomFilterParams>& bloomFilterParams)
+    const std::optional<Nautilus::Interface::BloomFilterParams>& bloomFilterParams,
+    const std::optional<double> maxLoadFactor,
+    const HashMapIndex index,
+    const uint64_t numberOfRadixPartitions)
     : dataTypes(fieldTypes), bufferManager(bufferManager), bloomFilterParams(bloomFilterParams)
 {
     PRECONDITION(
@@ -110,6 +114,9 @@ TestableChainedHashMap::TestableChainedHashMap(
         .entrySize = entrySize,
         .numberOfBuckets = numberOfBuckets,
         .pageSize = entrySize * numEntriesPerPage,
+        .maxLoadFactor = maxLoadFactor,
+        .index = index,
+        .numberOfRadixPartitions = numberOfRadixPartitions,
         .bloomFilterParams = bloomFilterParams,
         .fieldKeys = fieldKeys,
         .fieldValues = fieldValues,
@@ -120,13 +127,15 @@ TestableChainedHashMap::TestableChainedHashMap(
         .entrySize = probeEntrySize,
         .numberOfBuckets = 1,
         .pageSize = probeEntrySize,
+        .maxLoadFactor = std::nullopt,
+        .index = HashMapIndex::CHAINED,
+        .numberOfRadixPartitions = 1,
         .bloomFilterParams = std::nullopt,
         .fieldKeys = fieldKeys,
         .fieldValues = {},
         .hashFunction = hashFunction};
 
-    const auto hashMapBufferSize
-        = ChainedHashMap::calculateBufferSize(hashMapConfig.numberOfBuckets, hashMapConfig.bloomFilterMemAreaSize());
+    const auto hashMapBufferSize = ChainedHashMap::calculateBufferSize(hashMapConfig);
     auto chainedHashMapBufferOpt = bufferManager.getUnpooledBuffer(hashMapBufferSize);
     if (not chainedHashMapBufferOpt.has_value())
     {
@@ -240,7 +249,7 @@ std::optional<AnyVec> TestableChainedHashMap::at(const AnyVec& key)
 {
     /// probeConfig is the member the lookup trace was built with, not a fresh one: the map carries no sizing,
     /// so the config init() sees here has to be the exact one the compiled probe assumes.
-    const auto probeBufferSize = ChainedHashMap::calculateBufferSize(probeConfig.numberOfBuckets, probeConfig.bloomFilterMemAreaSize());
+    const auto probeBufferSize = ChainedHashMap::calculateBufferSize(probeConfig);
     auto probeBufferOpt = bufferManager.getUnpooledBuffer(probeBufferSize);
     if (not probeBufferOpt.has_value())
     {
@@ -290,6 +299,11 @@ ChainedHashMap TestableChainedHashMap::raw()
     return ChainedHashMap::load(chainedHashMapBuffer);
 }
 
+uint64_t TestableChainedHashMap::getEntrySize() const
+{
+    return hashMapConfig.entrySize;
+}
+
 size_t TestableChainedHashMap::numKeyFields() const
 {
     return keyDataTypes.size();
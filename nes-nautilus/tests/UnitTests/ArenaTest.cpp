@@ -0,0 +1,118 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Arena.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+namespace
+{
+constexpr size_t TEST_BUFFER_SIZE = 4096;
+constexpr size_t TEST_NUMBER_OF_BUFFERS = 16;
+constexpr BufferAlignment BUFFER_ALIGNMENT{64};
+constexpr double UNPOOLED_MEMORY_FRACTION = 0.5;
+constexpr size_t TOTAL_MEMORY_IN_BYTES = 2 * TEST_NUMBER_OF_BUFFERS * TEST_BUFFER_SIZE;
+constexpr size_t SMALL_ALLOCATION_SIZE = 100;
+}
+
+class ArenaTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite() { Logger::setupLogging("ArenaTest.log", LogLevel::LOG_DEBUG); }
+
+    void SetUp() override
+    {
+        Testing::BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create(
+            TOTAL_MEMORY_IN_BYTES,
+            UNPOOLED_MEMORY_FRACTION,
+            BUFFER_ALIGNMENT,
+            TEST_BUFFER_SIZE,
+            std::make_shared<NesDefaultMemoryAllocator>());
+    }
+
+    void TearDown() override
+    {
+        /// Asserts that the arenas of the test returned all buffers.
+        bufferManager->destroy();
+        Testing::BaseUnitTest::TearDown();
+    }
+
+protected:
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+TEST_F(ArenaTest, AllocationsFromTheSameBufferDoNotOverlap)
+{
+    Arena arena(bufferManager);
+    const auto first = arena.allocateMemory(SMALL_ALLOCATION_SIZE);
+    const auto second = arena.allocateMemory(SMALL_ALLOCATION_SIZE);
+    EXPECT_EQ(first.data() + SMALL_ALLOCATION_SIZE, second.data());
+    EXPECT_EQ(arena.fixedSizeBuffers.size(), 1);
+}
+
+TEST_F(ArenaTest, ResetReusesRetainedBuffers)
+{
+    const auto availableBuffers = bufferManager->getNumberOfAvailableBuffers();
+    {
+        Arena arena(bufferManager, 1);
+        const auto beforeReset = arena.allocateMemory(SMALL_ALLOCATION_SIZE);
+        arena.reset();
+        const auto afterReset = arena.allocateMemory(SMALL_ALLOCATION_SIZE);
+        EXPECT_EQ(beforeReset.data(), afterReset.data());
+        EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers - 1);
+    }
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers);
+}
+
+TEST_F(ArenaTest, ResetReleasesBuffersBeyondTheRetentionLimit)
+{
+    const auto availableBuffers = bufferManager->getNumberOfAvailableBuffers();
+    Arena arena(bufferManager, 1);
+    for (size_t buffer = 0; buffer < 3; ++buffer)
+    {
+        arena.allocateMemory(TEST_BUFFER_SIZE);
+    }
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers - 3);
+
+    arena.reset();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers - 1);
+
+    /// The retained buffer is used first, before the arena requests further buffers.
+    arena.allocateMemory(TEST_BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers - 1);
+    arena.allocateMemory(TEST_BUFFER_SIZE);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffers - 2);
+}
+
+TEST_F(ArenaTest, ResetReleasesUnpooledBuffers)
+{
+    Arena arena(bufferManager);
+    const auto allocation = arena.allocateMemory(2 * TEST_BUFFER_SIZE);
+    EXPECT_EQ(allocation.size(), 2 * TEST_BUFFER_SIZE);
+    EXPECT_EQ(arena.unpooledBuffers.size(), 1);
+    arena.reset();
+    EXPECT_TRUE(arena.unpooledBuffers.empty());
+}
+
+}
@@ -12,6 +12,7 @@
     limitations under the License.
 */
 
+#include <any>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -31,6 +32,7 @@
 #include <Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Runtime/BufferManager.hpp> /// NOLINT(misc-include-cleaner)
 #include <Runtime/TupleBuffer.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <Util/Logger/LogLevel.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/Logger/impl/NesLogger.hpp>
@@ -66,6 +68,14 @@ constexpr std::array<uint64_t, 4> BUFFER_SIZE_POOL = {128, 512, 4096, 2ULL * 102
 /// Number of buckets pool drawn from property to test different numbers of buckets for the chained hash map.
 constexpr std::array<uint64_t, 6> NUM_BUCKETS_POOL = {32, 64, 128, 256, 512, 1024};
 
+/// Initial bucket and load factor pools for growable maps. The buckets are tiny so that even a few hundred items trigger
+/// several growths, and a few of them land while an earlier growth is still migrating its chains.
+constexpr std::array<uint64_t, 4> GROWABLE_NUM_BUCKETS_POOL = {1, 2, 4, 32};
+constexpr std::array<double, 3> MAX_LOAD_FACTOR_POOL = {0.25, 1.0, 4.0};
+
+/// Radix partition counts, from a single one up to more partitions than most properties draw items.
+constexpr std::array<uint64_t, 4> RADIX_PARTITIONS_POOL = {1, 2, 8, 64};
+
 /// Number of entries per page — multiplied by entrySize to derive pageSize.
 /// Small values (1, 2) force long page chains; large values (64, 512) exercise the bulk path.
 constexpr std::array<uint64_t, 6> ENTRIES_PER_PAGE_POOL = {1, 2, 4, 16, 64, 512};
@@ -361,6 +371,215 @@ void bloomFilterMatchesDisabledProperty(TestUtils::EngineMode mode)
     verifyLookups(withFilter, oracle, fieldTypes);
 }
 
+/// Differential property: a growable CHM must be observationally indistinguishable from one with a fixed chain count.
+/// Lookups are interleaved with the inserts, so they also run against maps whose growth is only partially migrated.
+void growableMatchesFixedProperty(TestUtils::EngineMode mode)
+{
+    constexpr uint64_t maxIterations = 5;
+
+    const auto fieldTypes = *TestUtils::genDataTypeSchema(TestUtils::ALL_VALUE_TYPES, 1, TestUtils::MAX_SCHEMA_FIELDS);
+    const auto bufferSize = *rc::gen::elementOf(BUFFER_SIZE_POOL);
+    const auto numberOfItems = *rc::gen::inRange<uint64_t>(0, TestUtils::MAX_ITEMS_PER_PROPERTY);
+    const auto numberOfBuckets = *rc::gen::elementOf(GROWABLE_NUM_BUCKETS_POOL);
+    const auto maxLoadFactor = *rc::gen::elementOf(MAX_LOAD_FACTOR_POOL);
+    const auto numKeyFields = *rc::gen::inRange<size_t>(1, fieldTypes.size() + 1);
+    const auto numEntriesPerPage = *rc::gen::elementOf(ENTRIES_PER_PAGE_POOL);
+    const auto numIterations = *rc::gen::inRange<uint64_t>(1, maxIterations + 1);
+
+    NES_INFO(
+        "Property growableMatchesFixed: fields={}, N={}, bufferSize={}, numKeyFields={}, numBuckets={}, maxLoadFactor={}, "
+        "entriesPerPage={}, iterations={}, field_types={}",
+        fieldTypes.size(),
+        numberOfItems,
+        bufferSize,
+        numKeyFields,
+        numberOfBuckets,
+        maxLoadFactor,
+        numEntriesPerPage,
+        numIterations,
+        fmt::join(fieldTypes, ", "));
+
+    const auto records = genRecords(fieldTypes, numKeyFields, numberOfItems);
+
+    auto growableBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    auto fixedBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    TestUtils::TestableChainedHashMap growable{
+        fieldTypes, *growableBuffers, mode, numberOfBuckets, numKeyFields, numEntriesPerPage, std::nullopt, maxLoadFactor};
+    TestUtils::TestableChainedHashMap fixed{fieldTypes, *fixedBuffers, mode, numberOfBuckets, numKeyFields, numEntriesPerPage};
+
+    const auto itemsPerIteration = numberOfItems / numIterations;
+    auto nextRecord = records.begin();
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (uint64_t i = 0; i < itemsPerIteration; ++i, ++nextRecord)
+        {
+            growable.put(nextRecord->first, nextRecord->second);
+            fixed.put(nextRecord->first, nextRecord->second);
+        }
+        NES_INFO(
+            "growableMatchesFixed: iteration {}/{}, CHM has {} entries in {} chains, growing={}",
+            iteration + 1,
+            numIterations,
+            growable.size(),
+            growable.raw().getNumberOfChains(),
+            growable.raw().isGrowing());
+
+        const auto oracle = toReference(fixed);
+        RC_ASSERT(growable.size() == fixed.size());
+        RC_ASSERT(
+            growable.raw().isGrowing()
+            or static_cast<double>(growable.size()) <= maxLoadFactor * static_cast<double>(growable.raw().getNumberOfChains()));
+        verifyLookups(growable, oracle, fieldTypes);
+    }
+    verifyGetAll(growable, toReference(fixed));
+}
+
+/// Differential property: a CHM with a SWISS index must answer exactly like one walking chains. Lookups are interleaved
+/// with the inserts, so they also run right after the index was rebuilt at a larger capacity.
+void swissMatchesChainedProperty(TestUtils::EngineMode mode)
+{
+    constexpr uint64_t maxIterations = 5;
+
+    const auto fieldTypes = *TestUtils::genDataTypeSchema(TestUtils::ALL_VALUE_TYPES, 1, TestUtils::MAX_SCHEMA_FIELDS);
+    const auto bufferSize = *rc::gen::elementOf(BUFFER_SIZE_POOL);
+    const auto numberOfItems = *rc::gen::inRange<uint64_t>(0, TestUtils::MAX_ITEMS_PER_PROPERTY);
+    const auto numberOfBuckets = *rc::gen::elementOf(GROWABLE_NUM_BUCKETS_POOL);
+    const auto numKeyFields = *rc::gen::inRange<size_t>(1, fieldTypes.size() + 1);
+    const auto numEntriesPerPage = *rc::gen::elementOf(ENTRIES_PER_PAGE_POOL);
+    const auto numIterations = *rc::gen::inRange<uint64_t>(1, maxIterations + 1);
+
+    NES_INFO(
+        "Property swissMatchesChained: fields={}, N={}, bufferSize={}, numKeyFields={}, numBuckets={}, entriesPerPage={}, "
+        "iterations={}, field_types={}",
+        fieldTypes.size(),
+        numberOfItems,
+        bufferSize,
+        numKeyFields,
+        numberOfBuckets,
+        numEntriesPerPage,
+        numIterations,
+        fmt::join(fieldTypes, ", "));
+
+    const auto records = genRecords(fieldTypes, numKeyFields, numberOfItems);
+
+    auto swissBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    auto chainedBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    TestUtils::TestableChainedHashMap swiss{
+        fieldTypes,
+        *swissBuffers,
+        mode,
+        numberOfBuckets,
+        numKeyFields,
+        numEntriesPerPage,
+        std::nullopt,
+        std::nullopt,
+        HashMapIndex::SWISS};
+    TestUtils::TestableChainedHashMap chained{fieldTypes, *chainedBuffers, mode, numberOfBuckets, numKeyFields, numEntriesPerPage};
+
+    const auto itemsPerIteration = numberOfItems / numIterations;
+    auto nextRecord = records.begin();
+    for (uint64_t iteration = 0; iteration < numIterations; ++iteration)
+    {
+        for (uint64_t i = 0; i < itemsPerIteration; ++i, ++nextRecord)
+        {
+            swiss.put(nextRecord->first, nextRecord->second);
+            chained.put(nextRecord->first, nextRecord->second);
+        }
+        NES_INFO(
+            "swissMatchesChained: iteration {}/{}, CHM has {} entries in {} slots",
+            iteration + 1,
+            numIterations,
+            swiss.size(),
+            swiss.raw().getSwissCapacity());
+
+        const auto oracle = toReference(chained);
+        RC_ASSERT(swiss.size() == chained.size());
+        RC_ASSERT(swiss.size() * 8 <= swiss.raw().getSwissCapacity() * 7);
+        /// A SWISS map has no chains, and every rebuild replaces the previous index instead of adding a child next to it:
+        /// only the storage space, the varsized space and the one current index remain.
+        RC_ASSERT(swiss.raw().getNumberOfChains() == 0);
+        RC_ASSERT(swiss.raw().getBuffer()->getNumberOfChildBuffers() <= 3);
+        verifyLookups(swiss, oracle, fieldTypes);
+    }
+    verifyGetAll(swiss, toReference(chained));
+}
+
+/// Differential property: storing the entries per radix partition must not change what the map answers, and iterating
+/// the partitions one by one must visit every entry exactly once, each in the partition its hash belongs to.
+void partitionedMatchesUnpartitionedProperty(TestUtils::EngineMode mode)
+{
+    const auto fieldTypes = *TestUtils::genDataTypeSchema(TestUtils::ALL_VALUE_TYPES, 1, TestUtils::MAX_SCHEMA_FIELDS);
+    const auto bufferSize = *rc::gen::elementOf(BUFFER_SIZE_POOL);
+    const auto numberOfItems = *rc::gen::inRange<uint64_t>(0, TestUtils::MAX_ITEMS_PER_PROPERTY);
+    const auto numberOfBuckets = *rc::gen::elementOf(NUM_BUCKETS_POOL);
+    const auto numberOfRadixPartitions = *rc::gen::elementOf(RADIX_PARTITIONS_POOL);
+    const auto numKeyFields = *rc::gen::inRange<size_t>(1, fieldTypes.size() + 1);
+    const auto numEntriesPerPage = *rc::gen::elementOf(ENTRIES_PER_PAGE_POOL);
+
+    NES_INFO(
+        "Property partitionedMatchesUnpartitioned: fields={}, N={}, bufferSize={}, numKeyFields={}, numBuckets={}, partitions={}, "
+        "entriesPerPage={}, field_types={}",
+        fieldTypes.size(),
+        numberOfItems,
+        bufferSize,
+        numKeyFields,
+        numberOfBuckets,
+        numberOfRadixPartitions,
+        numEntriesPerPage,
+        fmt::join(fieldTypes, ", "));
+
+    const auto records = genRecords(fieldTypes, numKeyFields, numberOfItems);
+
+    auto partitionedBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    auto unpartitionedBuffers = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    TestUtils::TestableChainedHashMap partitioned{
+        fieldTypes,
+        *partitionedBuffers,
+        mode,
+        numberOfBuckets,
+        numKeyFields,
+        numEntriesPerPage,
+        std::nullopt,
+        std::nullopt,
+        HashMapIndex::CHAINED,
+        numberOfRadixPartitions};
+    TestUtils::TestableChainedHashMap unpartitioned{
+        fieldTypes, *unpartitionedBuffers, mode, numberOfBuckets, numKeyFields, numEntriesPerPage};
+
+    for (const auto& [key, value] : records)
+    {
+        partitioned.put(key, value);
+        unpartitioned.put(key, value);
+    }
+
+    const auto oracle = toReference(unpartitioned);
+    RC_ASSERT(partitioned.size() == unpartitioned.size());
+    verifyGetAll(partitioned, oracle);
+    verifyLookups(partitioned, oracle, fieldTypes);
+
+    const auto map = partitioned.raw();
+    RC_ASSERT(map.getNumberOfRadixPartitions() == numberOfRadixPartitions);
+    uint64_t visitedEntries = 0;
+    for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
+    {
+        uint64_t entriesInPartition = 0;
+        for (uint64_t pageIndex = 0; pageIndex < map.getNumberOfPages(partition); ++pageIndex)
+        {
+            const auto page = map.getPage(partition, pageIndex);
+            for (uint64_t entryIndex = 0; entryIndex < page.getNumberOfTuples(); ++entryIndex)
+            {
+                const auto* entry = reinterpret_cast<const ChainedHashMapEntry*>( /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    page.getAvailableMemoryArea().subspan(entryIndex * partitioned.getEntrySize()).data());
+                RC_ASSERT(ChainedHashMap::calculateRadixPartition(entry->hash, numberOfRadixPartitions) == partition);
+                ++entriesInPartition;
+            }
+        }
+        RC_ASSERT(entriesInPartition == map.getNumberOfRecords(partition));
+        visitedEntries += entriesInPartition;
+    }
+    RC_ASSERT(visitedEntries == partitioned.size());
+}
+
 /// Verify put()/at() with the chained hash map used purely as a HashSet: every field is a key and there are no
 /// value fields at all. Unlike putAndLookupKeysProperty, where numKeyFields is drawn from a range and the
 /// all-keys/no-values case only turns up incidentally whenever that draw happens to land on fieldTypes.size(),
@@ -461,6 +680,9 @@ TEST(ChainedHashMapIteratorTest, emptyMapIsAnEmptyRange)
         .entrySize = entrySize,
         .numberOfBuckets = numberOfBuckets,
         .pageSize = entrySize * entriesPerPage,
+        .maxLoadFactor = std::nullopt,
+        .index = HashMapIndex::CHAINED,
+        .numberOfRadixPartitions = 1,
         .bloomFilterParams = std::nullopt,
         .fieldKeys = {},
         .fieldValues = {},
@@ -468,7 +690,7 @@ TEST(ChainedHashMapIteratorTest, emptyMapIsAnEmptyRange)
 
     auto bufferManager = TestUtils::createBufferManager(bufferSize, numberOfPooledBuffers);
     /// NOLINTNEXTLINE(bugprone-unchecked-optional-access): .value() throws on nullopt, which fails the test.
-    auto hashMapBuffer = bufferManager->getUnpooledBuffer(ChainedHashMap::calculateBufferSize(numberOfBuckets, 0)).value();
+    auto hashMapBuffer = bufferManager->getUnpooledBuffer(ChainedHashMap::calculateBufferSize(hashMapConfig)).value();
     ChainedHashMap::init(hashMapBuffer, hashMapConfig);
 
     auto engine = TestUtils::makeEngine(TestUtils::EngineMode::Interpreter);
@@ -486,6 +708,42 @@ TEST(ChainedHashMapIteratorTest, emptyMapIsAnEmptyRange)
     EXPECT_NO_THROW(iterate(&hashMapBuffer));
 }
 
+TEST(ChainedHashMapGrowthTest, growsAndFinishesMigration)
+{
+    constexpr uint64_t bufferSize = 4096;
+    constexpr uint64_t numberOfBuckets = 1;
+    constexpr double maxLoadFactor = 1.0;
+    constexpr uint64_t numberOfItems = 1000;
+
+    const DataType uint64Type{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE};
+    const std::vector fieldTypes{uint64Type, uint64Type};
+    auto bufferManager = TestUtils::createBufferManager(bufferSize, TestUtils::pooledBufferCountFor(bufferSize));
+    TestUtils::TestableChainedHashMap chainedHashMap{
+        fieldTypes, *bufferManager, TestUtils::EngineMode::Interpreter, numberOfBuckets, 1, 64, std::nullopt, maxLoadFactor};
+    const auto initialNumberOfChains = ChainedHashMap::calculateNumberOfChains(numberOfBuckets);
+    ASSERT_EQ(chainedHashMap.raw().getNumberOfChains(), initialNumberOfChains);
+
+    for (uint64_t key = 0; key < numberOfItems; ++key)
+    {
+        chainedHashMap.put({key}, {key * 2});
+    }
+
+    /// Every growth doubles the chains and has migrated after a few inserts, so the final chain count is the
+    /// smallest power of two that keeps the load factor, or one doubling less while the last migration runs.
+    const auto numberOfChains = chainedHashMap.raw().getNumberOfChains();
+    EXPECT_GT(numberOfChains, initialNumberOfChains);
+    EXPECT_EQ(numberOfChains & (numberOfChains - 1), 0);
+    EXPECT_LE(static_cast<double>(numberOfItems), maxLoadFactor * static_cast<double>(numberOfChains));
+    EXPECT_EQ(chainedHashMap.size(), numberOfItems);
+    for (uint64_t key = 0; key < numberOfItems; ++key)
+    {
+        const auto value = chainedHashMap.at({key});
+        ASSERT_TRUE(value.has_value());
+        /// NOLINTNEXTLINE(bugprone-unchecked-optional-access): the ASSERT above aborts the test on nullopt.
+        EXPECT_EQ(std::any_cast<uint64_t>(value->front()), key * 2);
+    }
+}
+
 /// Same properties, but with the in-map BloomFilter enabled at random sizing. findOrCreateEntry consults
 /// the filter in findChain; a false negative would re-insert an existing key and break dedup, so a pass
 /// proves the results are identical to the disabled runs above for the randomly-chosen filter sizing.
@@ -527,4 +785,43 @@ RC_GTEST_PROP(ChainedHashMapPropertyTest, bloomFilterMatchesDisabledInterpreter,
     bloomFilterMatchesDisabledProperty(TestUtils::EngineMode::Interpreter);
 }
 
+/// Growable maps, compared against a fixed-size map on the same inputs.
+RC_GTEST_PROP(ChainedHashMapPropertyTest, growableMatchesFixedCompiler, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    growableMatchesFixedProperty(TestUtils::EngineMode::Compiler);
+}
+
+RC_GTEST_PROP(ChainedHashMapPropertyTest, growableMatchesFixedInterpreter, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    growableMatchesFixedProperty(TestUtils::EngineMode::Interpreter);
+}
+
+/// SWISS-indexed maps, compared against a chained map on the same inputs.
+RC_GTEST_PROP(ChainedHashMapPropertyTest, swissMatchesChainedCompiler, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    swissMatchesChainedProperty(TestUtils::EngineMode::Compiler);
+}
+
+RC_GTEST_PROP(ChainedHashMapPropertyTest, swissMatchesChainedInterpreter, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    swissMatchesChainedProperty(TestUtils::EngineMode::Interpreter);
+}
+
+/// Radix-partitioned maps, compared against an unpartitioned map on the same inputs.
+RC_GTEST_PROP(ChainedHashMapPropertyTest, partitionedMatchesUnpartitionedCompiler, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    partitionedMatchesUnpartitionedProperty(TestUtils::EngineMode::Compiler);
+}
+
+RC_GTEST_PROP(ChainedHashMapPropertyTest, partitionedMatchesUnpartitionedInterpreter, ())
+{
+    Logger::setupLogging("ChainedHashMapPropertyTest.log", LogLevel::LOG_DEBUG);
+    partitionedMatchesUnpartitionedProperty(TestUtils::EngineMode::Interpreter);
+}
+
 }
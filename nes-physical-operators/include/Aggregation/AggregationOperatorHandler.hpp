@@ -15,17 +15,20 @@
 #pragma once
 #include <algorithm>
 #include <bit>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
 #include <utility>
 #include <vector>
+#include <Aggregation/SlidingWindowAggregates.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <HashMapSlice.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 
@@ -35,15 +38,36 @@ namespace NES
 /// This struct models the information for an aggregation window trigger
 /// As we are triggering the probe pipeline by passing a tuple buffer to the probe operator, we assume that the tuple buffer
 /// is large enough to store all slices of the window to be triggered.
+/// A window is emitted once per non-empty radix partition of its hash maps, each as one chunk of the window's sequence number,
+/// so that the partitions are merged by different worker threads.
 struct EmittedAggregationWindow
 {
-    EmittedAggregationWindow(const WindowInfo windowInfo, uint64_t numberOfHashMaps)
-        : windowInfo(windowInfo), numberOfHashMaps(numberOfHashMaps)
+    EmittedAggregationWindow(
+        const WindowInfo windowInfo, uint64_t numberOfHashMaps, uint64_t partition, uint64_t numberOfSlices, uint64_t firstPrefixSlice)
+        : windowInfo(windowInfo)
+        , numberOfHashMaps(numberOfHashMaps)
+        , partition(partition)
+        , numberOfSlices(numberOfSlices)
+        , firstPrefixSlice(firstPrefixSlice)
     {
     }
 
     WindowInfo windowInfo;
     uint64_t numberOfHashMaps;
+    /// The radix partition of the hash maps this probe task merges.
+    uint64_t partition;
+    /// Only set for incrementally aggregated sliding windows. Then, numberOfSlices EmittedAggregationSlice follow this struct in the
+    /// buffer, sorted by their slice end, and the slices from firstPrefixSlice on belong to the next chunk, see SlidingWindowAggregates.
+    uint64_t numberOfSlices;
+    uint64_t firstPrefixSlice;
+};
+
+/// The hash maps of one slice of an incrementally aggregated window, as indices into the child buffers of the emitted window
+struct EmittedAggregationSlice
+{
+    SliceEnd::Underlying sliceEnd;
+    uint64_t firstHashMap;
+    uint64_t numberOfHashMaps;
 };
 
 class AggregationOperatorHandler final : public WindowBasedOperatorHandler
@@ -52,7 +76,13 @@ public:
     AggregationOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
-        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore);
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        uint64_t numberOfRadixPartitions,
+        std::unique_ptr<SlidingWindowAggregates> slidingWindowAggregates,
+        std::chrono::milliseconds originIdleTimeout);
+
+    /// Only available if the sliding windows of this aggregation are aggregated incrementally
+    [[nodiscard]] SlidingWindowAggregates& getSlidingWindowAggregates() const;
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
@@ -64,6 +94,13 @@ protected:
     void triggerSlices(
         const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
         PipelineExecutionContext* pipelineCtx) override;
+    void garbageCollectOperatorState(Timestamp newGlobalWaterMark) const override;
+
+private:
+    /// Must match ChainedHashMapConfig::numberOfRadixPartitions of the slices' hash maps.
+    uint64_t numberOfRadixPartitions;
+    /// nullptr, if each window merges the hash maps of all of its slices
+    std::unique_ptr<SlidingWindowAggregates> slidingWindowAggregates;
 };
 
 }
@@ -14,14 +14,21 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/SlidingWindowAggregates.hpp>
 #include <Interface/HashMap/ChainedHashMap/ChainedHashMapConfig.hpp>
+#include <Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Interface/NautilusBuffer.hpp>
 #include <Interface/RecordBuffer.hpp>
 #include <Operators/Windows/WindowMetaData.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <ExecutionContext.hpp>
 #include <WindowProbePhysicalOperator.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -33,12 +40,45 @@ public:
         ChainedHashMapConfig hashMapConfig,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
         OperatorHandlerId operatorHandlerId,
-        WindowMetaData windowMetaData);
+        WindowMetaData windowMetaData,
+        bool aggregateSlidingWindowsIncrementally);
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
+    /// Allocates an empty, unpartitioned hash map of this operator's configuration into the given buffer
+    void createHashMap(const nautilus::val<TupleBuffer*>& hashMapBuffer, ExecutionContext& executionCtx) const;
+
+    /// Combines all entries of the given partition of the source hash map into the target hash map
+    void combineHashMap(
+        ChainedHashMapRef& targetHashMap,
+        const nautilus::val<TupleBuffer*>& targetHashMapBuffer,
+        const nautilus::val<TupleBuffer*>& sourceHashMapBuffer,
+        const nautilus::val<uint64_t>& partition,
+        ExecutionContext& executionCtx) const;
+
+    /// Builds the partial aggregate of a slice from its hash maps and, if it has one, the partial aggregate of its neighbour.
+    /// Stores it and replaces `neighbour` with it, as it is the neighbour of the partial aggregate that is built next.
+    void buildPartialAggregate(
+        SlidingWindowAggregates::Side side,
+        const nautilus::val<OperatorHandler*>& operatorHandler,
+        const RecordBuffer& recordBuffer,
+        const nautilus::val<uint64_t>& sliceIdx,
+        OwnedNautilusBuffer& neighbour,
+        const nautilus::val<bool>& hasNeighbour,
+        const nautilus::val<uint64_t>& partition,
+        ExecutionContext& executionCtx) const;
+
+    /// Combines the window of the emitted record buffer from the suffix and prefix aggregates, building the ones that are still missing
+    void combinePartialAggregates(
+        ChainedHashMapRef& finalHashMap,
+        const nautilus::val<TupleBuffer*>& finalHashMapBuffer,
+        const RecordBuffer& recordBuffer,
+        ExecutionContext& executionCtx) const;
+
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     ChainedHashMapConfig hashMapConfig;
+    /// If set, windows are combined from partial aggregates stored in the SlidingWindowAggregates of the operator handler
+    bool aggregateSlidingWindowsIncrementally;
 };
 
 }
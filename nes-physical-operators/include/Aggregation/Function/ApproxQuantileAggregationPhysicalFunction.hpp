@@ -0,0 +1,77 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Interface/Record.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <val_concepts.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Estimates a quantile with a QuantileSketch. In contrast to the MedianAggregationPhysicalFunction, the state does not grow with the
+/// number of values, as the sketch has a fixed size. Like the median's paged vector, the sketch lives in a child buffer of the hash map.
+class ApproxQuantileAggregationPhysicalFunction : public AggregationPhysicalFunction
+{
+public:
+    ApproxQuantileAggregationPhysicalFunction(
+        DataType inputType,
+        DataType resultType,
+        PhysicalFunction inputFunction,
+        Record::RecordFieldIdentifier resultFieldIdentifier,
+        double quantile,
+        uint64_t compression);
+    void lift(
+        const nautilus::val<AggregationState*>& aggregationState,
+        nautilus::val<TupleBuffer*> parentBuffer,
+        PipelineMemoryProvider& pipelineMemoryProvider,
+        const Record& record) override;
+    void combine(
+        nautilus::val<AggregationState*> aggregationState1,
+        nautilus::val<TupleBuffer*> parentBuffer1,
+        nautilus::val<AggregationState*> aggregationState2,
+        nautilus::val<TupleBuffer*> parentBuffer2,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    Record lower(
+        nautilus::val<AggregationState*> aggregationState,
+        nautilus::val<TupleBuffer*> parentBuffer,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void reset(
+        nautilus::val<AggregationState*> aggregationState,
+        nautilus::val<TupleBuffer*> parentBuffer,
+        PipelineMemoryProvider& pipelineMemoryProvider) override;
+    void cleanup(nautilus::val<AggregationState*> aggregationState) override;
+    [[nodiscard]] size_t getSizeOfStateInBytes() const override;
+    ~ApproxQuantileAggregationPhysicalFunction() override = default;
+
+    static AggregationPhysicalFunctionRegistryReturnType create(AggregationPhysicalFunctionRegistryArguments arguments);
+
+private:
+    /// Returns the location of the sketch's child buffer index, which follows the optional null flag
+    [[nodiscard]] nautilus::val<uint32_t*> getChildBufferIndexRef(const nautilus::val<AggregationState*>& aggregationState) const;
+
+    double quantile;
+    uint64_t compression;
+};
+
+}
@@ -0,0 +1,45 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <SliceStore/SliceStoreRef.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <CompilationContext.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Build of a global/non-keyed aggregation. Lifts each record into the aggregation states of its worker thread in the
+/// KeylessAggregationSlice of the record, without going through a hash map.
+class KeylessAggregationBuildPhysicalOperator final : public WindowBuildPhysicalOperator
+{
+public:
+    KeylessAggregationBuildPhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        std::unique_ptr<TimeFunction> timeFunction,
+        std::unique_ptr<SliceStoreRef> sliceStoreRef,
+        std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions);
+    void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void execute(ExecutionContext& ctx, Record& record) const override;
+
+private:
+    std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
+};
+
+}
@@ -0,0 +1,65 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+
+/// This struct models the information for a keyless aggregation window trigger.
+/// The state buffers of all worker threads and slices of the window are stored as the children of the emitted tuple buffer.
+struct EmittedKeylessAggregationWindow
+{
+    EmittedKeylessAggregationWindow(const WindowInfo windowInfo, const uint64_t numberOfStateBuffers)
+        : windowInfo(windowInfo), numberOfStateBuffers(numberOfStateBuffers)
+    {
+    }
+
+    WindowInfo windowInfo;
+    uint64_t numberOfStateBuffers;
+};
+
+/// Operator handler of a global/non-keyed aggregation, whose slices are KeylessAggregationSlices
+class KeylessAggregationOperatorHandler final : public WindowBasedOperatorHandler
+{
+public:
+    KeylessAggregationOperatorHandler(
+        const std::vector<OriginId>& inputOrigins,
+        OriginId outputOriginId,
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        std::chrono::milliseconds originIdleTimeout);
+
+    [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+    getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
+
+protected:
+    void triggerSlices(
+        const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+        PipelineExecutionContext* pipelineCtx) override;
+};
+
+}
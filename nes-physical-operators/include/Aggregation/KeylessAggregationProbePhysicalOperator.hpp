@@ -0,0 +1,47 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Interface/RecordBuffer.hpp>
+#include <Operators/Windows/WindowMetaData.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+
+namespace NES
+{
+
+/// Probe of a global/non-keyed aggregation. Combines the aggregation states of all worker threads and slices of the emitted window
+/// into a single state and emits its lowered record.
+class KeylessAggregationProbePhysicalOperator final : public WindowProbePhysicalOperator
+{
+public:
+    KeylessAggregationProbePhysicalOperator(
+        std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
+        OperatorHandlerId operatorHandlerId,
+        WindowMetaData windowMetaData);
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+private:
+    std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
+    /// Sum of the state sizes of all aggregation functions
+    uint64_t sizeOfStatesInBytes;
+};
+
+}
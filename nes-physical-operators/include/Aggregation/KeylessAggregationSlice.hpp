@@ -0,0 +1,78 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+
+namespace NES
+{
+
+struct CreateNewKeylessAggregationSliceArgs final : CreateNewSlicesArguments
+{
+    explicit CreateNewKeylessAggregationSliceArgs(const uint64_t sizeOfStatesInBytes) : sizeOfStatesInBytes(sizeOfStatesInBytes) { }
+
+    ~CreateNewKeylessAggregationSliceArgs() override = default;
+    /// Sum of the state sizes of all aggregation functions
+    uint64_t sizeOfStatesInBytes;
+};
+
+/// Precedes the aggregation states in a state buffer. The states can only be reset by the traced build, so it resets them on the first
+/// record of a worker and then sets this flag.
+struct alignas(std::max_align_t) KeylessAggregationStateHeader
+{
+    bool initialized;
+};
+
+/// This class represents a single slice of a global/non-keyed aggregation. As there is only one group, it does not need a hash map:
+/// each worker thread updates its own aggregation states, and the probe combines the states of all worker threads directly.
+/// A state buffer holds a KeylessAggregationStateHeader followed by the states of all aggregation functions. It is allocated lazily,
+/// and its size is a multiple of the cache line size, so that no two worker threads write to the same cache line.
+/// Each worker thread has its own buffer rather than a slot in a shared one, as aggregation functions, e.g., the median, store child
+/// buffers in the buffer of their state, which is not thread-safe.
+class KeylessAggregationSlice final : public Slice
+{
+public:
+    KeylessAggregationSlice(
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const CreateNewKeylessAggregationSliceArgs& createNewKeylessAggregationSliceArgs,
+        uint64_t numberOfWorkerThreads);
+
+    [[nodiscard]] uint64_t getNumberOfStateBuffers() const;
+
+    /// Returns the state buffer of the worker thread, or nullptr if the worker thread has not seen a record of this slice.
+    /// Never allocates, so the trigger can call it without racing with a build worker thread that first-touches its state buffer.
+    [[nodiscard]] const TupleBuffer* getStateBufferRefForWorker(WorkerThreadId workerThreadId) const;
+
+    /// Returns the state buffer of the worker thread, lazily allocating it on first access
+    [[nodiscard]] const TupleBuffer*
+    getOrCreateStateBufferRefForWorker(AbstractBufferProvider& bufferProvider, WorkerThreadId workerThreadId);
+
+    /// Returns the size of a state buffer for aggregation states of the given size
+    [[nodiscard]] static uint64_t getStateBufferSize(uint64_t sizeOfStatesInBytes);
+
+private:
+    uint64_t sizeOfStatesInBytes;
+    std::vector<std::optional<TupleBuffer>> stateBuffers;
+};
+
+}
@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace NES
+{
+
+/// Mergeable sketch for approximate quantiles, following the merging t-digest of Dunning and Ertl.
+/// The sketch summarizes its input as weighted centroids. Centroids near the tails hold fewer values than the ones around the median,
+/// so extreme quantiles like p99 stay accurate. New values are buffered and merged into the centroids once the buffer is full.
+/// The sketch lives in a fixed-size memory area, so its size does not depend on the number of values it summarizes.
+/// As long as no centroids have been merged, the sketch stores every value and its quantiles are exact.
+class QuantileSketch
+{
+public:
+    /// Controls the trade-off between accuracy and size. The sketch keeps at most about this many centroids.
+    static constexpr uint64_t DEFAULT_COMPRESSION = 100;
+
+    [[nodiscard]] static uint64_t getSizeInBytes(uint64_t compression);
+    static void init(std::span<std::byte> memory, uint64_t compression);
+
+    /// Expects memory that has been initialized with init()
+    explicit QuantileSketch(std::span<std::byte> memory);
+
+    void add(double value, double weight = 1);
+    void merge(const QuantileSketch& other);
+
+    /// Returns the estimated value at the quantile, which has to lie in [0, 1]. Expects the sketch to not be empty.
+    [[nodiscard]] double getQuantile(double quantile);
+    [[nodiscard]] double getTotalWeight() const;
+
+private:
+    struct Header
+    {
+        uint64_t compression;
+        uint64_t capacity;
+        uint64_t numberOfCentroids;
+        double totalWeight;
+        double min;
+        double max;
+    };
+
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    /// Sorts all centroids and buffered values and merges neighbours as long as they stay within the size limit of the scale function
+    void compress();
+
+    Header* header;
+    /// The merged centroids, directly followed by the buffered values that have not been merged yet
+    std::span<Centroid> centroids;
+};
+
+}
@@ -0,0 +1,75 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+
+namespace NES
+{
+
+/// Partial aggregates for the incremental aggregation of sliding windows, following the chunked two-stacks scheme of van Herk and
+/// Gil-Werman. The time line is divided into chunks of ceil(windowSize / windowSlide) slides, which are at least as long as a window.
+/// Thus, every window consists of a suffix of one chunk and a prefix of the next one. For each slice, we store the aggregate of all
+/// slices from it to the end of its chunk (SUFFIX) and of all slices from the start of its chunk to it (PREFIX).
+/// A window then only combines two partial aggregates, while every partial aggregate is built once from its neighbour and one slice.
+/// Each partial aggregate is a hash map that holds the keys of one radix partition. Once built, they are immutable. Thus, the lock of
+/// a partition is only held while looking up or storing a partial aggregate, but never while a probe builds or combines one. If two
+/// probes build the same partial aggregate concurrently, both build the same hash map and the one stored first is kept.
+class SlidingWindowAggregates
+{
+public:
+    enum class Side : uint8_t
+    {
+        SUFFIX,
+        PREFIX
+    };
+
+    SlidingWindowAggregates(uint64_t windowSize, uint64_t windowSlide, uint64_t numberOfRadixPartitions);
+
+    /// Returns the index of the first slice that belongs to the prefix of the next chunk. Expects the slices to be sorted.
+    /// Returns 0 if the window starts at a chunk boundary, as the window is then a prefix of its chunk.
+    [[nodiscard]] uint64_t getFirstPrefixSlice(Timestamp windowStart, const std::vector<std::shared_ptr<Slice>>& sortedSlices) const;
+
+    /// Returns std::nullopt if no partial aggregate exists for the slice.
+    [[nodiscard]] std::optional<TupleBuffer> getPartialAggregate(Side side, SliceEnd sliceEnd, uint64_t partition) const;
+    /// Keeps the stored partial aggregate if another probe stored one for the slice in the meantime.
+    void storePartialAggregate(Side side, SliceEnd sliceEnd, uint64_t partition, const TupleBuffer& partialAggregate);
+
+    /// Removes the partial aggregates of all slices that can not be part of any window that has not been probed yet.
+    /// Probes hold copies of the partial aggregates they combine, so removing one does not invalidate a probe that is running.
+    void garbageCollect(Timestamp newGlobalWaterMark);
+
+private:
+    struct Partition
+    {
+        mutable std::mutex mutex;
+        std::map<SliceEnd, TupleBuffer> suffixes;
+        std::map<SliceEnd, TupleBuffer> prefixes;
+    };
+
+    uint64_t windowSize;
+    uint64_t chunkLength;
+    std::vector<std::unique_ptr<Partition>> partitions;
+};
+
+}
@@ -0,0 +1,118 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace NES
+{
+
+/// Mergeable sketch for the most frequent keys of a stream, following the Space-Saving algorithm of Metwally et al.
+/// The sketch monitors a fixed number of keys with a counter each. A key that is not monitored replaces the key with the smallest
+/// count and inherits its count as an error bound. Thus, a reported count overestimates the true count by at most its error, and
+/// every key that occurs more often than the total weight divided by the number of counters is guaranteed to be monitored.
+/// Two sketches merge following Agarwal et al.'s mergeable summaries, so per-worker sketches can be combined into a sketch of the window.
+///
+/// The sketch lives in a single memory area: a header, the counters as a structure of arrays, a hash index over the keys, a min-heap of
+/// the counters by count, and an area for the key bytes. Thus, adding a key takes O(1) to find its counter and O(log n) to keep the
+/// counter with the smallest count at the root of the heap. Keys are appended to the key area, which is compacted once it is full.
+/// All references within the memory area are indices, so the sketch stays valid if the memory area is copied.
+class SpaceSavingSketch
+{
+public:
+    /// Every reported key is backed by this many counters, which keeps the error bound of the reported keys low
+    static constexpr uint64_t COUNTERS_PER_REPORTED_KEY = 8;
+    /// The key area initially holds this many bytes per counter, which is enough for all fixed-size keys
+    static constexpr uint64_t INITIAL_KEY_BYTES_PER_COUNTER = 16;
+
+    struct Entry
+    {
+        std::span<const std::byte> key;
+        uint64_t count;
+        /// The count of the key is overestimated by at most this error
+        uint64_t error;
+    };
+
+    [[nodiscard]] static uint64_t getSizeInBytes(uint64_t numberOfCounters, uint64_t keyAreaSize);
+    static void init(std::span<std::byte> memory, uint64_t numberOfCounters, uint64_t keyAreaSize);
+
+    /// Expects memory that has been initialized with init()
+    explicit SpaceSavingSketch(std::span<std::byte> memory);
+
+    /// Adding a key and merging either succeed or leave the sketch unchanged and return false, if the key area can not hold the keys,
+    /// even after compacting it. In this case, the caller copies the sketch into one with a larger key area and tries again.
+    [[nodiscard]] bool add(std::span<const std::byte> key, uint64_t weight = 1);
+    [[nodiscard]] bool merge(const SpaceSavingSketch& other);
+
+    /// Copies all counters into the other sketch, which has to be empty and have the same number of counters
+    void copyInto(SpaceSavingSketch& other) const;
+
+    /// Returns up to k entries, ordered by descending count. Entries with the same count are ordered by their key bytes.
+    /// The keys point into the sketch and stay valid until the sketch is modified.
+    [[nodiscard]] std::vector<Entry> getTopK(uint64_t k) const;
+
+    [[nodiscard]] uint64_t getNumberOfCounters() const;
+    [[nodiscard]] uint64_t getKeyAreaSize() const;
+
+private:
+    struct Header
+    {
+        uint64_t numberOfCounters;
+        uint64_t numberOfUsedCounters;
+        uint64_t keyAreaSize;
+        uint64_t keyAreaUsed;
+    };
+
+    /// Marks an empty slot of the hash index, which otherwise holds the counter plus one
+    static constexpr uint32_t EMPTY_SLOT = 0;
+
+    /// The hash index uses linear probing and has at least twice as many slots as counters, which keeps the probe sequences short
+    [[nodiscard]] static uint64_t getNumberOfIndexSlots(uint64_t numberOfCounters);
+    [[nodiscard]] static uint64_t hashKey(std::span<const std::byte> key);
+    [[nodiscard]] std::span<const std::byte> getKey(uint64_t counter) const;
+    [[nodiscard]] std::optional<uint64_t> find(uint64_t hash, std::span<const std::byte> key) const;
+    [[nodiscard]] uint64_t getMinCount() const;
+
+    void insertIntoIndex(uint64_t counter);
+    void removeFromIndex(uint64_t counter);
+    /// Restores the heap order after the count of the counter at the position in the heap decreased or increased
+    void siftUp(uint64_t heapPosition);
+    void siftDown(uint64_t heapPosition);
+    /// Rebuilds the hash index and the heap from the counters, after all counters have been set at once
+    void rebuildIndexAndHeap();
+
+    /// Ensures that the key area can append keyLength bytes. The key of the counter that is going to be replaced does not need to be kept.
+    [[nodiscard]] bool reserveKeyBytes(uint64_t keyLength, std::optional<uint64_t> replacedCounter);
+    void compactKeyArea(std::optional<uint64_t> replacedCounter);
+    void setCounter(uint64_t counter, uint64_t hash, std::span<const std::byte> key, uint64_t count, uint64_t error);
+
+    Header* header;
+    std::span<uint64_t> hashes;
+    std::span<uint64_t> counts;
+    std::span<uint64_t> errors;
+    std::span<uint32_t> keyOffsets;
+    std::span<uint32_t> keyLengths;
+    /// The counters ordered as a binary min-heap by their count, and the position of every counter in the heap
+    std::span<uint32_t> heap;
+    std::span<uint32_t> heapPositions;
+    std::span<uint32_t> indexSlots;
+    std::span<std::byte> keyArea;
+};
+
+}
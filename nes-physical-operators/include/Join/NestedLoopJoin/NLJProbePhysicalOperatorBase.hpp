@@ -54,8 +54,13 @@ public:
         std::vector<Record::RecordFieldIdentifier> rightKeyFieldNames);
 
 protected:
+    /// Upper bound for the inner keys that performNLJ copies into one contiguous block, sized to stay within the L1 data cache
+    static constexpr uint64_t INNER_KEY_BLOCK_SIZE_IN_BYTES = 16 * 1024;
+
     /// Match-pairs nested-loop join: iterates outer × inner tuples, evaluates the join function on key fields,
     /// and emits joined records for matching pairs.
+    /// If innerKeyTupleLayout is set, the inner side is processed block-wise: the keys of a block of inner tuples are copied once into
+    /// a contiguous buffer, every outer tuple is evaluated against the whole block, and only matching inner tuples are read in full.
     void performNLJ(
         const PagedVectorRef& outerPagedVector,
         const PagedVectorRef& innerPagedVector,
@@ -63,10 +68,23 @@ protected:
         PagedVectorTupleLayout& innerTupleLayout,
         const std::vector<Record::RecordFieldIdentifier>& outerKeyFieldNames,
         const std::vector<Record::RecordFieldIdentifier>& innerKeyFieldNames,
+        const std::shared_ptr<PagedVectorTupleLayout>& innerKeyTupleLayout,
         ExecutionContext& executionCtx,
         const nautilus::val<Timestamp>& windowStart,
         const nautilus::val<Timestamp>& windowEnd) const;
 
+    /// Window and paged vectors of the single left and right slice that the trigger buffer of an inner join probe refers to
+    struct InnerProbeInput
+    {
+        nautilus::val<Timestamp> windowStart;
+        nautilus::val<Timestamp> windowEnd;
+        PagedVectorRef leftPagedVector;
+        PagedVectorRef rightPagedVector;
+    };
+
+    /// Parses the trigger buffer of an inner join probe, which always refers to one left and one right slice, and opens their paged vectors
+    InnerProbeInput openInnerProbeInput(ExecutionContext& executionCtx, const RecordBuffer& recordBuffer) const;
+
     /// Resolves the slice owning `sliceEnd` via the operator handler and returns the buffer ref backing its
     /// `side` PagedVector (worker-thread 0, where all pages are consolidated at trigger time). Wrap the result
     /// in BorrowedNautilusBuffer::from(...) together with the matching tuple layout to build a PagedVectorRef.
@@ -77,5 +95,8 @@ protected:
     std::shared_ptr<PagedVectorTupleLayout> rightTupleLayout;
     std::vector<Record::RecordFieldIdentifier> leftKeyFieldNames;
     std::vector<Record::RecordFieldIdentifier> rightKeyFieldNames;
+    /// Layouts of the key fields in the key blocks of performNLJ. nullptr if a side has no or variable-sized key fields.
+    std::shared_ptr<PagedVectorTupleLayout> leftKeyTupleLayout;
+    std::shared_ptr<PagedVectorTupleLayout> rightKeyTupleLayout;
 };
 }
@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <Functions/PhysicalFunction.hpp>
+#include <Interface/PagedVector/PagedVectorRef.hpp>
+#include <Interface/Record.hpp>
+#include <Interface/RecordBuffer.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperatorBase.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Operators/Windows/WindowMetaData.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <ExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Band condition `minDistance <= rightKey - leftKey <= maxDistance` between two integral key fields. A missing bound leaves the
+/// distance unbounded in this direction.
+struct SortMergeJoinBand
+{
+    Record::RecordFieldIdentifier leftKeyField;
+    Record::RecordFieldIdentifier rightKeyField;
+    /// UINT64 keys are mapped onto the signed sort key by flipping their most significant bit, which preserves their order
+    bool biasedUnsignedKeys;
+    std::optional<int64_t> minDistance;
+    std::optional<int64_t> maxDistance;
+};
+
+/// Performs the probe of inner joins whose join function contains a band or inequality condition. It reads the same slices as the NLJ
+/// probe, sorts the tuples of both sides on their key and, for every left tuple in key order, only visits the right tuples whose key
+/// lies within the band. As the left keys ascend, the band moves monotonically over the sorted right side.
+/// The complete join function is still evaluated on every candidate pair, so conditions besides the band are respected.
+class SortMergeJoinProbePhysicalOperator final : public NLJProbePhysicalOperatorBase
+{
+public:
+    SortMergeJoinProbePhysicalOperator(
+        OperatorHandlerId operatorHandlerId,
+        PhysicalFunction joinFunction,
+        WindowMetaData windowMetaData,
+        const JoinSchema& joinSchema,
+        std::shared_ptr<PagedVectorTupleLayout> leftTupleLayout,
+        std::shared_ptr<PagedVectorTupleLayout> rightTupleLayout,
+        std::vector<Record::RecordFieldIdentifier> leftKeyFieldNames,
+        std::vector<Record::RecordFieldIdentifier> rightKeyFieldNames,
+        SortMergeJoinBand band);
+
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
+
+    static constexpr bool supportsJoinType(JoinLogicalOperator::JoinType joinType) noexcept
+    {
+        return joinType == JoinLogicalOperator::JoinType::INNER_JOIN;
+    }
+
+private:
+    /// Writes a (sort key, position) entry for every tuple of the paged vector into arena memory and sorts the entries on their key
+    nautilus::val<int8_t*> createSortedEntries(
+        const PagedVectorRef& pagedVector, const Record::RecordFieldIdentifier& keyField, ExecutionContext& executionCtx) const;
+
+    SortMergeJoinBand band;
+};
+
+}
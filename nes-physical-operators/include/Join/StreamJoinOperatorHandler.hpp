@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <variant>
@@ -47,7 +48,8 @@ public:
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
         std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-        JoinTriggerStrategy triggerStrategy);
+        JoinTriggerStrategy triggerStrategy,
+        std::chrono::milliseconds originIdleTimeout);
 
 protected:
     /// Delegates to the configured JoinTriggerStrategy for each triggered window.
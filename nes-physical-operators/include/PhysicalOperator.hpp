@@ -28,6 +28,7 @@
 #include <Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Interface/Record.hpp>
 #include <Interface/RecordBuffer.hpp>
+#include <Operators/LogicalOperator.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Schema/Schema.hpp>
 #include <Schema/SchemaFwd.hpp>
@@ -282,6 +283,11 @@ public:
     [[nodiscard]] const std::optional<OperatorHandlerId>& getHandlerId() const;
     [[nodiscard]] PipelineLocation getPipelineLocation() const;
 
+    /// The logical operator whose lowering produced this physical operator. Two wrappers lowered from equal logical operators,
+    /// with equal schemas and layouts, and under the same QueryExecutionConfiguration, trace to the same code.
+    [[nodiscard]] const std::optional<LogicalOperator>& getLoweredFrom() const;
+    void setLoweredFrom(LogicalOperator logicalOperator);
+
 private:
     PhysicalOperator physicalOperator;
     std::optional<MemoryLayoutType> inputMemoryLayoutType;
@@ -293,6 +299,7 @@ private:
     std::optional<std::shared_ptr<OperatorHandler>> handler;
     std::optional<OperatorHandlerId> handlerId;
     PipelineLocation pipelineLocation;
+    std::optional<LogicalOperator> loweredFrom;
 };
 }
 
@@ -32,6 +32,7 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/SliceRing.hpp>
 #include <SliceStore/SliceStoreRef.hpp>
 #include <Time/Timestamp.hpp>
 #include <SliceCacheConfiguration.hpp>
@@ -55,7 +56,9 @@ struct SlicesAndState
 class DefaultTimeBasedSliceStore final : public WindowSlicesStoreInterface
 {
 public:
-    DefaultTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide, SliceCacheConfiguration sliceCacheConfiguration);
+    /// A slice ring capacity of 0 stores all slices in the synchronized slice map
+    DefaultTimeBasedSliceStore(
+        uint64_t windowSize, uint64_t windowSlide, SliceCacheConfiguration sliceCacheConfiguration, uint64_t sliceRingCapacity);
 
     ~DefaultTimeBasedSliceStore() override;
     std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
@@ -77,6 +80,16 @@ public:
         DefaultTimeBasedSliceStoreRef::DataStructureExtractor extractor, DefaultTimeBasedSliceStoreRef::CreateSlicesFunction creator);
 
 private:
+    /// Adds the newly created slice to all windows that contain it
+    void addSliceToWindows(const std::shared_ptr<Slice>& newSlice, std::map<WindowInfo, SlicesAndState>& lockedWindows) const;
+
+    /// Looks up or creates the slice in its slot of the slice ring. Returns nullptr, if the slot is occupied by another slice.
+    std::shared_ptr<Slice> getOrCreateRingSlice(
+        uint64_t sliceNumber,
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice);
+
     SliceCacheConfiguration sliceCacheConfiguration;
     folly::Synchronized<std::unordered_map<PipelineId, std::unique_ptr<TupleBuffer>>> pipelineIdToSliceCacheStarts;
 
@@ -86,6 +99,12 @@ private:
     folly::Synchronized<std::map<SliceEnd, std::shared_ptr<Slice>>> slices;
     SliceAssigner sliceAssigner;
 
+    /// Lock-free index of the slices, which spares all lookups of existing slices the contended slices lock.
+    /// Creating a slice still locks the slices and windows once, as the slice has to be added to its windows. A slice whose slot is
+    /// occupied, as more slices are alive than the ring has slots, is stored in the slices map instead. All creations check both the
+    /// ring and the map while holding the slices lock, so there is never more than one slice per slice end.
+    std::unique_ptr<SliceRing> sliceRing;
+
     /// We need to store the sequence number for the triggerable window infos. This is necessary, as we have to ensure that the sequence number is unique
     /// and increases for each window info.
     std::atomic<SequenceNumber::Underlying> sequenceNumber;
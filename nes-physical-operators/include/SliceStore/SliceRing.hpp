@@ -0,0 +1,115 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+
+namespace NES
+{
+
+/// Fixed-capacity ring of slices, indexed by the slice number modulo its capacity.
+/// As the slice boundaries are arithmetic, every slice start maps onto a unique and monotonically increasing slice number. Thus, the
+/// slices that are alive at the same time, i.e., the ones between the global watermark and the newest timestamp, occupy consecutive
+/// slots. Every slot has an atomic tag that stores the slice number and the state of the slot:
+///     Current State |     Action                         | Next State
+/// ---------------------------------------------------------------------------
+///     EMPTY         | claim                              | CREATING
+///     CREATING      | publish                            | READY
+///     CREATING      | abandon                            | EMPTY
+///     READY         | recycle (slice is below watermark) | RECYCLING
+///     RECYCLING     | all readers have left the slot     | EMPTY
+/// Lookups and creations do not take any lock. A lookup pins the slot via a reader counter, so that recycling waits until no thread
+/// copies the slice anymore. If the slot of a slice number is occupied by another slice, the caller has to store the slice elsewhere.
+class SliceRing
+{
+public:
+    enum class ClaimResult : uint8_t
+    {
+        /// The caller owns the slot and must either publish or abandon it
+        CLAIMED,
+        /// The slot already holds the slice number
+        PRESENT,
+        /// The slot holds another slice number
+        OCCUPIED
+    };
+
+    /// Rounds the capacity up to the next power of two, so that the slot of a slice number is a simple bit mask
+    SliceRing(uint64_t capacity, const SliceAssigner& sliceAssigner);
+
+    /// Maps the slice start onto its slice number. Returns nullopt if the slice number can not be encoded into a slot tag.
+    [[nodiscard]] std::optional<uint64_t> getSliceNumber(SliceStart sliceStart) const;
+
+    /// Returns the slice, if its slot currently holds it
+    [[nodiscard]] std::shared_ptr<Slice> find(uint64_t sliceNumber);
+
+    /// Claims the slot for the slice number. Waits if another thread is creating or recycling the same slice number.
+    ClaimResult claim(uint64_t sliceNumber);
+    void publish(uint64_t sliceNumber, std::shared_ptr<Slice> slice);
+    void abandon(uint64_t sliceNumber);
+
+    /// Empties all slots whose slice can be recycled. Returns their slices, so that the caller destroys them outside of the ring.
+    std::vector<std::shared_ptr<Slice>> recycle(const std::function<bool(SliceEnd)>& canBeRecycled);
+
+    /// Empties all slots. Must not be called concurrently to any other method.
+    void clear();
+
+    [[nodiscard]] uint64_t getCapacity() const;
+
+private:
+    enum class SlotState : uint8_t
+    {
+        EMPTY = 0,
+        CREATING = 1,
+        READY = 2,
+        RECYCLING = 3
+    };
+
+    static constexpr uint64_t STATE_BITS = 2;
+    static constexpr uint64_t STATE_MASK = (uint64_t{1} << STATE_BITS) - 1;
+
+    static uint64_t toTag(uint64_t sliceNumber, SlotState state);
+    static SlotState getState(uint64_t tag);
+    static uint64_t getSliceNumberOfTag(uint64_t tag);
+
+    /// Each slot lives in its own cache line, as threads of different slices should not invalidate each other's slots
+    struct alignas(std::hardware_destructive_interference_size) Slot
+    {
+        std::atomic<uint64_t> tag{0};
+        std::atomic<uint64_t> readers{0};
+        /// Only written in the CREATING and RECYCLING states, i.e., while no reader can copy it
+        std::shared_ptr<Slice> slice;
+        /// Atomic, as recycle reads it without pinning the slot to check whether the slot is worth recycling
+        std::atomic<SliceEnd::Underlying> sliceEnd{Timestamp::INITIAL_VALUE};
+    };
+
+    Slot& getSlot(uint64_t sliceNumber);
+
+    std::vector<Slot> slots;
+    uint64_t slotMask;
+    /// If the window size is a multiple of the slide, all slices start at a multiple of the slide. Otherwise, every slide contains a
+    /// second slice boundary at an offset of windowSize % windowSlide, which is why we need two slice numbers per slide.
+    uint64_t windowSlide;
+    bool twoSlicesPerSlide;
+};
+
+}
@@ -13,7 +13,11 @@
 */
 
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
@@ -25,16 +29,29 @@ namespace NES
 {
 
 /// @brief A multi origin version of the lock free watermark processor.
+/// The watermark is the minimum across all origins, so a single quiet origin holds back the watermark of all others. With an idle
+/// timeout, an origin that has not delivered a buffer for longer than the timeout is left out of the minimum until its next buffer
+/// arrives. As the watermark never moves backwards, tuples that a resumed origin delivers behind it are late.
+/// The idle timers start with the first buffer of any origin, as the processor is created when the query is lowered, which may be
+/// long before the query starts. Thus, an origin that never delivers a buffer becomes idle one timeout after the first buffer arrived.
 class MultiOriginWatermarkProcessor
 {
 public:
-    explicit MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins);
-    static std::shared_ptr<MultiOriginWatermarkProcessor> create(const std::vector<OriginId>& origins);
+    /// Returns the current time of the idle timers. Tests replace it to control the passing of time.
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    /// An idle timeout of zero waits for every origin indefinitely
+    explicit MultiOriginWatermarkProcessor(
+        const std::vector<OriginId>& origins,
+        std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero(),
+        Clock clock = [] { return std::chrono::steady_clock::now(); });
+    static std::shared_ptr<MultiOriginWatermarkProcessor>
+    create(const std::vector<OriginId>& origins, std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::zero());
 
     /// @brief Updates the watermark timestamp and origin and emits the current watermark.
     [[nodiscard]] Timestamp updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const;
 
-    /// @brief Returns the current watermark across all origins
+    /// @brief Returns the current watermark across all origins that are not idle
     [[nodiscard]] Timestamp getCurrentWatermark() const;
 
     std::string getCurrentStatus();
@@ -42,6 +59,14 @@ public:
 private:
     const std::vector<OriginId> origins;
     std::vector<std::shared_ptr<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>> watermarkProcessors;
+    const std::chrono::steady_clock::duration idleTimeout;
+    const Clock clock;
+    /// Clock ticks at which each origin delivered its last buffer. NOT_STARTED marks origins that can not be idle yet.
+    static constexpr auto NOT_STARTED = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+    mutable std::vector<std::atomic<std::chrono::steady_clock::rep>> lastActivity;
+    mutable std::atomic<bool> idleTimersStarted{false};
+    /// Highest watermark returned so far, which keeps the watermark monotonic if an idle origin resumes behind it
+    mutable std::atomic<uint64_t> currentWatermark{Timestamp::INITIAL_VALUE};
 };
 
 }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -57,10 +58,13 @@ struct BufferMetaData
 class WindowBasedOperatorHandler : public OperatorHandler
 {
 public:
+    /// Input origins that have not delivered a buffer for longer than originIdleTimeout no longer hold back the windows of the other
+    /// origins; zero waits for every input origin indefinitely
     WindowBasedOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
-        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore);
+        std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+        std::chrono::milliseconds originIdleTimeout);
 
     ~WindowBasedOperatorHandler() override = default;
 
@@ -92,6 +96,9 @@ protected:
         PipelineExecutionContext* pipelineCtx)
         = 0;
 
+    /// Gives the specific operator handler the chance to release its own state, once the slices and windows have been garbage collected
+    virtual void garbageCollectOperatorState(Timestamp) const { }
+
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore;
     std::unique_ptr<MultiOriginWatermarkProcessor> watermarkProcessorBuild;
     std::unique_ptr<MultiOriginWatermarkProcessor> watermarkProcessorProbe;
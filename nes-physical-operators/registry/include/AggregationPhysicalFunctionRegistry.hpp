@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -38,6 +39,10 @@ struct AggregationPhysicalFunctionRegistryArguments
     Record::RecordFieldIdentifier resultFieldIdentifier;
     std::optional<std::shared_ptr<PagedVectorTupleLayout>> tupleLayout;
     bool includeNullValues;
+    /// Only set for approximate quantiles: the quantile in [0, 1] that is estimated
+    std::optional<double> quantile;
+    /// Only set for top-k aggregations: the number of most frequent values that are reported
+    std::optional<uint64_t> k;
 };
 
 using AggregationPhysicalFunctionFn
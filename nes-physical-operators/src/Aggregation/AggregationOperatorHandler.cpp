@@ -26,12 +26,14 @@
 #include <utility>
 #include <vector>
 #include <Aggregation/AggregationSlice.hpp>
+#include <Aggregation/SlidingWindowAggregates.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Interface/HashMap/HashMap.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <HashMapSlice.hpp>
@@ -44,9 +46,30 @@ namespace NES
 AggregationOperatorHandler::AggregationOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
-    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
-    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore)), setupAlreadyCalled(false)
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const uint64_t numberOfRadixPartitions,
+    std::unique_ptr<SlidingWindowAggregates> slidingWindowAggregates,
+    const std::chrono::milliseconds originIdleTimeout)
+    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore), originIdleTimeout)
+    , setupAlreadyCalled(false)
+    , numberOfRadixPartitions(numberOfRadixPartitions)
+    , slidingWindowAggregates(std::move(slidingWindowAggregates))
 {
+    PRECONDITION(numberOfRadixPartitions > 0, "An aggregation needs at least one radix partition");
+}
+
+SlidingWindowAggregates& AggregationOperatorHandler::getSlidingWindowAggregates() const
+{
+    PRECONDITION(slidingWindowAggregates != nullptr, "The windows of this aggregation are not aggregated incrementally");
+    return *slidingWindowAggregates;
+}
+
+void AggregationOperatorHandler::garbageCollectOperatorState(const Timestamp newGlobalWaterMark) const
+{
+    if (slidingWindowAggregates)
+    {
+        slidingWindowAggregates->garbageCollect(newGlobalWaterMark);
+    }
 }
 
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
@@ -68,14 +91,27 @@ void AggregationOperatorHandler::triggerSlices(
     const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
     PipelineExecutionContext* pipelineCtx)
 {
-    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    for (const auto& [windowInfo, windowSlices] : slicesAndWindowInfo)
     {
-        /// Getting all hashmaps for each slice that has at least one tuple
+        /// The incremental aggregation builds its partial aggregates along the time line, so it needs the slices in order
+        std::vector<std::shared_ptr<Slice>> sortedSlices;
+        std::vector<EmittedAggregationSlice> emittedSlices;
+        uint64_t firstPrefixSlice = 0;
+        if (slidingWindowAggregates)
+        {
+            sortedSlices = windowSlices;
+            std::ranges::sort(sortedSlices, {}, [](const auto& slice) { return slice->getSliceEnd(); });
+            firstPrefixSlice = slidingWindowAggregates->getFirstPrefixSlice(windowInfo.windowInfo.windowStart, sortedSlices);
+        }
+        const auto& allSlices = slidingWindowAggregates ? sortedSlices : windowSlices;
+
+        /// Getting all hashmaps for each slice that has at least one tuple, and how many tuples each radix partition holds over all of them
         std::vector<TupleBuffer> allHashMapBuffers;
-        uint64_t totalNumberOfTuples = 0;
+        std::vector<uint64_t> numberOfTuplesPerPartition(numberOfRadixPartitions, 0);
         for (const auto& slice : allSlices)
         {
             const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
+            const auto firstHashMapOfSlice = allHashMapBuffers.size();
             for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMaps(); ++hashMapIdx)
             {
                 /// Read-only: a hash map no build worker ever touched for this slice is simply skipped rather than
@@ -88,56 +124,96 @@ void AggregationOperatorHandler::triggerSlices(
                 }
                 if (const ChainedHashMap hashMap = ChainedHashMap::load(*hashMapBuffer); hashMap.getTotalNumberOfRecords() > 0)
                 {
+                    INVARIANT(
+                        hashMap.getNumberOfRadixPartitions() == numberOfRadixPartitions,
+                        "Hash map has {} radix partitions, but the aggregation expects {}",
+                        hashMap.getNumberOfRadixPartitions(),
+                        numberOfRadixPartitions);
                     allHashMapBuffers.emplace_back(*hashMapBuffer);
-                    totalNumberOfTuples += hashMap.getTotalNumberOfRecords();
+                    for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
+                    {
+                        numberOfTuplesPerPartition[partition] += hashMap.getNumberOfRecords(partition);
+                    }
                 }
             }
+            if (slidingWindowAggregates)
+            {
+                emittedSlices.emplace_back(
+                    slice->getSliceEnd().getRawValue(), firstHashMapOfSlice, allHashMapBuffers.size() - firstHashMapOfSlice);
+            }
         }
 
-
-        /// We need a buffer that is large enough to store an EmittedAggregationWindow
-        constexpr auto neededBufferSize = sizeof(EmittedAggregationWindow);
-        const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
-        if (not tupleBufferVal.has_value())
+        /// Partitions hold disjoint keys, so each one is merged and lowered by its own probe task. Empty partitions need no
+        /// task, but a window without any tuple still emits partition 0, as downstream operators expect every sequence number.
+        std::vector<uint64_t> partitionsToEmit;
+        for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
         {
-            throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
+            if (numberOfTuplesPerPartition[partition] > 0)
+            {
+                partitionsToEmit.emplace_back(partition);
+            }
         }
-        auto tupleBuffer = tupleBufferVal.value();
-        /// Store each hash map buffer as a child so the probe can load them via loadChildBuffer(i)
-        for (auto hashMapBuffer : allHashMapBuffers)
+        if (partitionsToEmit.empty())
         {
-            std::ignore = tupleBuffer.storeChildBuffer(hashMapBuffer);
+            partitionsToEmit.emplace_back(0);
         }
 
-        /// It might be that the buffer is not zeroed out.
-        std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
-
-        /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
-        /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
-        tupleBuffer.setOriginId(outputOriginId);
-        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
-        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
-        tupleBuffer.setLastChunk(true);
-        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
-        tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-        tupleBuffer.setCreationTimestampInMS(Timestamp(
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
-
-
-        /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
-        auto tmp = tupleBuffer.getAvailableMemoryArea();
-        new (tmp.data()) EmittedAggregationWindow{windowInfo.windowInfo, allHashMapBuffers.size()};
-
-
-        /// Dispatching the buffer to the probe operator via the task queue.
-        pipelineCtx->emitBuffer(tupleBuffer);
-        NES_TRACE(
-            "Emitted window {}-{} with watermarkTs {} sequenceNumber {} originId {}",
-            windowInfo.windowInfo.windowStart,
-            windowInfo.windowInfo.windowEnd,
-            tupleBuffer.getWatermark(),
-            tupleBuffer.getSequenceNumber(),
-            tupleBuffer.getOriginId());
+        for (uint64_t chunk = 0; chunk < partitionsToEmit.size(); ++chunk)
+        {
+            const auto partition = partitionsToEmit[chunk];
+
+            /// We need a buffer that is large enough to store an EmittedAggregationWindow, followed by its slices
+            const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (emittedSlices.size() * sizeof(EmittedAggregationSlice));
+            const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+            if (not tupleBufferVal.has_value())
+            {
+                throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
+            }
+            auto tupleBuffer = tupleBufferVal.value();
+            /// Store each hash map buffer as a child so the probe can load them via loadChildBuffer(i). All probe tasks of a
+            /// window share the hash maps, but only read the entries of their own partition.
+            for (auto hashMapBuffer : allHashMapBuffers)
+            {
+                std::ignore = tupleBuffer.storeChildBuffer(hashMapBuffer);
+            }
+
+            /// It might be that the buffer is not zeroed out.
+            std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
+
+            /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+            /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
+            tupleBuffer.setOriginId(outputOriginId);
+            tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
+            tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL + chunk));
+            tupleBuffer.setLastChunk(chunk + 1 == partitionsToEmit.size());
+            tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
+            tupleBuffer.setNumberOfTuples(numberOfTuplesPerPartition[partition]);
+            tupleBuffer.setCreationTimestampInMS(Timestamp(
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch())
+                    .count()));
+
+
+            /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
+            auto tmp = tupleBuffer.getAvailableMemoryArea();
+            new (tmp.data()) EmittedAggregationWindow{
+                windowInfo.windowInfo, allHashMapBuffers.size(), partition, emittedSlices.size(), firstPrefixSlice};
+            /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto* emittedSlicesStart = reinterpret_cast<EmittedAggregationSlice*>(tmp.data() + sizeof(EmittedAggregationWindow));
+            std::ranges::copy(emittedSlices, emittedSlicesStart);
+
+
+            /// Dispatching the buffer to the probe operator via the task queue, so that the partitions are probed by all worker threads.
+            pipelineCtx->emitBuffer(tupleBuffer, PipelineExecutionContext::ContinuationPolicy::NEVER);
+            NES_TRACE(
+                "Emitted partition {} of window {}-{} with watermarkTs {} sequenceNumber {} chunkNumber {} originId {}",
+                partition,
+                windowInfo.windowInfo.windowStart,
+                windowInfo.windowInfo.windowEnd,
+                tupleBuffer.getWatermark(),
+                tupleBuffer.getSequenceNumber(),
+                tupleBuffer.getChunkNumber(),
+                tupleBuffer.getOriginId());
+        }
     }
 }
 
@@ -16,10 +16,12 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/SlidingWindowAggregates.hpp>
 #include <DataTypes/DataTypesUtil.hpp>
 #include <Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
@@ -31,8 +33,10 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
@@ -46,6 +50,288 @@
 namespace NES
 {
 
+namespace
+{
+using Side = SlidingWindowAggregates::Side;
+
+void loadChildHashMapProxy(TupleBuffer* parent, const uint64_t hashMapIdx, TupleBuffer* hashMapBuffer)
+{
+    INVARIANT(parent != nullptr, "Parent Tuplebuffer MUST NOT be null at this point");
+    const ChildBufferIndex bufferIndex{static_cast<ChildBufferIndex::Underlying>(hashMapIdx)};
+    *hashMapBuffer = parent->loadChildBuffer(bufferIndex);
+}
+
+SlidingWindowAggregates& getSlidingWindowAggregates(OperatorHandler* operatorHandler)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    return dynamic_cast<AggregationOperatorHandler&>(*operatorHandler).getSlidingWindowAggregates();
+}
+
+/// Looks up the partial aggregate that lies closest to the window boundary, i.e., the suffix with the smallest and the prefix with the
+/// largest slice index, and copies it to `partialAggregate`. Returns the index of the slice of the found suffix, or the index after the
+/// slice of the found prefix, which is where the probe starts building the missing ones. Returns the first prefix slice if none exists.
+template <Side side>
+uint64_t findPartialAggregateProxy(OperatorHandler* operatorHandler, EmittedAggregationWindow* window, TupleBuffer* partialAggregate)
+{
+    PRECONDITION(window != nullptr, "The emitted aggregation window should not be null");
+    const auto& slidingWindowAggregates = getSlidingWindowAggregates(operatorHandler);
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) the slices are laid out right after the window
+    const std::span slices{reinterpret_cast<const EmittedAggregationSlice*>(window + 1), window->numberOfSlices};
+    if constexpr (side == Side::SUFFIX)
+    {
+        for (uint64_t sliceIdx = 0; sliceIdx < window->firstPrefixSlice; ++sliceIdx)
+        {
+            if (auto suffix = slidingWindowAggregates.getPartialAggregate(side, SliceEnd(slices[sliceIdx].sliceEnd), window->partition))
+            {
+                *partialAggregate = std::move(*suffix);
+                return sliceIdx;
+            }
+        }
+    }
+    else
+    {
+        for (uint64_t sliceIdx = window->numberOfSlices; sliceIdx > window->firstPrefixSlice; --sliceIdx)
+        {
+            if (auto prefix = slidingWindowAggregates.getPartialAggregate(side, SliceEnd(slices[sliceIdx - 1].sliceEnd), window->partition))
+            {
+                *partialAggregate = std::move(*prefix);
+                return sliceIdx;
+            }
+        }
+    }
+    return window->firstPrefixSlice;
+}
+
+template <Side side>
+void storePartialAggregateProxy(OperatorHandler* operatorHandler, const uint64_t sliceEnd, const uint64_t partition, TupleBuffer* buffer)
+{
+    getSlidingWindowAggregates(operatorHandler).storePartialAggregate(side, SliceEnd(sliceEnd), partition, *buffer);
+}
+
+void assignBufferProxy(TupleBuffer* target, TupleBuffer* source)
+{
+    *target = *source;
+}
+
+nautilus::val<int8_t*> getEmittedSliceRef(const nautilus::val<int8_t*>& aggregationWindowRef, const nautilus::val<uint64_t>& sliceIdx)
+{
+    return aggregationWindowRef + sizeof(EmittedAggregationWindow) + (sliceIdx * nautilus::val<uint64_t>(sizeof(EmittedAggregationSlice)));
+}
+
+nautilus::val<uint64_t> getEmittedSliceEnd(const nautilus::val<int8_t*>& aggregationWindowRef, const nautilus::val<uint64_t>& sliceIdx)
+{
+    const auto sliceRef = getEmittedSliceRef(aggregationWindowRef, sliceIdx);
+    return readValueFromMemRef<uint64_t>(getMemberRef(sliceRef, &EmittedAggregationSlice::sliceEnd));
+}
+}
+
+void AggregationProbePhysicalOperator::createHashMap(const nautilus::val<TupleBuffer*>& hashMapBuffer, ExecutionContext& executionCtx) const
+{
+    /// Its sizing is the same as the per-worker maps it merges, and that is a query-compile-time constant, so it comes from hashMapConfig
+    /// rather than being read back out of one of the input maps. The proxy takes the numbers individually: a non-capturing lambda cannot
+    /// receive the config itself. The map only ever holds one radix partition, so it is not partitioned itself.
+    nautilus::invoke(
+        +[](AbstractBufferProvider* bufferProvider,
+            TupleBuffer* finalHashMapBuffer IF_PRECONDITION(, const uint64_t entrySize),
+            const uint64_t numberOfBuckets IF_PRECONDITION(, const uint64_t pageSize),
+            const uint64_t bloomBytes,
+            const bool swissIndex)
+        {
+            const auto index = swissIndex ? HashMapIndex::SWISS : HashMapIndex::CHAINED;
+            const auto neededFinalBufferSize = ChainedHashMap::calculateBufferSize(numberOfBuckets, bloomBytes, index);
+            std::optional<TupleBuffer> finalHashMapTupleBuffer = bufferProvider->getUnpooledBuffer(neededFinalBufferSize);
+            if (not finalHashMapTupleBuffer.has_value())
+            {
+                throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededFinalBufferSize);
+            }
+            /// initialize the final hash map tuple buffer
+            *finalHashMapBuffer = finalHashMapTupleBuffer.value();
+            ChainedHashMap::init(
+                *finalHashMapBuffer IF_PRECONDITION(, entrySize), numberOfBuckets IF_PRECONDITION(, pageSize), bloomBytes, 1, index);
+        },
+        executionCtx.pipelineMemoryProvider.bufferProvider,
+        hashMapBuffer IF_PRECONDITION(, nautilus::val<uint64_t>{hashMapConfig.entrySize}),
+        nautilus::val<uint64_t>{hashMapConfig.numberOfBuckets} IF_PRECONDITION(, nautilus::val<uint64_t>{hashMapConfig.pageSize}),
+        nautilus::val<uint64_t>{hashMapConfig.bloomFilterMemAreaSize()},
+        nautilus::val<bool>{hashMapConfig.usesSwissIndex()});
+}
+
+void AggregationProbePhysicalOperator::combineHashMap(
+    ChainedHashMapRef& targetHashMap,
+    const nautilus::val<TupleBuffer*>& targetHashMapBuffer,
+    const nautilus::val<TupleBuffer*>& sourceHashMapBuffer,
+    const nautilus::val<uint64_t>& partition,
+    ExecutionContext& executionCtx) const
+{
+    const ChainedHashMapRef currentMap{sourceHashMapBuffer, hashMapConfig};
+    const auto partitionEnd = currentMap.endPartition(partition);
+    for (auto entryIt = currentMap.beginPartition(partition); entryIt != partitionEnd; ++entryIt)
+    {
+        const auto entry = *entryIt;
+        const ChainedHashMapRef::ChainedEntryRef entryRef{entry, sourceHashMapBuffer, hashMapConfig.fieldKeys, hashMapConfig.fieldValues};
+        const auto tmpRecordKey = entryRef.getKey();
+
+        /// Inserting the record key into the target hash map. If an entry for the key already exists, we have to combine the aggregation states
+        /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
+        targetHashMap.insertOrUpdateEntry(
+            entryRef.entryRef,
+            [fieldKeys = hashMapConfig.fieldKeys,
+             fieldValues = hashMapConfig.fieldValues,
+             &executionCtx,
+             &entryRef,
+             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+             pinnedFinalBuffer = targetHashMapBuffer,
+             hashMapBufferRef = sourceHashMapBuffer](const nautilus::val<AbstractHashMapEntry*>& entryOnUpdate)
+            {
+                /// Combining the aggregation states of the current entry with the aggregation states of the target hash map
+                const ChainedHashMapRef::ChainedEntryRef entryRefOnInsert{entryOnUpdate, pinnedFinalBuffer, fieldKeys, fieldValues};
+                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    aggFunction->combine(
+                        globalState, pinnedFinalBuffer, entryRefState, hashMapBufferRef, executionCtx.pipelineMemoryProvider);
+                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                    entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
+                }
+            },
+            [fieldKeys = hashMapConfig.fieldKeys,
+             fieldValues = hashMapConfig.fieldValues,
+             &executionCtx,
+             &entryRef,
+             &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
+             pinnedFinalBuffer = targetHashMapBuffer,
+             hashMapBufferRef = sourceHashMapBuffer](const nautilus::val<AbstractHashMapEntry*>& entryOnInsert)
+            {
+                /// If the entry for the provided key has not been seen by this hash map / worker thread, we need
+                /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
+                const ChainedHashMapRef::ChainedEntryRef entryRefOnInsert{entryOnInsert, pinnedFinalBuffer, fieldKeys, fieldValues};
+                auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
+                auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
+                for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+                {
+                    /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
+                    aggFunction->reset(globalState, pinnedFinalBuffer, executionCtx.pipelineMemoryProvider);
+                    aggFunction->combine(
+                        globalState, pinnedFinalBuffer, entryRefStatePtr, hashMapBufferRef, executionCtx.pipelineMemoryProvider);
+                    globalState = globalState + aggFunction->getSizeOfStateInBytes();
+                    entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
+                }
+            },
+            executionCtx.pipelineMemoryProvider.bufferProvider);
+    }
+}
+
+void AggregationProbePhysicalOperator::buildPartialAggregate(
+    const SlidingWindowAggregates::Side side,
+    const nautilus::val<OperatorHandler*>& operatorHandler,
+    const RecordBuffer& recordBuffer,
+    const nautilus::val<uint64_t>& sliceIdx,
+    OwnedNautilusBuffer& neighbour,
+    const nautilus::val<bool>& hasNeighbour,
+    const nautilus::val<uint64_t>& partition,
+    ExecutionContext& executionCtx) const
+{
+    const auto aggregationWindowRef = recordBuffer.getMemArea();
+    const auto storePartialAggregate
+        = side == Side::SUFFIX ? storePartialAggregateProxy<Side::SUFFIX> : storePartialAggregateProxy<Side::PREFIX>;
+
+    OwnedNautilusBuffer partialAggregateNautilusBuffer;
+    createHashMap(partialAggregateNautilusBuffer.asArg(), executionCtx);
+    auto partialAggregateBufferRef = partialAggregateNautilusBuffer.asArg();
+    ChainedHashMapRef partialAggregate{partialAggregateBufferRef, hashMapConfig};
+
+    /// The partial aggregate of the neighbouring slice already covers all slices between it and the chunk boundary
+    if (hasNeighbour)
+    {
+        combineHashMap(
+            partialAggregate,
+            partialAggregateBufferRef,
+            neighbour.asArg(),
+            nautilus::val<uint64_t>{ChainedHashMapRef::ALL_PARTITIONS},
+            executionCtx);
+    }
+
+    const auto sliceRef = getEmittedSliceRef(aggregationWindowRef, sliceIdx);
+    const auto firstHashMap = readValueFromMemRef<uint64_t>(getMemberRef(sliceRef, &EmittedAggregationSlice::firstHashMap));
+    const auto numberOfHashMaps = readValueFromMemRef<uint64_t>(getMemberRef(sliceRef, &EmittedAggregationSlice::numberOfHashMaps));
+    const auto endHashMap = firstHashMap + numberOfHashMaps;
+    for (nautilus::val<uint64_t> hashMapIdx = firstHashMap; hashMapIdx < endHashMap; ++hashMapIdx)
+    {
+        OwnedNautilusBuffer hashMapNautilusBuffer;
+        nautilus::invoke(loadChildHashMapProxy, recordBuffer.getReference(), hashMapIdx, hashMapNautilusBuffer.asArg());
+        combineHashMap(partialAggregate, partialAggregateBufferRef, hashMapNautilusBuffer.asArg(), partition, executionCtx);
+    }
+    nautilus::invoke(
+        storePartialAggregate, operatorHandler, getEmittedSliceEnd(aggregationWindowRef, sliceIdx), partition, partialAggregateBufferRef);
+    nautilus::invoke(assignBufferProxy, neighbour.asArg(), partialAggregateBufferRef);
+}
+
+void AggregationProbePhysicalOperator::combinePartialAggregates(
+    ChainedHashMapRef& finalHashMap,
+    const nautilus::val<TupleBuffer*>& finalHashMapBuffer,
+    const RecordBuffer& recordBuffer,
+    ExecutionContext& executionCtx) const
+{
+    const auto aggregationWindowRef = recordBuffer.getMemArea();
+    const auto partition = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::partition));
+    const auto numberOfSlices
+        = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::numberOfSlices));
+    const auto firstPrefixSlice
+        = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::firstPrefixSlice));
+    const auto emittedWindow = static_cast<nautilus::val<EmittedAggregationWindow*>>(aggregationWindowRef);
+    const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+
+    /// Partial aggregates never change once built. Thus, we only build the ones that lie between the window boundary and the closest
+    /// existing partial aggregate, which is typically one new slice for the prefix and none for the suffix. Every built partial aggregate
+    /// is the neighbour of the next one, and the last one is the partial aggregate the window is combined from. No lock is held while
+    /// building them, as the probe keeps its own copies of the partial aggregates it combines.
+    OwnedNautilusBuffer suffixNautilusBuffer;
+    const auto firstBuiltSuffix
+        = nautilus::invoke(findPartialAggregateProxy<Side::SUFFIX>, operatorHandler, emittedWindow, suffixNautilusBuffer.asArg());
+    /// The suffixes of the window's current chunk are built backwards, starting at the last slice before the chunk boundary
+    for (nautilus::val<uint64_t> sliceIdx = firstBuiltSuffix; sliceIdx > 0; --sliceIdx)
+    {
+        buildPartialAggregate(
+            Side::SUFFIX,
+            operatorHandler,
+            recordBuffer,
+            sliceIdx - 1,
+            suffixNautilusBuffer,
+            sliceIdx < firstPrefixSlice,
+            partition,
+            executionCtx);
+    }
+
+    OwnedNautilusBuffer prefixNautilusBuffer;
+    const auto firstMissingPrefix
+        = nautilus::invoke(findPartialAggregateProxy<Side::PREFIX>, operatorHandler, emittedWindow, prefixNautilusBuffer.asArg());
+    /// The prefixes of the next chunk are built forwards, starting at the first slice after the chunk boundary
+    for (nautilus::val<uint64_t> sliceIdx = firstMissingPrefix; sliceIdx < numberOfSlices; ++sliceIdx)
+    {
+        buildPartialAggregate(
+            Side::PREFIX,
+            operatorHandler,
+            recordBuffer,
+            sliceIdx,
+            prefixNautilusBuffer,
+            sliceIdx > firstPrefixSlice,
+            partition,
+            executionCtx);
+    }
+
+    /// The window is the suffix of its first slice combined with the prefix of its last slice
+    const nautilus::val<uint64_t> allPartitions{ChainedHashMapRef::ALL_PARTITIONS};
+    if (firstPrefixSlice > 0)
+    {
+        combineHashMap(finalHashMap, finalHashMapBuffer, suffixNautilusBuffer.asArg(), allPartitions, executionCtx);
+    }
+    if (firstPrefixSlice < numberOfSlices)
+    {
+        combineHashMap(finalHashMap, finalHashMapBuffer, prefixNautilusBuffer.asArg(), allPartitions, executionCtx);
+    }
+}
+
 void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     /// As this operator functions as a scan, we have to set the execution context for this pipeline
@@ -61,110 +347,33 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
     const auto aggregationWindowRef = static_cast<nautilus::val<EmittedAggregationWindow*>>(recordBuffer.getMemArea());
     const auto numberOfHashMaps
         = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::numberOfHashMaps));
+    const auto partition = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::partition));
     const auto windowInfoRef = getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::windowInfo);
     const nautilus::val<Timestamp> windowStart{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
     const nautilus::val<Timestamp> windowEnd{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
 
-    /// create final hash map and pin it. Its sizing is the same as the per-worker maps it merges, and that is
-    /// a query-compile-time constant, so it comes from hashMapConfig rather than being read back out of one
-    /// of the input maps. The proxy takes the numbers individually: a non-capturing lambda cannot receive the
-    /// config itself.
+    /// create final hash map and pin it
     OwnedNautilusBuffer finalHashMapNautilusBuffer;
-    nautilus::invoke(
-        +[](AbstractBufferProvider* bufferProvider,
-            TupleBuffer* finalHashMapBuffer IF_PRECONDITION(, const uint64_t entrySize),
-            const uint64_t numberOfBuckets IF_PRECONDITION(, const uint64_t pageSize),
-            const uint64_t bloomBytes)
-        {
-            const auto neededFinalBufferSize = ChainedHashMap::calculateBufferSize(numberOfBuckets, bloomBytes);
-            std::optional<TupleBuffer> finalHashMapTupleBuffer = bufferProvider->getUnpooledBuffer(neededFinalBufferSize);
-            if (not finalHashMapTupleBuffer.has_value())
-            {
-                throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededFinalBufferSize);
-            }
-            /// initialize the final hash map tuple buffer
-            *finalHashMapBuffer = finalHashMapTupleBuffer.value();
-            ChainedHashMap::init(*finalHashMapBuffer IF_PRECONDITION(, entrySize), numberOfBuckets IF_PRECONDITION(, pageSize), bloomBytes);
-        },
-        executionCtx.pipelineMemoryProvider.bufferProvider,
-        finalHashMapNautilusBuffer.asArg() IF_PRECONDITION(, nautilus::val<uint64_t>{hashMapConfig.entrySize}),
-        nautilus::val<uint64_t>{hashMapConfig.numberOfBuckets} IF_PRECONDITION(, nautilus::val<uint64_t>{hashMapConfig.pageSize}),
-        nautilus::val<uint64_t>{hashMapConfig.bloomFilterMemAreaSize()});
+    createHashMap(finalHashMapNautilusBuffer.asArg(), executionCtx);
     /// get the reference to the final hash map buffer
     auto finalHashMapBufferRef = finalHashMapNautilusBuffer.asArg();
 
-    /// Combining all keys from all hash maps in the final hash map, and then iterating over the final hash map once to lower the aggregation states
+    /// Combining all keys of this task's radix partition from all hash maps in the final hash map, and then iterating over the final
+    /// hash map once to lower the aggregation states. The other partitions hold disjoint keys and are merged by other tasks.
     ChainedHashMapRef finalHashMap{finalHashMapBufferRef, hashMapConfig};
 
-    for (nautilus::val<uint64_t> curHashMapIdx = 0; curHashMapIdx < numberOfHashMaps; ++curHashMapIdx)
+    if (aggregateSlidingWindowsIncrementally)
     {
-        /// Use NautilusBuffer to persist the chained hash map buffer
-        OwnedNautilusBuffer hashMapNautilusBuffer;
-        nautilus::invoke(
-            +[](TupleBuffer* parent, uint32_t curHashMapIdx, TupleBuffer* hashMapBuffer)
-            {
-                INVARIANT(parent != nullptr, "Parent Tuplebuffer MUST NOT be null at this point");
-                const ChildBufferIndex bufferIndex{curHashMapIdx};
-                *hashMapBuffer = parent->loadChildBuffer(bufferIndex);
-            },
-            recordBuffer.getReference(),
-            curHashMapIdx,
-            hashMapNautilusBuffer.asArg());
-        auto hashMapBufferRef = hashMapNautilusBuffer.asArg();
-        const ChainedHashMapRef currentMap{hashMapBufferRef, hashMapConfig};
-        for (const auto entry : currentMap)
+        combinePartialAggregates(finalHashMap, finalHashMapBufferRef, recordBuffer, executionCtx);
+    }
+    else
+    {
+        for (nautilus::val<uint64_t> curHashMapIdx = 0; curHashMapIdx < numberOfHashMaps; ++curHashMapIdx)
         {
-            const ChainedHashMapRef::ChainedEntryRef entryRef{entry, hashMapBufferRef, hashMapConfig.fieldKeys, hashMapConfig.fieldValues};
-            const auto tmpRecordKey = entryRef.getKey();
-
-            /// Inserting the record key into the final/global hash map. If an entry for the key already exists, we have to combine the aggregation states
-            /// We do this by iterating over the aggregation functions and combining all aggregation states into a global state.
-            finalHashMap.insertOrUpdateEntry(
-                entryRef.entryRef,
-                [fieldKeys = hashMapConfig.fieldKeys,
-                 fieldValues = hashMapConfig.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 pinnedFinalBuffer = finalHashMapBufferRef,
-                 hashMapBufferRef = hashMapBufferRef](const nautilus::val<AbstractHashMapEntry*>& entryOnUpdate)
-                {
-                    /// Combining the aggregation states of the current entry with the aggregation states of the final hash map
-                    const ChainedHashMapRef::ChainedEntryRef entryRefOnInsert{entryOnUpdate, pinnedFinalBuffer, fieldKeys, fieldValues};
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefState = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        aggFunction->combine(
-                            globalState, pinnedFinalBuffer, entryRefState, hashMapBufferRef, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefState = entryRefState + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                [fieldKeys = hashMapConfig.fieldKeys,
-                 fieldValues = hashMapConfig.fieldValues,
-                 &executionCtx,
-                 &entryRef,
-                 &aggregationPhysicalFunctions = aggregationPhysicalFunctions,
-                 pinnedFinalBuffer = finalHashMapBufferRef,
-                 hashMapBufferRef = hashMapBufferRef](const nautilus::val<AbstractHashMapEntry*>& entryOnInsert)
-                {
-                    /// If the entry for the provided key has not been seen by this hash map / worker thread, we need
-                    /// to create a new one and initialize the aggregation states. After that, we can combine the aggregation states.
-                    const ChainedHashMapRef::ChainedEntryRef entryRefOnInsert{entryOnInsert, pinnedFinalBuffer, fieldKeys, fieldValues};
-                    auto globalState = static_cast<nautilus::val<AggregationState*>>(entryRefOnInsert.getValueMemArea());
-                    auto entryRefStatePtr = static_cast<nautilus::val<AggregationState*>>(entryRef.getValueMemArea());
-                    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
-                    {
-                        /// In contrast to the lambda method above, we have to reset the aggregation state before combining it with the other state
-                        aggFunction->reset(globalState, pinnedFinalBuffer, executionCtx.pipelineMemoryProvider);
-                        aggFunction->combine(
-                            globalState, pinnedFinalBuffer, entryRefStatePtr, hashMapBufferRef, executionCtx.pipelineMemoryProvider);
-                        globalState = globalState + aggFunction->getSizeOfStateInBytes();
-                        entryRefStatePtr = entryRefStatePtr + aggFunction->getSizeOfStateInBytes();
-                    }
-                },
-                executionCtx.pipelineMemoryProvider.bufferProvider);
+            /// Use NautilusBuffer to persist the chained hash map buffer
+            OwnedNautilusBuffer hashMapNautilusBuffer;
+            nautilus::invoke(loadChildHashMapProxy, recordBuffer.getReference(), curHashMapIdx, hashMapNautilusBuffer.asArg());
+            combineHashMap(finalHashMap, finalHashMapBufferRef, hashMapNautilusBuffer.asArg(), partition, executionCtx);
         }
     }
 
@@ -211,10 +420,12 @@ AggregationProbePhysicalOperator::AggregationProbePhysicalOperator(
     ChainedHashMapConfig hashMapConfig,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
     const OperatorHandlerId operatorHandlerId,
-    WindowMetaData windowMetaData)
+    WindowMetaData windowMetaData,
+    const bool aggregateSlidingWindowsIncrementally)
     : WindowProbePhysicalOperator(operatorHandlerId, std::move(windowMetaData))
     , aggregationPhysicalFunctions(std::move(aggregationPhysicalFunctions))
     , hashMapConfig(std::move(hashMapConfig))
+    , aggregateSlidingWindowsIncrementally(aggregateSlidingWindowsIncrementally)
 {
 }
 }
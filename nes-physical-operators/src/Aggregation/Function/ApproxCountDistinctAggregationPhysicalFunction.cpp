@@ -0,0 +1,146 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxCountDistinctAggregationPhysicalFunction.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/HyperLogLog.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/VarVal.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Interface/Hash/HashFunction.hpp>
+#include <Interface/Record.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <nautilus/function.hpp>
+#include <nautilus/std/cstring.h>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+ApproxCountDistinctAggregationPhysicalFunction::ApproxCountDistinctAggregationPhysicalFunction(
+    DataType inputType, DataType resultType, PhysicalFunction inputFunction, Record::RecordFieldIdentifier resultFieldIdentifier)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+{
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    nautilus::val<TupleBuffer*>,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena);
+    const auto addToSketch = [&]
+    {
+        /// The hash function casts numbers to an uint64_t, which would map all floats with the same integral part to the same hash.
+        /// Thus, floats are hashed by their bit pattern. Adding zero turns -0.0 into 0.0, as both are the same value.
+        auto hash = HashFunction::HashValue{0};
+        if (inputType.isFloat())
+        {
+            const auto bits = nautilus::invoke(
+                +[](const double floatValue) { return std::bit_cast<uint64_t>(floatValue + 0.0); },
+                value.castToType(DataType::Type::FLOAT64).getRawValueAs<nautilus::val<double>>());
+            hash = hashFunction.calculate(VarVal{bits});
+        }
+        else
+        {
+            hash = hashFunction.calculate(value);
+        }
+        nautilus::invoke(
+            +[](uint8_t* registers, const uint64_t hash) { HyperLogLog{{registers, HyperLogLog::NUMBER_OF_REGISTERS}}.add(hash); },
+            static_cast<nautilus::val<uint8_t*>>(aggregationState),
+            hash);
+    };
+
+    if (inputType.nullable)
+    {
+        /// SQL-standard: like COUNT(field), the distinct count skips NULL values
+        if (not value.isNull())
+        {
+            addToSketch();
+        }
+    }
+    else
+    {
+        addToSketch();
+    }
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    nautilus::val<TupleBuffer*>,
+    const nautilus::val<AggregationState*> aggregationState2,
+    nautilus::val<TupleBuffer*>,
+    PipelineMemoryProvider&)
+{
+    /// Merging takes the maximum of each pair of registers, which HyperLogLog::merge does with SIMD instructions
+    nautilus::invoke(
+        +[](uint8_t* registers1, uint8_t* registers2)
+        {
+            HyperLogLog{{registers1, HyperLogLog::NUMBER_OF_REGISTERS}}.merge(
+                HyperLogLog{{registers2, HyperLogLog::NUMBER_OF_REGISTERS}});
+        },
+        static_cast<nautilus::val<uint8_t*>>(aggregationState1),
+        static_cast<nautilus::val<uint8_t*>>(aggregationState2));
+}
+
+Record ApproxCountDistinctAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, nautilus::val<TupleBuffer*>, PipelineMemoryProvider&)
+{
+    const auto estimate = nautilus::invoke(
+        +[](uint8_t* registers) { return HyperLogLog{{registers, HyperLogLog::NUMBER_OF_REGISTERS}}.estimate(); },
+        static_cast<nautilus::val<uint8_t*>>(aggregationState));
+
+    Record resultRecord;
+    resultRecord.write(resultFieldIdentifier, VarVal{estimate}.castToType(resultType.type));
+    return resultRecord;
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::reset(
+    const nautilus::val<AggregationState*> aggregationState, nautilus::val<TupleBuffer*>, PipelineMemoryProvider&)
+{
+    /// An empty HyperLogLog has all registers set to zero
+    const auto memArea = static_cast<nautilus::val<int8_t*>>(aggregationState);
+    nautilus::memset(memArea, 0, getSizeOfStateInBytes());
+}
+
+void ApproxCountDistinctAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+}
+
+size_t ApproxCountDistinctAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    /// The registers of the HyperLogLog (1B each). No null flag, as the result is never NULL.
+    return HyperLogLog::NUMBER_OF_REGISTERS;
+}
+
+AggregationPhysicalFunctionRegistryReturnType
+ApproxCountDistinctAggregationPhysicalFunction::create(AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    return std::make_shared<ApproxCountDistinctAggregationPhysicalFunction>(
+        std::move(arguments.inputType), std::move(arguments.resultType), arguments.inputFunction, arguments.resultFieldIdentifier);
+}
+
+}
@@ -0,0 +1,212 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/ApproxQuantileAggregationPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/QuantileSketch.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Interface/Record.hpp>
+#include <nautilus/function.hpp>
+
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_arith.hpp>
+#include <val_bool.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+ApproxQuantileAggregationPhysicalFunction::ApproxQuantileAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Record::RecordFieldIdentifier resultFieldIdentifier,
+    const double quantile,
+    const uint64_t compression)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , quantile(quantile)
+    , compression(compression)
+{
+    PRECONDITION(quantile >= 0 and quantile <= 1, "The quantile must lie in [0, 1] but is {}", quantile);
+}
+
+nautilus::val<uint32_t*>
+ApproxQuantileAggregationPhysicalFunction::getChildBufferIndexRef(const nautilus::val<AggregationState*>& aggregationState) const
+{
+    /// Skipping the first byte (null), if the input is nullable
+    const auto memArea
+        = static_cast<nautilus::val<int8_t*>>(aggregationState + nautilus::val<uint64_t>{static_cast<uint64_t>(inputType.nullable)});
+    return static_cast<nautilus::val<uint32_t*>>(memArea);
+}
+
+void ApproxQuantileAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    nautilus::val<TupleBuffer*> parentBuffer,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena);
+    const auto addToSketch = [&]
+    {
+        nautilus::invoke(
+            +[](TupleBuffer* parent, const uint32_t* indexPtr, const double value)
+            {
+                auto sketchBuffer = parent->loadChildBuffer(ChildBufferIndex{*indexPtr});
+                QuantileSketch{sketchBuffer.getAvailableMemoryArea()}.add(value);
+            },
+            parentBuffer,
+            getChildBufferIndexRef(aggregationState),
+            value.castToType(DataType::Type::FLOAT64).getRawValueAs<nautilus::val<double>>());
+    };
+
+    if (inputType.nullable)
+    {
+        /// SQL-standard: NULL inputs are not part of the quantile set. The null flag flips to false with the first non-null value.
+        if (not value.isNull())
+        {
+            storeNull(aggregationState, false);
+            addToSketch();
+        }
+    }
+    else
+    {
+        addToSketch();
+    }
+}
+
+void ApproxQuantileAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    nautilus::val<TupleBuffer*> parentBuffer1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    nautilus::val<TupleBuffer*> parentBuffer2,
+    PipelineMemoryProvider&)
+{
+    if (inputType.nullable)
+    {
+        /// Combining the null values
+        const auto containsNull1 = readNull(aggregationState1);
+        const auto containsNull2 = readNull(aggregationState2);
+        storeNull(aggregationState1, containsNull1 and containsNull2);
+    }
+
+    /// Merging the sketches is independent of the number of values they summarize, as both have a fixed size
+    nautilus::invoke(
+        +[](TupleBuffer* parent1, const uint32_t* indexPtr1, TupleBuffer* parent2, const uint32_t* indexPtr2)
+        {
+            auto sketchBuffer1 = parent1->loadChildBuffer(ChildBufferIndex{*indexPtr1});
+            auto sketchBuffer2 = parent2->loadChildBuffer(ChildBufferIndex{*indexPtr2});
+            QuantileSketch{sketchBuffer1.getAvailableMemoryArea()}.merge(QuantileSketch{sketchBuffer2.getAvailableMemoryArea()});
+        },
+        parentBuffer1,
+        getChildBufferIndexRef(aggregationState1),
+        parentBuffer2,
+        getChildBufferIndexRef(aggregationState2));
+}
+
+Record ApproxQuantileAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState, nautilus::val<TupleBuffer*> parentBuffer, PipelineMemoryProvider&)
+{
+    /// If the input only contained null values, the sketch is empty and we return a null value
+    auto containsNull = nautilus::val<bool>{false};
+    if (inputType.nullable)
+    {
+        containsNull = readNull(aggregationState);
+    }
+
+    nautilus::val<double> estimate{0.0};
+    if (not containsNull)
+    {
+        estimate = nautilus::invoke(
+            +[](TupleBuffer* parent, const uint32_t* indexPtr, const double quantile)
+            {
+                auto sketchBuffer = parent->loadChildBuffer(ChildBufferIndex{*indexPtr});
+                return QuantileSketch{sketchBuffer.getAvailableMemoryArea()}.getQuantile(quantile);
+            },
+            parentBuffer,
+            getChildBufferIndexRef(aggregationState),
+            nautilus::val<double>{quantile});
+    }
+
+    Record resultRecord;
+    resultRecord.write(resultFieldIdentifier, VarVal{estimate, inputType.nullable, containsNull}.castToType(resultType.type));
+    return resultRecord;
+}
+
+void ApproxQuantileAggregationPhysicalFunction::reset(
+    const nautilus::val<AggregationState*> aggregationState,
+    nautilus::val<TupleBuffer*> parentBuffer,
+    PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    const nautilus::val<uint32_t> childBufferIndexVal = nautilus::invoke(
+        +[](TupleBuffer* parentBuffer, AbstractBufferProvider* bufferProvider, const uint64_t compression)
+        {
+            const auto sketchSize = QuantileSketch::getSizeInBytes(compression);
+            if (auto sketchBufferOpt = bufferProvider->getUnpooledBuffer(sketchSize))
+            {
+                auto sketchBuffer = sketchBufferOpt.value();
+                QuantileSketch::init(sketchBuffer.getAvailableMemoryArea(), compression);
+                return parentBuffer->storeChildBuffer(sketchBuffer).getRawValue();
+            }
+            throw BufferAllocationFailure("No unpooled TupleBuffer available for the quantile sketch of {}B", sketchSize);
+        },
+        parentBuffer,
+        pipelineMemoryProvider.bufferProvider,
+        nautilus::val<uint64_t>{compression});
+
+    if (inputType.nullable)
+    {
+        /// Initialize the null flag to "no value seen yet" so all-NULL windows correctly emit NULL
+        storeNull(aggregationState, true);
+    }
+    *getChildBufferIndexRef(aggregationState) = childBufferIndexVal;
+}
+
+void ApproxQuantileAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+    /// No-op: the sketch buffer is stored as a child of the parent hash map TupleBuffer and
+    /// is released automatically when the parent is released.
+}
+
+size_t ApproxQuantileAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    /// ContainsNullValues (1B, optional) + uint32_t child buffer index (4B)
+    return static_cast<uint64_t>(inputType.nullable) + sizeof(uint32_t);
+}
+
+AggregationPhysicalFunctionRegistryReturnType
+ApproxQuantileAggregationPhysicalFunction::create(AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.quantile.has_value(), "The quantile of an approximate quantile aggregation is not set");
+    return std::make_shared<ApproxQuantileAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.resultFieldIdentifier,
+        arguments.quantile.value(),
+        QuantileSketch::DEFAULT_COMPRESSION);
+}
+
+}
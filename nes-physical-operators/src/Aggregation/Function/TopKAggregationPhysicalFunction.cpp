@@ -0,0 +1,356 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/Function/TopKAggregationPhysicalFunction.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/SpaceSavingSketch.hpp>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/VarVal.hpp>
+#include <DataTypes/VariableSizedData.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Interface/Record.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <nautilus/function.hpp>
+#include <AggregationPhysicalFunctionRegistry.hpp>
+#include <Arena.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Marks text keys in the templates below, as they are the only keys that are not stored as a fixed-size value
+struct TextKey
+{
+};
+
+TupleBuffer allocateSketchBuffer(AbstractBufferProvider* bufferProvider, const uint64_t numberOfCounters, const uint64_t keyAreaSize)
+{
+    const auto sketchSize = SpaceSavingSketch::getSizeInBytes(numberOfCounters, keyAreaSize);
+    if (auto sketchBufferOpt = bufferProvider->getUnpooledBuffer(sketchSize))
+    {
+        auto sketchBuffer = sketchBufferOpt.value();
+        SpaceSavingSketch::init(sketchBuffer.getAvailableMemoryArea(), numberOfCounters, keyAreaSize);
+        return sketchBuffer;
+    }
+    throw BufferAllocationFailure("No unpooled TupleBuffer available for the space-saving sketch of {}B", sketchSize);
+}
+
+/// Applies the update to the sketch of the aggregation state. If the key area of the sketch is full, the sketch moves into a child buffer
+/// with twice the key area. The previous child buffer stays attached to the parent until the parent is released, which wastes at most
+/// as much memory as the final sketch takes, as the key area doubles.
+template <typename Update>
+void updateSketch(TupleBuffer* parent, uint32_t* childBufferIndex, AbstractBufferProvider* bufferProvider, const Update& update)
+{
+    auto sketchBuffer = parent->loadChildBuffer(ChildBufferIndex{*childBufferIndex});
+    SpaceSavingSketch sketch{sketchBuffer.getAvailableMemoryArea()};
+    while (not update(sketch))
+    {
+        auto largerSketchBuffer = allocateSketchBuffer(bufferProvider, sketch.getNumberOfCounters(), 2 * sketch.getKeyAreaSize());
+        SpaceSavingSketch largerSketch{largerSketchBuffer.getAvailableMemoryArea()};
+        sketch.copyInto(largerSketch);
+        *childBufferIndex = parent->storeChildBuffer(largerSketchBuffer).getRawValue();
+        sketch = largerSketch;
+    }
+}
+
+void addKey(TupleBuffer* parent, uint32_t* childBufferIndex, AbstractBufferProvider* bufferProvider, std::span<const std::byte> key)
+{
+    updateSketch(parent, childBufferIndex, bufferProvider, [key](SpaceSavingSketch& sketch) { return sketch.add(key); });
+}
+
+/// Fixed-size keys are widened to 64 bits, so the proxy function is the same for all integer and all floating point types
+template <typename KeyType>
+void invokeAddKey(
+    const nautilus::val<TupleBuffer*>& parentBuffer,
+    const nautilus::val<uint32_t*>& childBufferIndex,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider,
+    const VarVal& value,
+    const DataType::Type widenedType)
+{
+    nautilus::invoke(
+        +[](TupleBuffer* parent, uint32_t* childBufferIndex, AbstractBufferProvider* bufferProvider, KeyType key)
+        {
+            if constexpr (std::is_floating_point_v<KeyType>)
+            {
+                /// Adding zero turns -0.0 into 0.0, as both are the same value but differ in their bytes
+                key += 0.0;
+            }
+            addKey(parent, childBufferIndex, bufferProvider, std::as_bytes(std::span{&key, 1}));
+        },
+        parentBuffer,
+        childBufferIndex,
+        bufferProvider,
+        value.castToType(widenedType).getRawValueAs<nautilus::val<KeyType>>());
+}
+
+/// Text keys that contain a separator of the rendered list or a quote are quoted, and their quotes are doubled, e.g., "a;b":3
+std::string renderTextKey(const std::string_view text)
+{
+    if (text.find_first_of(";:,\"") == std::string_view::npos)
+    {
+        return std::string{text};
+    }
+    std::string quoted = "\"";
+    for (const auto character : text)
+    {
+        if (character == '"')
+        {
+            quoted += '"';
+        }
+        quoted += character;
+    }
+    quoted += '"';
+    return quoted;
+}
+
+template <typename KeyType>
+std::string renderKey(const std::span<const std::byte> key)
+{
+    if constexpr (std::is_same_v<KeyType, TextKey>)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): text keys are stored as their characters
+        return renderTextKey(std::string_view{reinterpret_cast<const char*>(key.data()), key.size()});
+    }
+    else
+    {
+        KeyType value{};
+        std::memcpy(&value, key.data(), sizeof(KeyType));
+        return std::format("{}", value);
+    }
+}
+
+/// Lists the k most frequent keys with their counts, e.g., "/home:42;/login:17"
+template <typename KeyType>
+std::string renderTopK(const TupleBuffer* parent, const uint32_t childBufferIndex, const uint64_t k)
+{
+    auto sketchBuffer = parent->loadChildBuffer(ChildBufferIndex{childBufferIndex});
+    std::string result;
+    for (const auto& entry : SpaceSavingSketch{sketchBuffer.getAvailableMemoryArea()}.getTopK(k))
+    {
+        if (not result.empty())
+        {
+            result += ';';
+        }
+        result += std::format("{}:{}", renderKey<KeyType>(entry.key), entry.count);
+    }
+    return result;
+}
+
+/// The length of the text is needed to allocate it in the arena, so the text is rendered twice. Lowering happens once per key and
+/// window, so this is cheap compared to building the sketch.
+template <typename KeyType>
+VarVal invokeRenderTopK(
+    const nautilus::val<TupleBuffer*>& parentBuffer, const nautilus::val<uint32_t*>& childBufferIndex, const uint64_t k, ArenaRef& arena)
+{
+    const auto length = nautilus::invoke(
+        +[](const TupleBuffer* parent, const uint32_t* childBufferIndex, const uint64_t k) -> uint64_t
+        { return renderTopK<KeyType>(parent, *childBufferIndex, k).size(); },
+        parentBuffer,
+        childBufferIndex,
+        nautilus::val<uint64_t>{k});
+    auto topK = arena.allocateVariableSizedData(length);
+    nautilus::invoke(
+        +[](const TupleBuffer* parent, const uint32_t* childBufferIndex, const uint64_t k, char* topK)
+        { std::ranges::copy(renderTopK<KeyType>(parent, *childBufferIndex, k), topK); },
+        parentBuffer,
+        childBufferIndex,
+        nautilus::val<uint64_t>{k},
+        topK.getContent());
+    return VarVal{topK, false, false};
+}
+}
+
+TopKAggregationPhysicalFunction::TopKAggregationPhysicalFunction(
+    DataType inputType,
+    DataType resultType,
+    PhysicalFunction inputFunction,
+    Record::RecordFieldIdentifier resultFieldIdentifier,
+    const uint64_t k)
+    : AggregationPhysicalFunction(std::move(inputType), std::move(resultType), std::move(inputFunction), std::move(resultFieldIdentifier))
+    , k(k)
+{
+    PRECONDITION(k > 0, "TopK must report at least one value");
+}
+
+void TopKAggregationPhysicalFunction::lift(
+    const nautilus::val<AggregationState*>& aggregationState,
+    nautilus::val<TupleBuffer*> parentBuffer,
+    PipelineMemoryProvider& pipelineMemoryProvider,
+    const Record& record)
+{
+    const auto value = inputFunction.execute(record, pipelineMemoryProvider.arena);
+    const auto addToSketch = [&]
+    {
+        const auto childBufferIndex = static_cast<nautilus::val<uint32_t*>>(aggregationState);
+        if (inputType.isType(DataType::Type::VARSIZED))
+        {
+            const auto text = value.getRawValueAs<VariableSizedData>();
+            nautilus::invoke(
+                +[](TupleBuffer* parent,
+                    uint32_t* childBufferIndex,
+                    AbstractBufferProvider* bufferProvider,
+                    int8_t* content,
+                    const uint64_t size) { addKey(parent, childBufferIndex, bufferProvider, std::as_bytes(std::span{content, size})); },
+                parentBuffer,
+                childBufferIndex,
+                pipelineMemoryProvider.bufferProvider,
+                text.getContent(),
+                text.getSize());
+        }
+        else if (inputType.isFloat())
+        {
+            invokeAddKey<double>(parentBuffer, childBufferIndex, pipelineMemoryProvider.bufferProvider, value, DataType::Type::FLOAT64);
+        }
+        else if (inputType.isSignedInteger())
+        {
+            invokeAddKey<int64_t>(parentBuffer, childBufferIndex, pipelineMemoryProvider.bufferProvider, value, DataType::Type::INT64);
+        }
+        else
+        {
+            invokeAddKey<uint64_t>(parentBuffer, childBufferIndex, pipelineMemoryProvider.bufferProvider, value, DataType::Type::UINT64);
+        }
+    };
+
+    if (inputType.nullable)
+    {
+        /// Like COUNT(field), NULL values are not counted
+        if (not value.isNull())
+        {
+            addToSketch();
+        }
+    }
+    else
+    {
+        addToSketch();
+    }
+}
+
+void TopKAggregationPhysicalFunction::combine(
+    const nautilus::val<AggregationState*> aggregationState1,
+    nautilus::val<TupleBuffer*> parentBuffer1,
+    const nautilus::val<AggregationState*> aggregationState2,
+    nautilus::val<TupleBuffer*> parentBuffer2,
+    PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    /// Merging only touches the counters of both sketches, so it is independent of the number of values they summarize
+    nautilus::invoke(
+        +[](TupleBuffer* parent1,
+            uint32_t* childBufferIndex1,
+            TupleBuffer* parent2,
+            const uint32_t* childBufferIndex2,
+            AbstractBufferProvider* bufferProvider)
+        {
+            auto sketchBuffer2 = parent2->loadChildBuffer(ChildBufferIndex{*childBufferIndex2});
+            const SpaceSavingSketch sketch2{sketchBuffer2.getAvailableMemoryArea()};
+            updateSketch(
+                parent1, childBufferIndex1, bufferProvider, [&sketch2](SpaceSavingSketch& sketch1) { return sketch1.merge(sketch2); });
+        },
+        parentBuffer1,
+        static_cast<nautilus::val<uint32_t*>>(aggregationState1),
+        parentBuffer2,
+        static_cast<nautilus::val<uint32_t*>>(aggregationState2),
+        pipelineMemoryProvider.bufferProvider);
+}
+
+Record TopKAggregationPhysicalFunction::lower(
+    const nautilus::val<AggregationState*> aggregationState,
+    nautilus::val<TupleBuffer*> parentBuffer,
+    PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    const auto childBufferIndex = static_cast<nautilus::val<uint32_t*>>(aggregationState);
+    auto renderTopKOfInputType = [&]
+    {
+        if (inputType.isType(DataType::Type::VARSIZED))
+        {
+            return invokeRenderTopK<TextKey>(parentBuffer, childBufferIndex, k, pipelineMemoryProvider.arena);
+        }
+        if (inputType.isFloat())
+        {
+            return invokeRenderTopK<double>(parentBuffer, childBufferIndex, k, pipelineMemoryProvider.arena);
+        }
+        if (inputType.isSignedInteger())
+        {
+            return invokeRenderTopK<int64_t>(parentBuffer, childBufferIndex, k, pipelineMemoryProvider.arena);
+        }
+        return invokeRenderTopK<uint64_t>(parentBuffer, childBufferIndex, k, pipelineMemoryProvider.arena);
+    };
+
+    Record resultRecord;
+    resultRecord.write(resultFieldIdentifier, renderTopKOfInputType());
+    return resultRecord;
+}
+
+void TopKAggregationPhysicalFunction::reset(
+    const nautilus::val<AggregationState*> aggregationState,
+    nautilus::val<TupleBuffer*> parentBuffer,
+    PipelineMemoryProvider& pipelineMemoryProvider)
+{
+    const nautilus::val<uint32_t> childBufferIndexVal = nautilus::invoke(
+        +[](TupleBuffer* parentBuffer, AbstractBufferProvider* bufferProvider, const uint64_t k)
+        {
+            const auto numberOfCounters = k * SpaceSavingSketch::COUNTERS_PER_REPORTED_KEY;
+            const auto keyAreaSize = numberOfCounters * SpaceSavingSketch::INITIAL_KEY_BYTES_PER_COUNTER;
+            auto sketchBuffer = allocateSketchBuffer(bufferProvider, numberOfCounters, keyAreaSize);
+            return parentBuffer->storeChildBuffer(sketchBuffer).getRawValue();
+        },
+        parentBuffer,
+        pipelineMemoryProvider.bufferProvider,
+        nautilus::val<uint64_t>{k});
+    *static_cast<nautilus::val<uint32_t*>>(aggregationState) = childBufferIndexVal;
+}
+
+void TopKAggregationPhysicalFunction::cleanup(nautilus::val<AggregationState*>)
+{
+    /// No-op: the sketch buffers are stored as children of the parent hash map TupleBuffer and
+    /// are released automatically when the parent is released.
+}
+
+size_t TopKAggregationPhysicalFunction::getSizeOfStateInBytes() const
+{
+    /// uint32_t child buffer index (4B). No null flag, as the result is never NULL.
+    return sizeof(uint32_t);
+}
+
+AggregationPhysicalFunctionRegistryReturnType
+TopKAggregationPhysicalFunction::create(AggregationPhysicalFunctionRegistryArguments arguments)
+{
+    INVARIANT(arguments.k.has_value(), "The k of a top-k aggregation is not set");
+    return std::make_shared<TopKAggregationPhysicalFunction>(
+        std::move(arguments.inputType),
+        std::move(arguments.resultType),
+        arguments.inputFunction,
+        arguments.resultFieldIdentifier,
+        arguments.k.value());
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Aggregation/HyperLogLog.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+HyperLogLog::HyperLogLog(const std::span<uint8_t> registers) : registers(registers)
+{
+    PRECONDITION(
+        registers.size() == NUMBER_OF_REGISTERS, "A HyperLogLog expects {} registers but got {}", NUMBER_OF_REGISTERS, registers.size());
+}
+
+void HyperLogLog::add(const uint64_t hash)
+{
+    const auto registerIndex = hash >> (64 - PRECISION);
+    /// The bits below the register index, of which at most 64 - PRECISION can be zero
+    const auto remainingBits = hash << PRECISION;
+    const auto rank = static_cast<uint8_t>(std::min<uint64_t>(std::countl_zero(remainingBits), 64 - PRECISION) + 1);
+    registers[registerIndex] = std::max(registers[registerIndex], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other)
+{
+    /// A plain loop over raw pointers, so that the compiler turns it into SIMD maximum instructions. Going through the spans instead
+    /// would reload their data pointers after every store, as a uint8_t may alias them.
+    auto* const target = registers.data();
+    const auto* const source = other.registers.data();
+    for (uint64_t i = 0; i < NUMBER_OF_REGISTERS; ++i)
+    {
+        target[i] = std::max(target[i], source[i]);
+    }
+}
+
+uint64_t HyperLogLog::estimate() const
+{
+    constexpr auto numberOfRegisters = static_cast<double>(NUMBER_OF_REGISTERS);
+    /// Bias correction for 2^PRECISION >= 128 registers
+    constexpr auto alpha = 0.7213 / (1 + (1.079 / numberOfRegisters));
+
+    double harmonicSum = 0;
+    uint64_t numberOfEmptyRegisters = 0;
+    for (const auto rank : registers)
+    {
+        harmonicSum += std::ldexp(1.0, -rank);
+        numberOfEmptyRegisters += static_cast<uint64_t>(rank == 0);
+    }
+
+    auto estimate = alpha * numberOfRegisters * numberOfRegisters / harmonicSum;
+    /// The raw estimate overestimates small cardinalities, for which the number of empty registers is more accurate.
+    /// With 64-bit hashes, collisions are too rare to require a correction for large cardinalities.
+    if (estimate <= 2.5 * numberOfRegisters and numberOfEmptyRegisters > 0)
+    {
+        estimate = numberOfRegisters * std::log(numberOfRegisters / static_cast<double>(numberOfEmptyRegisters));
+    }
+    return static_cast<uint64_t>(std::llround(estimate));
+}
+
+}
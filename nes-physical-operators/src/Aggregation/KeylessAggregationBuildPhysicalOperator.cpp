@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Aggregation/KeylessAggregationBuildPhysicalOperator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/KeylessAggregationSlice.hpp>
+#include <DataTypes/DataTypesUtil.hpp>
+#include <DataTypes/VarVal.hpp>
+#include <Interface/Record.hpp>
+#include <CompilationContext.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowBuildPhysicalOperator.hpp>
+#include <static.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+void KeylessAggregationBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
+{
+    WindowBuildPhysicalOperator::setup(executionCtx, compilationContext);
+}
+
+void KeylessAggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
+{
+    /// Getting the operator handler from the local state
+    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
+    auto operatorHandler = localState->getOperatorHandler();
+
+    /// Getting the state buffer of this worker thread for the corresponding slice
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    auto stateBuffer
+        = sliceStoreRef->getDataStructureRef(timestamp, ctx.workerThreadId, operatorHandler, ctx.pipelineMemoryProvider.bufferProvider);
+    const auto stateBufferRef = stateBuffer.data();
+    const auto initializedRef = getMemberRef(stateBufferRef, &KeylessAggregationStateHeader::initialized);
+    const auto statesRef = static_cast<nautilus::val<AggregationState*>>(
+        stateBufferRef + nautilus::val<uint64_t>{sizeof(KeylessAggregationStateHeader)});
+
+    /// A new state buffer is only zeroed out, so its aggregation states have to be reset before the first record is lifted into them
+    if (not readValueFromMemRef<bool>(initializedRef))
+    {
+        auto state = statesRef;
+        for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+        {
+            aggFunction->reset(state, stateBuffer.asArg(), ctx.pipelineMemoryProvider);
+            state = state + aggFunction->getSizeOfStateInBytes();
+        }
+        VarVal{nautilus::val<bool>{true}}.writeToMemory(initializedRef);
+    }
+
+    /// Updating the aggregation states
+    auto state = statesRef;
+    for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+    {
+        aggFunction->lift(state, stateBuffer.asArg(), ctx.pipelineMemoryProvider, record);
+        state = state + aggFunction->getSizeOfStateInBytes();
+    }
+}
+
+KeylessAggregationBuildPhysicalOperator::KeylessAggregationBuildPhysicalOperator(
+    const OperatorHandlerId operatorHandlerId,
+    std::unique_ptr<TimeFunction> timeFunction,
+    std::unique_ptr<SliceStoreRef> sliceStoreRef,
+    std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions)
+    : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction), std::move(sliceStoreRef))
+    , aggregationPhysicalFunctions(std::move(aggregationFunctions))
+{
+}
+
+}
@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Aggregation/KeylessAggregationOperatorHandler.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <Aggregation/KeylessAggregationSlice.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <WindowBasedOperatorHandler.hpp>
+
+namespace NES
+{
+
+KeylessAggregationOperatorHandler::KeylessAggregationOperatorHandler(
+    const std::vector<OriginId>& inputOrigins,
+    const OriginId outputOriginId,
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const std::chrono::milliseconds originIdleTimeout)
+    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore), originIdleTimeout)
+{
+}
+
+std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
+KeylessAggregationOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const
+{
+    PRECONDITION(
+        numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Was setWorkerThreads() being called?");
+    const auto& newKeylessSliceArgs = dynamic_cast<const CreateNewKeylessAggregationSliceArgs&>(newSlicesArguments);
+    return std::function(
+        [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewKeylessSliceArgs = newKeylessSliceArgs](
+            SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+        {
+            NES_TRACE("Creating new keyless aggregation slice for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
+            return {std::make_shared<KeylessAggregationSlice>(sliceStart, sliceEnd, copyOfNewKeylessSliceArgs, numberOfWorkerThreads)};
+        });
+}
+
+void KeylessAggregationOperatorHandler::triggerSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    for (const auto& [windowInfo, windowSlices] : slicesAndWindowInfo)
+    {
+        /// Getting the state buffers of all worker threads that have seen a record of any slice of the window.
+        /// Read-only, as trigger-time must never allocate, see KeylessAggregationSlice::getStateBufferRefForWorker.
+        std::vector<TupleBuffer> allStateBuffers;
+        for (const auto& slice : windowSlices)
+        {
+            const auto keylessSlice = std::dynamic_pointer_cast<KeylessAggregationSlice>(slice);
+            INVARIANT(keylessSlice != nullptr, "A keyless aggregation must only store keyless aggregation slices");
+            for (uint64_t stateBufferIdx = 0; stateBufferIdx < keylessSlice->getNumberOfStateBuffers(); ++stateBufferIdx)
+            {
+                if (const auto* stateBuffer = keylessSlice->getStateBufferRefForWorker(WorkerThreadId(stateBufferIdx)))
+                {
+                    allStateBuffers.emplace_back(*stateBuffer);
+                }
+            }
+        }
+
+        const auto neededBufferSize = sizeof(EmittedKeylessAggregationWindow);
+        const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+        if (not tupleBufferVal.has_value())
+        {
+            throw CannotAllocateBuffer("{}B for the keyless aggregation window trigger were requested", neededBufferSize);
+        }
+        auto tupleBuffer = tupleBufferVal.value();
+        /// Store each state buffer as a child so the probe can load them via loadChildBuffer(i)
+        for (auto stateBuffer : allStateBuffers)
+        {
+            std::ignore = tupleBuffer.storeChildBuffer(stateBuffer);
+        }
+
+        /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+        /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
+        /// A window is never split into chunks, as all of its states are combined into the single output record.
+        tupleBuffer.setOriginId(outputOriginId);
+        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
+        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+        tupleBuffer.setLastChunk(true);
+        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
+        tupleBuffer.setNumberOfTuples(allStateBuffers.size());
+        tupleBuffer.setCreationTimestampInMS(Timestamp(
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+
+        /// Writing all necessary information for the keyless aggregation probe to the buffer via the placement new constructor
+        new (tupleBuffer.getAvailableMemoryArea().data()) EmittedKeylessAggregationWindow{windowInfo.windowInfo, allStateBuffers.size()};
+
+        /// Dispatching the buffer to the probe operator via the task queue.
+        pipelineCtx->emitBuffer(tupleBuffer, PipelineExecutionContext::ContinuationPolicy::NEVER);
+        NES_TRACE(
+            "Emitted keyless window {}-{} with {} state buffers, watermarkTs {} sequenceNumber {} originId {}",
+            windowInfo.windowInfo.windowStart,
+            windowInfo.windowInfo.windowEnd,
+            allStateBuffers.size(),
+            tupleBuffer.getWatermark(),
+            tupleBuffer.getSequenceNumber(),
+            tupleBuffer.getOriginId());
+    }
+}
+
+}
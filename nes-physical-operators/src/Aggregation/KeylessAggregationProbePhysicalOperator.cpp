@@ -0,0 +1,150 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Aggregation/KeylessAggregationProbePhysicalOperator.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/KeylessAggregationOperatorHandler.hpp>
+#include <Aggregation/KeylessAggregationSlice.hpp>
+#include <DataTypes/DataTypesUtil.hpp>
+#include <Interface/NautilusBuffer.hpp>
+#include <Interface/Record.hpp>
+#include <Interface/RecordBuffer.hpp>
+#include <Interface/TimestampRef.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <WindowProbePhysicalOperator.hpp>
+#include <function.hpp>
+#include <static.hpp>
+#include <val.hpp>
+#include <val_arith.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+void loadChildStateBufferProxy(TupleBuffer* parent, const uint64_t stateBufferIdx, TupleBuffer* stateBuffer)
+{
+    INVARIANT(parent != nullptr, "Parent Tuplebuffer MUST NOT be null at this point");
+    const ChildBufferIndex bufferIndex{static_cast<ChildBufferIndex::Underlying>(stateBufferIdx)};
+    *stateBuffer = parent->loadChildBuffer(bufferIndex);
+}
+
+void createFinalStateBufferProxy(AbstractBufferProvider* bufferProvider, TupleBuffer* finalStateBuffer, const uint64_t sizeOfStatesInBytes)
+{
+    /// A window without aggregation functions has no states, but still needs a buffer to pass to them
+    const auto neededBufferSize = std::max<uint64_t>(sizeOfStatesInBytes, 1);
+    std::optional<TupleBuffer> finalStateTupleBuffer = bufferProvider->getUnpooledBuffer(neededBufferSize);
+    if (not finalStateTupleBuffer.has_value())
+    {
+        throw CannotAllocateBuffer("{}B for the keyless aggregation probe were requested", neededBufferSize);
+    }
+    *finalStateBuffer = finalStateTupleBuffer.value();
+}
+}
+
+void KeylessAggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// As this operator functions as a scan, we have to set the execution context for this pipeline
+    executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
+    executionCtx.currentTs = recordBuffer.getCreatingTs();
+    executionCtx.sequenceNumber = recordBuffer.getSequenceNumber();
+    executionCtx.chunkNumber = recordBuffer.getChunkNumber();
+    executionCtx.lastChunk = recordBuffer.isLastChunk();
+    executionCtx.originId = recordBuffer.getOriginId();
+    openChild(executionCtx, recordBuffer);
+
+    /// Getting necessary values from the record buffer
+    const auto aggregationWindowRef = recordBuffer.getMemArea();
+    const auto numberOfStateBuffers
+        = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedKeylessAggregationWindow::numberOfStateBuffers));
+    const auto windowInfoRef = getMemberRef(aggregationWindowRef, &EmittedKeylessAggregationWindow::windowInfo);
+    const nautilus::val<Timestamp> windowStart{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
+    const nautilus::val<Timestamp> windowEnd{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
+
+    /// A window without any record has no state buffer and, as for keyed aggregations, produces no output record
+    if (numberOfStateBuffers > 0)
+    {
+        /// Combining the states of all worker threads and slices into a fresh final state
+        OwnedNautilusBuffer finalStateBuffer;
+        nautilus::invoke(
+            createFinalStateBufferProxy,
+            executionCtx.pipelineMemoryProvider.bufferProvider,
+            finalStateBuffer.asArg(),
+            nautilus::val<uint64_t>{sizeOfStatesInBytes});
+        const auto finalStatesRef = static_cast<nautilus::val<AggregationState*>>(finalStateBuffer.data());
+        auto finalState = finalStatesRef;
+        for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+        {
+            aggFunction->reset(finalState, finalStateBuffer.asArg(), executionCtx.pipelineMemoryProvider);
+            finalState = finalState + aggFunction->getSizeOfStateInBytes();
+        }
+
+        for (nautilus::val<uint64_t> stateBufferIdx = 0; stateBufferIdx < numberOfStateBuffers; ++stateBufferIdx)
+        {
+            OwnedNautilusBuffer stateBuffer;
+            nautilus::invoke(loadChildStateBufferProxy, recordBuffer.getReference(), stateBufferIdx, stateBuffer.asArg());
+            auto state = static_cast<nautilus::val<AggregationState*>>(
+                stateBuffer.data() + nautilus::val<uint64_t>{sizeof(KeylessAggregationStateHeader)});
+            finalState = finalStatesRef;
+            for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+            {
+                aggFunction->combine(
+                    finalState, finalStateBuffer.asArg(), state, stateBuffer.asArg(), executionCtx.pipelineMemoryProvider);
+                finalState = finalState + aggFunction->getSizeOfStateInBytes();
+                state = state + aggFunction->getSizeOfStateInBytes();
+            }
+        }
+
+        /// Lowering the final state and passing the record with the window start and end to the child
+        Record outputRecord;
+        finalState = finalStatesRef;
+        for (const auto& aggFunction : nautilus::static_iterable(aggregationPhysicalFunctions))
+        {
+            outputRecord.reassignFields(aggFunction->lower(finalState, finalStateBuffer.asArg(), executionCtx.pipelineMemoryProvider));
+            finalState = finalState + aggFunction->getSizeOfStateInBytes();
+        }
+        outputRecord.write(windowMetaData.startField.getFullyQualifiedName(), windowStart.convertToValue());
+        outputRecord.write(windowMetaData.endField.getFullyQualifiedName(), windowEnd.convertToValue());
+        executeChild(executionCtx, outputRecord);
+    }
+}
+
+KeylessAggregationProbePhysicalOperator::KeylessAggregationProbePhysicalOperator(
+    std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions,
+    const OperatorHandlerId operatorHandlerId,
+    WindowMetaData windowMetaData)
+    : WindowProbePhysicalOperator(operatorHandlerId, std::move(windowMetaData))
+    , aggregationPhysicalFunctions(std::move(aggregationPhysicalFunctions))
+    , sizeOfStatesInBytes(std::accumulate(
+          this->aggregationPhysicalFunctions.begin(),
+          this->aggregationPhysicalFunctions.end(),
+          uint64_t{0},
+          [](const uint64_t sum, const auto& function) { return sum + function->getSizeOfStateInBytes(); }))
+{
+}
+
+}
@@ -0,0 +1,76 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Aggregation/KeylessAggregationSlice.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+KeylessAggregationSlice::KeylessAggregationSlice(
+    const SliceStart sliceStart,
+    const SliceEnd sliceEnd,
+    const CreateNewKeylessAggregationSliceArgs& createNewKeylessAggregationSliceArgs,
+    const uint64_t numberOfWorkerThreads)
+    : Slice(sliceStart, sliceEnd), sizeOfStatesInBytes(createNewKeylessAggregationSliceArgs.sizeOfStatesInBytes)
+{
+    PRECONDITION(numberOfWorkerThreads > 0, "A keyless aggregation slice needs at least one state buffer");
+    stateBuffers.resize(numberOfWorkerThreads);
+}
+
+uint64_t KeylessAggregationSlice::getNumberOfStateBuffers() const
+{
+    return stateBuffers.size();
+}
+
+const TupleBuffer* KeylessAggregationSlice::getStateBufferRefForWorker(const WorkerThreadId workerThreadId) const
+{
+    const auto& stateBuffer = stateBuffers[workerThreadId % stateBuffers.size()];
+    return stateBuffer.has_value() ? &stateBuffer.value() : nullptr;
+}
+
+const TupleBuffer*
+KeylessAggregationSlice::getOrCreateStateBufferRefForWorker(AbstractBufferProvider& bufferProvider, const WorkerThreadId workerThreadId)
+{
+    auto& stateBuffer = stateBuffers[workerThreadId % stateBuffers.size()];
+    if (not stateBuffer.has_value())
+    {
+        const auto stateBufferSize = getStateBufferSize(sizeOfStatesInBytes);
+        stateBuffer = bufferProvider.getUnpooledBuffer(stateBufferSize);
+        if (not stateBuffer.has_value())
+        {
+            throw BufferAllocationFailure("No unpooled TupleBuffer of {}B available for a keyless aggregation state!", stateBufferSize);
+        }
+        /// It might be that the buffer is not zeroed out.
+        std::ranges::fill(stateBuffer->getAvailableMemoryArea(), std::byte{0});
+        new (stateBuffer->getAvailableMemoryArea().data()) KeylessAggregationStateHeader{.initialized = false};
+    }
+    return &stateBuffer.value();
+}
+
+uint64_t KeylessAggregationSlice::getStateBufferSize(const uint64_t sizeOfStatesInBytes)
+{
+    constexpr uint64_t cacheLineSize = std::hardware_destructive_interference_size;
+    const auto neededSize = sizeof(KeylessAggregationStateHeader) + sizeOfStatesInBytes;
+    return (neededSize + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+}
+
+}
@@ -0,0 +1,178 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/QuantileSketch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <numbers>
+#include <span>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Values are buffered until the sketch holds this many times the compression, which amortizes the sorting in compress()
+constexpr uint64_t CAPACITY_PER_COMPRESSION = 5;
+
+/// The k1 scale function of the t-digest and its inverse. A centroid may span at most one unit of k, which bounds the number of
+/// centroids by the compression and shrinks centroids towards q = 0 and q = 1.
+double scale(const double quantile, const double compression)
+{
+    return compression / (2 * std::numbers::pi) * std::asin((2 * quantile) - 1);
+}
+
+double inverseScale(const double k, const double compression)
+{
+    if (k >= compression / 4)
+    {
+        return 1;
+    }
+    return (std::sin(k * 2 * std::numbers::pi / compression) + 1) / 2;
+}
+}
+
+uint64_t QuantileSketch::getSizeInBytes(const uint64_t compression)
+{
+    return sizeof(Header) + (compression * CAPACITY_PER_COMPRESSION * sizeof(Centroid));
+}
+
+void QuantileSketch::init(std::span<std::byte> memory, const uint64_t compression)
+{
+    PRECONDITION(compression > 0, "The compression of a quantile sketch must be positive");
+    PRECONDITION(
+        memory.size() >= getSizeInBytes(compression),
+        "A quantile sketch needs {}B but got {}B",
+        getSizeInBytes(compression),
+        memory.size());
+    new (memory.data()) Header{
+        .compression = compression,
+        .capacity = compression * CAPACITY_PER_COMPRESSION,
+        .numberOfCentroids = 0,
+        .totalWeight = 0,
+        .min = std::numeric_limits<double>::max(),
+        .max = std::numeric_limits<double>::lowest()};
+}
+
+QuantileSketch::QuantileSketch(std::span<std::byte> memory)
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): init() placed the header at the start of the memory area
+    : header(reinterpret_cast<Header*>(memory.data()))
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): the centroids directly follow the header
+    , centroids(reinterpret_cast<Centroid*>(memory.data() + sizeof(Header)), header->capacity)
+{
+    PRECONDITION(memory.size() >= getSizeInBytes(header->compression), "The memory area is too small for the quantile sketch");
+}
+
+void QuantileSketch::add(const double value, const double weight)
+{
+    if (header->numberOfCentroids == header->capacity)
+    {
+        compress();
+    }
+    centroids[header->numberOfCentroids++] = Centroid{.mean = value, .weight = weight};
+    header->totalWeight += weight;
+    header->min = std::min(header->min, value);
+    header->max = std::max(header->max, value);
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    for (const auto& centroid : other.centroids.first(other.header->numberOfCentroids))
+    {
+        add(centroid.mean, centroid.weight);
+    }
+    /// The extremes of the other sketch might have been merged into centroids
+    header->min = std::min(header->min, other.header->min);
+    header->max = std::max(header->max, other.header->max);
+}
+
+void QuantileSketch::compress()
+{
+    const auto unmerged = centroids.first(header->numberOfCentroids);
+    if (unmerged.empty())
+    {
+        return;
+    }
+    std::ranges::sort(unmerged, {}, &Centroid::mean);
+
+    /// Merging in place, as the merged centroids never overtake the ones that are read
+    const auto compression = static_cast<double>(header->compression);
+    uint64_t numberOfMerged = 0;
+    double weightBefore = 0;
+    double weightLimit = header->totalWeight * inverseScale(scale(0, compression) + 1, compression);
+    for (uint64_t i = 1; i < unmerged.size(); ++i)
+    {
+        auto& current = centroids[numberOfMerged];
+        const auto& next = unmerged[i];
+        if (weightBefore + current.weight + next.weight <= weightLimit)
+        {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        }
+        else
+        {
+            weightBefore += current.weight;
+            weightLimit = header->totalWeight * inverseScale(scale(weightBefore / header->totalWeight, compression) + 1, compression);
+            centroids[++numberOfMerged] = next;
+        }
+    }
+    header->numberOfCentroids = numberOfMerged + 1;
+    INVARIANT(header->numberOfCentroids < header->capacity, "Compressing must leave room for buffered values");
+}
+
+double QuantileSketch::getQuantile(const double quantile)
+{
+    PRECONDITION(quantile >= 0 and quantile <= 1, "The quantile must lie in [0, 1] but is {}", quantile);
+    PRECONDITION(header->numberOfCentroids > 0, "Can not estimate a quantile of an empty sketch");
+    compress();
+
+    /// Each centroid is centered in the weight it covers. Between the centers we interpolate linearly, outside of them towards the
+    /// extremes. If every centroid holds exactly one value, this matches the usual definition of the median for an even count.
+    const auto merged = centroids.first(header->numberOfCentroids);
+    const auto targetWeight = quantile * header->totalWeight;
+    if (targetWeight <= merged.front().weight / 2)
+    {
+        const auto fraction = merged.front().weight > 1 ? targetWeight / (merged.front().weight / 2) : 1;
+        return header->min + ((merged.front().mean - header->min) * fraction);
+    }
+
+    double centerWeight = merged.front().weight / 2;
+    for (uint64_t i = 1; i < merged.size(); ++i)
+    {
+        const auto nextCenterWeight = centerWeight + ((merged[i - 1].weight + merged[i].weight) / 2);
+        if (targetWeight <= nextCenterWeight)
+        {
+            const auto fraction = (targetWeight - centerWeight) / (nextCenterWeight - centerWeight);
+            return merged[i - 1].mean + ((merged[i].mean - merged[i - 1].mean) * fraction);
+        }
+        centerWeight = nextCenterWeight;
+    }
+
+    const auto remainingWeight = header->totalWeight - centerWeight;
+    const auto fraction = merged.back().weight > 1 ? (targetWeight - centerWeight) / remainingWeight : 0;
+    return merged.back().mean + ((header->max - merged.back().mean) * fraction);
+}
+
+double QuantileSketch::getTotalWeight() const
+{
+    return header->totalWeight;
+}
+
+}
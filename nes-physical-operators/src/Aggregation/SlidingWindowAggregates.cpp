@@ -0,0 +1,101 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/SlidingWindowAggregates.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SlidingWindowAggregates::SlidingWindowAggregates(
+    const uint64_t windowSize, const uint64_t windowSlide, const uint64_t numberOfRadixPartitions)
+    : windowSize(windowSize), chunkLength(((windowSize + windowSlide - 1) / windowSlide) * windowSlide)
+{
+    PRECONDITION(windowSlide > 0 and windowSlide < windowSize, "Only sliding windows are aggregated incrementally");
+    PRECONDITION(numberOfRadixPartitions > 0, "An aggregation needs at least one radix partition");
+    partitions.reserve(numberOfRadixPartitions);
+    for (uint64_t partition = 0; partition < numberOfRadixPartitions; ++partition)
+    {
+        partitions.emplace_back(std::make_unique<Partition>());
+    }
+}
+
+uint64_t
+SlidingWindowAggregates::getFirstPrefixSlice(const Timestamp windowStart, const std::vector<std::shared_ptr<Slice>>& sortedSlices) const
+{
+    if (windowStart.getRawValue() % chunkLength == 0)
+    {
+        return 0;
+    }
+
+    /// A window that does not start at a chunk boundary contains exactly one, as the chunks are at least as long as a window
+    const auto nextChunkStart = Timestamp(((windowStart.getRawValue() / chunkLength) + 1) * chunkLength);
+    const auto firstPrefixSlice = std::ranges::find_if(sortedSlices, [nextChunkStart](const auto& slice)
+                                                       { return slice->getSliceStart() >= nextChunkStart; });
+    return static_cast<uint64_t>(std::distance(sortedSlices.begin(), firstPrefixSlice));
+}
+
+std::optional<TupleBuffer>
+SlidingWindowAggregates::getPartialAggregate(const Side side, const SliceEnd sliceEnd, const uint64_t partition) const
+{
+    const auto& partitionState = *partitions.at(partition);
+    const std::scoped_lock lock(partitionState.mutex);
+    const auto& partialAggregates = side == Side::SUFFIX ? partitionState.suffixes : partitionState.prefixes;
+    if (const auto it = partialAggregates.find(sliceEnd); it != partialAggregates.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void SlidingWindowAggregates::storePartialAggregate(
+    const Side side, const SliceEnd sliceEnd, const uint64_t partition, const TupleBuffer& partialAggregate)
+{
+    auto& partitionState = *partitions.at(partition);
+    const std::scoped_lock lock(partitionState.mutex);
+    auto& partialAggregates = side == Side::SUFFIX ? partitionState.suffixes : partitionState.prefixes;
+    partialAggregates.try_emplace(sliceEnd, partialAggregate);
+}
+
+void SlidingWindowAggregates::garbageCollect(const Timestamp newGlobalWaterMark)
+{
+    /// Same condition as for the slices themselves: no window that has not been probed yet contains a slice ending before this
+    const auto removeExpired = [this, newGlobalWaterMark](std::map<SliceEnd, TupleBuffer>& partialAggregates)
+    {
+        const auto firstAlive = std::ranges::find_if(
+            partialAggregates, [this, newGlobalWaterMark](const auto& entry) { return entry.first + windowSize >= newGlobalWaterMark; });
+        partialAggregates.erase(partialAggregates.begin(), firstAlive);
+    };
+
+    for (const auto& partition : partitions)
+    {
+        const std::scoped_lock lock(partition->mutex);
+        removeExpired(partition->suffixes);
+        removeExpired(partition->prefixes);
+    }
+}
+
+}
@@ -0,0 +1,445 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/SpaceSavingSketch.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// Orders entries by descending count. Equal counts are ordered by their key bytes, so that the reported order is deterministic.
+bool isMoreFrequent(const SpaceSavingSketch::Entry& lhs, const SpaceSavingSketch::Entry& rhs)
+{
+    if (lhs.count != rhs.count)
+    {
+        return lhs.count > rhs.count;
+    }
+    return std::ranges::lexicographical_compare(lhs.key, rhs.key);
+}
+}
+
+uint64_t SpaceSavingSketch::getSizeInBytes(const uint64_t numberOfCounters, const uint64_t keyAreaSize)
+{
+    /// Hash, count, and error (8B each) plus the offset and length of the key and the heap entry and position (4B each) per counter
+    constexpr uint64_t bytesPerCounter = (3 * sizeof(uint64_t)) + (4 * sizeof(uint32_t));
+    return sizeof(Header) + (numberOfCounters * bytesPerCounter) + (getNumberOfIndexSlots(numberOfCounters) * sizeof(uint32_t))
+        + keyAreaSize;
+}
+
+void SpaceSavingSketch::init(std::span<std::byte> memory, const uint64_t numberOfCounters, const uint64_t keyAreaSize)
+{
+    PRECONDITION(numberOfCounters > 0, "A space-saving sketch needs at least one counter");
+    PRECONDITION(
+        numberOfCounters < std::numeric_limits<uint32_t>::max(),
+        "A space-saving sketch must not have more than 4G counters but has {}",
+        numberOfCounters);
+    PRECONDITION(
+        keyAreaSize <= std::numeric_limits<uint32_t>::max(),
+        "The key area of a space-saving sketch must not exceed 4GiB but is {}B",
+        keyAreaSize);
+    PRECONDITION(
+        memory.size() >= getSizeInBytes(numberOfCounters, keyAreaSize),
+        "A space-saving sketch needs {}B but got {}B",
+        getSizeInBytes(numberOfCounters, keyAreaSize),
+        memory.size());
+    new (memory.data())
+        Header{.numberOfCounters = numberOfCounters, .numberOfUsedCounters = 0, .keyAreaSize = keyAreaSize, .keyAreaUsed = 0};
+    SpaceSavingSketch sketch{memory};
+    std::ranges::fill(sketch.indexSlots, EMPTY_SLOT);
+}
+
+/// The header starts the memory area and the counter arrays, the heap, the hash index, and the key area follow it, as placed by init()
+/// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+SpaceSavingSketch::SpaceSavingSketch(std::span<std::byte> memory)
+    : header(reinterpret_cast<Header*>(memory.data()))
+    , hashes(reinterpret_cast<uint64_t*>(memory.data() + sizeof(Header)), header->numberOfCounters)
+    , counts(hashes.data() + header->numberOfCounters, header->numberOfCounters)
+    , errors(counts.data() + header->numberOfCounters, header->numberOfCounters)
+    , keyOffsets(reinterpret_cast<uint32_t*>(errors.data() + header->numberOfCounters), header->numberOfCounters)
+    , keyLengths(keyOffsets.data() + header->numberOfCounters, header->numberOfCounters)
+    , heap(keyLengths.data() + header->numberOfCounters, header->numberOfCounters)
+    , heapPositions(heap.data() + header->numberOfCounters, header->numberOfCounters)
+    , indexSlots(heapPositions.data() + header->numberOfCounters, getNumberOfIndexSlots(header->numberOfCounters))
+    , keyArea(reinterpret_cast<std::byte*>(indexSlots.data() + indexSlots.size()), header->keyAreaSize)
+{
+    PRECONDITION(
+        memory.size() >= getSizeInBytes(header->numberOfCounters, header->keyAreaSize),
+        "The memory area is too small for the space-saving sketch");
+}
+
+/// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+bool SpaceSavingSketch::add(const std::span<const std::byte> key, const uint64_t weight)
+{
+    const auto hash = hashKey(key);
+    if (const auto counter = find(hash, key))
+    {
+        counts[*counter] += weight;
+        siftDown(heapPositions[*counter]);
+        return true;
+    }
+
+    if (header->numberOfUsedCounters < header->numberOfCounters)
+    {
+        if (not reserveKeyBytes(key.size(), std::nullopt))
+        {
+            return false;
+        }
+        const auto counter = header->numberOfUsedCounters++;
+        setCounter(counter, hash, key, weight, 0);
+        insertIntoIndex(counter);
+        heap[counter] = static_cast<uint32_t>(counter);
+        heapPositions[counter] = static_cast<uint32_t>(counter);
+        siftUp(counter);
+        return true;
+    }
+
+    /// The key replaces the one with the smallest count, as the key might have been seen that often before without being monitored
+    const uint64_t minCounter = heap.front();
+    if (not reserveKeyBytes(key.size(), minCounter))
+    {
+        return false;
+    }
+    removeFromIndex(minCounter);
+    const auto minCount = counts[minCounter];
+    setCounter(minCounter, hash, key, minCount + weight, minCount);
+    insertIntoIndex(minCounter);
+    siftDown(0);
+    return true;
+}
+
+bool SpaceSavingSketch::merge(const SpaceSavingSketch& other)
+{
+    PRECONDITION(
+        header->numberOfCounters == other.header->numberOfCounters,
+        "Can not merge space-saving sketches with {} and {} counters",
+        header->numberOfCounters,
+        other.header->numberOfCounters);
+
+    /// A key that a full sketch does not monitor occurred at most as often as the smallest count of that sketch
+    const auto minCount = getMinCount();
+    const auto otherMinCount = other.getMinCount();
+
+    std::vector<Entry> merged;
+    merged.reserve(header->numberOfUsedCounters + other.header->numberOfUsedCounters);
+    std::vector<bool> isMonitoredByBoth(other.header->numberOfUsedCounters, false);
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        auto entry = Entry{.key = getKey(counter), .count = counts[counter] + otherMinCount, .error = errors[counter] + otherMinCount};
+        if (const auto match = other.find(hashes[counter], entry.key))
+        {
+            entry.count = counts[counter] + other.counts[*match];
+            entry.error = errors[counter] + other.errors[*match];
+            isMonitoredByBoth[*match] = true;
+        }
+        merged.push_back(entry);
+    }
+    for (uint64_t otherCounter = 0; otherCounter < other.header->numberOfUsedCounters; ++otherCounter)
+    {
+        if (not isMonitoredByBoth[otherCounter])
+        {
+            merged.push_back(Entry{
+                .key = other.getKey(otherCounter),
+                .count = other.counts[otherCounter] + minCount,
+                .error = other.errors[otherCounter] + minCount});
+        }
+    }
+
+    /// Keeping the most frequent keys, as every key that is dropped is at most as frequent as the smallest count of the merged sketch
+    if (merged.size() > header->numberOfCounters)
+    {
+        std::ranges::nth_element(merged, merged.begin() + static_cast<std::ptrdiff_t>(header->numberOfCounters), isMoreFrequent);
+        merged.resize(header->numberOfCounters);
+    }
+    uint64_t mergedKeyBytes = 0;
+    for (const auto& entry : merged)
+    {
+        mergedKeyBytes += entry.key.size();
+    }
+    if (mergedKeyBytes > header->keyAreaSize)
+    {
+        return false;
+    }
+
+    /// The merged keys point into both key areas, so they have to be copied before the key area of this sketch is rewritten
+    std::vector<std::byte> mergedKeys;
+    mergedKeys.reserve(mergedKeyBytes);
+    for (const auto& entry : merged)
+    {
+        mergedKeys.insert(mergedKeys.end(), entry.key.begin(), entry.key.end());
+    }
+    header->numberOfUsedCounters = merged.size();
+    header->keyAreaUsed = 0;
+    uint64_t mergedKeyOffset = 0;
+    for (uint64_t counter = 0; counter < merged.size(); ++counter)
+    {
+        const auto key = std::span<const std::byte>{mergedKeys}.subspan(mergedKeyOffset, merged[counter].key.size());
+        setCounter(counter, hashKey(key), key, merged[counter].count, merged[counter].error);
+        mergedKeyOffset += key.size();
+    }
+    rebuildIndexAndHeap();
+    return true;
+}
+
+void SpaceSavingSketch::copyInto(SpaceSavingSketch& other) const
+{
+    PRECONDITION(
+        other.header->numberOfUsedCounters == 0 and other.header->numberOfCounters == header->numberOfCounters,
+        "Can only copy a space-saving sketch into an empty one with the same number of counters");
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        const auto key = getKey(counter);
+        const auto hasReservedKeyBytes = other.reserveKeyBytes(key.size(), std::nullopt);
+        INVARIANT(hasReservedKeyBytes, "The key area of the copy is too small for the keys of the space-saving sketch");
+        other.setCounter(counter, hashes[counter], key, counts[counter], errors[counter]);
+    }
+    other.header->numberOfUsedCounters = header->numberOfUsedCounters;
+    other.rebuildIndexAndHeap();
+}
+
+std::vector<SpaceSavingSketch::Entry> SpaceSavingSketch::getTopK(const uint64_t k) const
+{
+    std::vector<Entry> entries;
+    entries.reserve(header->numberOfUsedCounters);
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        entries.push_back(Entry{.key = getKey(counter), .count = counts[counter], .error = errors[counter]});
+    }
+    const auto numberOfReported = std::min<uint64_t>(k, entries.size());
+    std::ranges::partial_sort(entries, entries.begin() + static_cast<std::ptrdiff_t>(numberOfReported), isMoreFrequent);
+    entries.resize(numberOfReported);
+    return entries;
+}
+
+uint64_t SpaceSavingSketch::getNumberOfCounters() const
+{
+    return header->numberOfCounters;
+}
+
+uint64_t SpaceSavingSketch::getKeyAreaSize() const
+{
+    return header->keyAreaSize;
+}
+
+uint64_t SpaceSavingSketch::getNumberOfIndexSlots(const uint64_t numberOfCounters)
+{
+    return std::bit_ceil(2 * numberOfCounters);
+}
+
+uint64_t SpaceSavingSketch::hashKey(const std::span<const std::byte> key)
+{
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): hashing the key bytes as characters
+    return std::hash<std::string_view>{}(std::string_view{reinterpret_cast<const char*>(key.data()), key.size()});
+}
+
+std::span<const std::byte> SpaceSavingSketch::getKey(const uint64_t counter) const
+{
+    return std::span<const std::byte>{keyArea}.subspan(keyOffsets[counter], keyLengths[counter]);
+}
+
+std::optional<uint64_t> SpaceSavingSketch::find(const uint64_t hash, const std::span<const std::byte> key) const
+{
+    const auto slotMask = indexSlots.size() - 1;
+    for (auto slot = hash & slotMask; indexSlots[slot] != EMPTY_SLOT; slot = (slot + 1) & slotMask)
+    {
+        const uint64_t counter = indexSlots[slot] - 1;
+        if (hashes[counter] == hash and std::ranges::equal(getKey(counter), key))
+        {
+            return counter;
+        }
+    }
+    return std::nullopt;
+}
+
+uint64_t SpaceSavingSketch::getMinCount() const
+{
+    if (header->numberOfUsedCounters < header->numberOfCounters)
+    {
+        return 0;
+    }
+    return counts[heap.front()];
+}
+
+void SpaceSavingSketch::insertIntoIndex(const uint64_t counter)
+{
+    const auto slotMask = indexSlots.size() - 1;
+    auto slot = hashes[counter] & slotMask;
+    while (indexSlots[slot] != EMPTY_SLOT)
+    {
+        slot = (slot + 1) & slotMask;
+    }
+    indexSlots[slot] = static_cast<uint32_t>(counter + 1);
+}
+
+void SpaceSavingSketch::removeFromIndex(const uint64_t counter)
+{
+    const auto slotMask = indexSlots.size() - 1;
+    auto emptiedSlot = hashes[counter] & slotMask;
+    while (indexSlots[emptiedSlot] != counter + 1)
+    {
+        emptiedSlot = (emptiedSlot + 1) & slotMask;
+    }
+    indexSlots[emptiedSlot] = EMPTY_SLOT;
+
+    /// Shifts the following entries of the probe sequence back, so that no lookup stops at the emptied slot before reaching its key.
+    /// An entry can fill the emptied slot if its home slot does not lie cyclically between the emptied slot and its own slot.
+    for (auto slot = (emptiedSlot + 1) & slotMask; indexSlots[slot] != EMPTY_SLOT; slot = (slot + 1) & slotMask)
+    {
+        const auto homeSlot = hashes[indexSlots[slot] - 1] & slotMask;
+        if (((slot - homeSlot) & slotMask) >= ((slot - emptiedSlot) & slotMask))
+        {
+            indexSlots[emptiedSlot] = indexSlots[slot];
+            indexSlots[slot] = EMPTY_SLOT;
+            emptiedSlot = slot;
+        }
+    }
+}
+
+void SpaceSavingSketch::siftUp(uint64_t heapPosition)
+{
+    const auto counter = heap[heapPosition];
+    while (heapPosition > 0)
+    {
+        const auto parentPosition = (heapPosition - 1) / 2;
+        if (counts[heap[parentPosition]] <= counts[counter])
+        {
+            break;
+        }
+        heap[heapPosition] = heap[parentPosition];
+        heapPositions[heap[heapPosition]] = static_cast<uint32_t>(heapPosition);
+        heapPosition = parentPosition;
+    }
+    heap[heapPosition] = counter;
+    heapPositions[counter] = static_cast<uint32_t>(heapPosition);
+}
+
+void SpaceSavingSketch::siftDown(uint64_t heapPosition)
+{
+    const auto counter = heap[heapPosition];
+    const auto heapSize = header->numberOfUsedCounters;
+    while (2 * heapPosition + 1 < heapSize)
+    {
+        auto childPosition = 2 * heapPosition + 1;
+        if (childPosition + 1 < heapSize and counts[heap[childPosition + 1]] < counts[heap[childPosition]])
+        {
+            ++childPosition;
+        }
+        if (counts[counter] <= counts[heap[childPosition]])
+        {
+            break;
+        }
+        heap[heapPosition] = heap[childPosition];
+        heapPositions[heap[heapPosition]] = static_cast<uint32_t>(heapPosition);
+        heapPosition = childPosition;
+    }
+    heap[heapPosition] = counter;
+    heapPositions[counter] = static_cast<uint32_t>(heapPosition);
+}
+
+void SpaceSavingSketch::rebuildIndexAndHeap()
+{
+    std::ranges::fill(indexSlots, EMPTY_SLOT);
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        insertIntoIndex(counter);
+        heap[counter] = static_cast<uint32_t>(counter);
+        heapPositions[counter] = static_cast<uint32_t>(counter);
+    }
+    for (auto heapPosition = header->numberOfUsedCounters / 2; heapPosition > 0; --heapPosition)
+    {
+        siftDown(heapPosition - 1);
+    }
+}
+
+bool SpaceSavingSketch::reserveKeyBytes(const uint64_t keyLength, const std::optional<uint64_t> replacedCounter)
+{
+    if (header->keyAreaUsed + keyLength <= header->keyAreaSize)
+    {
+        return true;
+    }
+
+    uint64_t liveKeyBytes = 0;
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        if (counter != replacedCounter)
+        {
+            liveKeyBytes += keyLengths[counter];
+        }
+    }
+    if (liveKeyBytes + keyLength > header->keyAreaSize)
+    {
+        return false;
+    }
+    compactKeyArea(replacedCounter);
+    return true;
+}
+
+void SpaceSavingSketch::compactKeyArea(const std::optional<uint64_t> replacedCounter)
+{
+    /// Moving the keys in the order of their offsets never overwrites a key that has not been moved yet
+    std::vector<uint64_t> liveCounters;
+    liveCounters.reserve(header->numberOfUsedCounters);
+    for (uint64_t counter = 0; counter < header->numberOfUsedCounters; ++counter)
+    {
+        if (counter != replacedCounter)
+        {
+            liveCounters.push_back(counter);
+        }
+    }
+    std::ranges::sort(liveCounters, {}, [this](const uint64_t counter) { return keyOffsets[counter]; });
+
+    uint64_t keyAreaUsed = 0;
+    for (const auto counter : liveCounters)
+    {
+        std::memmove(keyArea.data() + keyAreaUsed, keyArea.data() + keyOffsets[counter], keyLengths[counter]);
+        keyOffsets[counter] = static_cast<uint32_t>(keyAreaUsed);
+        keyAreaUsed += keyLengths[counter];
+    }
+    if (replacedCounter)
+    {
+        keyOffsets[*replacedCounter] = 0;
+        keyLengths[*replacedCounter] = 0;
+    }
+    header->keyAreaUsed = keyAreaUsed;
+}
+
+void SpaceSavingSketch::setCounter(
+    const uint64_t counter, const uint64_t hash, const std::span<const std::byte> key, const uint64_t count, const uint64_t error)
+{
+    INVARIANT(header->keyAreaUsed + key.size() <= header->keyAreaSize, "The key bytes have not been reserved");
+    std::ranges::copy(key, keyArea.begin() + static_cast<std::ptrdiff_t>(header->keyAreaUsed));
+    hashes[counter] = hash;
+    counts[counter] = count;
+    errors[counter] = error;
+    keyOffsets[counter] = static_cast<uint32_t>(header->keyAreaUsed);
+    keyLengths[counter] = static_cast<uint32_t>(key.size());
+    header->keyAreaUsed += key.size();
+}
+
+}
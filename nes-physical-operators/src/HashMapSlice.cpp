@@ -81,8 +81,7 @@ HashMapSlice::getOrCreateHashMapBufferRef(AbstractBufferProvider& bufferProvider
     {
         /// initialize the chained hash map buffer
         /// allocate buffers for the hash maps
-        if (auto childBuffer = bufferProvider.getUnpooledBuffer(
-                ChainedHashMap::calculateBufferSize(hashMapConfig.numberOfBuckets, hashMapConfig.bloomFilterMemAreaSize())))
+        if (auto childBuffer = bufferProvider.getUnpooledBuffer(ChainedHashMap::calculateBufferSize(hashMapConfig)))
         {
             /// initialize chained hash map i
             ChainedHashMap::init(childBuffer.value(), hashMapConfig);
@@ -84,8 +84,9 @@ HJOperatorHandler::HJOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    JoinTriggerStrategy triggerStrategy)
-    : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore), std::move(triggerStrategy))
+    JoinTriggerStrategy triggerStrategy,
+    const std::chrono::milliseconds originIdleTimeout)
+    : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore), std::move(triggerStrategy), originIdleTimeout)
     , setupAlreadyCalledLeft(false)
     , setupAlreadyCalledRight(false)
 {
@@ -178,7 +179,7 @@ void HJOperatorHandler::emitSlicesToProbe(
         std::ignore = tupleBuffer.storeChildBuffer(rightBuffer);
     }
 
-    pipelineCtx->emitBuffer(tupleBuffer);
+    pipelineCtx->emitBuffer(tupleBuffer, PipelineExecutionContext::ContinuationPolicy::NEVER);
 }
 
 }
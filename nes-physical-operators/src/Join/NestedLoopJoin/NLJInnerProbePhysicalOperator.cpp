@@ -18,24 +18,18 @@
 #include <memory>
 #include <utility>
 #include <vector>
-#include <DataTypes/DataTypesUtil.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
-#include <Interface/NESStrongTypeRef.hpp>
-#include <Interface/NautilusBuffer.hpp>
 #include <Interface/PagedVector/PagedVectorRef.hpp>
 #include <Interface/Record.hpp>
 #include <Interface/RecordBuffer.hpp>
 #include <Interface/TimestampRef.hpp>
-#include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
 #include <Join/NestedLoopJoin/NLJProbePhysicalOperatorBase.hpp>
-#include <Join/NestedLoopJoin/NLJSlice.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Operators/Windows/WindowMetaData.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/Slice.hpp>
-#include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
 #include <ExecutionContext.hpp>
 #include <val.hpp>
@@ -69,24 +63,7 @@ void NLJInnerProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordB
 {
     StreamJoinProbePhysicalOperator::open(executionCtx, recordBuffer);
 
-    /// Parse trigger buffer — for inner join, always 1 left + 1 right slice end
-    const auto triggerRef = static_cast<nautilus::val<EmittedNLJWindowTrigger*>>(recordBuffer.getMemArea());
-    const auto windowInfoRef = getMemberRef(triggerRef, &EmittedNLJWindowTrigger::windowInfo);
-    const auto windowStart = nautilus::val<Timestamp>{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
-    const auto windowEnd = nautilus::val<Timestamp>{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
-
-    auto leftSliceEndsPtr = readValueFromMemRef<SliceEnd::Underlying*>(getMemberRef(triggerRef, &EmittedNLJWindowTrigger::leftSliceEnds));
-    auto rightSliceEndsPtr = readValueFromMemRef<SliceEnd::Underlying*>(getMemberRef(triggerRef, &EmittedNLJWindowTrigger::rightSliceEnds));
-    const nautilus::val<SliceEnd> sliceIdLeft{leftSliceEndsPtr[0]};
-    const nautilus::val<SliceEnd> sliceIdRight{rightSliceEndsPtr[0]};
-
-    /// Getting the left and right paged vector
-    const auto operatorHandlerMemRef = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
-    const auto leftPagedVectorRef = getPagedVectorBufferRef(operatorHandlerMemRef, sliceIdLeft, JoinBuildSideType::Left);
-    const auto rightPagedVectorRef = getPagedVectorBufferRef(operatorHandlerMemRef, sliceIdRight, JoinBuildSideType::Right);
-
-    const PagedVectorRef leftPagedVector(BorrowedNautilusBuffer::from(leftPagedVectorRef), leftTupleLayout);
-    const PagedVectorRef rightPagedVector(BorrowedNautilusBuffer::from(rightPagedVectorRef), rightTupleLayout);
+    const auto [windowStart, windowEnd, leftPagedVector, rightPagedVector] = openInnerProbeInput(executionCtx, recordBuffer);
     const auto numberOfTuplesLeft = leftPagedVector.getNumberOfRecords();
     const auto numberOfTuplesRight = rightPagedVector.getNumberOfRecords();
 
@@ -100,6 +77,7 @@ void NLJInnerProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordB
             *rightTupleLayout,
             leftKeyFieldNames,
             rightKeyFieldNames,
+            rightKeyTupleLayout,
             executionCtx,
             windowStart,
             windowEnd);
@@ -113,6 +91,7 @@ void NLJInnerProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordB
             *leftTupleLayout,
             rightKeyFieldNames,
             leftKeyFieldNames,
+            leftKeyTupleLayout,
             executionCtx,
             windowStart,
             windowEnd);
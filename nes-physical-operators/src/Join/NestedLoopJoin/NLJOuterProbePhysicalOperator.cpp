@@ -215,6 +215,7 @@ void NLJOuterProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordB
             *rightTupleLayout,
             leftKeyFieldNames,
             rightKeyFieldNames,
+            rightKeyTupleLayout,
             executionCtx,
             windowStart,
             windowEnd);
@@ -228,6 +229,7 @@ void NLJOuterProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordB
             *leftTupleLayout,
             rightKeyFieldNames,
             leftKeyFieldNames,
+            leftKeyTupleLayout,
             executionCtx,
             windowStart,
             windowEnd);
@@ -14,15 +14,23 @@
 
 #include <Join/NestedLoopJoin/NLJProbePhysicalOperatorBase.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <utility>
 #include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypesUtil.hpp>
+#include <DataTypes/UnboundField.hpp>
+#include <DataTypes/UnboundSchema.hpp>
 #include <Functions/PhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Interface/NESStrongTypeRef.hpp>
+#include <Interface/NautilusBuffer.hpp>
 #include <Interface/PagedVector/PagedVectorRef.hpp>
 #include <Interface/Record.hpp>
+#include <Interface/RecordBuffer.hpp>
 #include <Interface/TimestampRef.hpp>
 #include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
 #include <Join/NestedLoopJoin/NLJSlice.hpp>
@@ -54,6 +62,31 @@ NLJSlice* getNLJSliceRefFromEndProxy(OperatorHandler* ptrOpHandler, const SliceE
     INVARIANT(slice.has_value(), "Could not find a slice for slice end {}", sliceEnd);
     return dynamic_cast<NLJSlice*>(slice.value().get());
 }
+
+/// Creates the layout of the key blocks, which only contains the key fields of one side. Returns nullptr if a key field is variable-sized,
+/// as the key block only holds fixed-size values, or if there are no key fields at all.
+std::shared_ptr<PagedVectorTupleLayout>
+createKeyTupleLayout(const PagedVectorTupleLayout& tupleLayout, const std::vector<Record::RecordFieldIdentifier>& keyFieldNames)
+{
+    std::vector<QualifiedUnboundField> keyFields;
+    for (const auto& keyFieldName : keyFieldNames)
+    {
+        const auto keyField = tupleLayout.getSchema().getFieldByName(keyFieldName);
+        if (not keyField.has_value() or keyField->getDataType().isType(DataType::Type::VARSIZED))
+        {
+            return nullptr;
+        }
+        if (not std::ranges::contains(keyFields, keyField.value()))
+        {
+            keyFields.emplace_back(keyField.value());
+        }
+    }
+    if (keyFields.empty())
+    {
+        return nullptr;
+    }
+    return std::make_shared<DefaultPagedVectorTupleLayout>(Schema<QualifiedUnboundField, Ordered>{std::move(keyFields)});
+}
 }
 
 NLJProbePhysicalOperatorBase::NLJProbePhysicalOperatorBase(
@@ -70,7 +103,32 @@ NLJProbePhysicalOperatorBase::NLJProbePhysicalOperatorBase(
     , rightTupleLayout(std::move(rightTupleLayout))
     , leftKeyFieldNames(std::move(leftKeyFieldNames))
     , rightKeyFieldNames(std::move(rightKeyFieldNames))
+    , leftKeyTupleLayout(createKeyTupleLayout(*this->leftTupleLayout, this->leftKeyFieldNames))
+    , rightKeyTupleLayout(createKeyTupleLayout(*this->rightTupleLayout, this->rightKeyFieldNames))
+{
+}
+
+NLJProbePhysicalOperatorBase::InnerProbeInput
+NLJProbePhysicalOperatorBase::openInnerProbeInput(ExecutionContext& executionCtx, const RecordBuffer& recordBuffer) const
 {
+    const auto triggerRef = static_cast<nautilus::val<EmittedNLJWindowTrigger*>>(recordBuffer.getMemArea());
+    const auto windowInfoRef = getMemberRef(triggerRef, &EmittedNLJWindowTrigger::windowInfo);
+    const auto windowStart = nautilus::val<Timestamp>{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowStart))};
+    const auto windowEnd = nautilus::val<Timestamp>{readValueFromMemRef<uint64_t>(getMemberRef(windowInfoRef, &WindowInfo::windowEnd))};
+
+    auto leftSliceEndsPtr = readValueFromMemRef<SliceEnd::Underlying*>(getMemberRef(triggerRef, &EmittedNLJWindowTrigger::leftSliceEnds));
+    auto rightSliceEndsPtr = readValueFromMemRef<SliceEnd::Underlying*>(getMemberRef(triggerRef, &EmittedNLJWindowTrigger::rightSliceEnds));
+    const nautilus::val<SliceEnd> sliceIdLeft{leftSliceEndsPtr[0]};
+    const nautilus::val<SliceEnd> sliceIdRight{rightSliceEndsPtr[0]};
+
+    const auto operatorHandlerMemRef = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    const auto leftPagedVectorRef = getPagedVectorBufferRef(operatorHandlerMemRef, sliceIdLeft, JoinBuildSideType::Left);
+    const auto rightPagedVectorRef = getPagedVectorBufferRef(operatorHandlerMemRef, sliceIdRight, JoinBuildSideType::Right);
+    return InnerProbeInput{
+        .windowStart = windowStart,
+        .windowEnd = windowEnd,
+        .leftPagedVector = PagedVectorRef(BorrowedNautilusBuffer::from(leftPagedVectorRef), leftTupleLayout),
+        .rightPagedVector = PagedVectorRef(BorrowedNautilusBuffer::from(rightPagedVectorRef), rightTupleLayout)};
 }
 
 void NLJProbePhysicalOperatorBase::performNLJ(
@@ -80,6 +138,7 @@ void NLJProbePhysicalOperatorBase::performNLJ(
     PagedVectorTupleLayout& innerTupleLayout,
     const std::vector<Record::RecordFieldIdentifier>& outerKeyFieldNames,
     const std::vector<Record::RecordFieldIdentifier>& innerKeyFieldNames,
+    const std::shared_ptr<PagedVectorTupleLayout>& innerKeyTupleLayout,
     ExecutionContext& executionCtx,
     const nautilus::val<Timestamp>& windowStart,
     const nautilus::val<Timestamp>& windowEnd) const
@@ -87,16 +146,65 @@ void NLJProbePhysicalOperatorBase::performNLJ(
     const auto outerFields = getOrderedFieldNames(outerTupleLayout.getSchema());
     const auto innerFields = getOrderedFieldNames(innerTupleLayout.getSchema());
 
-    for (auto outerIt = outerPagedVector.begin(); outerIt != outerPagedVector.end(); ++outerIt)
+    if (innerKeyTupleLayout == nullptr)
     {
-        for (auto innerIt = innerPagedVector.begin(); innerIt != innerPagedVector.end(); ++innerIt)
+        for (auto outerIt = outerPagedVector.begin(); outerIt != outerPagedVector.end(); ++outerIt)
+        {
+            for (auto innerIt = innerPagedVector.begin(); innerIt != innerPagedVector.end(); ++innerIt)
+            {
+                const auto joinedKeyFields
+                    = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerKeyFieldNames, innerKeyFieldNames);
+                if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
+                {
+                    auto joinedRecord = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerFields, innerFields);
+                    executeChild(executionCtx, joinedRecord);
+                }
+            }
+        }
+        return;
+    }
+
+    /// The key block only holds fixed-size fields, so the var-sized callbacks of the layout are never invoked
+    const AllocateVarSizedFunction noVarSizedAllocation = [](const nautilus::val<int8_t*>& fieldSlot, const nautilus::val<uint64_t>&)
+    { return fieldSlot; };
+    const LoadVarSizedFunction noVarSizedLoad = [](const nautilus::val<int8_t*>& fieldSlot)
+    { return std::make_pair(fieldSlot, nautilus::val<uint64_t>(0)); };
+
+    const uint64_t keyTupleSize = getSizeInBytes(innerKeyTupleLayout->getSchema());
+    const uint64_t tuplesPerBlock = std::max<uint64_t>(1, INNER_KEY_BLOCK_SIZE_IN_BYTES / keyTupleSize);
+    const auto keyBlock = executionCtx.allocateMemory(nautilus::val<size_t>(tuplesPerBlock * keyTupleSize));
+    const auto numberOfInnerTuples = innerPagedVector.getNumberOfRecords();
+
+    auto innerIt = innerPagedVector.begin();
+    for (nautilus::val<uint64_t> blockStart = 0; blockStart < numberOfInnerTuples; blockStart = blockStart + tuplesPerBlock)
+    {
+        nautilus::val<uint64_t> blockSize = numberOfInnerTuples - blockStart;
+        if (blockSize > tuplesPerBlock)
+        {
+            blockSize = tuplesPerBlock;
+        }
+
+        /// Copies the keys of the next block of inner tuples into the contiguous key block
+        for (nautilus::val<uint64_t> blockIdx = 0; blockIdx < blockSize; ++blockIdx)
+        {
+            innerKeyTupleLayout->writeRecord(*innerIt, keyBlock + blockIdx * keyTupleSize, noVarSizedAllocation);
+            ++innerIt;
+        }
+
+        for (auto outerIt = outerPagedVector.begin(); outerIt != outerPagedVector.end(); ++outerIt)
         {
-            const auto joinedKeyFields
-                = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerKeyFieldNames, innerKeyFieldNames);
-            if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
+            const auto outerRecord = *outerIt;
+            for (nautilus::val<uint64_t> blockIdx = 0; blockIdx < blockSize; ++blockIdx)
             {
-                auto joinedRecord = createJoinedRecord(*outerIt, *innerIt, windowStart, windowEnd, outerFields, innerFields);
-                executeChild(executionCtx, joinedRecord);
+                const auto innerKeys = innerKeyTupleLayout->readRecord(keyBlock + blockIdx * keyTupleSize, noVarSizedLoad);
+                const auto joinedKeyFields
+                    = createJoinedRecord(outerRecord, innerKeys, windowStart, windowEnd, outerKeyFieldNames, innerKeyFieldNames);
+                if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
+                {
+                    const auto innerRecord = innerPagedVector.at(blockStart + blockIdx);
+                    auto joinedRecord = createJoinedRecord(outerRecord, innerRecord, windowStart, windowEnd, outerFields, innerFields);
+                    executeChild(executionCtx, joinedRecord);
+                }
             }
         }
     }
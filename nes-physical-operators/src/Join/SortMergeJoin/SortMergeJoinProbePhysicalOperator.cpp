@@ -0,0 +1,224 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/SortMergeJoin/SortMergeJoinProbePhysicalOperator.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataTypesUtil.hpp>
+#include <DataTypes/VarVal.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Interface/PagedVector/PagedVectorRef.hpp>
+#include <Interface/Record.hpp>
+#include <Interface/RecordBuffer.hpp>
+#include <Interface/TimestampRef.hpp>
+#include <Join/NestedLoopJoin/NLJProbePhysicalOperatorBase.hpp>
+#include <Join/StreamJoinProbePhysicalOperator.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Operators/Windows/WindowMetaData.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Schema/Schema.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <ExecutionContext.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_arith.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+namespace
+{
+struct SortEntry
+{
+    int64_t key;
+    uint64_t position;
+};
+
+std::span<SortEntry> asSortEntries(int8_t* entries, const uint64_t numberOfEntries)
+{
+    return {reinterpret_cast<SortEntry*>(entries), numberOfEntries}; /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/// The arena hands out unaligned memory, which is why we over-allocate by alignof(SortEntry) and align the start here
+int8_t* alignSortEntriesProxy(int8_t* memory)
+{
+    void* alignedMemory = memory;
+    size_t space = std::numeric_limits<size_t>::max();
+    std::align(alignof(SortEntry), sizeof(SortEntry), alignedMemory, space);
+    return static_cast<int8_t*>(alignedMemory);
+}
+
+void sortEntriesProxy(int8_t* entries, const uint64_t numberOfEntries, const bool biasedUnsignedKeys)
+{
+    const auto sortEntries = asSortEntries(entries, numberOfEntries);
+    if (biasedUnsignedKeys)
+    {
+        /// The keys were written as raw unsigned bits. Flipping the sign bit maps them order-preserving onto int64.
+        for (auto& entry : sortEntries)
+        {
+            entry.key = std::bit_cast<int64_t>(std::bit_cast<uint64_t>(entry.key) ^ (uint64_t{1} << 63U));
+        }
+    }
+    std::ranges::sort(sortEntries, {}, &SortEntry::key);
+}
+
+int64_t addSaturated(const int64_t key, const int64_t distance)
+{
+    int64_t bound = 0;
+    if (__builtin_add_overflow(key, distance, &bound))
+    {
+        return distance > 0 ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+    }
+    return bound;
+}
+
+/// Returns the first position in [from, numberOfEntries) whose key is not smaller than `key + minDistance`
+uint64_t lowerBoundProxy(int8_t* entries, const uint64_t from, const uint64_t numberOfEntries, const int64_t key, const int64_t minDistance)
+{
+    const auto sortEntries = asSortEntries(entries, numberOfEntries);
+    const auto it = std::ranges::lower_bound(sortEntries.subspan(from), addSaturated(key, minDistance), {}, &SortEntry::key);
+    return static_cast<uint64_t>(std::distance(sortEntries.begin(), it));
+}
+
+/// Returns the first position in [from, numberOfEntries) whose key is larger than `key + maxDistance`
+uint64_t upperBoundProxy(int8_t* entries, const uint64_t from, const uint64_t numberOfEntries, const int64_t key, const int64_t maxDistance)
+{
+    const auto sortEntries = asSortEntries(entries, numberOfEntries);
+    const auto it = std::ranges::upper_bound(sortEntries.subspan(from), addSaturated(key, maxDistance), {}, &SortEntry::key);
+    return static_cast<uint64_t>(std::distance(sortEntries.begin(), it));
+}
+}
+
+SortMergeJoinProbePhysicalOperator::SortMergeJoinProbePhysicalOperator(
+    OperatorHandlerId operatorHandlerId,
+    PhysicalFunction joinFunction,
+    WindowMetaData windowMetaData,
+    const JoinSchema& joinSchema,
+    std::shared_ptr<PagedVectorTupleLayout> leftTupleLayout,
+    std::shared_ptr<PagedVectorTupleLayout> rightTupleLayout,
+    std::vector<Record::RecordFieldIdentifier> leftKeyFieldNames,
+    std::vector<Record::RecordFieldIdentifier> rightKeyFieldNames,
+    SortMergeJoinBand band)
+    : NLJProbePhysicalOperatorBase(
+          operatorHandlerId,
+          std::move(joinFunction),
+          std::move(windowMetaData),
+          joinSchema,
+          std::move(leftTupleLayout),
+          std::move(rightTupleLayout),
+          std::move(leftKeyFieldNames),
+          std::move(rightKeyFieldNames))
+    , band(std::move(band))
+{
+}
+
+nautilus::val<int8_t*> SortMergeJoinProbePhysicalOperator::createSortedEntries(
+    const PagedVectorRef& pagedVector, const Record::RecordFieldIdentifier& keyField, ExecutionContext& executionCtx) const
+{
+    const auto numberOfTuples = pagedVector.getNumberOfRecords();
+    const auto memory = executionCtx.allocateMemory(numberOfTuples * sizeof(SortEntry) + alignof(SortEntry));
+    const auto entries = nautilus::invoke(alignSortEntriesProxy, memory);
+
+    nautilus::val<uint64_t> position = 0;
+    for (auto it = pagedVector.begin(); it != pagedVector.end(); ++it)
+    {
+        const auto entry = entries + position * nautilus::val<uint64_t>(sizeof(SortEntry));
+        const auto key = (*it).read(keyField);
+        if (band.biasedUnsignedKeys)
+        {
+            VarVal{key.getRawValueAs<nautilus::val<uint64_t>>()}.writeToMemory(getMemberRef(entry, &SortEntry::key));
+        }
+        else
+        {
+            VarVal{key.getRawValueAs<nautilus::val<int64_t>>()}.writeToMemory(getMemberRef(entry, &SortEntry::key));
+        }
+        VarVal{position}.writeToMemory(getMemberRef(entry, &SortEntry::position));
+        position = position + nautilus::val<uint64_t>(1);
+    }
+
+    nautilus::invoke(sortEntriesProxy, entries, numberOfTuples, nautilus::val<bool>(band.biasedUnsignedKeys));
+    return entries;
+}
+
+void SortMergeJoinProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    StreamJoinProbePhysicalOperator::open(executionCtx, recordBuffer);
+
+    const auto [windowStart, windowEnd, leftPagedVector, rightPagedVector] = openInnerProbeInput(executionCtx, recordBuffer);
+    const auto numberOfTuplesLeft = leftPagedVector.getNumberOfRecords();
+    const auto numberOfTuplesRight = rightPagedVector.getNumberOfRecords();
+
+    const auto leftEntries = createSortedEntries(leftPagedVector, band.leftKeyField, executionCtx);
+    const auto rightEntries = createSortedEntries(rightPagedVector, band.rightKeyField, executionCtx);
+    const auto leftFields = getOrderedFieldNames(leftTupleLayout->getSchema());
+    const auto rightFields = getOrderedFieldNames(rightTupleLayout->getSchema());
+
+    /// The left keys ascend, so both ends of the band only move forward over the sorted right side
+    nautilus::val<uint64_t> candidatesBegin = 0;
+    nautilus::val<uint64_t> candidatesEnd = numberOfTuplesRight;
+    for (nautilus::val<uint64_t> leftIdx = 0; leftIdx < numberOfTuplesLeft; ++leftIdx)
+    {
+        const auto leftEntry = leftEntries + leftIdx * nautilus::val<uint64_t>(sizeof(SortEntry));
+        const auto leftKey = readValueFromMemRef<int64_t>(getMemberRef(leftEntry, &SortEntry::key));
+        if (band.minDistance.has_value())
+        {
+            candidatesBegin = nautilus::invoke(
+                lowerBoundProxy,
+                rightEntries,
+                candidatesBegin,
+                numberOfTuplesRight,
+                leftKey,
+                nautilus::val<int64_t>(band.minDistance.value()));
+        }
+        if (band.maxDistance.has_value())
+        {
+            candidatesEnd = nautilus::invoke(
+                upperBoundProxy,
+                rightEntries,
+                candidatesBegin,
+                numberOfTuplesRight,
+                leftKey,
+                nautilus::val<int64_t>(band.maxDistance.value()));
+        }
+
+        const auto leftRecord = leftPagedVector.at(readValueFromMemRef<uint64_t>(getMemberRef(leftEntry, &SortEntry::position)));
+        for (nautilus::val<uint64_t> rightIdx = candidatesBegin; rightIdx < candidatesEnd; ++rightIdx)
+        {
+            const auto rightEntry = rightEntries + rightIdx * nautilus::val<uint64_t>(sizeof(SortEntry));
+            const auto rightRecord = rightPagedVector.at(readValueFromMemRef<uint64_t>(getMemberRef(rightEntry, &SortEntry::position)));
+            const auto joinedKeyFields
+                = createJoinedRecord(leftRecord, rightRecord, windowStart, windowEnd, leftKeyFieldNames, rightKeyFieldNames);
+            if (joinFunction.execute(joinedKeyFields, executionCtx.pipelineMemoryProvider.arena))
+            {
+                auto joinedRecord = createJoinedRecord(leftRecord, rightRecord, windowStart, windowEnd, leftFields, rightFields);
+                executeChild(executionCtx, joinedRecord);
+            }
+        }
+    }
+}
+
+}
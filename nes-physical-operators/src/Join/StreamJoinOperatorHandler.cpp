@@ -14,6 +14,7 @@
 
 #include <Join/StreamJoinOperatorHandler.hpp>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <utility>
@@ -33,8 +34,10 @@ StreamJoinOperatorHandler::StreamJoinOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    JoinTriggerStrategy triggerStrategy)
-    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore)), triggerStrategy(std::move(triggerStrategy))
+    JoinTriggerStrategy triggerStrategy,
+    const std::chrono::milliseconds originIdleTimeout)
+    : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore), originIdleTimeout)
+    , triggerStrategy(std::move(triggerStrategy))
 {
 }
 
@@ -25,6 +25,7 @@
 #include <Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Interface/Record.hpp>
 #include <Interface/RecordBuffer.hpp>
+#include <Operators/LogicalOperator.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Schema/Schema.hpp>
 #include <Schema/SchemaFwd.hpp>
@@ -317,4 +318,14 @@ PhysicalOperatorWrapper::PipelineLocation PhysicalOperatorWrapper::getPipelineLo
     return pipelineLocation;
 }
 
+const std::optional<LogicalOperator>& PhysicalOperatorWrapper::getLoweredFrom() const
+{
+    return loweredFrom;
+}
+
+void PhysicalOperatorWrapper::setLoweredFrom(LogicalOperator logicalOperator)
+{
+    loweredFrom = std::move(logicalOperator);
+}
+
 }
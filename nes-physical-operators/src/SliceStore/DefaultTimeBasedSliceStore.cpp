@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
@@ -31,6 +32,7 @@
 #include <SliceStore/DefaultTimeBasedSliceStoreRef.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/SliceRing.hpp>
 #include <SliceStore/SliceStoreRef.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
 #include <Time/Timestamp.hpp>
@@ -42,9 +44,13 @@
 namespace NES
 {
 DefaultTimeBasedSliceStore::DefaultTimeBasedSliceStore(
-    const uint64_t windowSize, const uint64_t windowSlide, SliceCacheConfiguration sliceCacheConfiguration)
+    const uint64_t windowSize,
+    const uint64_t windowSlide,
+    SliceCacheConfiguration sliceCacheConfiguration,
+    const uint64_t sliceRingCapacity)
     : sliceCacheConfiguration(std::move(sliceCacheConfiguration))
     , sliceAssigner(windowSize, windowSlide)
+    , sliceRing(sliceRingCapacity == 0 ? nullptr : std::make_unique<SliceRing>(sliceRingCapacity, sliceAssigner))
     , sequenceNumber(SequenceNumber::INITIAL)
     , numberOfActiveInputPipelines(0)
 {
@@ -55,12 +61,97 @@ DefaultTimeBasedSliceStore::~DefaultTimeBasedSliceStore()
     deleteState();
 }
 
+void DefaultTimeBasedSliceStore::addSliceToWindows(
+    const std::shared_ptr<Slice>& newSlice, std::map<WindowInfo, SlicesAndState>& lockedWindows) const
+{
+    /// Update the state of all windows that contain this slice as we have to expect new tuples
+    for (auto windowInfo : sliceAssigner.getAllWindowsForSlice(*newSlice))
+    {
+        const auto numberOfExpectedSlices = sliceAssigner.getWindowSize() / sliceAssigner.getWindowSlide();
+        const auto [it, success] = lockedWindows.try_emplace(windowInfo, numberOfExpectedSlices);
+        if (it->second.windowState == WindowInfoState::EMITTED_TO_PROBE)
+        {
+            throw WindowingError("We should not add slices to a window that has already been triggered.");
+        }
+        it->second.windowState = WindowInfoState::WINDOW_FILLING;
+        it->second.windowSlices.emplace_back(newSlice);
+    }
+}
+
+std::shared_ptr<Slice> DefaultTimeBasedSliceStore::getOrCreateRingSlice(
+    const uint64_t sliceNumber,
+    const SliceStart sliceStart,
+    const SliceEnd sliceEnd,
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice)
+{
+    switch (sliceRing->claim(sliceNumber))
+    {
+        case SliceRing::ClaimResult::OCCUPIED:
+            return nullptr;
+        case SliceRing::ClaimResult::PRESENT:
+            if (auto existingSlice = sliceRing->find(sliceNumber))
+            {
+                return existingSlice;
+            }
+            /// The slice got recycled in the meantime, so we have to claim its slot again
+            return getOrCreateRingSlice(sliceNumber, sliceStart, sliceEnd, createNewSlice);
+        case SliceRing::ClaimResult::CLAIMED:
+            break;
+    }
+
+    /// The claimed slot prevents other threads from creating this slice in the ring, but a thread whose lookup found the slot occupied
+    /// might have created it in the slices map. Thus, we check the map before creating the slice, and again while holding the slices
+    /// lock, which we need for the windows anyway.
+    try
+    {
+        {
+            const auto slicesReadLocked = slices.rlock();
+            if (const auto existingSlice = slicesReadLocked->find(sliceEnd); existingSlice != slicesReadLocked->end())
+            {
+                sliceRing->publish(sliceNumber, existingSlice->second);
+                return existingSlice->second;
+            }
+        }
+
+        const auto newSlices = createNewSlice(sliceStart, sliceEnd);
+        INVARIANT(newSlices.size() == 1, "We assume that only one slice is created per timestamp for our default time-based slice store.");
+        auto slice = newSlices[0];
+        {
+            auto [slicesWriteLocked, windowsWriteLocked] = acquireLocked(slices, windows);
+            if (const auto existingSlice = slicesWriteLocked->find(sliceEnd); existingSlice != slicesWriteLocked->end())
+            {
+                slice = existingSlice->second;
+            }
+            else
+            {
+                addSliceToWindows(slice, *windowsWriteLocked);
+            }
+            sliceRing->publish(sliceNumber, slice);
+        }
+        return slice;
+    }
+    catch (...)
+    {
+        sliceRing->abandon(sliceNumber);
+        throw;
+    }
+}
+
 std::vector<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSlicesOrCreate(
     const Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice)
 {
     /// We first check, if the slice already exist in the slice store
     const auto sliceStart = sliceAssigner.getSliceStartTs(timestamp);
     const auto sliceEnd = sliceAssigner.getSliceEndTs(timestamp);
+    const auto sliceNumber = sliceRing ? sliceRing->getSliceNumber(sliceStart) : std::nullopt;
+    if (sliceNumber.has_value())
+    {
+        if (auto ringSlice = getOrCreateRingSlice(sliceNumber.value(), sliceStart, sliceEnd, createNewSlice))
+        {
+            return {ringSlice};
+        }
+    }
+
     {
         const auto slicesWriteLocked = slices.rlock();
         if (const auto existingSlice = slicesWriteLocked->find(sliceEnd); existingSlice != slicesWriteLocked->end())
@@ -81,24 +172,20 @@ std::vector<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSlicesOrCreat
         return {slicesWriteLocked->find(sliceEnd)->second};
     }
 
-    /// At this moment, we can be sure that no slice exists and we can insert the newly created slice into the slice store
-    auto newSlice = newSlices[0];
-    slicesWriteLocked->emplace(sliceEnd, newSlice);
-    slicesWriteLocked.unlock();
-
-    /// Update the state of all windows that contain this slice as we have to expect new tuples
-    for (auto windowInfo : sliceAssigner.getAllWindowsForSlice(*newSlice))
+    /// The slot of the slice might have been freed and refilled with this slice since our lookup in the ring
+    if (sliceNumber.has_value())
     {
-        const auto numberOfExpectedSlices = sliceAssigner.getWindowSize() / sliceAssigner.getWindowSlide();
-        const auto [it, success] = windowsWriteLocked->try_emplace(windowInfo, numberOfExpectedSlices);
-        if (it->second.windowState == WindowInfoState::EMITTED_TO_PROBE)
+        if (auto ringSlice = sliceRing->find(sliceNumber.value()))
         {
-            throw WindowingError("We should not add slices to a window that has already been triggered.");
+            return {ringSlice};
         }
-        it->second.windowState = WindowInfoState::WINDOW_FILLING;
-        it->second.windowSlices.emplace_back(newSlice);
     }
 
+    /// At this moment, we can be sure that no slice exists and we can insert the newly created slice into the slice store
+    auto newSlice = newSlices[0];
+    slicesWriteLocked->emplace(sliceEnd, newSlice);
+    slicesWriteLocked.unlock();
+    addSliceToWindows(newSlice, *windowsWriteLocked);
     return {newSlice};
 }
 
@@ -141,6 +228,19 @@ DefaultTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWat
 
 std::optional<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
 {
+    if (sliceRing and sliceEnd.getRawValue() > 0)
+    {
+        /// The slice end itself belongs to the next slice, so we look up the slice of the last timestamp before it
+        const auto sliceStart = sliceAssigner.getSliceStartTs(Timestamp(sliceEnd.getRawValue() - 1));
+        if (const auto sliceNumber = sliceRing->getSliceNumber(sliceStart))
+        {
+            if (auto ringSlice = sliceRing->find(sliceNumber.value()); ringSlice and ringSlice->getSliceEnd() == sliceEnd)
+            {
+                return ringSlice;
+            }
+        }
+    }
+
     if (const auto slicesReadLocked = slices.rlock(); slicesReadLocked->contains(sliceEnd))
     {
         return slicesReadLocked->find(sliceEnd)->second;
@@ -268,6 +368,15 @@ void DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp
         }
     }
 
+    /// 3. The ring recycles the slots of these slices without taking any lock
+    if (sliceRing)
+    {
+        const auto canBeRecycled = [this, newGlobalWaterMark](const SliceEnd sliceEnd)
+        { return sliceEnd + sliceAssigner.getWindowSize() < newGlobalWaterMark; };
+        auto recycledSlices = sliceRing->recycle(canBeRecycled);
+        std::ranges::move(recycledSlices, std::back_inserter(slicesToDelete));
+    }
+
     /// Now we can remove/call destructor on every slice without still holding the lock
     slicesToDelete.clear();
 }
@@ -275,6 +384,10 @@ void DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp
 void DefaultTimeBasedSliceStore::deleteState()
 {
     auto [slicesWriteLocked, windowsWriteLocked] = acquireLocked(slices, windows);
+    if (sliceRing)
+    {
+        sliceRing->clear();
+    }
     slicesWriteLocked->clear();
     windowsWriteLocked->clear();
 }
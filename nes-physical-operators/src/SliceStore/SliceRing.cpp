@@ -0,0 +1,186 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SliceStore/SliceRing.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+SliceRing::SliceRing(const uint64_t capacity, const SliceAssigner& sliceAssigner)
+    : slots(std::bit_ceil(capacity))
+    , slotMask(slots.size() - 1)
+    , windowSlide(sliceAssigner.getWindowSlide())
+    , twoSlicesPerSlide(sliceAssigner.getWindowSize() % sliceAssigner.getWindowSlide() != 0)
+{
+    PRECONDITION(capacity > 0, "The capacity of the slice ring must not be 0");
+}
+
+std::optional<uint64_t> SliceRing::getSliceNumber(const SliceStart sliceStart) const
+{
+    const auto sliceStartRaw = sliceStart.getRawValue();
+    auto sliceNumber = sliceStartRaw / windowSlide;
+    if (twoSlicesPerSlide)
+    {
+        sliceNumber = (sliceNumber * 2) + (sliceStartRaw % windowSlide == 0 ? 0 : 1);
+    }
+    if (sliceNumber > (UINT64_MAX >> (STATE_BITS + 1)))
+    {
+        return std::nullopt;
+    }
+    return sliceNumber;
+}
+
+uint64_t SliceRing::toTag(const uint64_t sliceNumber, const SlotState state)
+{
+    return (sliceNumber << STATE_BITS) | static_cast<uint64_t>(state);
+}
+
+SliceRing::SlotState SliceRing::getState(const uint64_t tag)
+{
+    return static_cast<SlotState>(tag & STATE_MASK);
+}
+
+uint64_t SliceRing::getSliceNumberOfTag(const uint64_t tag)
+{
+    return tag >> STATE_BITS;
+}
+
+SliceRing::Slot& SliceRing::getSlot(const uint64_t sliceNumber)
+{
+    return slots[sliceNumber & slotMask];
+}
+
+std::shared_ptr<Slice> SliceRing::find(const uint64_t sliceNumber)
+{
+    auto& slot = getSlot(sliceNumber);
+
+    /// Pinning the slot before reading the tag guarantees that a concurrent recycle either sees our pin or we see its RECYCLING state.
+    /// Both require sequentially consistent operations, as this is a store-load pattern on two different variables.
+    slot.readers.fetch_add(1);
+    std::shared_ptr<Slice> slice;
+    if (slot.tag.load() == toTag(sliceNumber, SlotState::READY))
+    {
+        slice = slot.slice;
+    }
+    slot.readers.fetch_sub(1, std::memory_order_release);
+    return slice;
+}
+
+SliceRing::ClaimResult SliceRing::claim(const uint64_t sliceNumber)
+{
+    auto& slot = getSlot(sliceNumber);
+    while (true)
+    {
+        auto tag = slot.tag.load();
+        const auto state = getState(tag);
+        if (state == SlotState::EMPTY)
+        {
+            if (slot.tag.compare_exchange_weak(tag, toTag(sliceNumber, SlotState::CREATING)))
+            {
+                return ClaimResult::CLAIMED;
+            }
+            continue;
+        }
+        if (getSliceNumberOfTag(tag) != sliceNumber)
+        {
+            return ClaimResult::OCCUPIED;
+        }
+        if (state == SlotState::READY)
+        {
+            return ClaimResult::PRESENT;
+        }
+
+        /// Another thread is creating or recycling this slice number, which only takes a short amount of time
+        std::this_thread::yield();
+    }
+}
+
+void SliceRing::publish(const uint64_t sliceNumber, std::shared_ptr<Slice> slice)
+{
+    auto& slot = getSlot(sliceNumber);
+    INVARIANT(
+        slot.tag.load(std::memory_order_relaxed) == toTag(sliceNumber, SlotState::CREATING),
+        "The slot of slice number {} must have been claimed before publishing it",
+        sliceNumber);
+    slot.sliceEnd.store(slice->getSliceEnd().getRawValue(), std::memory_order_relaxed);
+    slot.slice = std::move(slice);
+    slot.tag.store(toTag(sliceNumber, SlotState::READY));
+}
+
+void SliceRing::abandon(const uint64_t sliceNumber)
+{
+    auto& slot = getSlot(sliceNumber);
+    INVARIANT(
+        slot.tag.load(std::memory_order_relaxed) == toTag(sliceNumber, SlotState::CREATING),
+        "The slot of slice number {} must have been claimed before abandoning it",
+        sliceNumber);
+    slot.tag.store(toTag(0, SlotState::EMPTY));
+}
+
+std::vector<std::shared_ptr<Slice>> SliceRing::recycle(const std::function<bool(SliceEnd)>& canBeRecycled)
+{
+    std::vector<std::shared_ptr<Slice>> recycledSlices;
+    for (auto& slot : slots)
+    {
+        auto tag = slot.tag.load();
+        if (getState(tag) != SlotState::READY or not canBeRecycled(SliceEnd(slot.sliceEnd.load(std::memory_order_relaxed))))
+        {
+            continue;
+        }
+        if (not slot.tag.compare_exchange_strong(tag, toTag(getSliceNumberOfTag(tag), SlotState::RECYCLING)))
+        {
+            /// Another thread recycles this slot concurrently
+            continue;
+        }
+
+        /// New readers see the RECYCLING state and leave the slice alone, so we only have to wait for the ones that are copying it
+        while (slot.readers.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        recycledSlices.emplace_back(std::move(slot.slice));
+        slot.slice.reset();
+        slot.tag.store(toTag(0, SlotState::EMPTY));
+    }
+    return recycledSlices;
+}
+
+void SliceRing::clear()
+{
+    for (auto& slot : slots)
+    {
+        slot.slice.reset();
+        slot.tag.store(toTag(0, SlotState::EMPTY));
+    }
+}
+
+uint64_t SliceRing::getCapacity() const
+{
+    return slots.size();
+}
+
+}
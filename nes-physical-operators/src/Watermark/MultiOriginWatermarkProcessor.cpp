@@ -12,11 +12,14 @@
     limitations under the License.
 */
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
@@ -29,27 +32,47 @@
 namespace NES
 {
 
-MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins) : origins(origins)
+MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(
+    const std::vector<OriginId>& origins, const std::chrono::milliseconds idleTimeout, Clock clock)
+    : origins(origins), idleTimeout(idleTimeout), clock(std::move(clock)), lastActivity(origins.size())
 {
+    PRECONDITION(idleTimeout.count() >= 0, "The idle timeout must not be negative, but was {}ms", idleTimeout.count());
+    for (auto& activity : lastActivity)
+    {
+        activity.store(NOT_STARTED, std::memory_order::relaxed);
+    }
     for (const auto& _ : origins)
     {
         watermarkProcessors.emplace_back(std::make_shared<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>());
     }
 };
 
-std::shared_ptr<MultiOriginWatermarkProcessor> MultiOriginWatermarkProcessor::create(const std::vector<OriginId>& origins)
+std::shared_ptr<MultiOriginWatermarkProcessor>
+MultiOriginWatermarkProcessor::create(const std::vector<OriginId>& origins, const std::chrono::milliseconds idleTimeout)
 {
-    return std::make_shared<MultiOriginWatermarkProcessor>(origins);
+    return std::make_shared<MultiOriginWatermarkProcessor>(origins, idleTimeout);
 }
 
 Timestamp MultiOriginWatermarkProcessor::updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const
 {
+    const auto now = clock().time_since_epoch().count();
+    if (not idleTimersStarted.load(std::memory_order::relaxed) and not idleTimersStarted.exchange(true, std::memory_order::relaxed))
+    {
+        /// The first buffer starts the idle timers of all origins, unless another origin already delivered its own buffer
+        for (auto& activity : lastActivity)
+        {
+            auto notStarted = NOT_STARTED;
+            activity.compare_exchange_strong(notStarted, now, std::memory_order::relaxed);
+        }
+    }
+
     bool found = false;
     for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
     {
         if (origins[originIndex] == origin)
         {
             watermarkProcessors[originIndex]->emplace(sequenceData, ts.getRawValue());
+            lastActivity[originIndex].store(now, std::memory_order::relaxed);
             found = true;
         }
     }
@@ -74,12 +97,30 @@ std::string MultiOriginWatermarkProcessor::getCurrentStatus()
 
 Timestamp MultiOriginWatermarkProcessor::getCurrentWatermark() const
 {
+    const auto idleBefore = (clock() - idleTimeout).time_since_epoch().count();
     auto minimalWatermark = UINT64_MAX;
-    for (const auto& wt : watermarkProcessors)
+    bool anyOriginActive = false;
+    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
+    {
+        if (idleTimeout.count() > 0 and lastActivity[originIndex].load(std::memory_order::relaxed) < idleBefore)
+        {
+            continue;
+        }
+        minimalWatermark = std::min(minimalWatermark, watermarkProcessors[originIndex]->getCurrentValue());
+        anyOriginActive = true;
+    }
+    if (not anyOriginActive)
+    {
+        /// All origins are idle, so none of them can advance the watermark
+        return Timestamp(currentWatermark.load(std::memory_order::relaxed));
+    }
+
+    auto previousWatermark = currentWatermark.load(std::memory_order::relaxed);
+    while (previousWatermark < minimalWatermark
+           and not currentWatermark.compare_exchange_weak(previousWatermark, minimalWatermark, std::memory_order::relaxed))
     {
-        minimalWatermark = std::min(minimalWatermark, wt->getCurrentValue());
     }
-    return Timestamp(minimalWatermark);
+    return Timestamp(std::max(previousWatermark, minimalWatermark));
 }
 
 }
@@ -14,6 +14,7 @@
 
 #include <WindowBasedOperatorHandler.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -32,9 +33,10 @@ namespace NES
 WindowBasedOperatorHandler::WindowBasedOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
-    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore)
+    std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
+    const std::chrono::milliseconds originIdleTimeout)
     : sliceAndWindowStore(std::move(sliceAndWindowStore))
-    , watermarkProcessorBuild(std::make_unique<MultiOriginWatermarkProcessor>(inputOrigins))
+    , watermarkProcessorBuild(std::make_unique<MultiOriginWatermarkProcessor>(inputOrigins, originIdleTimeout))
     , watermarkProcessorProbe(std::make_unique<MultiOriginWatermarkProcessor>(std::vector{outputOriginId}))
     , outputOriginId(outputOriginId)
     , inputOrigins(inputOrigins)
@@ -67,6 +69,7 @@ void WindowBasedOperatorHandler::garbageCollectSlicesAndWindows(const BufferMeta
         bufferMetaData.seqNumber,
         bufferMetaData.watermarkTs);
     sliceAndWindowStore->garbageCollectSlicesAndWindows(newGlobalWaterMarkProbe);
+    garbageCollectOperatorState(newGlobalWaterMarkProbe);
 }
 
 void WindowBasedOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx)
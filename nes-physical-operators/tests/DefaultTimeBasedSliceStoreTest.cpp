@@ -0,0 +1,140 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <SliceCacheConfiguration.hpp>
+
+namespace NES
+{
+
+/// NOLINTBEGIN(readability-magic-numbers)
+class DefaultTimeBasedSliceStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("DefaultTimeBasedSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup DefaultTimeBasedSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Tumbling windows of size 10 with a slice ring of two slots, i.e., the slices [0,10) and [20,30) share a slot.
+    static constexpr uint64_t WINDOW_SIZE = 10;
+    static constexpr uint64_t SLICE_RING_CAPACITY = 2;
+
+    /// Creates plain slices and counts how many it created
+    size_t numberOfCreatedSlices = 0;
+    const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)> createNewSlice
+        = [this](const SliceStart sliceStart, const SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+    {
+        ++numberOfCreatedSlices;
+        return {std::make_shared<Slice>(sliceStart, sliceEnd)};
+    };
+
+    static DefaultTimeBasedSliceStore createSliceStore()
+    {
+        return DefaultTimeBasedSliceStore(WINDOW_SIZE, WINDOW_SIZE, SliceCacheConfiguration{}, SLICE_RING_CAPACITY);
+    }
+
+    std::shared_ptr<Slice> getSliceOrCreate(DefaultTimeBasedSliceStore& sliceStore, const uint64_t timestamp) const
+    {
+        const auto slices = sliceStore.getSlicesOrCreate(Timestamp(timestamp), createNewSlice);
+        EXPECT_EQ(slices.size(), 1);
+        return slices.empty() ? nullptr : slices.front();
+    }
+};
+
+TEST_F(DefaultTimeBasedSliceStoreTest, GetSliceBySliceEndIsServedFromTheRing)
+{
+    auto sliceStore = createSliceStore();
+    const auto slice = getSliceOrCreate(sliceStore, 5);
+    ASSERT_NE(slice, nullptr);
+    EXPECT_EQ(slice->getSliceStart(), Timestamp(0));
+    EXPECT_EQ(slice->getSliceEnd(), Timestamp(10));
+
+    /// Slices whose slot is free are only stored in the ring, so the lookups can not have been answered by the slices map
+    EXPECT_EQ(getSliceOrCreate(sliceStore, 9), slice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(10)), slice);
+    EXPECT_EQ(numberOfCreatedSlices, 1);
+
+    /// The slot of the slice end 30 holds the slice with the slice end 10
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(30)), std::nullopt);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(20)), std::nullopt);
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, OccupiedRingSlotFallsBackToTheSlicesMap)
+{
+    auto sliceStore = createSliceStore();
+    sliceStore.incrementNumberOfInputPipelines();
+    const auto firstSlice = getSliceOrCreate(sliceStore, 0);
+    const auto secondSlice = getSliceOrCreate(sliceStore, 10);
+
+    /// Both slots are occupied, so the third slice is stored in the slices map
+    const auto thirdSlice = getSliceOrCreate(sliceStore, 25);
+    ASSERT_NE(thirdSlice, nullptr);
+    EXPECT_EQ(thirdSlice->getSliceEnd(), Timestamp(30));
+    EXPECT_EQ(getSliceOrCreate(sliceStore, 29), thirdSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(30)), thirdSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(10)), firstSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(20)), secondSlice);
+    EXPECT_EQ(numberOfCreatedSlices, 3);
+
+    /// Slices of the ring and of the map are added to their windows alike
+    const auto windows = sliceStore.getAllNonTriggeredSlices();
+    ASSERT_EQ(windows.size(), 3);
+    std::vector<std::shared_ptr<Slice>> windowSlices;
+    for (const auto& [windowInfo, slices] : windows)
+    {
+        ASSERT_EQ(slices.size(), 1);
+        windowSlices.emplace_back(slices.front());
+    }
+    EXPECT_EQ(windowSlices, (std::vector{firstSlice, secondSlice, thirdSlice}));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, FreedRingSlotReusesTheSliceOfTheSlicesMap)
+{
+    auto sliceStore = createSliceStore();
+    getSliceOrCreate(sliceStore, 0);
+    const auto secondSlice = getSliceOrCreate(sliceStore, 10);
+    const auto thirdSlice = getSliceOrCreate(sliceStore, 20);
+    EXPECT_EQ(numberOfCreatedSlices, 3);
+
+    /// Frees the slot of the first slice, which the third slice maps onto, while the third slice remains in the slices map
+    sliceStore.garbageCollectSlicesAndWindows(Timestamp(21));
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(10)), std::nullopt);
+
+    /// The lookup claims the free slot and publishes the slice of the map, without creating another slice
+    EXPECT_EQ(getSliceOrCreate(sliceStore, 25), thirdSlice);
+    EXPECT_EQ(getSliceOrCreate(sliceStore, 15), secondSlice);
+    EXPECT_EQ(sliceStore.getSliceBySliceEnd(Timestamp(30)), thirdSlice);
+    EXPECT_EQ(numberOfCreatedSlices, 3);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -0,0 +1,84 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <vector>
+#include <Aggregation/HyperLogLog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class HyperLogLogTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HyperLogLogTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HyperLogLogTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Finalizer of SplitMix64, which spreads consecutive values uniformly over all bits like the hash function of the aggregation
+    static uint64_t hash(uint64_t value)
+    {
+        value = (value ^ (value >> 30U)) * UINT64_C(0xbf58476d1ce4e5b9);
+        value = (value ^ (value >> 27U)) * UINT64_C(0x94d049bb133111eb);
+        return value ^ (value >> 31U);
+    }
+};
+
+TEST_F(HyperLogLogTest, SmallCardinalitiesAreNearlyExact)
+{
+    std::vector<uint8_t> registers(HyperLogLog::NUMBER_OF_REGISTERS, 0);
+    HyperLogLog sketch{registers};
+    EXPECT_EQ(sketch.estimate(), 0);
+
+    /// Adding every value multiple times must not change the estimate
+    for (uint64_t repetition = 0; repetition < 3; ++repetition)
+    {
+        for (uint64_t value = 0; value < 100; ++value)
+        {
+            sketch.add(hash(value));
+        }
+    }
+    EXPECT_NEAR(static_cast<double>(sketch.estimate()), 100, 2);
+}
+
+TEST_F(HyperLogLogTest, MergedSketchesEstimateTheUnion)
+{
+    /// Two overlapping sets of distinct values, as seen by two worker threads
+    constexpr uint64_t numberOfValues = 1000000;
+    std::vector<uint8_t> registers1(HyperLogLog::NUMBER_OF_REGISTERS, 0);
+    std::vector<uint8_t> registers2(HyperLogLog::NUMBER_OF_REGISTERS, 0);
+    HyperLogLog sketch1{registers1};
+    HyperLogLog sketch2{registers2};
+    for (uint64_t value = 0; value < numberOfValues; ++value)
+    {
+        sketch1.add(hash(value));
+        sketch2.add(hash(value + (numberOfValues / 2)));
+    }
+    sketch1.merge(sketch2);
+
+    /// Five standard errors of the sketch
+    constexpr auto expectedNumberOfValues = 1.5 * numberOfValues;
+    EXPECT_NEAR(static_cast<double>(sketch1.estimate()), expectedNumberOfValues, 0.08 * expectedNumberOfValues);
+}
+
+}
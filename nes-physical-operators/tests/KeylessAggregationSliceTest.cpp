@@ -0,0 +1,127 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <Aggregation/KeylessAggregationSlice.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+namespace
+{
+constexpr uint32_t POOLED_BUFFER_SIZE = 4096;
+constexpr uint32_t NUMBER_OF_POOLED_BUFFERS = 64;
+constexpr BufferAlignment BUFFER_ALIGNMENT{64};
+constexpr double UNPOOLED_MEMORY_FRACTION = 0.9;
+constexpr size_t TOTAL_MEMORY_IN_BYTES = 10 * static_cast<size_t>(NUMBER_OF_POOLED_BUFFERS) * POOLED_BUFFER_SIZE;
+constexpr uint64_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
+}
+
+class KeylessAggregationSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("KeylessAggregationSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup KeylessAggregationSliceTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create(
+            TOTAL_MEMORY_IN_BYTES,
+            UNPOOLED_MEMORY_FRACTION,
+            BUFFER_ALIGNMENT,
+            POOLED_BUFFER_SIZE,
+            std::make_shared<NesDefaultMemoryAllocator>());
+    }
+
+    static KeylessAggregationSlice createSlice(const uint64_t sizeOfStatesInBytes, const uint64_t numberOfWorkerThreads)
+    {
+        return {SliceStart(0), SliceEnd(10), CreateNewKeylessAggregationSliceArgs(sizeOfStatesInBytes), numberOfWorkerThreads};
+    }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+/// The header and the states share a buffer, whose size is rounded up to whole cache lines
+TEST_F(KeylessAggregationSliceTest, StateBufferSizeIsAMultipleOfTheCacheLine)
+{
+    const auto headerSize = sizeof(KeylessAggregationStateHeader);
+    for (const uint64_t sizeOfStates : {0UL, 1UL, 8UL, CACHE_LINE_SIZE - headerSize, CACHE_LINE_SIZE - headerSize + 1, 1000UL})
+    {
+        const auto stateBufferSize = KeylessAggregationSlice::getStateBufferSize(sizeOfStates);
+        EXPECT_EQ(stateBufferSize % CACHE_LINE_SIZE, 0U) << "for states of " << sizeOfStates << "B";
+        EXPECT_GE(stateBufferSize, headerSize + sizeOfStates) << "for states of " << sizeOfStates << "B";
+        EXPECT_LT(stateBufferSize, headerSize + sizeOfStates + CACHE_LINE_SIZE) << "for states of " << sizeOfStates << "B";
+    }
+    EXPECT_EQ(KeylessAggregationSlice::getStateBufferSize(CACHE_LINE_SIZE - headerSize), CACHE_LINE_SIZE);
+    EXPECT_EQ(KeylessAggregationSlice::getStateBufferSize(CACHE_LINE_SIZE - headerSize + 1), 2 * CACHE_LINE_SIZE);
+}
+
+/// A state buffer is allocated on the first access of its worker thread, zeroed, and marked as not initialized
+TEST_F(KeylessAggregationSliceTest, StateBufferIsAllocatedOnFirstAccess)
+{
+    constexpr uint64_t sizeOfStates = 24;
+    auto slice = createSlice(sizeOfStates, 2);
+    EXPECT_EQ(slice.getNumberOfStateBuffers(), 2U);
+    EXPECT_EQ(slice.getStateBufferRefForWorker(WorkerThreadId(0)), nullptr);
+    EXPECT_EQ(slice.getStateBufferRefForWorker(WorkerThreadId(1)), nullptr);
+
+    const auto* stateBuffer = slice.getOrCreateStateBufferRefForWorker(*bufferManager, WorkerThreadId(1));
+    ASSERT_NE(stateBuffer, nullptr);
+    EXPECT_GE(stateBuffer->getBufferSize(), KeylessAggregationSlice::getStateBufferSize(sizeOfStates));
+    const auto memoryArea = stateBuffer->getAvailableMemoryArea();
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_FALSE(reinterpret_cast<const KeylessAggregationStateHeader*>(memoryArea.data())->initialized);
+    const auto states = memoryArea.subspan(sizeof(KeylessAggregationStateHeader), sizeOfStates);
+    EXPECT_TRUE(std::ranges::all_of(states, [](const std::byte byte) { return byte == std::byte{0}; }));
+
+    /// Only the accessing worker thread gets a state buffer, and later accesses return the same buffer
+    EXPECT_EQ(slice.getStateBufferRefForWorker(WorkerThreadId(0)), nullptr);
+    EXPECT_EQ(slice.getStateBufferRefForWorker(WorkerThreadId(1)), stateBuffer);
+    EXPECT_EQ(slice.getOrCreateStateBufferRefForWorker(*bufferManager, WorkerThreadId(1)), stateBuffer);
+}
+
+/// Each worker thread owns a separate state buffer. Worker thread ids beyond the number of state buffers wrap around.
+TEST_F(KeylessAggregationSliceTest, WorkerThreadsAreMappedOntoTheirStateBuffers)
+{
+    auto slice = createSlice(8, 2);
+    const auto* firstStateBuffer = slice.getOrCreateStateBufferRefForWorker(*bufferManager, WorkerThreadId(0));
+    const auto* secondStateBuffer = slice.getOrCreateStateBufferRefForWorker(*bufferManager, WorkerThreadId(1));
+    ASSERT_NE(firstStateBuffer, nullptr);
+    ASSERT_NE(secondStateBuffer, nullptr);
+    EXPECT_NE(firstStateBuffer, secondStateBuffer);
+    EXPECT_NE(firstStateBuffer->getAvailableMemoryArea().data(), secondStateBuffer->getAvailableMemoryArea().data());
+
+    EXPECT_EQ(slice.getOrCreateStateBufferRefForWorker(*bufferManager, WorkerThreadId(2)), firstStateBuffer);
+    EXPECT_EQ(slice.getStateBufferRefForWorker(WorkerThreadId(3)), secondStateBuffer);
+}
+
+}
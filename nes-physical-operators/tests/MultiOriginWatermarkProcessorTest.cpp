@@ -0,0 +1,120 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class MultiOriginWatermarkProcessorTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MultiOriginWatermarkProcessorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MultiOriginWatermarkProcessorTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static constexpr auto IDLE_TIMEOUT = std::chrono::milliseconds(50);
+    const OriginId activeOrigin = OriginId(1);
+    const OriginId quietOrigin = OriginId(2);
+
+    /// The idle timers read the time from this clock, which only moves if a test advances it
+    std::chrono::steady_clock::time_point now;
+    const MultiOriginWatermarkProcessor::Clock clock = [this] { return now; };
+
+    void advanceClock(const std::chrono::steady_clock::duration duration) { now += duration; }
+
+    /// Each origin delivers its buffers with consecutive sequence numbers in a single chunk
+    static Timestamp update(const MultiOriginWatermarkProcessor& processor, const OriginId origin, const uint64_t seq, const uint64_t ts)
+    {
+        return processor.updateWatermark(Timestamp(ts), SequenceData(SequenceNumber(seq), INITIAL_CHUNK_NUMBER, true), origin);
+    }
+};
+
+/// Without an idle timeout, the watermark waits for the quiet origin indefinitely
+TEST_F(MultiOriginWatermarkProcessorTest, quietOriginHoldsBackWatermarkWithoutTimeout)
+{
+    const MultiOriginWatermarkProcessor processor({activeOrigin, quietOrigin}, std::chrono::milliseconds::zero(), clock);
+    EXPECT_EQ(update(processor, quietOrigin, 1, 10), Timestamp(0));
+    EXPECT_EQ(update(processor, activeOrigin, 1, 100), Timestamp(10));
+
+    advanceClock(2 * IDLE_TIMEOUT);
+    EXPECT_EQ(update(processor, activeOrigin, 2, 200), Timestamp(10));
+}
+
+/// With an idle timeout, the quiet origin is left out of the minimum until it delivers a buffer again
+TEST_F(MultiOriginWatermarkProcessorTest, idleOriginIsExcludedUntilItResumes)
+{
+    const MultiOriginWatermarkProcessor processor({activeOrigin, quietOrigin}, IDLE_TIMEOUT, clock);
+    EXPECT_EQ(update(processor, quietOrigin, 1, 10), Timestamp(0));
+    EXPECT_EQ(update(processor, activeOrigin, 1, 100), Timestamp(10));
+
+    advanceClock(2 * IDLE_TIMEOUT);
+    EXPECT_EQ(update(processor, activeOrigin, 2, 200), Timestamp(200));
+
+    /// Resuming behind the watermark does not move it backwards, but holds it until the resumed origin catches up
+    EXPECT_EQ(update(processor, quietOrigin, 2, 150), Timestamp(200));
+    EXPECT_EQ(update(processor, activeOrigin, 3, 300), Timestamp(200));
+    EXPECT_EQ(update(processor, quietOrigin, 3, 250), Timestamp(250));
+}
+
+/// An origin that never delivers a buffer becomes idle one timeout after the first buffer of any origin
+TEST_F(MultiOriginWatermarkProcessorTest, originWithoutDataBecomesIdle)
+{
+    const MultiOriginWatermarkProcessor processor({activeOrigin, quietOrigin}, IDLE_TIMEOUT, clock);
+    EXPECT_EQ(update(processor, activeOrigin, 1, 100), Timestamp(0));
+
+    advanceClock(IDLE_TIMEOUT / 2);
+    EXPECT_EQ(update(processor, activeOrigin, 2, 150), Timestamp(0));
+
+    advanceClock(IDLE_TIMEOUT);
+    EXPECT_EQ(update(processor, activeOrigin, 3, 200), Timestamp(200));
+}
+
+/// The processor is created when the query is lowered, so the time until the query starts must not count towards the idle timeout
+TEST_F(MultiOriginWatermarkProcessorTest, idleTimersStartWithTheFirstBuffer)
+{
+    const MultiOriginWatermarkProcessor processor({activeOrigin, quietOrigin}, IDLE_TIMEOUT, clock);
+    advanceClock(10 * IDLE_TIMEOUT);
+    EXPECT_EQ(processor.getCurrentWatermark(), Timestamp(0));
+    EXPECT_EQ(update(processor, activeOrigin, 1, 100), Timestamp(0));
+    EXPECT_EQ(update(processor, quietOrigin, 1, 10), Timestamp(10));
+}
+
+/// If all origins are idle, the watermark stays where it is
+TEST_F(MultiOriginWatermarkProcessorTest, allOriginsIdleKeepsWatermark)
+{
+    const MultiOriginWatermarkProcessor processor({activeOrigin, quietOrigin}, IDLE_TIMEOUT, clock);
+    EXPECT_EQ(update(processor, quietOrigin, 1, 10), Timestamp(0));
+    EXPECT_EQ(update(processor, activeOrigin, 1, 100), Timestamp(10));
+
+    advanceClock(2 * IDLE_TIMEOUT);
+    EXPECT_EQ(processor.getCurrentWatermark(), Timestamp(10));
+}
+
+}
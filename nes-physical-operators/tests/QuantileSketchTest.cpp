@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Aggregation/QuantileSketch.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class QuantileSketchTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("QuantileSketchTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup QuantileSketchTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::byte> createSketchMemory(const uint64_t compression)
+    {
+        std::vector<std::byte> memory(QuantileSketch::getSizeInBytes(compression));
+        QuantileSketch::init(memory, compression);
+        return memory;
+    }
+};
+
+TEST_F(QuantileSketchTest, QuantilesOfFewValuesAreExact)
+{
+    auto memory = createSketchMemory(QuantileSketch::DEFAULT_COMPRESSION);
+    QuantileSketch sketch{memory};
+    for (const auto value : {4.0, 1.0, 3.0, 2.0})
+    {
+        sketch.add(value);
+    }
+    EXPECT_DOUBLE_EQ(sketch.getQuantile(0), 1);
+    EXPECT_DOUBLE_EQ(sketch.getQuantile(0.5), 2.5);
+    EXPECT_DOUBLE_EQ(sketch.getQuantile(1), 4);
+
+    sketch.add(5);
+    EXPECT_DOUBLE_EQ(sketch.getQuantile(0.5), 3);
+}
+
+TEST_F(QuantileSketchTest, MergedSketchesEstimateTailQuantiles)
+{
+    /// Far more values than the sketch can hold, split over two sketches as over two worker threads
+    constexpr uint64_t numberOfValues = 100000;
+    auto memory1 = createSketchMemory(QuantileSketch::DEFAULT_COMPRESSION);
+    auto memory2 = createSketchMemory(QuantileSketch::DEFAULT_COMPRESSION);
+    QuantileSketch sketch1{memory1};
+    QuantileSketch sketch2{memory2};
+    for (uint64_t value = 0; value < numberOfValues; ++value)
+    {
+        (value % 2 == 0 ? sketch1 : sketch2).add(static_cast<double>(value));
+    }
+    sketch1.merge(sketch2);
+
+    EXPECT_DOUBLE_EQ(sketch1.getTotalWeight(), numberOfValues);
+    EXPECT_DOUBLE_EQ(sketch1.getQuantile(0), 0);
+    EXPECT_DOUBLE_EQ(sketch1.getQuantile(1), numberOfValues - 1);
+    for (const auto quantile : {0.01, 0.5, 0.9, 0.99, 0.999})
+    {
+        EXPECT_NEAR(sketch1.getQuantile(quantile), quantile * numberOfValues, 0.005 * numberOfValues) << "quantile " << quantile;
+    }
+}
+
+}
@@ -0,0 +1,182 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <SliceStore/Slice.hpp>
+#include <SliceStore/SliceAssigner.hpp>
+#include <SliceStore/SliceRing.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SliceRingTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SliceRingTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SliceRingTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Claims and publishes the slice of the timestamp, as the slice store does on a lookup miss
+    static std::shared_ptr<Slice> getOrCreate(SliceRing& sliceRing, const SliceAssigner& sliceAssigner, const Timestamp timestamp)
+    {
+        const auto sliceStart = sliceAssigner.getSliceStartTs(timestamp);
+        const auto sliceNumber = sliceRing.getSliceNumber(sliceStart).value();
+        switch (sliceRing.claim(sliceNumber))
+        {
+            case SliceRing::ClaimResult::OCCUPIED:
+                return nullptr;
+            case SliceRing::ClaimResult::PRESENT:
+                return sliceRing.find(sliceNumber);
+            case SliceRing::ClaimResult::CLAIMED: {
+                auto slice = std::make_shared<Slice>(sliceStart, sliceAssigner.getSliceEndTs(timestamp));
+                sliceRing.publish(sliceNumber, slice);
+                return slice;
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(SliceRingTest, SliceNumbersAreUniqueAndAscending)
+{
+    /// Tumbling windows only have slice boundaries at multiples of the slide
+    const SliceAssigner tumblingAssigner(10, 10);
+    const SliceRing tumblingRing(16, tumblingAssigner);
+    EXPECT_EQ(tumblingRing.getSliceNumber(tumblingAssigner.getSliceStartTs(Timestamp(5))), 0);
+    EXPECT_EQ(tumblingRing.getSliceNumber(tumblingAssigner.getSliceStartTs(Timestamp(10))), 1);
+    EXPECT_EQ(tumblingRing.getSliceNumber(tumblingAssigner.getSliceStartTs(Timestamp(35))), 3);
+
+    /// A size of 10 and a slide of 4 results in the slices [0,4), [4,8), [8,10), [10,12), [12,14), [14,16), ...
+    const SliceAssigner slidingAssigner(10, 4);
+    const SliceRing slidingRing(16, slidingAssigner);
+    uint64_t previousSliceNumber = 0;
+    for (uint64_t timestamp = 4; timestamp < 100; ++timestamp)
+    {
+        const auto sliceStart = slidingAssigner.getSliceStartTs(Timestamp(timestamp));
+        const auto sliceNumber = slidingRing.getSliceNumber(sliceStart).value();
+        if (sliceStart == Timestamp(timestamp))
+        {
+            EXPECT_GT(sliceNumber, previousSliceNumber);
+        }
+        else
+        {
+            EXPECT_EQ(sliceNumber, previousSliceNumber);
+        }
+        previousSliceNumber = sliceNumber;
+    }
+}
+
+TEST_F(SliceRingTest, ClaimPublishAndFind)
+{
+    const SliceAssigner sliceAssigner(10, 10);
+    SliceRing sliceRing(4, sliceAssigner);
+
+    EXPECT_EQ(sliceRing.find(0), nullptr);
+    ASSERT_EQ(sliceRing.claim(0), SliceRing::ClaimResult::CLAIMED);
+    /// A claimed slot is not visible to lookups until it is published
+    EXPECT_EQ(sliceRing.find(0), nullptr);
+    sliceRing.publish(0, std::make_shared<Slice>(Timestamp(0), Timestamp(10)));
+
+    EXPECT_EQ(sliceRing.claim(0), SliceRing::ClaimResult::PRESENT);
+    ASSERT_NE(sliceRing.find(0), nullptr);
+    EXPECT_EQ(sliceRing.find(0)->getSliceEnd(), Timestamp(10));
+
+    /// Slice number 4 maps onto the same slot as slice number 0
+    EXPECT_EQ(sliceRing.claim(4), SliceRing::ClaimResult::OCCUPIED);
+    EXPECT_EQ(sliceRing.find(4), nullptr);
+
+    ASSERT_EQ(sliceRing.claim(1), SliceRing::ClaimResult::CLAIMED);
+    sliceRing.abandon(1);
+    EXPECT_EQ(sliceRing.find(1), nullptr);
+    EXPECT_EQ(sliceRing.claim(1), SliceRing::ClaimResult::CLAIMED);
+}
+
+TEST_F(SliceRingTest, RecycleFreesSlotsBelowWatermark)
+{
+    const SliceAssigner sliceAssigner(10, 10);
+    SliceRing sliceRing(4, sliceAssigner);
+    for (uint64_t timestamp = 0; timestamp < 40; timestamp += 10)
+    {
+        ASSERT_NE(getOrCreate(sliceRing, sliceAssigner, Timestamp(timestamp)), nullptr);
+    }
+    EXPECT_EQ(getOrCreate(sliceRing, sliceAssigner, Timestamp(40)), nullptr);
+
+    const auto recycledSlices = sliceRing.recycle([](const SliceEnd sliceEnd) { return sliceEnd <= Timestamp(20); });
+    EXPECT_EQ(recycledSlices.size(), 2);
+    EXPECT_EQ(sliceRing.find(0), nullptr);
+    EXPECT_EQ(sliceRing.find(1), nullptr);
+    EXPECT_NE(sliceRing.find(2), nullptr);
+
+    /// The slot of slice number 0 can now be reused for slice number 4
+    const auto newSlice = getOrCreate(sliceRing, sliceAssigner, Timestamp(45));
+    ASSERT_NE(newSlice, nullptr);
+    EXPECT_EQ(newSlice->getSliceStart(), Timestamp(40));
+}
+
+TEST_F(SliceRingTest, ConcurrentCreationYieldsOneSlicePerSliceNumber)
+{
+    constexpr size_t numberOfThreads = 8;
+    constexpr uint64_t numberOfSlices = 64;
+    const SliceAssigner sliceAssigner(10, 10);
+    SliceRing sliceRing(numberOfSlices, sliceAssigner);
+
+    std::vector<std::vector<Slice*>> slicesPerThread(numberOfThreads);
+    std::atomic<bool> start{false};
+    {
+        std::vector<std::jthread> threads;
+        for (size_t threadIdx = 0; threadIdx < numberOfThreads; ++threadIdx)
+        {
+            threads.emplace_back(
+                [&, threadIdx]
+                {
+                    while (not start.load())
+                    {
+                        std::this_thread::yield();
+                    }
+                    for (uint64_t sliceNumber = 0; sliceNumber < numberOfSlices; ++sliceNumber)
+                    {
+                        const auto slice = getOrCreate(sliceRing, sliceAssigner, Timestamp(sliceNumber * 10));
+                        slicesPerThread[threadIdx].emplace_back(slice.get());
+                    }
+                });
+        }
+        start = true;
+    }
+
+    for (size_t threadIdx = 1; threadIdx < numberOfThreads; ++threadIdx)
+    {
+        EXPECT_EQ(slicesPerThread[threadIdx], slicesPerThread[0]);
+    }
+    for (const auto* slice : slicesPerThread[0])
+    {
+        EXPECT_NE(slice, nullptr);
+    }
+}
+
+}
@@ -0,0 +1,119 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Aggregation/SlidingWindowAggregates.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SlidingWindowAggregatesTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SlidingWindowAggregatesTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SlidingWindowAggregatesTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::shared_ptr<Slice>> createSlices(const std::vector<uint64_t>& sliceBoundaries)
+    {
+        std::vector<std::shared_ptr<Slice>> slices;
+        for (uint64_t i = 0; i + 1 < sliceBoundaries.size(); ++i)
+        {
+            slices.emplace_back(std::make_shared<Slice>(SliceStart(sliceBoundaries[i]), SliceEnd(sliceBoundaries[i + 1])));
+        }
+        return slices;
+    }
+};
+
+TEST_F(SlidingWindowAggregatesTest, WindowsAreSplitAtChunkBoundaries)
+{
+    /// A size of 10 and a slide of 4 results in chunks of 12 and the slices [0,4), [4,8), [8,10), [10,12), [12,14), [14,16), ...
+    const SlidingWindowAggregates slidingWindowAggregates(10, 4, 1);
+
+    /// Windows starting at a chunk boundary are a prefix of their chunk
+    EXPECT_EQ(slidingWindowAggregates.getFirstPrefixSlice(Timestamp(0), createSlices({0, 4, 8, 10})), 0);
+    EXPECT_EQ(slidingWindowAggregates.getFirstPrefixSlice(Timestamp(12), createSlices({12, 14, 16, 20, 22})), 0);
+
+    /// All other windows consist of a suffix of their chunk and a prefix of the next one
+    EXPECT_EQ(slidingWindowAggregates.getFirstPrefixSlice(Timestamp(4), createSlices({4, 8, 10, 12, 14})), 3);
+    EXPECT_EQ(slidingWindowAggregates.getFirstPrefixSlice(Timestamp(8), createSlices({8, 10, 12, 14, 16, 18})), 2);
+}
+
+TEST_F(SlidingWindowAggregatesTest, PartialAggregatesAreStoredPerSideAndPartition)
+{
+    SlidingWindowAggregates slidingWindowAggregates(10, 4, 2);
+    EXPECT_FALSE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::SUFFIX, SliceEnd(8), 1).has_value());
+    slidingWindowAggregates.storePartialAggregate(SlidingWindowAggregates::Side::SUFFIX, SliceEnd(8), 1, TupleBuffer{});
+    EXPECT_TRUE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::SUFFIX, SliceEnd(8), 1).has_value());
+    EXPECT_FALSE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(8), 1).has_value());
+    EXPECT_FALSE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::SUFFIX, SliceEnd(8), 0).has_value());
+}
+
+TEST_F(SlidingWindowAggregatesTest, ConcurrentlyBuiltPartialAggregatesKeepTheFirstOne)
+{
+    SlidingWindowAggregates slidingWindowAggregates(10, 4, 1);
+    std::vector<std::thread> probes;
+    for (uint64_t probe = 0; probe < 4; ++probe)
+    {
+        probes.emplace_back(
+            [&slidingWindowAggregates]
+            {
+                for (const uint64_t sliceEnd : {4, 8, 10, 12})
+                {
+                    slidingWindowAggregates.storePartialAggregate(
+                        SlidingWindowAggregates::Side::PREFIX, SliceEnd(sliceEnd), 0, TupleBuffer{});
+                }
+            });
+    }
+    for (auto& probe : probes)
+    {
+        probe.join();
+    }
+    for (const uint64_t sliceEnd : {4, 8, 10, 12})
+    {
+        EXPECT_TRUE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(sliceEnd), 0).has_value());
+    }
+}
+
+TEST_F(SlidingWindowAggregatesTest, GarbageCollectionKeepsPartialAggregatesOfUnprobedWindows)
+{
+    SlidingWindowAggregates slidingWindowAggregates(10, 4, 1);
+    for (const uint64_t sliceEnd : {4, 8, 10, 12, 14})
+    {
+        slidingWindowAggregates.storePartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(sliceEnd), 0, TupleBuffer{});
+    }
+
+    slidingWindowAggregates.garbageCollect(Timestamp(21));
+    EXPECT_FALSE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(4), 0).has_value());
+    EXPECT_FALSE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(10), 0).has_value());
+    EXPECT_TRUE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(12), 0).has_value());
+    EXPECT_TRUE(slidingWindowAggregates.getPartialAggregate(SlidingWindowAggregates::Side::PREFIX, SliceEnd(14), 0).has_value());
+}
+
+}
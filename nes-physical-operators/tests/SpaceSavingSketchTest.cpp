@@ -0,0 +1,208 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <Aggregation/SpaceSavingSketch.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class SpaceSavingSketchTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SpaceSavingSketchTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SpaceSavingSketchTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static std::vector<std::byte> createSketchMemory(const uint64_t numberOfCounters, const uint64_t keyAreaSize)
+    {
+        std::vector<std::byte> memory(SpaceSavingSketch::getSizeInBytes(numberOfCounters, keyAreaSize));
+        SpaceSavingSketch::init(memory, numberOfCounters, keyAreaSize);
+        return memory;
+    }
+
+    static std::span<const std::byte> asKey(const std::string_view key) { return std::as_bytes(std::span{key}); }
+
+    static std::string asString(const std::span<const std::byte> key)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): the keys of the tests are strings
+        return {reinterpret_cast<const char*>(key.data()), key.size()};
+    }
+
+    /// Key i occurs (numberOfKeys - i) times, interleaved with a long tail of keys that occur once
+    static std::vector<std::string> createSkewedStream(const uint64_t numberOfKeys, const uint64_t tailOffset)
+    {
+        std::vector<std::string> stream;
+        for (uint64_t round = 0; round < numberOfKeys; ++round)
+        {
+            for (uint64_t key = 0; key < numberOfKeys - round; ++key)
+            {
+                stream.push_back("key" + std::to_string(key));
+                stream.push_back("tail" + std::to_string(tailOffset + stream.size()));
+            }
+        }
+        return stream;
+    }
+};
+
+TEST_F(SpaceSavingSketchTest, CountsAreExactWhileAllKeysAreMonitored)
+{
+    auto memory = createSketchMemory(8, 64);
+    SpaceSavingSketch sketch{memory};
+    for (const auto* key : {"a", "b", "a", "c", "a", "b"})
+    {
+        ASSERT_TRUE(sketch.add(asKey(key)));
+    }
+
+    const auto topK = sketch.getTopK(2);
+    ASSERT_EQ(topK.size(), 2);
+    EXPECT_EQ(asString(topK[0].key), "a");
+    EXPECT_EQ(topK[0].count, 3);
+    EXPECT_EQ(topK[0].error, 0);
+    EXPECT_EQ(asString(topK[1].key), "b");
+    EXPECT_EQ(topK[1].count, 2);
+    EXPECT_EQ(sketch.getTopK(10).size(), 3);
+}
+
+TEST_F(SpaceSavingSketchTest, FrequentKeysSurviveALongTail)
+{
+    constexpr uint64_t numberOfKeys = 10;
+    auto memory = createSketchMemory(numberOfKeys * SpaceSavingSketch::COUNTERS_PER_REPORTED_KEY, 4096);
+    SpaceSavingSketch sketch{memory};
+    for (const auto& key : createSkewedStream(numberOfKeys, 0))
+    {
+        ASSERT_TRUE(sketch.add(asKey(key)));
+    }
+
+    /// The true count lies within the error bound of every reported count
+    const auto topK = sketch.getTopK(3);
+    ASSERT_EQ(topK.size(), 3);
+    for (uint64_t rank = 0; rank < topK.size(); ++rank)
+    {
+        EXPECT_EQ(asString(topK[rank].key), "key" + std::to_string(rank));
+        EXPECT_GE(topK[rank].count, numberOfKeys - rank);
+        EXPECT_LE(topK[rank].count - topK[rank].error, numberOfKeys - rank);
+    }
+}
+
+TEST_F(SpaceSavingSketchTest, ReplacingKeysKeepsEveryMonitoredKeyFindable)
+{
+    /// Few counters and many distinct keys replace counters on almost every add, which moves keys within the hash index and the heap
+    constexpr uint64_t numberOfCounters = 16;
+    auto memory = createSketchMemory(numberOfCounters, 4096);
+    SpaceSavingSketch sketch{memory};
+    std::unordered_map<std::string, uint64_t> trueCounts;
+    uint64_t totalWeight = 0;
+    for (uint64_t i = 0; i < 10000; ++i)
+    {
+        /// Every second key is one of three frequent keys
+        const auto key = i % 2 == 0 ? "frequent" + std::to_string((i / 2) % 3) : "rare" + std::to_string((i * 7919) % 1000);
+        const auto weight = 1 + (i % 3);
+        ASSERT_TRUE(sketch.add(asKey(key), weight));
+        trueCounts[key] += weight;
+        totalWeight += weight;
+    }
+
+    /// Adding a monitored key must increase its counter instead of monitoring it twice
+    const auto entries = sketch.getTopK(numberOfCounters);
+    ASSERT_EQ(entries.size(), numberOfCounters);
+    std::unordered_set<std::string> reportedKeys;
+    uint64_t sumOfCounts = 0;
+    for (const auto& entry : entries)
+    {
+        const auto key = asString(entry.key);
+        EXPECT_TRUE(reportedKeys.insert(key).second) << key << " is monitored twice";
+        EXPECT_GE(entry.count, trueCounts[key]);
+        EXPECT_LE(entry.count - entry.error, trueCounts[key]);
+        sumOfCounts += entry.count;
+    }
+    EXPECT_EQ(sumOfCounts, totalWeight);
+
+    /// Each frequent key makes up at least a twelfth of the total weight, which exceeds the total weight divided by the number of counters
+    for (uint64_t rank = 0; rank < 3; ++rank)
+    {
+        EXPECT_TRUE(reportedKeys.contains("frequent" + std::to_string(rank)));
+    }
+}
+
+TEST_F(SpaceSavingSketchTest, MergedSketchesReportTheFrequentKeysOfBoth)
+{
+    constexpr uint64_t numberOfKeys = 10;
+    constexpr uint64_t numberOfCounters = numberOfKeys * SpaceSavingSketch::COUNTERS_PER_REPORTED_KEY;
+    auto memory1 = createSketchMemory(numberOfCounters, 4096);
+    auto memory2 = createSketchMemory(numberOfCounters, 4096);
+    SpaceSavingSketch sketch1{memory1};
+    SpaceSavingSketch sketch2{memory2};
+    for (const auto& key : createSkewedStream(numberOfKeys, 0))
+    {
+        ASSERT_TRUE(sketch1.add(asKey(key)));
+    }
+    for (const auto& key : createSkewedStream(numberOfKeys, 1000000))
+    {
+        ASSERT_TRUE(sketch2.add(asKey(key)));
+    }
+    ASSERT_TRUE(sketch1.merge(sketch2));
+
+    const auto topK = sketch1.getTopK(3);
+    ASSERT_EQ(topK.size(), 3);
+    for (uint64_t rank = 0; rank < topK.size(); ++rank)
+    {
+        EXPECT_EQ(asString(topK[rank].key), "key" + std::to_string(rank));
+        EXPECT_GE(topK[rank].count, 2 * (numberOfKeys - rank));
+        EXPECT_LE(topK[rank].count - topK[rank].error, 2 * (numberOfKeys - rank));
+    }
+}
+
+TEST_F(SpaceSavingSketchTest, FullKeyAreaIsReportedAndCopiedIntoLargerSketch)
+{
+    auto smallMemory = createSketchMemory(4, 8);
+    SpaceSavingSketch smallSketch{smallMemory};
+    ASSERT_TRUE(smallSketch.add(asKey("1234")));
+    ASSERT_TRUE(smallSketch.add(asKey("1234")));
+    ASSERT_TRUE(smallSketch.add(asKey("5678")));
+
+    /// A rejected key leaves the sketch unchanged
+    ASSERT_FALSE(smallSketch.add(asKey("9")));
+    ASSERT_EQ(smallSketch.getTopK(4).size(), 2);
+
+    auto largeMemory = createSketchMemory(smallSketch.getNumberOfCounters(), 2 * smallSketch.getKeyAreaSize());
+    SpaceSavingSketch largeSketch{largeMemory};
+    smallSketch.copyInto(largeSketch);
+    ASSERT_TRUE(largeSketch.add(asKey("9")));
+
+    const auto topK = largeSketch.getTopK(4);
+    ASSERT_EQ(topK.size(), 3);
+    EXPECT_EQ(asString(topK[0].key), "1234");
+    EXPECT_EQ(topK[0].count, 2);
+    EXPECT_EQ(asString(topK[1].key), "5678");
+    EXPECT_EQ(asString(topK[2].key), "9");
+}
+
+}
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
@@ -270,6 +271,15 @@ bool TCPSource::fillBuffer(TupleBuffer& tupleBuffer, size_t& numReceivedBytes)
     return numReceivedBytes == 0 and readWasValid;
 }
 
+std::optional<Source::AsyncReadTarget> TCPSource::getAsyncReadTarget()
+{
+    /// Like 'fillBuffer', a buffer is emitted once it is full or the flush interval passed.
+    return AsyncReadTarget{
+        .fileDescriptor = sockfd,
+        .positional = false,
+        .flushInterval = std::chrono::milliseconds(static_cast<int64_t>(flushIntervalInMs))};
+}
+
 DescriptorConfig::Config TCPSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
 {
     return DescriptorConfig::validateAndFormat<ConfigParametersTCP>(std::move(config), name());
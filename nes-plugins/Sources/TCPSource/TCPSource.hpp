@@ -188,6 +188,9 @@ public:
     /// Close TCP connection.
     void close() override;
 
+    /// Lets the io_uring ingestion read from the connected socket directly.
+    [[nodiscard]] std::optional<AsyncReadTarget> getAsyncReadTarget() override;
+
     static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
 
     /// Systest adaptors: materialize inline/file test data by spinning up a TCPDataServer.
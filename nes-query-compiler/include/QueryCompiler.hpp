@@ -21,6 +21,12 @@
 #include <CompiledQueryPlan.hpp>
 #include <QueryExecutionConfiguration.hpp>
 
+namespace NES
+{
+class BackgroundCompiler;
+class CompiledPipelineCache;
+}
+
 namespace NES::QueryCompilation
 {
 
@@ -36,15 +42,21 @@ struct QueryCompilationRequest
 
 /// The query compiler behaves as a pure function: QueryPlan -> CompiledQueryPlan
 /// This guarantees that identical QueryPlan instances produce identical CompiledQueryPlan results.
+/// The compiled pipeline cache does not change the results, it only skips recompiling pipelines that were compiled before.
 class QueryCompiler
 {
 public:
-    explicit QueryCompiler(QueryExecutionConfiguration defaultQueryExecution) : defaultQueryExecution(std::move(defaultQueryExecution)) { };
+    explicit QueryCompiler(QueryExecutionConfiguration defaultQueryExecution);
 
     std::unique_ptr<CompiledQueryPlan> compileQuery(std::unique_ptr<QueryCompilationRequest> request);
 
 private:
     QueryExecutionConfiguration defaultQueryExecution;
+    /// Shared by the pipeline stages of all queries compiled by this compiler, nullptr if disabled.
+    std::shared_ptr<CompiledPipelineCache> compiledPipelineCache;
+    /// Compiles the pipelines of all queries in the TIERED execution mode, and ahead of time in the COMPILER execution mode if
+    /// compile_ahead_of_time is set. nullptr otherwise.
+    std::shared_ptr<BackgroundCompiler> backgroundCompiler;
 };
 
 }
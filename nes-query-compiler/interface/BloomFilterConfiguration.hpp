@@ -56,8 +56,9 @@ public:
         = {"expected_entries",
            std::to_string(DEFAULT_BLOOM_FILTER_EXPECTED_ENTRIES),
            "Number of keys one hash map is expected to hold, which is what the bit array is sized for. This is not bounded by "
-           "number_of_partitions: the hash maps never rehash, they just grow their chains, so the entry count is a property of the "
-           "workload. Too low saturates the filter and it stops skipping anything; too high wastes memory per hash map.",
+           "number_of_partitions: the hash maps either never rehash and just grow their chains, or grow past their initial "
+           "bucket count, so the entry count is a property of the workload. Too low saturates the filter and it stops skipping "
+           "anything; too high wastes memory per hash map.",
            {std::make_shared<NumberValidation>()}};
 
 private:
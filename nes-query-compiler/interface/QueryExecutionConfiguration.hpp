@@ -22,9 +22,12 @@
 #include <Configurations/BaseOption.hpp>
 #include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
+#include <Configurations/Validation/FloatValidation.hpp>
 #include <Configurations/Validation/NonZeroValidation.hpp>
 #include <Configurations/Validation/NumberValidation.hpp>
+#include <Configurations/Validation/PowerOfTwoValidation.hpp>
 #include <Util/ExecutionMode.hpp>
+#include <Util/HashMapIndex.hpp>
 #include <BloomFilterConfiguration.hpp>
 #include <SliceCacheConfiguration.hpp>
 
@@ -35,6 +38,13 @@ static constexpr auto DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES = 1024;
 static constexpr auto DEFAULT_PAGED_VECTOR_SIZE = 1024;
 static constexpr auto DEFAULT_OPERATOR_BUFFER_SIZE = 4096;
 static constexpr auto DEFAULT_NUMBER_OF_RECORDS_PER_KEY = 10;
+static constexpr auto DEFAULT_HASH_MAP_MAX_LOAD_FACTOR = 1.0;
+static constexpr auto DEFAULT_AGGREGATION_PROBE_PARTITIONS = 1;
+static constexpr auto DEFAULT_SLICE_STORE_RING_CAPACITY = 1024;
+/// Below a quarter record per chain a growth would double the chains array faster than it can be migrated; above 16 the
+/// chain walks are what growth is supposed to prevent in the first place.
+static constexpr auto MIN_HASH_MAP_MAX_LOAD_FACTOR = 0.25;
+static constexpr auto MAX_HASH_MAP_MAX_LOAD_FACTOR = 16.0;
 
 class QueryExecutionConfiguration : public BaseConfiguration
 {
@@ -45,14 +55,38 @@ public:
     EnumOption<ExecutionMode> executionMode
         = {"execution_mode",
            ExecutionMode::COMPILER,
-           "Execution mode for the query compiler"
-           "[COMPILER|INTERPRETER]."};
+           "Execution mode for the query compiler. TIERED starts interpreting a query immediately and switches every pipeline to "
+           "compiled code once a background thread has compiled it "
+           "[COMPILER|INTERPRETER|TIERED]."};
     UIntOption numberOfPartitions
         = {"number_of_partitions",
            std::to_string(DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES),
-           "Number of buckets in a hash table. Fixed at query-compilation time and never grown: the hash maps do not rehash, so too low "
-           "a value lengthens the chains, while too high a one costs a chain pointer per hash map, worker thread and slice.",
+           "Number of buckets in a hash table. Without enable_hash_map_growth it is fixed at query-compilation time: the hash maps do "
+           "not rehash, so too low a value lengthens the chains, while too high a one costs a chain pointer per hash map, worker thread "
+           "and slice. With growth enabled it is only the initial number of buckets and can be kept small.",
            {std::make_shared<NumberValidation>(), std::make_shared<NonZeroValidation>()}};
+    BoolOption enableHashMapGrowth
+        = {"enable_hash_map_growth",
+           "false",
+           "Lets the hash maps double their number of buckets whenever hash_map_max_load_factor is exceeded. The rehash is spread "
+           "over the following inserts, so no single insert pays for it."};
+    FloatOption hashMapMaxLoadFactor
+        = {"hash_map_max_load_factor",
+           std::to_string(DEFAULT_HASH_MAP_MAX_LOAD_FACTOR),
+           "Average number of entries per bucket above which a growing hash map doubles its buckets. Only used with "
+           "enable_hash_map_growth.",
+           {std::make_shared<FloatValidation>(MIN_HASH_MAP_MAX_LOAD_FACTOR, MAX_HASH_MAP_MAX_LOAD_FACTOR)}};
+    EnumOption<HashMapIndex> hashMapIndex
+        = {"hash_map_index",
+           HashMapIndex::CHAINED,
+           "How the hash maps look up their entries: a chain per bucket, or SIMD-probed open addressing that sizes itself at runtime "
+           "and therefore ignores enable_hash_map_growth [CHAINED|SWISS]."};
+    UIntOption aggregationProbePartitions
+        = {"aggregation_probe_partitions",
+           std::to_string(DEFAULT_AGGREGATION_PROBE_PARTITIONS),
+           "Number of radix partitions the window aggregation splits its hash maps into by the top bits of the key hash. A triggered "
+           "window is merged and emitted by one task per non-empty partition, so that all worker threads share the work. Power of two.",
+           {std::make_shared<NumberValidation>(), std::make_shared<PowerOfTwoValidation>()}};
     UIntOption pageSize
         = {"page_size",
            std::to_string(DEFAULT_PAGED_VECTOR_SIZE),
@@ -68,6 +102,44 @@ public:
            std::to_string(DEFAULT_OPERATOR_BUFFER_SIZE),
            "Buffer size of a operator e.g. during scan",
            {std::make_shared<NumberValidation>()}};
+    UIntOption backgroundCompilationThreads
+        = {"background_compilation_threads",
+           "1",
+           "Number of threads that compile pipelines in the background: in the TIERED execution mode while the pipelines execute "
+           "interpreted, and in the COMPILER execution mode if compile_ahead_of_time is set.",
+           {std::make_shared<NumberValidation>(), std::make_shared<NonZeroValidation>()}};
+    BoolOption compileAheadOfTime
+        = {"compile_ahead_of_time",
+           "false",
+           "Compiles all pipelines of a query concurrently on the background compilation threads before the query starts, instead of "
+           "compiling each pipeline on the worker thread that starts it. Only used in the COMPILER execution mode."};
+    UIntOption compiledPipelineCacheSize
+        = {"compiled_pipeline_cache_size",
+           "0",
+           "Number of compiled pipelines the query compiler keeps, so that a structurally equal pipeline of a later query skips "
+           "tracing and compilation. Only used in the COMPILER and TIERED execution modes without IR dumps. 0 disables the cache.",
+           {std::make_shared<NumberValidation>()}};
+
+    UIntOption sliceStoreRingCapacity
+        = {"slice_store_ring_capacity",
+           std::to_string(DEFAULT_SLICE_STORE_RING_CAPACITY),
+           "Number of slots of the lock-free ring in which the window operators look up their slices. It should exceed the number of "
+           "slices between the global watermark and the newest timestamp; further slices fall back to a locked map. Rounded up to the "
+           "next power of two, 0 disables the ring.",
+           {std::make_shared<NumberValidation>()}};
+    BoolOption incrementalSlidingWindowAggregation
+        = {"incremental_sliding_window_aggregation",
+           "false",
+           "Lets sliding window aggregations combine each window from two partial aggregates per radix partition that are shared "
+           "between overlapping windows, instead of merging every slice of the window. Has no effect on tumbling windows and on "
+           "aggregations without grouping keys, which combine the aggregation states of their slices directly."};
+    UIntOption originIdleTimeoutInMs
+        = {"origin_idle_timeout_ms",
+           "0",
+           "Time in milliseconds after which an input origin of a window aggregation or join that has not delivered any data no longer "
+           "holds back the watermark of the other origins. It counts again once it delivers data, whose tuples are late if they are "
+           "behind the watermark by then. 0 waits for every origin indefinitely.",
+           {std::make_shared<NumberValidation>()}};
 
     SliceCacheConfiguration sliceCacheConfiguration = {"slice_cache", "Configuration for the slice cache"};
 
@@ -80,8 +152,18 @@ private:
             &executionMode,
             &pageSize,
             &numberOfPartitions,
+            &enableHashMapGrowth,
+            &hashMapMaxLoadFactor,
+            &hashMapIndex,
+            &aggregationProbePartitions,
             &numberOfRecordsPerKey,
             &operatorBufferSize,
+            &backgroundCompilationThreads,
+            &compileAheadOfTime,
+            &compiledPipelineCacheSize,
+            &sliceStoreRingCapacity,
+            &incrementalSlidingWindowAggregation,
+            &originIdleTimeoutInMs,
             &sliceCacheConfiguration,
             &bloomFilterConfiguration};
     }
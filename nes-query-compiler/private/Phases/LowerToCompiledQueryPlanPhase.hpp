@@ -16,10 +16,14 @@
 
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
 #include <Identifiers/Identifiers.hpp>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledExecutablePipelineStage.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Util/DumpMode.hpp>
 #include <CompiledQueryPlan.hpp>
 #include <PipelinedQueryPlan.hpp>
@@ -29,8 +33,13 @@ namespace NES
 class LowerToCompiledQueryPlanPhase
 {
 public:
-    explicit LowerToCompiledQueryPlanPhase(DumpMode dumpQueryCompilationIntermediateRepresentations)
+    explicit LowerToCompiledQueryPlanPhase(
+        DumpMode dumpQueryCompilationIntermediateRepresentations,
+        std::shared_ptr<CompiledPipelineCache> compiledPipelineCache = nullptr,
+        std::shared_ptr<BackgroundCompiler> backgroundCompiler = nullptr)
         : dumpQueryCompilationIR(dumpQueryCompilationIntermediateRepresentations)
+        , compiledPipelineCache(std::move(compiledPipelineCache))
+        , backgroundCompiler(std::move(backgroundCompiler))
     {
     }
 
@@ -46,15 +55,24 @@ private:
     void processSource(const std::shared_ptr<Pipeline>& pipeline);
 
     std::unique_ptr<ExecutablePipelineStage> getStage(const std::shared_ptr<Pipeline>& pipeline);
+    /// Compiles the collected stages concurrently on the background compiler and waits until all of them are compiled.
+    std::vector<CompiledQueryPlan::PipelineCompilation> compileAheadOfTime();
 
     /// Lowering context
     std::vector<CompiledQueryPlan::Sink> sinks;
     std::vector<CompiledQueryPlan::Source> sources;
     std::unordered_map<PipelineId, std::shared_ptr<ExecutablePipeline>> pipelineToExecutableMap;
+    /// Owned by the executable pipelines above.
+    std::vector<std::pair<PipelineId, CompiledExecutablePipelineStage*>> stagesToCompileAheadOfTime;
 
     std::shared_ptr<PipelinedQueryPlan> pipelineQueryPlan;
 
     /// Config parameter
     DumpMode dumpQueryCompilationIR;
+    /// Only handed to the stages of compiled pipelines that do not dump their IR, as reused pipelines skip tracing.
+    std::shared_ptr<CompiledPipelineCache> compiledPipelineCache;
+    /// If set, compiles all pipelines of a query concurrently in the COMPILER execution mode. Only handed to the stages in the TIERED
+    /// execution mode, which compile in the background while they execute interpreted.
+    std::shared_ptr<BackgroundCompiler> backgroundCompiler;
 };
 }
@@ -0,0 +1,33 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <QueryExecutionConfiguration.hpp>
+
+namespace NES
+{
+
+/// Load factor at which the hash maps double their chains, or nullopt when they keep numberOfBuckets.
+inline std::optional<double> createMaxLoadFactor(const QueryExecutionConfiguration& conf)
+{
+    if (not conf.enableHashMapGrowth.getValue())
+    {
+        return std::nullopt;
+    }
+    return conf.hashMapMaxLoadFactor.getValue();
+}
+
+}
@@ -39,6 +39,7 @@ LoweringRuleResultSubgraph LowerToPhysicalEventTimeWatermarkAssigner::apply(Logi
 
     const auto memoryLayoutTypeTrait = traitSet.get<MemoryLayoutTypeTrait>();
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
+    const auto inputMemoryLayoutType = assignerOp->getChild()->getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     const auto outputSchema = createPhysicalOutputSchema(traitSet);
     const auto inputSchema = createPhysicalOutputSchema(assignerOp->getChild().getTraitSet());
@@ -48,7 +49,7 @@ LoweringRuleResultSubgraph LowerToPhysicalEventTimeWatermarkAssigner::apply(Logi
     auto physicalOperator = EventTimeWatermarkAssignerPhysicalOperator(EventTimeFunction(physicalFunction, assignerOp->getUnit()));
 
     const auto wrapper
-        = std::make_shared<PhysicalOperatorWrapper>(physicalOperator, inputSchema, outputSchema, memoryLayoutType, memoryLayoutType);
+        = std::make_shared<PhysicalOperatorWrapper>(physicalOperator, inputSchema, outputSchema, inputMemoryLayoutType, memoryLayoutType);
 
     /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
     std::vector leaves(logicalOperator.getChildren().size(), wrapper);
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -73,6 +74,7 @@
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Common.hpp>
+#include <Util/HashMapConfiguration.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/SchemaFactory.hpp>
 #include <Watermark/TimeFunction.hpp>
@@ -101,8 +103,9 @@ struct FieldNamesExtension
 /// Sizing of the join's in-map BloomFilter, or nullopt when it is switched off.
 ///
 /// Sized from expectedEntries rather than from the numberOfBuckets these options carry, because the bucket
-/// count bounds nothing: the hash maps never rehash, they only lengthen their chains, so a map routinely
-/// holds far more keys than it has buckets. Sizing the filter for the bucket count would saturate every bit
+/// count bounds nothing: unless growth is enabled the hash maps never rehash, they only lengthen their chains,
+/// and a growing map outgrows its initial bucket count by design, so a map routinely holds far more keys than
+/// numberOfBuckets. Sizing the filter for the bucket count would saturate every bit
 /// and make mightContain() always true, i.e. pay the hash positions and skip nothing.
 std::optional<Nautilus::Interface::BloomFilterParams> createBloomFilterParams(const QueryExecutionConfiguration& conf)
 {
@@ -269,6 +272,9 @@ std::pair<ChainedHashMapConfig, std::vector<PhysicalFunction>> createChainedHash
             .entrySize = entrySize,
             .numberOfBuckets = numberOfBuckets,
             .pageSize = pageSize,
+            .maxLoadFactor = createMaxLoadFactor(conf),
+            .index = conf.hashMapIndex.getValue(),
+            .numberOfRadixPartitions = 1,
             .bloomFilterParams = createBloomFilterParams(conf),
             .fieldKeys = fieldKeys,
             .fieldValues = fieldValues,
@@ -321,8 +327,11 @@ LoweringRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logica
     /// Our current hash join implementation uses a hash table that requires each key to be 100% identical in terms of no. fields and data types.
     /// Therefore, we need to create map operators that extend and cast the fields to the correct data types.
     auto [leftJoinFields, rightJoinFields] = getJoinFieldExtensionsLeftRight(leftOperator, rightOperator, logicalJoinFunction);
-    auto [newLeftInputSchema, leftMapOperators] = addMapOperators(leftOperator, leftJoinFields, memoryLayoutType);
-    auto [newRightInputSchema, rightMapOperators] = addMapOperators(rightOperator, rightJoinFields, memoryLayoutType);
+    /// The build sides scan the buffers of their children, which are emitted in the layout of the children's traits.
+    const auto leftMemoryLayoutType = leftOperator.getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
+    const auto rightMemoryLayoutType = rightOperator.getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
+    auto [newLeftInputSchema, leftMapOperators] = addMapOperators(leftOperator, leftJoinFields, leftMemoryLayoutType);
+    auto [newRightInputSchema, rightMapOperators] = addMapOperators(rightOperator, rightJoinFields, rightMemoryLayoutType);
     auto leftTupleLayout = std::make_shared<DefaultPagedVectorTupleLayout>(newLeftInputSchema);
     auto rightTupleLayout = std::make_shared<DefaultPagedVectorTupleLayout>(newRightInputSchema);
     auto [leftHashMapConfig, leftKeyFunctions] = createChainedHashMapConfig(leftJoinFields, newLeftInputSchema, conf);
@@ -331,7 +340,10 @@ LoweringRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logica
     /// Creating the hash join operator handler and slice store
     auto handlerId = getNextOperatorHandlerId();
     auto sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
-        windowType.getSize().getTime(), windowType.getSlide().getTime(), conf.sliceCacheConfiguration);
+        windowType.getSize().getTime(),
+        windowType.getSlide().getTime(),
+        conf.sliceCacheConfiguration,
+        conf.sliceStoreRingCapacity.getValue());
     auto sliceStoreRefLeft = sliceAndWindowStore->createSliceStoreRef(
         [](Slice& slice, const WorkerThreadId workerThreadId, AbstractBufferProvider& bufferProvider)
         {
@@ -374,8 +386,12 @@ LoweringRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logica
         std::unreachable();
     };
 
-    auto handler
-        = std::make_shared<HJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), createTriggerStrategy());
+    auto handler = std::make_shared<HJOperatorHandler>(
+        inputOriginIds,
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        createTriggerStrategy(),
+        std::chrono::milliseconds(conf.originIdleTimeoutInMs.getValue()));
 
     /// Creating the left and right hash join build operator
     const HJBuildPhysicalOperator leftBuildOperator{
@@ -403,7 +419,7 @@ LoweringRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logica
         std::move(leftBuildOperator),
         newLeftInputSchema,
         physicalOutputSchema,
-        memoryLayoutType,
+        leftMemoryLayoutType,
         memoryLayoutType,
         handlerId,
         handler,
@@ -413,7 +429,7 @@ LoweringRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logica
         std::move(rightBuildOperator),
         newRightInputSchema,
         physicalOutputSchema,
-        memoryLayoutType,
+        rightMemoryLayoutType,
         memoryLayoutType,
         handlerId,
         handler,
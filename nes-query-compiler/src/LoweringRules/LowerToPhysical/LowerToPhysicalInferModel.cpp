@@ -82,6 +82,7 @@ LoweringRuleResultSubgraph LowerToPhysicalInferModel::apply(LogicalOperator logi
     const auto memoryLayoutTypeTrait = logicalOperator.getTraitSet().tryGet<MemoryLayoutTypeTrait>();
     PRECONDITION(memoryLayoutTypeTrait.has_value(), "Expected a memory layout type trait");
     const auto memoryLayoutType = memoryLayoutTypeTrait.value()->memoryLayout;
+    const auto inputMemoryLayoutType = inferModelOp.get().getChildren().at(0).getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     const auto physicalOutputSchema = createPhysicalOutputSchema(logicalOperator.getTraitSet());
     const auto physicalInputSchema = createPhysicalOutputSchema(inferModelOp.get().getChildren().at(0).getTraitSet());
@@ -90,7 +91,7 @@ LoweringRuleResultSubgraph LowerToPhysicalInferModel::apply(LogicalOperator logi
         physicalOperator,
         physicalInputSchema,
         physicalOutputSchema,
-        memoryLayoutType,
+        inputMemoryLayoutType,
         memoryLayoutType,
         PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
 
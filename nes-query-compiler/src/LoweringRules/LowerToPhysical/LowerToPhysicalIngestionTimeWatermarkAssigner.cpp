@@ -38,13 +38,14 @@ LoweringRuleResultSubgraph LowerToPhysicalIngestionTimeWatermarkAssigner::apply(
 
     const auto memoryLayoutTypeTrait = traitSet.get<MemoryLayoutTypeTrait>();
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
+    const auto inputMemoryLayoutType = assignOp->getChild()->getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     const auto outputSchema = createPhysicalOutputSchema(traitSet);
     const auto inputSchema = createPhysicalOutputSchema(assignOp->getChild().getTraitSet());
 
     auto physicalOperator = IngestionTimeWatermarkAssignerPhysicalOperator(IngestionTimeFunction());
     auto wrapper
-        = std::make_shared<PhysicalOperatorWrapper>(physicalOperator, inputSchema, outputSchema, memoryLayoutType, memoryLayoutType);
+        = std::make_shared<PhysicalOperatorWrapper>(physicalOperator, inputSchema, outputSchema, inputMemoryLayoutType, memoryLayoutType);
 
     /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
     std::vector leaves(logicalOperator.getChildren().size(), wrapper);
@@ -15,9 +15,11 @@
 #include <LoweringRules/LowerToPhysical/LowerToPhysicalNLJoin.hpp>
 
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <string>
@@ -45,6 +47,7 @@
 #include <Join/NestedLoopJoin/NLJOperatorHandler.hpp>
 #include <Join/NestedLoopJoin/NLJOuterProbePhysicalOperator.hpp>
 #include <Join/NestedLoopJoin/NLJSlice.hpp>
+#include <Join/SortMergeJoin/SortMergeJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinOperatorHandler.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <LoweringRules/AbstractLoweringRule.hpp>
@@ -52,11 +55,14 @@
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Schema/Binder.hpp>
+#include <Schema/Field.hpp>
 #include <Schema/Schema.hpp>
 #include <Schema/SchemaFwd.hpp>
 #include <SliceStore/DefaultTimeBasedSliceStore.hpp>
 #include <SliceStore/Slice.hpp>
 #include <Traits/FieldMappingTrait.hpp>
+#include <Traits/JoinImplementationTypeTrait.hpp>
 #include <Traits/MemoryLayoutTypeTrait.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
@@ -66,6 +72,7 @@
 #include <Watermark/TimeFunction.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
+#include <BandJoinPredicate.hpp>
 #include <ErrorHandling.hpp>
 #include <LoweringRuleRegistry.hpp>
 #include <PhysicalOperator.hpp>
@@ -104,6 +111,9 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
 
     auto leftInputSchema = createPhysicalOutputSchema(children[0]->getTraitSet());
     auto rightInputSchema = createPhysicalOutputSchema(children[1]->getTraitSet());
+    /// The build sides scan the buffers of their children, which are emitted in the layout of the children's traits.
+    const auto leftMemoryLayoutType = children[0]->getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
+    const auto rightMemoryLayoutType = children[1]->getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
     auto outputSchema = createPhysicalOutputSchema(traitSet);
     auto outputOriginId = (*outputOriginIds)[0];
     auto logicalJoinFunction = join->getJoinFunction();
@@ -140,7 +150,10 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
         = std::get<std::array<Windowing::BoundTimeCharacteristic, 2>>(joinTimeCharacteristicsVariant);
 
     auto sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
-        windowType.getSize().getTime(), windowType.getSlide().getTime(), conf.sliceCacheConfiguration);
+        windowType.getSize().getTime(),
+        windowType.getSlide().getTime(),
+        conf.sliceCacheConfiguration,
+        conf.sliceStoreRingCapacity.getValue());
     auto sliceStoreRefLeft = sliceAndWindowStore->createSliceStoreRef(
         [](Slice& slice, const WorkerThreadId workerThreadId, AbstractBufferProvider&)
         {
@@ -189,8 +202,12 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
         std::unreachable();
     };
 
-    auto handler
-        = std::make_shared<NLJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), createTriggerStrategy());
+    auto handler = std::make_shared<NLJOperatorHandler>(
+        inputOriginIds,
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        createTriggerStrategy(),
+        std::chrono::milliseconds(conf.originIdleTimeoutInMs.getValue()));
 
     const NLJBuildPhysicalOperator leftBuildOperator{
         handlerId, JoinBuildSideType::Left, TimeFunction::create(timeStampFieldLeft), leftTupleLayout, std::move(sliceStoreRefLeft)};
@@ -203,7 +220,7 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
         std::move(leftBuildOperator),
         leftInputSchema,
         outputSchema,
-        memoryLayoutType,
+        leftMemoryLayoutType,
         memoryLayoutType,
         handlerId,
         handler,
@@ -213,7 +230,7 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
         std::move(rightBuildOperator),
         rightInputSchema,
         outputSchema,
-        memoryLayoutType,
+        rightMemoryLayoutType,
         memoryLayoutType,
         handlerId,
         handler,
@@ -222,6 +239,7 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
     /// Select probe operator based on join type
     static_assert(JoinProbeOperator<NLJInnerProbePhysicalOperator>);
     static_assert(JoinProbeOperator<NLJOuterProbePhysicalOperator>);
+    static_assert(JoinProbeOperator<SortMergeJoinProbePhysicalOperator>);
 
     auto createProbeWrapper = [&](const auto& probeOperator)
     {
@@ -237,8 +255,38 @@ LoweringRuleResultSubgraph LowerToPhysicalNLJoin::apply(LogicalOperator logicalO
             std::vector{leftBuildWrapper, rightBuildWrapper});
     };
 
+    const auto useSortMergeJoin
+        = traitSet.get<JoinImplementationTypeTrait>()->implementationType == JoinImplementation::SORT_MERGE_JOIN;
     std::shared_ptr<PhysicalOperatorWrapper> probeWrapper;
-    if (isOuterJoin(currentJoinType))
+    if (const auto bandPredicate = useSortMergeJoin ? extractBandJoinPredicate(*join) : std::nullopt)
+    {
+        PRECONDITION(
+            SortMergeJoinProbePhysicalOperator::supportsJoinType(currentJoinType),
+            "SortMergeJoinProbePhysicalOperator does not support join type");
+        auto getKeyField = [&combinedFieldMapping](const Field& field)
+        {
+            const auto mappedName = combinedFieldMapping.getMapping(unbind(field));
+            INVARIANT(mappedName.has_value(), "Can not find mapping for {}", field);
+            return mappedName.value();
+        };
+        SortMergeJoinBand band{
+            .leftKeyField = getKeyField(bandPredicate->leftKey),
+            .rightKeyField = getKeyField(bandPredicate->rightKey),
+            .biasedUnsignedKeys = bandPredicate->keyEncoding == BandJoinPredicate::KeyEncoding::BIASED_UNSIGNED,
+            .minDistance = bandPredicate->minDistance,
+            .maxDistance = bandPredicate->maxDistance};
+        probeWrapper = createProbeWrapper(SortMergeJoinProbePhysicalOperator(
+            handlerId,
+            joinFunction,
+            WindowMetaData{join->getStartField(), join->getEndField()},
+            joinSchema,
+            leftTupleLayout,
+            rightTupleLayout,
+            leftKeyFieldNames,
+            rightKeyFieldNames,
+            std::move(band)));
+    }
+    else if (isOuterJoin(currentJoinType))
     {
         PRECONDITION(
             NLJOuterProbePhysicalOperator::supportsJoinType(currentJoinType), "NLJOuterProbePhysicalOperator does not support join type");
@@ -96,14 +96,16 @@ LoweringRuleResultSubgraph LowerToPhysicalProjection::apply(LogicalOperator proj
 
     const auto memoryLayoutTypeTrait = traitSet.get<MemoryLayoutTypeTrait>();
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
+    /// The projection scans the buffers of its child, which are emitted in the layout of the child's trait.
+    const auto inputMemoryLayoutType = childTraitSet.get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     auto bufferSize = conf.pageSize.getValue();
-    auto scan = createScanOperator(projection, bufferSize, inputSchema, memoryLayoutType);
+    auto scan = createScanOperator(projection, bufferSize, inputSchema, inputMemoryLayoutType);
     auto scanWrapper = std::make_shared<PhysicalOperatorWrapper>(
         scan,
         inputSchema,
         outputSchema,
-        memoryLayoutType,
+        inputMemoryLayoutType,
         memoryLayoutType,
         std::nullopt,
         std::nullopt,
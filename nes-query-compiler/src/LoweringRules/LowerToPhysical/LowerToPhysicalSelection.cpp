@@ -42,6 +42,8 @@ LoweringRuleResultSubgraph LowerToPhysicalSelection::apply(LogicalOperator logic
 
     const auto memoryLayoutTypeTrait = traitSet.get<MemoryLayoutTypeTrait>();
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
+    /// The trait of an operator describes the layout of the buffers it emits. Thus, the operator scans the layout of its child.
+    const auto inputMemoryLayoutType = selection->getChild()->getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     const auto outputSchema = createPhysicalOutputSchema(traitSet);
     const auto inputSchema = createPhysicalOutputSchema(selection->getChild()->getTraitSet());
@@ -51,7 +53,7 @@ LoweringRuleResultSubgraph LowerToPhysicalSelection::apply(LogicalOperator logic
         physicalOperator,
         inputSchema,
         outputSchema,
-        memoryLayoutType,
+        inputMemoryLayoutType,
         memoryLayoutType,
         PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
 
@@ -55,6 +55,7 @@ LoweringRuleResultSubgraph LowerToPhysicalSink::apply(LogicalOperator logicalOpe
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
 
     auto childTraitSet = sink->getChild()->getTraitSet();
+    const auto inputMemoryLayoutType = childTraitSet.get<MemoryLayoutTypeTrait>()->memoryLayout;
     const auto inputFieldMapping = childTraitSet.get<FieldMappingTrait>();
     const auto childFieldOrdering = childTraitSet.get<FieldOrderingTrait>();
 
@@ -92,7 +93,7 @@ LoweringRuleResultSubgraph LowerToPhysicalSink::apply(LogicalOperator logicalOpe
                     physicalOperator,
                     inputSchemaWithRedirections,
                     inputSchema,
-                    memoryLayoutType,
+                    inputMemoryLayoutType,
                     memoryLayoutType,
                     PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
             }();
@@ -105,7 +106,7 @@ LoweringRuleResultSubgraph LowerToPhysicalSink::apply(LogicalOperator logicalOpe
                     physicalOperator,
                     inputSchemaWithRedirections,
                     inputSchema,
-                    memoryLayoutType,
+                    inputMemoryLayoutType,
                     memoryLayoutType,
                     std::nullopt,
                     std::nullopt,
@@ -123,7 +124,7 @@ LoweringRuleResultSubgraph LowerToPhysicalSink::apply(LogicalOperator logicalOpe
         physicalOperator,
         inputSchema,
         outputSchema,
-        memoryLayoutType,
+        inputMemoryLayoutType,
         memoryLayoutType,
         PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
 
@@ -65,7 +65,7 @@ LoweringRuleResultSubgraph LowerToPhysicalUnion::apply(LogicalOperator logicalOp
                                UnionRenamePhysicalOperator{extractNames(childOutputSchema), extractNames(outputSchema)},
                                childOutputSchema,
                                outputSchema,
-                               memoryLayoutType,
+                               childTraitSet.get<MemoryLayoutTypeTrait>()->memoryLayout,
                                memoryLayoutType,
                                PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
                        })
@@ -14,6 +14,8 @@
 
 #include <LoweringRules/LowerToPhysical/LowerToPhysicalWindowedAggregation.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -30,6 +32,11 @@
 #include <Aggregation/AggregationProbePhysicalOperator.hpp>
 #include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
+#include <Aggregation/KeylessAggregationBuildPhysicalOperator.hpp>
+#include <Aggregation/KeylessAggregationOperatorHandler.hpp>
+#include <Aggregation/KeylessAggregationProbePhysicalOperator.hpp>
+#include <Aggregation/KeylessAggregationSlice.hpp>
+#include <Aggregation/SlidingWindowAggregates.hpp>
 #include <DataTypes/DataTypeProvider.hpp>
 #include <Functions/FieldAccessPhysicalFunction.hpp>
 #include <Functions/FunctionProvider.hpp>
@@ -44,6 +51,8 @@
 #include <Interface/Record.hpp>
 #include <LoweringRules/AbstractLoweringRule.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/TopKAggregationLogicalFunction.hpp>
 #include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
@@ -54,6 +63,7 @@
 #include <Traits/MemoryLayoutTypeTrait.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
+#include <Util/HashMapConfiguration.hpp>
 #include <Util/SchemaFactory.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
@@ -105,13 +115,26 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
         const auto resultFieldIdentifier = descriptor.name;
         auto name = descriptor.function->getName();
 
+        std::optional<double> quantile;
+        if (const auto approxQuantile = descriptor.function.tryGetAs<ApproxQuantileAggregationLogicalFunction>())
+        {
+            quantile = approxQuantile.value()->getQuantile();
+        }
+        std::optional<uint64_t> k;
+        if (const auto topK = descriptor.function.tryGetAs<TopKAggregationLogicalFunction>())
+        {
+            k = topK.value()->getK();
+        }
+
         auto aggregationArguments = AggregationPhysicalFunctionRegistryArguments(
             std::move(physicalInputType),
             std::move(physicalFinalType),
             std::move(aggregationInputFunction),
             resultFieldIdentifier,
             tupleLayout,
-            descriptor.function.shallIncludeNullValues());
+            descriptor.function.shallIncludeNullValues(),
+            quantile,
+            k);
         if (const auto aggregationFactory = AggregationPhysicalFunctionRegistry::instance().find(std::string{name}))
         {
             aggregationPhysicalFunctions.push_back((*aggregationFactory)(std::move(aggregationArguments)));
@@ -138,6 +161,8 @@ LoweringRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOper
 
     const auto memoryLayoutTypeTrait = traitSet.get<MemoryLayoutTypeTrait>();
     const auto memoryLayoutType = memoryLayoutTypeTrait->memoryLayout;
+    /// The build scans the buffers of the child, which are emitted in the layout of the child's trait.
+    const auto inputMemoryLayoutType = childTraitSet.get<MemoryLayoutTypeTrait>()->memoryLayout;
 
     PRECONDITION(
         std::holds_alternative<Windowing::BoundTimeCharacteristic>(aggregation->getCharacteristic()),
@@ -169,7 +194,8 @@ LoweringRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOper
     }
     const auto entrySize = sizeof(ChainedHashMapEntry) + keySize + valueSize;
     const auto numberOfBuckets = conf.numberOfPartitions.getValue();
-    const auto pageSize = conf.pageSize.getValue();
+    /// A page has to hold at least one entry, which large fixed-size states, e.g., the registers of APPROX_COUNT_DISTINCT, can exceed
+    const auto pageSize = std::max<uint64_t>(conf.pageSize.getValue(), entrySize);
 
     const auto fieldKeyNames
         = boundGroupingKeys | std::views::transform([](const auto& field) { return QualifiedIdentifier{field->getField().getLastName()}; });
@@ -187,18 +213,80 @@ LoweringRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOper
 
     const auto windowMetaData = WindowMetaData{aggregation->getWindowStartField(), aggregation->getWindowEndField()};
 
+    /// Wraps the build and the probe into the physical subgraph of this operator
+    const auto createSubgraph = [&](const auto& build, const auto& probe, const std::shared_ptr<WindowBasedOperatorHandler>& handler)
+    {
+        auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
+            build,
+            physicalInputSchema,
+            physicalOutputSchema,
+            inputMemoryLayoutType,
+            memoryLayoutType,
+            handlerId,
+            handler,
+            PhysicalOperatorWrapper::PipelineLocation::EMIT);
+
+        auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
+            probe,
+            physicalInputSchema,
+            physicalOutputSchema,
+            memoryLayoutType,
+            memoryLayoutType,
+            handlerId,
+            handler,
+            PhysicalOperatorWrapper::PipelineLocation::SCAN,
+            std::vector{buildWrapper});
+
+        /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
+        std::vector leaves(logicalOperator.getChildren().size(), buildWrapper);
+        return LoweringRuleResultSubgraph{.root = probeWrapper, .leaves = {leaves}};
+    };
+
+    auto sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
+        windowType.getSize().getTime(),
+        windowType.getSlide().getTime(),
+        conf.sliceCacheConfiguration,
+        conf.sliceStoreRingCapacity.getValue());
+
+    /// Without grouping keys, there is a single group. Thus, each worker thread aggregates into its own states without a hash map,
+    /// and the probe combines the states of all worker threads directly.
+    if (boundGroupingKeys.empty())
+    {
+        auto sliceStoreRef = sliceAndWindowStore->createSliceStoreRef(
+            [](Slice& slice, const WorkerThreadId workerThreadId, AbstractBufferProvider& bufferProvider) -> const TupleBuffer*
+            {
+                auto& keylessSlice = dynamic_cast<KeylessAggregationSlice&>(slice);
+                return keylessSlice.getOrCreateStateBufferRefForWorker(bufferProvider, workerThreadId);
+            },
+            [sizeOfStatesInBytes = static_cast<uint64_t>(valueSize)](WindowBasedOperatorHandler& handler, AbstractBufferProvider&)
+            {
+                const CreateNewKeylessAggregationSliceArgs keylessSliceArgs{sizeOfStatesInBytes};
+                return handler.getCreateNewSlicesFunction(keylessSliceArgs);
+            });
+        const KeylessAggregationBuildPhysicalOperator build{
+            handlerId, std::move(timeFunction), std::move(sliceStoreRef), aggregationPhysicalFunctions};
+        const KeylessAggregationProbePhysicalOperator probe{aggregationPhysicalFunctions, handlerId, windowMetaData};
+        auto handler = std::make_shared<KeylessAggregationOperatorHandler>(
+            *inputOriginIds | std::ranges::to<std::vector>(),
+            outputOriginId,
+            std::move(sliceAndWindowStore),
+            std::chrono::milliseconds(conf.originIdleTimeoutInMs.getValue()));
+        return createSubgraph(build, probe, handler);
+    }
+
     /// Aggregation does not benefit of using the ChainedHashMap's optional filter, so bloomFilter stays empty.
     const ChainedHashMapConfig hashMapConfig{
         .entrySize = entrySize,
         .numberOfBuckets = numberOfBuckets,
         .pageSize = pageSize,
+        .maxLoadFactor = createMaxLoadFactor(conf),
+        .index = conf.hashMapIndex.getValue(),
+        .numberOfRadixPartitions = conf.aggregationProbePartitions.getValue(),
         .bloomFilterParams = std::nullopt,
         .fieldKeys = fieldKeys,
         .fieldValues = fieldValues,
         .hashFunction = std::make_shared<MurMur3HashFunction>()};
 
-    auto sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
-        windowType.getSize().getTime(), windowType.getSlide().getTime(), conf.sliceCacheConfiguration);
     auto sliceStoreRef = sliceAndWindowStore->createSliceStoreRef(
         [](Slice& slice, const WorkerThreadId workerThreadId, AbstractBufferProvider& bufferProvider) -> const TupleBuffer*
         {
@@ -214,33 +302,24 @@ LoweringRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOper
         });
     const AggregationBuildPhysicalOperator build{
         handlerId, std::move(timeFunction), std::move(sliceStoreRef), aggregationPhysicalFunctions, hashMapConfig, keyFunctions};
-    const AggregationProbePhysicalOperator probe{hashMapConfig, aggregationPhysicalFunctions, handlerId, windowMetaData};
+
+    /// Only overlapping windows share slices, so only they benefit from sharing partial aggregates
+    std::unique_ptr<SlidingWindowAggregates> slidingWindowAggregates;
+    if (conf.incrementalSlidingWindowAggregation.getValue() and windowType.getSlide().getTime() < windowType.getSize().getTime())
+    {
+        slidingWindowAggregates = std::make_unique<SlidingWindowAggregates>(
+            windowType.getSize().getTime(), windowType.getSlide().getTime(), hashMapConfig.numberOfRadixPartitions);
+    }
+    const AggregationProbePhysicalOperator probe{
+        hashMapConfig, aggregationPhysicalFunctions, handlerId, windowMetaData, slidingWindowAggregates != nullptr};
 
     auto handler = std::make_shared<AggregationOperatorHandler>(
-        *inputOriginIds | std::ranges::to<std::vector>(), outputOriginId, std::move(sliceAndWindowStore));
-    auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
-        build,
-        physicalInputSchema,
-        physicalOutputSchema,
-        memoryLayoutType,
-        memoryLayoutType,
-        handlerId,
-        handler,
-        PhysicalOperatorWrapper::PipelineLocation::EMIT);
-
-    auto probeWrapper = std::make_shared<PhysicalOperatorWrapper>(
-        probe,
-        physicalInputSchema,
-        physicalOutputSchema,
-        memoryLayoutType,
-        memoryLayoutType,
-        handlerId,
-        handler,
-        PhysicalOperatorWrapper::PipelineLocation::SCAN,
-        std::vector{buildWrapper});
-
-    /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
-    std::vector leaves(logicalOperator.getChildren().size(), buildWrapper);
-    return {.root = probeWrapper, .leaves = {leaves}};
+        *inputOriginIds | std::ranges::to<std::vector>(),
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        hashMapConfig.numberOfRadixPartitions,
+        std::move(slidingWindowAggregates),
+        std::chrono::milliseconds(conf.originIdleTimeoutInMs.getValue()));
+    return createSubgraph(build, probe, handler);
 }
 }
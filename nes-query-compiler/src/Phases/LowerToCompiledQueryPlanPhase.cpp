@@ -15,6 +15,8 @@
 #include <Phases/LowerToCompiledQueryPlanPhase.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <optional>
 #include <ranges>
@@ -96,9 +98,12 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
     /// strategy and the backend explicitly rather than relying on the "non-empty backend implies legacy" shortcut.
     options.setOption("engine.compilationStrategy", std::string("legacy"));
     options.setOption("engine.backend", std::string("mlir"));
-    switch (pipelineQueryPlan->getExecutionMode())
+    const auto executionMode = pipelineQueryPlan->getExecutionMode();
+    switch (executionMode)
     {
-        case ExecutionMode::COMPILER: {
+        case ExecutionMode::COMPILER:
+        case ExecutionMode::TIERED: {
+            /// The stage of a tiered pipeline derives the options of its interpreter from these.
             options.setOption("engine.Compilation", true);
             break;
         }
@@ -135,7 +140,53 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
             break;
     }
     options.setOption("dump.graph", dumpQueryCompilationIR.isDumpGraphEnabled());
-    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options);
+    const auto useCompiledPipelineCache = executionMode != ExecutionMode::INTERPRETER
+        and dumpQueryCompilationIR.getDumpOption() == DumpMode::Options::NONE and not dumpQueryCompilationIR.isDumpGraphEnabled();
+    INVARIANT(
+        executionMode != ExecutionMode::TIERED or backgroundCompiler,
+        "The TIERED execution mode requires a background compiler, which the query compiler only creates if it is its default mode");
+    auto stage = std::make_unique<CompiledExecutablePipelineStage>(
+        pipeline,
+        pipeline->getOperatorHandlers(),
+        options,
+        useCompiledPipelineCache ? compiledPipelineCache : nullptr,
+        executionMode == ExecutionMode::TIERED ? backgroundCompiler : nullptr);
+    if (executionMode == ExecutionMode::COMPILER and backgroundCompiler)
+    {
+        stagesToCompileAheadOfTime.emplace_back(pipeline->getPipelineId(), stage.get());
+    }
+    return stage;
+}
+
+std::vector<CompiledQueryPlan::PipelineCompilation> LowerToCompiledQueryPlanPhase::compileAheadOfTime()
+{
+    /// The compiled code of a pipeline looks up its successors and operator handlers at runtime, so the pipelines of a query do
+    /// not depend on each other during compilation.
+    std::vector<std::future<CompiledQueryPlan::PipelineCompilation>> compilations;
+    compilations.reserve(stagesToCompileAheadOfTime.size());
+    for (const auto& [pipelineId, stage] : stagesToCompileAheadOfTime)
+    {
+        auto compilation = std::make_shared<std::packaged_task<CompiledQueryPlan::PipelineCompilation()>>(
+            [pipelineId, stage]
+            {
+                const auto start = std::chrono::system_clock::now();
+                const auto compilationStart = std::chrono::steady_clock::now();
+                const auto reusedCompiledCode = stage->compileAheadOfTime();
+                return CompiledQueryPlan::PipelineCompilation{
+                    .pipelineId = pipelineId,
+                    .start = start,
+                    .duration = std::chrono::steady_clock::now() - compilationStart,
+                    .reusedCompiledCode = reusedCompiledCode};
+            });
+        compilations.emplace_back(compilation->get_future());
+        backgroundCompiler->submit([compilation] { (*compilation)(); });
+    }
+    /// All compilations reference stages of this plan, so they have to finish before a failure is rethrown.
+    for (const auto& compilation : compilations)
+    {
+        compilation.wait();
+    }
+    return compilations | std::views::transform([](auto& compilation) { return compilation.get(); }) | std::ranges::to<std::vector>();
 }
 
 std::shared_ptr<ExecutablePipeline> LowerToCompiledQueryPlanPhase::processOperatorPipeline(const std::shared_ptr<Pipeline>& pipeline)
@@ -169,9 +220,13 @@ std::unique_ptr<CompiledQueryPlan> LowerToCompiledQueryPlanPhase::apply(const st
         processSource(pipeline);
     }
 
+    auto pipelineCompilations = compileAheadOfTime();
     auto pipelines = std::move(pipelineToExecutableMap) | std::views::values | std::ranges::to<std::vector>();
 
-    return CompiledQueryPlan::create(pipelineQueryPlan->getQueryId(), std::move(pipelines), std::move(sinks), std::move(sources));
+    auto compiledQueryPlan
+        = CompiledQueryPlan::create(pipelineQueryPlan->getQueryId(), std::move(pipelines), std::move(sinks), std::move(sources));
+    compiledQueryPlan->pipelineCompilations = std::move(pipelineCompilations);
+    return compiledQueryPlan;
 }
 
 }
@@ -54,6 +54,8 @@ resolveLoweringRule(const LogicalOperator& logicalOperator, const LoweringRuleRe
                 }
                 throw UnknownOptimizerRule("Lowering rule for logical operator '{}' can't be resolved", logicalOperator.getName());
             }
+            /// The sort-merge join shares the build side and the slices with the NLJ, whose lowering rule selects the sorting probe
+            case JoinImplementation::SORT_MERGE_JOIN:
             case JoinImplementation::NESTED_LOOP_JOIN: {
                 if (const auto rule = LoweringRuleRegistry::instance().find(std::string("NLJoin")))
                 {
@@ -72,6 +74,20 @@ resolveLoweringRule(const LogicalOperator& logicalOperator, const LoweringRuleRe
     }
     throw UnknownOptimizerRule("Lowering rule for logical operator '{}' can't be resolved", logicalOperator.getName());
 }
+
+/// Records the logical operator at every physical operator of the subgraph it was lowered to, down to the leaves of the subgraph.
+void stampLoweredFrom(const std::shared_ptr<PhysicalOperatorWrapper>& wrapper, const LogicalOperator& logicalOperator)
+{
+    if (wrapper->getLoweredFrom().has_value())
+    {
+        return;
+    }
+    wrapper->setLoweredFrom(logicalOperator);
+    for (const auto& child : wrapper->getChildren())
+    {
+        stampLoweredFrom(child, logicalOperator);
+    }
+}
 }
 
 LoweringRuleResultSubgraph::SubGraphRoot
@@ -109,6 +125,7 @@ lowerOperatorRecursively(const LogicalOperator& logicalOperator, const LoweringR
         children.size(),
         leaves.size(),
         logicalOperator);
+    stampLoweredFrom(root, logicalOperator);
 
     std::ranges::for_each(
         std::views::zip(children, leaves),
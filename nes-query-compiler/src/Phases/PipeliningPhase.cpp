@@ -14,6 +14,7 @@
 
 #include <Phases/PipeliningPhase.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -38,6 +39,8 @@
 #include <Schema/SchemaFwd.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/Strings.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
 #include <EmitOperatorHandler.hpp>
 #include <EmitPhysicalOperator.hpp>
 #include <ErrorHandling.hpp>
@@ -45,6 +48,7 @@
 #include <PhysicalOperator.hpp>
 #include <PhysicalPlan.hpp>
 #include <Pipeline.hpp>
+#include <PipelineFingerprint.hpp>
 #include <PipelinedQueryPlan.hpp>
 #include <ScanPhysicalOperator.hpp>
 #include <SinkPhysicalOperator.hpp>
@@ -87,11 +91,37 @@ MergePointSet findMergePoints(const std::vector<std::shared_ptr<PhysicalOperator
     return mergePoints;
 }
 
+/// Fingerprint of an operator produced by the lowering, which is fully described by its logical operator, schemas, and layouts.
+PipelineFingerprint::Operator fingerprintOf(const PhysicalOperatorWrapper& wrapper)
+{
+    return PipelineFingerprint::Operator{
+        .physicalOperator = wrapper.getPhysicalOperator().toString(),
+        .loweredFrom = wrapper.getLoweredFrom(),
+        .inputSchema = wrapper.getInputSchema(),
+        .outputSchema = wrapper.getOutputSchema(),
+        .inputMemoryLayoutType = wrapper.getInputMemoryLayoutType(),
+        .outputMemoryLayoutType = wrapper.getOutputMemoryLayoutType(),
+        .parameters = {},
+        .operatorHandlerId = wrapper.getHandlerId()};
+}
+
+void appendOperator(Pipeline& pipeline, const PhysicalOperatorWrapper& wrapper)
+{
+    pipeline.appendOperator(wrapper.getPhysicalOperator());
+    pipeline.getFingerprint().append(fingerprintOf(wrapper));
+}
+
+struct ScanOperator
+{
+    PhysicalOperator scan;
+    PipelineFingerprint::Operator fingerprint;
+};
+
 /// Helper function to add a default scan operator
 /// This is used only when the wrapped operator does not already provide a scan
 /// @note Once we have refactored the memory layout and schema we can get rid of the configured buffer size.
 /// Do not add further parameters here that should be part of the QueryExecutionConfiguration.
-PhysicalOperator createScanOperator(
+ScanOperator createScanOperator(
     const Pipeline& prevPipeline,
     const std::optional<Schema<QualifiedUnboundField, Ordered>>& inputSchema,
     const std::optional<MemoryLayoutType>& memoryLayout,
@@ -123,16 +153,41 @@ PhysicalOperator createScanOperator(
                 = *prevPipeline.getRootOperator().get<SourceDescriptorPhysicalOperator>().getDescriptor().getLogicalSource().getSchema();
             const auto sourceMemoryProvider
                 = LowerSchemaProvider::lowerSchema(configuredBufferSize, sourceLogicalSchema, memoryLayout.value());
-            return ScanPhysicalOperator(
+            PhysicalOperator scan = ScanPhysicalOperator(
                 provideInputFormatter(inputFormatterConfig, sourceMemoryProvider),
                 inputSchema.value() | std::views::transform([](const auto& field) { return field.getFullyQualifiedName(); })
                     | std::ranges::to<std::vector>());
+            auto fingerprint = PipelineFingerprint::Operator{
+                .physicalOperator = scan.toString(),
+                .loweredFrom = std::nullopt,
+                .inputSchema = std::nullopt,
+                .outputSchema = inputSchema,
+                .inputMemoryLayoutType = std::nullopt,
+                .outputMemoryLayoutType = memoryLayout,
+                .parameters = fmt::format(
+                    "bufferSize: {}, inputFormatter: {} {}, sourceSchema: {}",
+                    configuredBufferSize,
+                    inputFormatterConfig.getInputFormatterType(),
+                    inputFormatterConfig,
+                    sourceLogicalSchema),
+                .operatorHandlerId = std::nullopt};
+            return {.scan = std::move(scan), .fingerprint = std::move(fingerprint)};
         }
     }
-    return ScanPhysicalOperator(
+    PhysicalOperator scan = ScanPhysicalOperator(
         memoryProvider,
         *inputSchema | std::views::transform([](const auto& field) { return field.getFullyQualifiedName(); })
             | std::ranges::to<std::vector>());
+    auto fingerprint = PipelineFingerprint::Operator{
+        .physicalOperator = scan.toString(),
+        .loweredFrom = std::nullopt,
+        .inputSchema = std::nullopt,
+        .outputSchema = inputSchema,
+        .inputMemoryLayoutType = std::nullopt,
+        .outputMemoryLayoutType = memoryLayout,
+        .parameters = fmt::format("bufferSize: {}", configuredBufferSize),
+        .operatorHandlerId = std::nullopt};
+    return {.scan = std::move(scan), .fingerprint = std::move(fingerprint)};
 }
 
 /// Creates a new pipeline that contains a scan followed by the wrappedOpAfterScan. The newly created pipeline is a successor of the prevPipeline
@@ -142,11 +197,13 @@ std::shared_ptr<Pipeline> createNewPipelineWithScan(
     const PhysicalOperatorWrapper& wrappedOpAfterScan,
     const uint64_t configuredBufferSize)
 {
-    const auto newPipeline = std::make_shared<Pipeline>(createScanOperator(
-        *prevPipeline, wrappedOpAfterScan.getInputSchema(), wrappedOpAfterScan.getInputMemoryLayoutType(), configuredBufferSize));
+    auto [scan, scanFingerprint] = createScanOperator(
+        *prevPipeline, wrappedOpAfterScan.getInputSchema(), wrappedOpAfterScan.getInputMemoryLayoutType(), configuredBufferSize);
+    const auto newPipeline = std::make_shared<Pipeline>(std::move(scan));
+    newPipeline->getFingerprint().append(std::move(scanFingerprint));
     prevPipeline->addSuccessor(newPipeline, prevPipeline);
     pipelineMap[wrappedOpAfterScan.getPhysicalOperator().getId()] = newPipeline;
-    newPipeline->appendOperator(wrappedOpAfterScan.getPhysicalOperator());
+    appendOperator(*newPipeline, wrappedOpAfterScan);
     return newPipeline;
 }
 
@@ -167,7 +224,17 @@ void addDefaultEmit(
     /// Create an operator handler for the emit
     const OperatorHandlerId operatorHandlerIndex = getNextOperatorHandlerId();
     pipeline->getOperatorHandlers().emplace(operatorHandlerIndex, std::make_shared<EmitOperatorHandler>());
-    pipeline->appendOperator(EmitPhysicalOperator(operatorHandlerIndex, bufferRef));
+    const PhysicalOperator emit = EmitPhysicalOperator(operatorHandlerIndex, bufferRef);
+    pipeline->appendOperator(emit);
+    pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+        .physicalOperator = emit.toString(),
+        .loweredFrom = std::nullopt,
+        .inputSchema = schema,
+        .outputSchema = std::nullopt,
+        .inputMemoryLayoutType = memoryLayoutType,
+        .outputMemoryLayoutType = std::nullopt,
+        .parameters = fmt::format("bufferSize: {}", configuredBufferSize),
+        .operatorHandlerId = operatorHandlerIndex});
 }
 
 /// Helper functions to add an emit operator that also performs output formatting. A sink should follow such emit operators at all times, since
@@ -188,7 +255,22 @@ void addOutputFormattingEmit(
     /// Create an operator handler for the emit
     const OperatorHandlerId operatorHandlerIndex = getNextOperatorHandlerId();
     pipeline->getOperatorHandlers().emplace(operatorHandlerIndex, std::make_shared<EmitOperatorHandler>());
-    pipeline->appendOperator(EmitPhysicalOperator(operatorHandlerIndex, bufferRef));
+    const PhysicalOperator emit = EmitPhysicalOperator(operatorHandlerIndex, bufferRef);
+    pipeline->appendOperator(emit);
+
+    /// Sorted, as the iteration order of the config depends on its insertion history.
+    auto configEntries = config | std::views::transform([](const auto& entry) { return fmt::format("{}={}", entry.first, entry.second); })
+        | std::ranges::to<std::vector>();
+    std::ranges::sort(configEntries);
+    pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+        .physicalOperator = emit.toString(),
+        .loweredFrom = std::nullopt,
+        .inputSchema = schema,
+        .outputSchema = std::nullopt,
+        .inputMemoryLayoutType = std::nullopt,
+        .outputMemoryLayoutType = std::nullopt,
+        .parameters = fmt::format("bufferSize: {}, outputFormat: {}, config: {}", configuredBufferSize, outputFormat, configEntries),
+        .operatorHandlerId = operatorHandlerIndex});
 }
 
 enum class PipelinePolicy : uint8_t
@@ -247,6 +329,7 @@ void buildPipelineRecursively(
             addDefaultEmit(currentPipeline, *prevOpWrapper, configuredBufferSize);
         }
         auto newPipeline = std::make_shared<Pipeline>(opWrapper->getPhysicalOperator());
+        newPipeline->getFingerprint().append(fingerprintOf(*opWrapper));
         if (opWrapper->getHandler() && opWrapper->getHandlerId())
         {
             newPipeline->getOperatorHandlers().emplace(opWrapper->getHandlerId().value(), opWrapper->getHandler().value());
@@ -286,7 +369,7 @@ void buildPipelineRecursively(
         }
         else
         {
-            currentPipeline->appendOperator(opWrapper->getPhysicalOperator());
+            appendOperator(*currentPipeline, *opWrapper);
             if (opWrapper->getHandler() && opWrapper->getHandlerId())
             {
                 currentPipeline->getOperatorHandlers().emplace(opWrapper->getHandlerId().value(), opWrapper->getHandler().value());
@@ -319,7 +402,7 @@ void buildPipelineRecursively(
             /// The sink would output these buffers (out of order if the engine uses multiple threads), producing malformed data
             if (not(sourceFormat == "NATIVE" and toUpperCase(sinkFormat) == "NATIVE"))
             {
-                const auto sourcePipeline = std::make_shared<Pipeline>(createScanOperator(
+                auto [scan, scanFingerprint] = createScanOperator(
                     *currentPipeline,
                     *currentPipeline->getRootOperator()
                          .get<SourceDescriptorPhysicalOperator>()
@@ -327,7 +410,9 @@ void buildPipelineRecursively(
                          .getLogicalSource()
                          .getSchema(),
                     opWrapper->getInputMemoryLayoutType(),
-                    configuredBufferSize));
+                    configuredBufferSize);
+                const auto sourcePipeline = std::make_shared<Pipeline>(std::move(scan));
+                sourcePipeline->getFingerprint().append(std::move(scanFingerprint));
                 currentPipeline->addSuccessor(sourcePipeline, currentPipeline);
 
                 if (toUpperCase(sinkFormat) == "NATIVE")
@@ -399,9 +484,11 @@ void buildPipelineRecursively(
     {
         if (prevOpWrapper and prevOpWrapper->getPipelineLocation() != PhysicalOperatorWrapper::PipelineLocation::EMIT)
         {
-            addDefaultEmit(currentPipeline, *opWrapper, configuredBufferSize);
+            /// The emit writes the output of the previous operator, in the layout that the scan of the new pipeline expects.
+            addDefaultEmit(currentPipeline, *prevOpWrapper, configuredBufferSize);
         }
         const auto newPipeline = std::make_shared<Pipeline>(opWrapper->getPhysicalOperator());
+        newPipeline->getFingerprint().append(fingerprintOf(*opWrapper));
         if (auto handlerId = opWrapper->getHandlerId())
         {
             newPipeline->getOperatorHandlers().emplace(*handlerId, opWrapper->getHandler().value());
@@ -410,8 +497,10 @@ void buildPipelineRecursively(
         const auto newPipelinePtr = currentPipeline->getSuccessors().back();
         pipelineMap[opId] = newPipelinePtr;
         PRECONDITION(newPipelinePtr->isOperatorPipeline(), "Only add scan physical operator to operator pipelines");
-        newPipelinePtr->prependOperator(
-            createScanOperator(*currentPipeline, opWrapper->getInputSchema(), opWrapper->getInputMemoryLayoutType(), configuredBufferSize));
+        auto [scan, scanFingerprint] = createScanOperator(
+            *currentPipeline, opWrapper->getInputSchema(), opWrapper->getInputMemoryLayoutType(), configuredBufferSize);
+        newPipelinePtr->prependOperator(std::move(scan));
+        newPipelinePtr->getFingerprint().prepend(std::move(scanFingerprint));
         for (auto& child : opWrapper->getChildren())
         {
             buildPipelineRecursively(
@@ -429,7 +518,7 @@ void buildPipelineRecursively(
     }
     else
     {
-        currentPipeline->appendOperator(opWrapper->getPhysicalOperator());
+        appendOperator(*currentPipeline, *opWrapper);
     }
 
     if (opWrapper->getHandler() && opWrapper->getHandlerId())
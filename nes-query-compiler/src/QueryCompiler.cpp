@@ -16,10 +16,14 @@
 #include <QueryCompiler.hpp>
 
 #include <memory>
+#include <utility>
 #include <Configuration/WorkerConfiguration.hpp>
 #include <Phases/LowerToCompiledQueryPlanPhase.hpp>
 #include <Phases/LowerToPhysicalOperators.hpp>
 #include <Phases/PipeliningPhase.hpp>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
+#include <Util/ExecutionMode.hpp>
 #include <Util/DumpMode.hpp>
 #include <CompiledQueryPlan.hpp>
 #include <ErrorHandling.hpp>
@@ -27,10 +31,26 @@
 namespace NES::QueryCompilation
 {
 
+QueryCompiler::QueryCompiler(QueryExecutionConfiguration defaultQueryExecution)
+    : defaultQueryExecution(std::move(defaultQueryExecution))
+    , compiledPipelineCache(
+          this->defaultQueryExecution.compiledPipelineCacheSize.getValue() > 0
+              ? std::make_shared<CompiledPipelineCache>(this->defaultQueryExecution.compiledPipelineCacheSize.getValue())
+              : nullptr)
+    , backgroundCompiler(
+          this->defaultQueryExecution.executionMode.getValue() == ExecutionMode::TIERED
+                  or (this->defaultQueryExecution.executionMode.getValue() == ExecutionMode::COMPILER
+                      and this->defaultQueryExecution.compileAheadOfTime.getValue())
+              ? std::make_shared<BackgroundCompiler>(this->defaultQueryExecution.backgroundCompilationThreads.getValue())
+              : nullptr)
+{
+}
+
 /// This phase should be as dumb as possible and not further decisions should be made here.
 std::unique_ptr<CompiledQueryPlan> QueryCompiler::compileQuery(std::unique_ptr<QueryCompilationRequest> request)
 {
-    auto lowerToCompiledQueryPlanPhase = LowerToCompiledQueryPlanPhase(request->dumpCompilationResult);
+    auto lowerToCompiledQueryPlanPhase
+        = LowerToCompiledQueryPlanPhase(request->dumpCompilationResult, compiledPipelineCache, backgroundCompiler);
     auto queryPlan = LowerToPhysicalOperators::apply(request->queryPlan, defaultQueryExecution);
     auto pipelinedQueryPlan = PipeliningPhase::apply(queryPlan);
     return lowerToCompiledQueryPlanPhase.apply(pipelinedQueryPlan);
@@ -0,0 +1,218 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/UnboundField.hpp>
+#include <Identifiers/Identifier.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Identifiers/QualifiedIdentifier.hpp>
+#include <Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Phases/LowerToCompiledQueryPlanPhase.hpp>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/DumpMode.hpp>
+#include <Util/ExecutionMode.hpp>
+#include <Util/UUID.hpp>
+#include <CompiledQueryPlan.hpp>
+#include <EmitOperatorHandler.hpp>
+#include <EmitPhysicalOperator.hpp>
+#include <InputFormatterDescriptor.hpp>
+#include <PhysicalOperator.hpp>
+#include <Pipeline.hpp>
+#include <PipelineFingerprint.hpp>
+#include <PipelinedQueryPlan.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <SinkPhysicalOperator.hpp>
+#include <SourceDescriptorPhysicalOperator.hpp>
+
+namespace NES
+{
+namespace
+{
+
+constexpr size_t BUFFER_SIZE = 4096;
+
+class LowerToCompiledQueryPlanPhaseTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite() { Logger::setupLogging("LowerToCompiledQueryPlanPhaseTest.log", LogLevel::LOG_DEBUG); }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static Schema<UnqualifiedUnboundField, Ordered> createSchema()
+    {
+        return Schema<UnqualifiedUnboundField, Ordered>{
+            {Identifier::parse("id"), DataTypeProvider::provideDataType(DataType::Type::UINT64)},
+            {Identifier::parse("value"), DataTypeProvider::provideDataType(DataType::Type::UINT64)}};
+    }
+
+    /// Creates a Scan -> Emit pipeline and records its fingerprint like the pipelining phase does. Pipelines created with different
+    /// operator handler ids are structurally equal.
+    static std::shared_ptr<Pipeline> makeOperatorPipeline(const OperatorHandlerId emitHandlerId)
+    {
+        const auto schema = createSchema();
+        const auto bufferRef = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, schema, MemoryLayoutType::ROW_LAYOUT);
+        auto fields = schema
+            | std::views::transform([](const UnqualifiedUnboundField& field)
+                                    { return static_cast<QualifiedIdentifier>(field.getFullyQualifiedName()); })
+            | std::ranges::to<std::vector>();
+        const PhysicalOperator emit = EmitPhysicalOperator(emitHandlerId, bufferRef);
+        ScanPhysicalOperator scan(bufferRef, std::move(fields));
+        scan.setChild(emit);
+
+        auto pipeline = std::make_shared<Pipeline>(PhysicalOperator(scan));
+        pipeline->getOperatorHandlers().emplace(emitHandlerId, std::make_shared<EmitOperatorHandler>());
+        pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+            .physicalOperator = PhysicalOperator(scan).toString(),
+            .loweredFrom = std::nullopt,
+            .inputSchema = std::nullopt,
+            .outputSchema = std::nullopt,
+            .inputMemoryLayoutType = std::nullopt,
+            .outputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+            .parameters = fmt::format("bufferSize: {}", BUFFER_SIZE),
+            .operatorHandlerId = std::nullopt});
+        pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+            .physicalOperator = emit.toString(),
+            .loweredFrom = std::nullopt,
+            .inputSchema = std::nullopt,
+            .outputSchema = std::nullopt,
+            .inputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+            .outputMemoryLayoutType = std::nullopt,
+            .parameters = fmt::format("bufferSize: {}", BUFFER_SIZE),
+            .operatorHandlerId = emitHandlerId});
+        return pipeline;
+    }
+
+    /// Creates the plan Source -> Scan/Emit -> Scan/Emit -> Sink.
+    std::shared_ptr<PipelinedQueryPlan> makeQueryPlan(const ExecutionMode executionMode)
+    {
+        const auto schema = createSchema();
+        auto sourceDescriptor = sourceCatalog.getAnonymousSource(
+            Identifier::parse("File"),
+            schema,
+            Host("localhost"),
+            {{Identifier::parse(InputFormatterDescriptor::getTypeString()), "CSV"}},
+            {{Identifier::parse("file_path"), "/dev/null"}});
+        EXPECT_TRUE(sourceDescriptor.has_value());
+        auto sinkDescriptor = sinkCatalog.getAnonymousSink(
+            schema, Identifier::parse("Print"), Host("localhost"), {{Identifier::parse("output_format"), "CSV"}}, {});
+        EXPECT_TRUE(sinkDescriptor.has_value());
+
+        /// NOLINTBEGIN(bugprone-unchecked-optional-access)
+        auto source = std::make_shared<Pipeline>(SourceDescriptorPhysicalOperator(std::move(sourceDescriptor.value()), OriginId(1)));
+        auto sink = std::make_shared<Pipeline>(SinkPhysicalOperator(sinkDescriptor.value()));
+        /// NOLINTEND(bugprone-unchecked-optional-access)
+        auto first = makeOperatorPipeline(OperatorHandlerId(nextOperatorHandlerId++));
+        auto second = makeOperatorPipeline(OperatorHandlerId(nextOperatorHandlerId++));
+        source->addSuccessor(first, source);
+        first->addSuccessor(second, first);
+        second->addSuccessor(sink, second);
+
+        auto plan = std::make_shared<PipelinedQueryPlan>(QueryId::createLocal(LocalQueryId(generateUUID())), executionMode);
+        for (const auto& pipeline : {source, first, second, sink})
+        {
+            plan->addPipeline(pipeline);
+        }
+        return plan;
+    }
+
+    static std::vector<PipelineId> operatorPipelineIds(const PipelinedQueryPlan& plan)
+    {
+        return plan.getPipelines() | std::views::filter([](const auto& pipeline) { return pipeline->isOperatorPipeline(); })
+            | std::views::transform([](const auto& pipeline) { return pipeline->getPipelineId(); }) | std::ranges::to<std::vector>();
+    }
+
+    static std::vector<PipelineId> compiledPipelineIds(const CompiledQueryPlan& compiledQueryPlan)
+    {
+        return compiledQueryPlan.pipelineCompilations
+            | std::views::transform([](const auto& compilation) { return compilation.pipelineId; }) | std::ranges::to<std::vector>();
+    }
+
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    uint64_t nextOperatorHandlerId = 1;
+    const DumpMode noDump{DumpMode::Options::NONE, false};
+};
+
+TEST_F(LowerToCompiledQueryPlanPhaseTest, CompilesEveryOperatorPipelineAheadOfTime)
+{
+    const auto plan = makeQueryPlan(ExecutionMode::COMPILER);
+    const auto compiledQueryPlan = LowerToCompiledQueryPlanPhase(noDump, nullptr, std::make_shared<BackgroundCompiler>(2)).apply(plan);
+
+    EXPECT_EQ(compiledQueryPlan->pipelines.size(), 2);
+    auto compiledIds = compiledPipelineIds(*compiledQueryPlan);
+    auto expectedIds = operatorPipelineIds(*plan);
+    std::ranges::sort(compiledIds);
+    std::ranges::sort(expectedIds);
+    EXPECT_EQ(compiledIds, expectedIds);
+    EXPECT_TRUE(std::ranges::none_of(compiledQueryPlan->pipelineCompilations, &CompiledQueryPlan::PipelineCompilation::reusedCompiledCode));
+}
+
+TEST_F(LowerToCompiledQueryPlanPhaseTest, ReusesPipelinesCompiledAheadOfTimeByAnEarlierQuery)
+{
+    const auto compiledPipelineCache = std::make_shared<CompiledPipelineCache>(4);
+    const auto backgroundCompiler = std::make_shared<BackgroundCompiler>(1);
+    const auto firstQuery
+        = LowerToCompiledQueryPlanPhase(noDump, compiledPipelineCache, backgroundCompiler).apply(makeQueryPlan(ExecutionMode::COMPILER));
+    ASSERT_EQ(firstQuery->pipelineCompilations.size(), 2);
+    /// The single background thread compiles the pipelines of a query one after the other, thus the second reuses the first
+    EXPECT_FALSE(firstQuery->pipelineCompilations.front().reusedCompiledCode);
+    EXPECT_TRUE(firstQuery->pipelineCompilations.back().reusedCompiledCode);
+
+    /// The pipelines of the second query use other operator handler ids, but are structurally equal
+    const auto secondQuery
+        = LowerToCompiledQueryPlanPhase(noDump, compiledPipelineCache, backgroundCompiler).apply(makeQueryPlan(ExecutionMode::COMPILER));
+    ASSERT_EQ(secondQuery->pipelineCompilations.size(), 2);
+    EXPECT_TRUE(std::ranges::all_of(secondQuery->pipelineCompilations, &CompiledQueryPlan::PipelineCompilation::reusedCompiledCode));
+    EXPECT_EQ(compiledPipelineCache->getStatistics().hits, 3);
+}
+
+TEST_F(LowerToCompiledQueryPlanPhaseTest, CompilesOnStartWithoutBackgroundCompiler)
+{
+    const auto compiledQueryPlan = LowerToCompiledQueryPlanPhase(noDump).apply(makeQueryPlan(ExecutionMode::COMPILER));
+    EXPECT_EQ(compiledQueryPlan->pipelines.size(), 2);
+    EXPECT_TRUE(compiledQueryPlan->pipelineCompilations.empty());
+}
+
+TEST_F(LowerToCompiledQueryPlanPhaseTest, TieredPipelinesAreNotCompiledAheadOfTime)
+{
+    const auto backgroundCompiler = std::make_shared<BackgroundCompiler>(1);
+    const auto compiledQueryPlan
+        = LowerToCompiledQueryPlanPhase(noDump, nullptr, backgroundCompiler).apply(makeQueryPlan(ExecutionMode::TIERED));
+    EXPECT_EQ(compiledQueryPlan->pipelines.size(), 2);
+    EXPECT_TRUE(compiledQueryPlan->pipelineCompilations.empty());
+}
+
+}
+}
@@ -69,6 +69,9 @@ namespace
 constexpr auto PIPELINE_STOP_BACKOFF_INTERVAL = std::chrono::milliseconds(25);
 constexpr auto PIPELINE_STOP_BACKOFF_THRESHOLD = 2;
 
+/// Maximum number of tasks a worker thread executes inline on behalf of a single task it took from the queue.
+constexpr size_t INLINE_CONTINUATION_BUDGET = 64;
+
 /// This function is unsafe because it requires the lifetime of the RunningQueryPlanNode exceed the lifetime of the callback
 auto injectQueryFailureUnsafe(RunningQueryPlanNode& node, TaskCallback::onFailure failure)
 {
@@ -340,6 +343,13 @@ public:
         switch (continuationPolicy)
         {
             case PipelineExecutionContext::ContinuationPolicy::POSSIBLE:
+                if (WorkerThread::inlineContinuationDepth < maxInlineContinuationDepth and WorkerThread::inlineContinuationBudget > 0)
+                {
+                    continueInline(std::move(task));
+                    return true;
+                }
+                addInternalTask(std::move(task));
+                return true;
             case PipelineExecutionContext::ContinuationPolicy::NEVER:
                 addInternalTask(std::move(task));
                 return true;
@@ -409,11 +419,14 @@ public:
         std::shared_ptr<AbstractQueryStatusListener> listener,
         std::shared_ptr<QueryEngineStatisticListener> stats,
         std::shared_ptr<AbstractBufferProvider> bufferProvider,
-        const size_t admissionQueueSize)
+        const size_t admissionQueueSize,
+        const size_t numberOfLocalQueues,
+        const size_t maxInlineContinuationDepth)
         : listener(std::move(listener))
         , statistic(std::move(stats))
         , bufferProvider(std::move(bufferProvider))
-        , taskQueue(admissionQueueSize)
+        , maxInlineContinuationDepth(maxInlineContinuationDepth)
+        , taskQueue(admissionQueueSize, numberOfLocalQueues)
         , delayedTaskSubmitter([this](Task&& task) noexcept { taskQueue.addInternalTaskNonBlocking(std::move(task)); })
     {
     }
@@ -428,6 +441,13 @@ public:
     struct WorkerThread
     {
         static thread_local WorkerThreadId id;
+        /// Index of the local task queue owned by this thread. Only set for WorkerThreads in work stealing mode.
+        static thread_local std::optional<size_t> localQueue;
+        /// Number of tasks the thread currently executes inline, on top of the task it took from the queue.
+        static thread_local size_t inlineContinuationDepth;
+        /// Number of tasks the thread may still execute inline, before the task it took from the queue completes.
+        /// Only worker threads that are not terminating receive a budget.
+        static thread_local size_t inlineContinuationBudget;
 
         [[nodiscard]] WorkerThread(ThreadPool& pool, bool terminating) : pool(pool), terminating(terminating) { }
 
@@ -448,9 +468,25 @@ public:
     };
 
 private:
+    /// Executes the task on the calling worker thread, while the pipeline that emitted its buffer is still running. This saves the
+    /// round-trip through the task queue, and the buffer is processed while it is still in the cache of the worker.
+    void continueInline(WorkTask&& task)
+    {
+        --WorkerThread::inlineContinuationBudget;
+        ++WorkerThread::inlineContinuationDepth;
+        /// handleTask does not throw, failures of the task are reported via its callback.
+        handleTask(WorkerThread{*this, false}, std::move(task));
+        --WorkerThread::inlineContinuationDepth;
+    }
+
     void addInternalTask(Task&& task)
     {
         PRECONDITION(ThreadPool::WorkerThread::id != INVALID<WorkerThreadId>, "This should only be called from a worker thread");
+        if (WorkerThread::localQueue)
+        {
+            taskQueue.addLocalTaskNonBlocking(*WorkerThread::localQueue, std::move(task));
+            return;
+        }
         taskQueue.addInternalTaskNonBlocking(std::move(task)); /// NOLINT no move will happen if tryWriteUntil has failed
     }
 
@@ -459,6 +495,7 @@ private:
     std::shared_ptr<QueryEngineStatisticListener> statistic;
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
     std::atomic<TaskId::Underlying> taskIdCounter;
+    size_t maxInlineContinuationDepth;
 
     TaskQueue<Task> taskQueue;
     DelayedTaskSubmitter<> delayedTaskSubmitter;
@@ -474,6 +511,9 @@ private:
 
 /// Marks every Thread which has not explicitly been created by the ThreadPool as a non-worker thread
 thread_local WorkerThreadId ThreadPool::WorkerThread::id = INVALID<WorkerThreadId>;
+thread_local std::optional<size_t> ThreadPool::WorkerThread::localQueue = std::nullopt;
+thread_local size_t ThreadPool::WorkerThread::inlineContinuationDepth = 0;
+thread_local size_t ThreadPool::WorkerThread::inlineContinuationBudget = 0;
 
 bool ThreadPool::WorkerThread::operator()(WorkTask& task) const
 {
@@ -747,19 +787,27 @@ void ThreadPool::addThread(const Host& host)
         [this, id = numberOfThreads_++](const std::stop_token& stopToken)
         {
             WorkerThread::id = WorkerThreadId(WorkerThreadId::INITIAL + id);
+            if (static_cast<size_t>(id) < taskQueue.numberOfLocalQueues())
+            {
+                WorkerThread::localQueue = static_cast<size_t>(id);
+            }
             const WorkerThread worker{*this, false};
             while (!stopToken.stop_requested())
             {
-                if (auto task = taskQueue.getNextTaskBlocking(stopToken))
+                if (auto task = taskQueue.getNextTaskBlocking(stopToken, WorkerThread::localQueue))
                 {
+                    /// Bounds the work a single task can pull onto this thread, e.g., if its pipeline emits many buffers,
+                    /// so that other tasks in the queue are not starved.
+                    WorkerThread::inlineContinuationBudget = INLINE_CONTINUATION_BUDGET;
                     handleTask(worker, std::move(*task));
                 }
             }
+            WorkerThread::inlineContinuationBudget = 0;
 
             ENGINE_LOG_INFO("WorkerThread {} shutting down", id);
             /// Worker in termination mode will not emit further work and eventually clear the task queue and terminate.
             const WorkerThread terminatingWorker{*this, true};
-            while (auto task = taskQueue.getNextTaskNonBlocking())
+            while (auto task = taskQueue.getNextTaskNonBlocking(WorkerThread::localQueue))
             {
                 handleTask(terminatingWorker, std::move(*task));
             }
@@ -776,7 +824,13 @@ QueryEngine::QueryEngine(
     , statusListener(std::move(listener))
     , statisticListener(std::move(statListener))
     , queryCatalog(std::make_shared<QueryCatalog>())
-    , threadPool(std::make_unique<ThreadPool>(statusListener, statisticListener, bufferManager, config.admissionQueueSize.getValue()))
+    , threadPool(std::make_unique<ThreadPool>(
+          statusListener,
+          statisticListener,
+          bufferManager,
+          config.admissionQueueSize.getValue(),
+          config.workStealing.getValue() ? config.numberOfWorkerThreads.getValue() : 0,
+          config.maxInlineContinuationDepth.getValue()))
     , host(host)
 {
     for (size_t i = 0; i < config.numberOfWorkerThreads.getValue(); ++i)
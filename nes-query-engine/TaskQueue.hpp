@@ -16,10 +16,14 @@
 
 #include <chrono>
 #include <cstddef>
+#include <deque>
+#include <mutex>
+#include <new>
 #include <optional>
 #include <semaphore>
 #include <stop_token>
 #include <utility>
+#include <vector>
 #include <folly/MPMCQueue.h>
 #include <folly/concurrency/UnboundedQueue.h>
 
@@ -31,39 +35,108 @@ namespace NES
 /// internal queue, which is unbounded to deal with occasionally bursty loads like a large join. Access to the internal task queue is always
 /// non-blocking. The TaskQueue exposes a blocking `getNextTaskBlocking` method which reads from either queue without spinning and is
 /// supposed to be used by the worker threads.
+///
+/// Optionally, the TaskQueue maintains one local queue per WorkerThread (work stealing mode). WorkerThreads push the tasks they produce
+/// into their own local queue and pop from its back, which keeps successor tasks on the thread that produced their input and avoids
+/// contention on the shared internal queue. Idle WorkerThreads steal from the front of their peers' local queues. The shared internal
+/// queue remains available for threads which do not own a local queue, e.g., the DelayedTaskSubmitter.
 template <typename TaskType>
 class TaskQueue
 {
+    /// Each local queue is placed on its own cache line to prevent false sharing between neighbouring WorkerThreads.
+    struct alignas(std::hardware_destructive_interference_size) LocalQueue
+    {
+        std::mutex mutex;
+        std::deque<TaskType> tasks;
+    };
+
     folly::UMPMCQueue<TaskType, true> internal;
     folly::MPMCQueue<TaskType> admission;
-
-    /// INVARIANT: internal.size() + admission.size() >= tasksAvailable
+    std::vector<LocalQueue> localQueues;
+
+    /// INVARIANT: internal.size() + admission.size() + sum(localQueues.tasks.size()) >= tasksAvailable
+    ///
+    /// In work stealing mode the semaphore remains global instead of signalling the owner of a local queue. A task in a local queue is
+    /// meant to be stolen by whichever WorkerThread is idle, so one permit per task, which wakes any one blocked WorkerThread, is the
+    /// signal stealing needs, and the owner still prefers its own local queue once it asks for its next task. Parking and unparking
+    /// individual WorkerThreads would have to pick a thread to wake for every task and hand the wakeup on to a peer whenever the chosen
+    /// thread is busy, while the permits already guarantee that every woken thread finds a task in one of the queues.
     std::counting_semaphore<> tasksAvailable{0};
 
     /// To provide cancellation, we only block for StopTokenCheckInterval.
     /// This parameter could be tuned to allow for more timely cancellation
     static constexpr std::chrono::milliseconds StopTokenCheckInterval{100};
 
-    TaskType readElementAssumingItExists()
+    /// The owner of a local queue takes the most recently produced task, as its input is most likely still in cache.
+    bool tryPopLocal(size_t worker, TaskType& task)
+    {
+        auto& local = localQueues[worker];
+        const std::scoped_lock lock(local.mutex);
+        if (local.tasks.empty())
+        {
+            return false;
+        }
+        task = std::move(local.tasks.back());
+        local.tasks.pop_back();
+        return true;
+    }
+
+    /// Thieves take the oldest task of a peer, starting with the next peer to spread steals across all local queues.
+    bool trySteal(size_t thief, TaskType& task)
+    {
+        for (size_t offset = 1; offset <= localQueues.size(); ++offset)
+        {
+            auto& victim = localQueues[(thief + offset) % localQueues.size()];
+            const std::unique_lock lock(victim.mutex, std::try_to_lock);
+            if (lock.owns_lock() and not victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TaskType readElementAssumingItExists(std::optional<size_t> worker)
     {
         TaskType task;
-        /// The semaphore guarantees that there is at least one element in either one of the queues.
-        if (internal.try_dequeue(task))
+        if (localQueues.empty())
         {
+            /// The semaphore guarantees that there is at least one element in either one of the queues.
+            if (internal.try_dequeue(task))
+            {
+                return task;
+            }
+
+            /// However, the MPMC `read` can spuriously fail under high contention, the alternative `readIfNotEmpty` does not but is
+            /// significantly slower.
+            while (!admission.read(task)) [[unlikely]]
+            {
+            }
+
             return task;
         }
 
-        /// However, the MPMC `read` can spuriously fail under high contention, the alternative `readIfNotEmpty` does not but is
-        /// significantly slower.
-        while (!admission.read(task)) [[unlikely]]
+        /// The semaphore guarantees that there is at least one element in one of the queues. Every consumer holds a permit for exactly
+        /// one element, but the element might sit in a queue that was locked by a thief or the owner during the first pass.
+        const size_t thief = worker.value_or(0);
+        while (true)
         {
+            if ((worker and tryPopLocal(*worker, task)) or internal.try_dequeue(task) or trySteal(thief, task) or admission.read(task))
+            {
+                return task;
+            }
         }
-
-        return task;
     }
 
 public:
-    explicit TaskQueue(size_t admissionTaskQueueSize) : admission(admissionTaskQueueSize) { }
+    explicit TaskQueue(size_t admissionTaskQueueSize, size_t numberOfLocalQueues = 0)
+        : admission(admissionTaskQueueSize), localQueues(numberOfLocalQueues)
+    {
+    }
+
+    [[nodiscard]] size_t numberOfLocalQueues() const { return localQueues.size(); }
 
     /// By design the admission queue is bounded, which could lead to writes being blocked.
     /// The stop token allows cancellation. In case the writing was canceled, this method returns false.
@@ -93,11 +166,25 @@ public:
         tasksAvailable.release();
     }
 
+    /// Write a Task to the local queue of a WorkerThread. Like the internal task queue, local queues are unbounded.
+    /// Local queues only exist in work stealing mode, i.e., if the TaskQueue was constructed with `numberOfLocalQueues > 0`.
+    template <typename T = TaskType>
+    void addLocalTaskNonBlocking(size_t worker, T&& task)
+    {
+        {
+            auto& local = localQueues.at(worker);
+            const std::scoped_lock lock(local.mutex);
+            local.tasks.emplace_back(std::forward<T>(task));
+        }
+        tasksAvailable.release();
+    }
+
     /// Blocking read to retrieve the next task from the internal queue, or the admission queue if the internal task queue is empty.
     /// This operation can be canceled using a stop token. In case of a cancellation, this method returns an empty optional.
     /// The method prioritizes reading over cancellation. This implies, if a read is non-blocking, it succeeds regardless of the state of
     /// the stop token.
-    std::optional<TaskType> getNextTaskBlocking(const std::stop_token& stoken)
+    /// In work stealing mode, `worker` identifies the local queue of the calling WorkerThread, which is preferred over all other queues.
+    std::optional<TaskType> getNextTaskBlocking(const std::stop_token& stoken, std::optional<size_t> worker = std::nullopt)
     {
         while (!tasksAvailable.try_acquire_for(StopTokenCheckInterval))
         {
@@ -107,18 +194,18 @@ public:
             }
         }
 
-        return readElementAssumingItExists();
+        return readElementAssumingItExists(worker);
     }
 
     /// Non-Blocking version of `getNextTaskBlocking` if the queue is empty, this method returns an empty optional.
-    std::optional<TaskType> getNextTaskNonBlocking()
+    std::optional<TaskType> getNextTaskNonBlocking(std::optional<size_t> worker = std::nullopt)
     {
         if (!tasksAvailable.try_acquire())
         {
             return std::nullopt;
         }
 
-        return readElementAssumingItExists();
+        return readElementAssumingItExists(worker);
     }
 };
 }
@@ -39,8 +39,20 @@ public:
         = {"number_of_worker_threads", "4", "Number of worker threads used within the QueryEngine", {numberOfThreadsValidator()}};
     UIntOption admissionQueueSize
         = {"admission_queue_size", "1000", "Size of the bounded admission queue used within the QueryEngine", {queueSizeValidator()}};
+    BoolOption workStealing
+        = {"work_stealing",
+           "false",
+           "If enabled, every worker thread keeps the tasks it produces in a local queue and idle worker threads steal from their peers"};
+    UIntOption maxInlineContinuationDepth
+        = {"max_inline_continuation_depth",
+           "0",
+           "Maximum number of successor pipelines a worker thread executes inline for a buffer that was emitted with the "
+           "ContinuationPolicy::POSSIBLE, instead of enqueueing a task. 0 disables inline continuation"};
 
 protected:
-    std::vector<BaseOption*> getOptions() override { return {&numberOfWorkerThreads, &admissionQueueSize}; }
+    std::vector<BaseOption*> getOptions() override
+    {
+        return {&numberOfWorkerThreads, &admissionQueueSize, &workStealing, &maxInlineContinuationDepth};
+    }
 };
 }
@@ -38,15 +38,23 @@ TEST_F(QueryEngineConfigurationTest, testConfigurationsDefault)
     const QueryEngineConfiguration defaultConfig;
     EXPECT_EQ(defaultConfig.admissionQueueSize.getValue(), 1000);
     EXPECT_EQ(defaultConfig.numberOfWorkerThreads.getValue(), 4);
+    EXPECT_FALSE(defaultConfig.workStealing.getValue());
+    EXPECT_EQ(defaultConfig.maxInlineContinuationDepth.getValue(), 0);
 }
 
 TEST_F(QueryEngineConfigurationTest, testConfigurationsValidInput)
 {
     QueryEngineConfiguration defaultConfig;
-    defaultConfig.overwriteConfigWithCommandLineInput({{"number_of_worker_threads", "2"}, {"admission_queue_size", "123"}});
+    defaultConfig.overwriteConfigWithCommandLineInput(
+        {{"number_of_worker_threads", "2"},
+         {"admission_queue_size", "123"},
+         {"work_stealing", "true"},
+         {"max_inline_continuation_depth", "3"}});
 
     EXPECT_EQ(defaultConfig.admissionQueueSize.getValue(), 123);
     EXPECT_EQ(defaultConfig.numberOfWorkerThreads.getValue(), 2);
+    EXPECT_TRUE(defaultConfig.workStealing.getValue());
+    EXPECT_EQ(defaultConfig.maxInlineContinuationDepth.getValue(), 3);
 }
 
 TEST_F(QueryEngineConfigurationTest, testConfigurationsBadInputNonString)
@@ -1256,6 +1256,116 @@ TEST_F(QueryEngineTest, SingleQueryWithRepeatingPipeline)
     }
 }
 
+TEST_F(QueryEngineTest, InlineContinuationIsBoundedByMaxDepth)
+{
+    TestingHarness test;
+    test.maxInlineContinuationDepth = 2;
+    auto builder = test.buildNewQuery();
+    auto source = builder.addSource();
+    auto pipeline1 = builder.addPipeline({source});
+    auto pipeline2 = builder.addPipeline({pipeline1});
+    auto pipeline3 = builder.addPipeline({pipeline2});
+    auto pipeline4 = builder.addPipeline({pipeline3});
+    auto sink = builder.addSink({pipeline4});
+    auto query = test.addNewQuery(std::move(builder));
+    test.expectQueryStatusEvents(test.queryId(0), {QueryStatus::Started, QueryStatus::Running, QueryStatus::Stopped});
+    test.expectSourceTermination(test.queryId(0), source, QueryTerminationType::Graceful);
+
+    constexpr size_t numberOfBuffers = 4;
+    test.start();
+    {
+        auto queryId = query->queryId;
+        test.startQuery(std::move(query));
+        for (size_t i = 0; i < numberOfBuffers; ++i)
+        {
+            test.sourceControls[source]->injectData(identifiableData(i), NUMBER_OF_TUPLES_PER_BUFFER);
+        }
+        test.sourceControls[source]->injectEoS();
+
+        ASSERT_TRUE(test.sinkControls[sink]->waitForNumberOfReceivedBuffersOrMore(numberOfBuffers));
+        ASSERT_TRUE(test.waitForQepTermination(queryId, DEFAULT_LONG_AWAIT_TIMEOUT));
+    }
+    test.stop();
+
+    /// Buffers emitted by the source are taken from the task queue. The next two successors run inline within the emit of their
+    /// predecessor, the third successor exceeds the maximum depth and is queued again.
+    EXPECT_EQ(test.pipelineControls[pipeline1]->maxObservedNesting.load(), 0U);
+    EXPECT_EQ(test.pipelineControls[pipeline2]->maxObservedNesting.load(), 1U);
+    EXPECT_EQ(test.pipelineControls[pipeline3]->maxObservedNesting.load(), 2U);
+    EXPECT_EQ(test.pipelineControls[pipeline4]->maxObservedNesting.load(), 0U);
+    for (const auto pipeline : {pipeline1, pipeline2, pipeline3, pipeline4})
+    {
+        EXPECT_EQ(test.pipelineControls[pipeline]->invocations.load(), numberOfBuffers);
+    }
+}
+
+TEST_F(QueryEngineTest, NoInlineContinuationWithoutMaxDepth)
+{
+    TestingHarness test;
+    auto builder = test.buildNewQuery();
+    auto source = builder.addSource();
+    auto pipeline1 = builder.addPipeline({source});
+    auto pipeline2 = builder.addPipeline({pipeline1});
+    auto sink = builder.addSink({pipeline2});
+    auto query = test.addNewQuery(std::move(builder));
+    test.expectQueryStatusEvents(test.queryId(0), {QueryStatus::Started, QueryStatus::Running, QueryStatus::Stopped});
+    test.expectSourceTermination(test.queryId(0), source, QueryTerminationType::Graceful);
+
+    test.start();
+    {
+        auto queryId = query->queryId;
+        test.startQuery(std::move(query));
+        test.sourceControls[source]->injectData(identifiableData(1), NUMBER_OF_TUPLES_PER_BUFFER);
+        test.sourceControls[source]->injectEoS();
+
+        ASSERT_TRUE(test.sinkControls[sink]->waitForNumberOfReceivedBuffersOrMore(1));
+        ASSERT_TRUE(test.waitForQepTermination(queryId, DEFAULT_LONG_AWAIT_TIMEOUT));
+    }
+    test.stop();
+
+    EXPECT_EQ(test.pipelineControls[pipeline1]->maxObservedNesting.load(), 0U);
+    EXPECT_EQ(test.pipelineControls[pipeline2]->maxObservedNesting.load(), 0U);
+}
+
+TEST_F(QueryEngineTest, SingleQueryWithWorkStealing)
+{
+    TestingHarness test(LARGE_NUMBER_OF_THREADS, NUMBER_OF_BUFFERS_PER_SOURCE);
+    test.workStealing = true;
+    auto builder = test.buildNewQuery();
+    auto source = builder.addSource();
+    auto pipeline1 = builder.addPipeline({source});
+    auto pipeline2 = builder.addPipeline({pipeline1});
+    auto pipeline3 = builder.addPipeline({pipeline1});
+    auto sink = builder.addSink({pipeline2, pipeline3});
+    auto query = test.addNewQuery(std::move(builder));
+    test.expectQueryStatusEvents(test.queryId(0), {QueryStatus::Started, QueryStatus::Running, QueryStatus::Stopped});
+    test.expectSourceTermination(test.queryId(0), source, QueryTerminationType::Graceful);
+
+    /// The successors of pipeline1 are pushed into the local queue of the emitting WorkerThread, from which idle WorkerThreads steal
+    constexpr size_t numberOfBuffers = 64;
+    test.start();
+    {
+        auto queryId = query->queryId;
+        test.startQuery(std::move(query));
+        for (size_t i = 0; i < numberOfBuffers; ++i)
+        {
+            test.sourceControls[source]->injectData(identifiableData(i), NUMBER_OF_TUPLES_PER_BUFFER);
+        }
+        test.sourceControls[source]->injectEoS();
+
+        ASSERT_TRUE(test.sinkControls[sink]->waitForNumberOfReceivedBuffersOrMore(2 * numberOfBuffers));
+        ASSERT_TRUE(test.waitForQepTermination(queryId, DEFAULT_LONG_AWAIT_TIMEOUT));
+        ASSERT_TRUE(test.sourceControls[source]->waitUntilDestroyed());
+    }
+    test.stop();
+
+    for (const auto pipeline : {pipeline1, pipeline2, pipeline3})
+    {
+        EXPECT_EQ(test.pipelineControls[pipeline]->invocations.load(), numberOfBuffers);
+        EXPECT_TRUE(test.pipelineControls[pipeline]->wasStopped());
+    }
+}
+
 TEST_F(QueryEngineTest, SingleQueryWithRepeatingSinkDuringQueryStop)
 {
     TestingHarness test;
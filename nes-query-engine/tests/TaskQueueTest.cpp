@@ -244,4 +244,68 @@ TEST_F(TaskQueueTest, StressTest)
     consumedTasks.verifyUnique();
 }
 
+/// In work stealing mode, a worker pushes the follow-up tasks of every admission task it takes into its own local queue. Each admission
+/// task fans out into many follow-ups, so the local queues fill unevenly and the workers with an empty one have to steal to make progress.
+/// The test verifies that no task is lost or duplicated between the owners popping from the back and thieves stealing from the front.
+TEST_F(TaskQueueTest, WorkStealingTest)
+{
+    constexpr int numberOfWorkerThreads = 8;
+    constexpr int numberOfInitialTasks = 100;
+    constexpr int followUpTasksPerTask = 100;
+    constexpr int totalTasks = numberOfInitialTasks * (followUpTasksPerTask + 1);
+
+    TaskQueue<Task> stealingQueue{100, numberOfWorkerThreads};
+    ConsumedTasks<numberOfWorkerThreads> consumedTasks;
+    std::atomic tasksConsumed{0};
+
+    /// Barrier to synchronize all threads to start at the same time
+    std::barrier syncBarrier{numberOfWorkerThreads + 1};
+
+    std::vector<std::jthread> worker;
+    worker.reserve(numberOfWorkerThreads);
+    for (int host = 0; host < numberOfWorkerThreads; ++host)
+    {
+        worker.emplace_back(
+            [&, host](const std::stop_token& stoken)
+            {
+                /// Wait for all threads to be ready before starting
+                syncBarrier.arrive_and_wait();
+
+                int count = 0;
+                while (!stoken.stop_requested())
+                {
+                    if (auto task = stealingQueue.getNextTaskBlocking(stoken, static_cast<size_t>(host)))
+                    {
+                        /// Only tasks from the admission queue produce follow-up tasks, which end up in the local queue of this worker
+                        if (std::get<0>(*task) == numberOfWorkerThreads)
+                        {
+                            for (int i = 0; i < followUpTasksPerTask; ++i)
+                            {
+                                stealingQueue.addLocalTaskNonBlocking(static_cast<size_t>(host), Task{host, count++, {}});
+                            }
+                        }
+                        consumedTasks.localCounters.at(host).add(*task);
+                        tasksConsumed.fetch_add(1, std::memory_order::relaxed);
+                    }
+                }
+            });
+    }
+
+    syncBarrier.arrive_and_wait();
+    for (int i = 0; i < numberOfInitialTasks; ++i)
+    {
+        stealingQueue.addAdmissionTaskBlocking({}, Task{numberOfWorkerThreads, i, {}});
+    }
+
+    while (tasksConsumed.load(std::memory_order::relaxed) < totalTasks)
+    {
+        std::this_thread::yield();
+    }
+    worker.clear();
+
+    EXPECT_FALSE(stealingQueue.getNextTaskNonBlocking().has_value());
+    EXPECT_EQ(consumedTasks.size(), totalTasks);
+    consumedTasks.verifyUnique();
+}
+
 }
@@ -380,6 +380,8 @@ void TestingHarness::start()
     }
     QueryEngineConfiguration configuration{};
     configuration.numberOfWorkerThreads.setValue(numberOfThreads);
+    configuration.maxInlineContinuationDepth.setValue(maxInlineContinuationDepth);
+    configuration.workStealing.setValue(workStealing);
     qm = std::make_unique<QueryEngine>(configuration, this->statListener, this->status, this->bm, Host("test"));
 }
 
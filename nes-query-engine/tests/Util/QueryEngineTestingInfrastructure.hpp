@@ -218,6 +218,9 @@ public:
     std::atomic<size_t> throwOnNthInvocation = -1;
     std::atomic<size_t> repeatCount = 0;
     std::atomic<size_t> repeatCountDuringStop = 0;
+    /// Largest number of TestPipeline invocations that were still running on the calling thread when this pipeline was invoked.
+    /// Pipelines taken from the task queue observe zero, pipelines continued inline observe their inline continuation depth.
+    std::atomic<size_t> maxObservedNesting = 0;
 
     std::promise<void> start;
     std::promise<void> startEntered;
@@ -316,6 +319,12 @@ struct TestPipeline final : ExecutablePipelineStage
 
     void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override
     {
+        auto observedNesting = controller->maxObservedNesting.load();
+        while (observedNesting < activeInvocations
+               and not controller->maxObservedNesting.compare_exchange_weak(observedNesting, activeInvocations))
+        {
+        }
+
         if (controller->invocations.fetch_add(1) + 1 == controller->throwOnNthInvocation)
         {
             throw Exception("I should throw here.", 9999);
@@ -336,10 +345,15 @@ struct TestPipeline final : ExecutablePipelineStage
             }
         }
 
+        /// Successors that are continued inline run within emitBuffer and observe this invocation as still running.
+        ++activeInvocations;
         pipelineExecutionContext.emitBuffer(inputTupleBuffer, PipelineExecutionContext::ContinuationPolicy::POSSIBLE);
+        --activeInvocations;
     }
 
     std::shared_ptr<TestPipelineController> controller;
+    /// Number of TestPipeline invocations that are currently emitting on this thread.
+    static inline thread_local size_t activeInvocations = 0;
 
 protected:
     std::ostream& toString(std::ostream& os) const override;
@@ -532,6 +546,9 @@ struct TestingHarness
     std::shared_ptr<QueryStatusListener> status = std::make_shared<QueryStatusListener>();
     std::unique_ptr<QueryEngine> qm;
     size_t numberOfThreads;
+    /// Passed to the query engine configuration in `start`.
+    size_t maxInlineContinuationDepth = 0;
+    bool workStealing = false;
 
     std::vector<QueryId> queryIds;
     OriginId::Underlying lastOriginIdCounter = INITIAL<OriginId>.getRawValue();
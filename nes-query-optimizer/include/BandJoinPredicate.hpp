@@ -0,0 +1,59 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Schema/Field.hpp>
+
+namespace NES
+{
+
+/// Range condition between one integral key field of each join side, normalized to `minDistance <= rightKey - leftKey <= maxDistance`.
+/// For example, `left.ts >= right.ts - 5 AND left.ts <= right.ts + 5` results in {left.ts, right.ts, -5, 5} and `left.a < right.b`
+/// results in {left.a, right.b, 1, nullopt}. A missing bound means that the distance is unbounded in this direction.
+struct BandJoinPredicate
+{
+    /// How the probe maps the keys onto a signed 64-bit sort key. UINT64 keys do not fit into an int64, so they are stored with their
+    /// most significant bit flipped, which preserves their unsigned order. This requires both keys to be unsigned.
+    enum class KeyEncoding : uint8_t
+    {
+        SIGNED,
+        BIASED_UNSIGNED
+    };
+
+    Field leftKey;
+    Field rightKey;
+    KeyEncoding keyEncoding;
+    std::optional<int64_t> minDistance;
+    std::optional<int64_t> maxDistance;
+    /// Whether a bounding conjunct offsets one of the keys by a non-zero constant, e.g., `right.ts - 5`
+    bool hasOffsets;
+
+    /// The bounds follow mathematical integer semantics, whereas the join function evaluates the offsets in the key type.
+    /// Both agree if no offset is applied or if both keys are signed, as only unsigned offsets like `right.ts - 5` wrap around in practice.
+    [[nodiscard]] bool offsetsCanWrap() const;
+};
+
+/// Extracts the band predicate from the top-level conjuncts of the join function. A conjunct qualifies if it is a <, <=, > or >=
+/// comparison between an integral field of each join side, where either side may be offset by an integral constant (`right.ts + 5`).
+/// The first qualifying conjunct determines the key fields; later conjuncts on the same fields narrow the bounds.
+/// All other conjuncts are ignored here, as the probe still evaluates the complete join function on every candidate pair.
+/// Returns nullopt if no conjunct qualifies, e.g., for pure equi-joins or disjunctions.
+std::optional<BandJoinPredicate> extractBandJoinPredicate(const JoinLogicalOperator& join);
+
+}
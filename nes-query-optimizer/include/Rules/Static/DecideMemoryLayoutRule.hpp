@@ -13,6 +13,7 @@
 */
 
 #pragma once
+#include <cstddef>
 #include <set>
 #include <string_view>
 #include <typeindex>
@@ -25,10 +26,19 @@
 namespace NES
 {
 
-/// Decides what memory layout should be used per operator. For now, we use row-layout across all operators.
+/// Decides the memory layout of the buffers every operator emits, which is the layout its parents scan.
+/// A columnar layout pays off if the parents access only a few fields of a wide schema, e.g., narrow projections, selections on a few
+/// fields, or aggregations over a few columns, since a columnar scan only touches the cache lines of the accessed columns.
+/// Otherwise, the row layout keeps the fields of a tuple together. Sources, sinks, and the inputs of binary operators use the row
+/// layout. The pipelining phase converts between layouts, as every pipeline scans the layout of its input and emits its own.
 class DecideMemoryLayoutRule
 {
 public:
+    /// Narrower schemas keep the row layout, as every tuple spans only a few cache lines anyway.
+    static constexpr size_t MIN_FIELDS_FOR_COLUMNAR_LAYOUT = 8;
+    /// Parents may access at most every fourth field of a columnar buffer.
+    static constexpr size_t MAX_ACCESSED_FIELDS_DIVISOR_FOR_COLUMNAR_LAYOUT = 4;
+
     static PlanRuleRegistryReturnType create(PlanRuleRegistryArguments arguments);
     static constexpr std::string_view NAME = "DecideMemoryLayoutRule";
 
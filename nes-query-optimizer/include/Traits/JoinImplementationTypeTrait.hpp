@@ -29,6 +29,8 @@ enum class JoinImplementation : uint8_t
 {
     NESTED_LOOP_JOIN,
     HASH_JOIN,
+    /// Sorts both sides on the key of a band or inequality predicate and merges them. Shares the build side with the NLJ.
+    SORT_MERGE_JOIN,
     CHOICELESS
 };
 
@@ -0,0 +1,283 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <BandJoinPredicate.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <Functions/ArithmeticalFunctions/AddLogicalFunction.hpp>
+#include <Functions/ArithmeticalFunctions/SubLogicalFunction.hpp>
+#include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Operators/Windows/JoinLogicalOperator.hpp>
+#include <Schema/Field.hpp>
+
+namespace NES
+{
+
+namespace
+{
+enum class RangeComparison : uint8_t
+{
+    LESS,
+    LESS_EQUALS,
+    GREATER,
+    GREATER_EQUALS
+};
+
+/// A field plus a constant offset, i.e., `field + offset`
+struct OffsetField
+{
+    Field field;
+    int64_t offset;
+};
+
+/// Mirrors the comparison for swapped operands, e.g., `a < b` is equivalent to `b > a`
+RangeComparison mirror(const RangeComparison comparison)
+{
+    switch (comparison)
+    {
+        case RangeComparison::LESS:
+            return RangeComparison::GREATER;
+        case RangeComparison::LESS_EQUALS:
+            return RangeComparison::GREATER_EQUALS;
+        case RangeComparison::GREATER:
+            return RangeComparison::LESS;
+        case RangeComparison::GREATER_EQUALS:
+            return RangeComparison::LESS_EQUALS;
+    }
+    std::unreachable();
+}
+
+std::optional<RangeComparison> getRangeComparison(const LogicalFunction& function)
+{
+    if (function.tryGetAs<LessLogicalFunction>().has_value())
+    {
+        return RangeComparison::LESS;
+    }
+    if (function.tryGetAs<LessEqualsLogicalFunction>().has_value())
+    {
+        return RangeComparison::LESS_EQUALS;
+    }
+    if (function.tryGetAs<GreaterLogicalFunction>().has_value())
+    {
+        return RangeComparison::GREATER;
+    }
+    if (function.tryGetAs<GreaterEqualsLogicalFunction>().has_value())
+    {
+        return RangeComparison::GREATER_EQUALS;
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> getIntegralConstant(const LogicalFunction& function)
+{
+    const auto constantFunction = function.tryGetAs<ConstantValueLogicalFunction>();
+    if (not constantFunction.has_value() or not constantFunction.value()->getDataType().isInteger())
+    {
+        return std::nullopt;
+    }
+    const auto constantValue = constantFunction.value()->getConstantValue();
+    int64_t value = 0;
+    const auto [end, errorCode] = std::from_chars(constantValue.data(), constantValue.data() + constantValue.size(), value);
+    if (errorCode != std::errc{} or end != constantValue.data() + constantValue.size())
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/// Accepts `field`, `field + constant`, `constant + field` and `field - constant`
+std::optional<OffsetField> getOffsetField(const LogicalFunction& function)
+{
+    if (const auto fieldAccess = function.tryGetAs<FieldAccessLogicalFunction>())
+    {
+        return OffsetField{fieldAccess.value()->getField(), 0};
+    }
+
+    const auto isAdd = function.tryGetAs<AddLogicalFunction>().has_value();
+    const auto isSub = function.tryGetAs<SubLogicalFunction>().has_value();
+    const auto children = function.getChildren();
+    if ((not isAdd and not isSub) or children.size() != 2)
+    {
+        return std::nullopt;
+    }
+
+    auto fieldAccess = children[0].tryGetAs<FieldAccessLogicalFunction>();
+    auto constant = getIntegralConstant(children[1]);
+    if (isAdd and not fieldAccess.has_value())
+    {
+        fieldAccess = children[1].tryGetAs<FieldAccessLogicalFunction>();
+        constant = getIntegralConstant(children[0]);
+    }
+    if (not fieldAccess.has_value() or not constant.has_value())
+    {
+        return std::nullopt;
+    }
+    if (isSub)
+    {
+        if (constant.value() == std::numeric_limits<int64_t>::min())
+        {
+            return std::nullopt;
+        }
+        return OffsetField{fieldAccess.value()->getField(), -constant.value()};
+    }
+    return OffsetField{fieldAccess.value()->getField(), constant.value()};
+}
+
+void collectConjuncts(const LogicalFunction& function, std::vector<LogicalFunction>& conjuncts)
+{
+    if (function.tryGetAs<AndLogicalFunction>().has_value())
+    {
+        for (const auto& child : function.getChildren())
+        {
+            collectConjuncts(child, conjuncts);
+        }
+        return;
+    }
+    conjuncts.emplace_back(function);
+}
+
+std::optional<BandJoinPredicate::KeyEncoding> getKeyEncoding(const DataType& leftType, const DataType& rightType)
+{
+    if (not leftType.isInteger() or not rightType.isInteger())
+    {
+        return std::nullopt;
+    }
+    if (not leftType.isType(DataType::Type::UINT64) and not rightType.isType(DataType::Type::UINT64))
+    {
+        return BandJoinPredicate::KeyEncoding::SIGNED;
+    }
+    if (leftType.isSignedInteger() or rightType.isSignedInteger())
+    {
+        return std::nullopt;
+    }
+    return BandJoinPredicate::KeyEncoding::BIASED_UNSIGNED;
+}
+}
+
+bool BandJoinPredicate::offsetsCanWrap() const
+{
+    if (not hasOffsets)
+    {
+        return false;
+    }
+    return not leftKey.getDataType().isSignedInteger() or not rightKey.getDataType().isSignedInteger();
+}
+
+std::optional<BandJoinPredicate> extractBandJoinPredicate(const JoinLogicalOperator& join)
+{
+    const auto children = join.getBothChildren();
+    const auto leftSchema = children[0].getOutputSchema();
+    const auto rightSchema = children[1].getOutputSchema();
+
+    std::vector<LogicalFunction> conjuncts;
+    collectConjuncts(join.getJoinFunction(), conjuncts);
+
+    std::optional<BandJoinPredicate> bandPredicate;
+    for (const auto& conjunct : conjuncts)
+    {
+        auto comparison = getRangeComparison(conjunct);
+        const auto operands = conjunct.getChildren();
+        if (not comparison.has_value() or operands.size() != 2)
+        {
+            continue;
+        }
+        auto lhs = getOffsetField(operands[0]);
+        auto rhs = getOffsetField(operands[1]);
+        if (not lhs.has_value() or not rhs.has_value())
+        {
+            continue;
+        }
+
+        /// Brings the comparison into the form `left + a <cmp> right + b`
+        if (rightSchema.contains(lhs->field.getFullyQualifiedName()) and leftSchema.contains(rhs->field.getFullyQualifiedName()))
+        {
+            std::swap(lhs, rhs);
+            comparison = mirror(comparison.value());
+        }
+        if (not leftSchema.contains(lhs->field.getFullyQualifiedName()) or not rightSchema.contains(rhs->field.getFullyQualifiedName()))
+        {
+            continue;
+        }
+
+        if (not bandPredicate.has_value())
+        {
+            const auto keyEncoding = getKeyEncoding(lhs->field.getDataType(), rhs->field.getDataType());
+            if (not keyEncoding.has_value())
+            {
+                continue;
+            }
+            bandPredicate = BandJoinPredicate{lhs->field, rhs->field, keyEncoding.value(), std::nullopt, std::nullopt, false};
+        }
+        else if (bandPredicate->leftKey != lhs->field or bandPredicate->rightKey != rhs->field)
+        {
+            continue;
+        }
+
+        /// `left + a <cmp> right + b` is equivalent to `right - left <mirrored cmp> a - b`. Integral keys allow us to turn the strict
+        /// comparisons into inclusive bounds. Conjuncts whose bound overflows are skipped, which only widens the range of candidates.
+        /// The offsets follow mathematical integer semantics, i.e., pairs that only match because `right.ts - 5` wraps around are missed.
+        int64_t distance = 0;
+        if (__builtin_sub_overflow(lhs->offset, rhs->offset, &distance))
+        {
+            continue;
+        }
+        bandPredicate->hasOffsets = bandPredicate->hasOffsets or lhs->offset != 0 or rhs->offset != 0;
+        switch (comparison.value())
+        {
+            case RangeComparison::LESS:
+                if (distance != std::numeric_limits<int64_t>::max())
+                {
+                    bandPredicate->minDistance = std::max(bandPredicate->minDistance.value_or(distance + 1), distance + 1);
+                }
+                break;
+            case RangeComparison::LESS_EQUALS:
+                bandPredicate->minDistance = std::max(bandPredicate->minDistance.value_or(distance), distance);
+                break;
+            case RangeComparison::GREATER:
+                if (distance != std::numeric_limits<int64_t>::min())
+                {
+                    bandPredicate->maxDistance = std::min(bandPredicate->maxDistance.value_or(distance - 1), distance - 1);
+                }
+                break;
+            case RangeComparison::GREATER_EQUALS:
+                bandPredicate->maxDistance = std::min(bandPredicate->maxDistance.value_or(distance), distance);
+                break;
+        }
+    }
+
+    /// A key pair whose conjuncts all overflowed does not restrict the candidates at all
+    if (bandPredicate.has_value() and not bandPredicate->minDistance.has_value() and not bandPredicate->maxDistance.has_value())
+    {
+        return std::nullopt;
+    }
+    return bandPredicate;
+}
+
+}
@@ -38,6 +38,7 @@
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/Logger/Logger.hpp>
+#include <BandJoinPredicate.hpp>
 #include <ErrorHandling.hpp>
 #include <PlanRuleRegistry.hpp>
 #include <QueryOptimizerConfiguration.hpp>
@@ -86,6 +87,23 @@ bool shallUseHashJoin(const LogicalFunction& joinFunction)
     return true;
 }
 
+/// The sort-merge join only replaces the probe of inner joins, as the outer join probes need to track unmatched tuples across all pairs.
+bool canUseSortMergeJoin(const JoinLogicalOperator& joinOperator)
+{
+    return joinOperator.getJoinType() == JoinLogicalOperator::JoinType::INNER_JOIN and extractBandJoinPredicate(joinOperator).has_value();
+}
+
+/// The sort-merge probe misses pairs that only match because an unsigned offset wraps around, e.g., `right.ts - 5` for `right.ts < 5`.
+/// Thus, the optimizer only chooses it on its own if it returns the same rows as the NLJ. Otherwise, it must be requested explicitly.
+bool shallUseSortMergeJoin(const JoinLogicalOperator& joinOperator)
+{
+    if (not canUseSortMergeJoin(joinOperator))
+    {
+        return false;
+    }
+    return not extractBandJoinPredicate(joinOperator)->offsetsCanWrap();
+}
+
 LogicalOperator
 decideJoinTypes(const LogicalOperator& logicalOperator, const std::vector<LogicalOperator>& children, const StreamJoinStrategy joinStrategy)
 {
@@ -96,10 +114,29 @@ decideJoinTypes(const LogicalOperator& logicalOperator, const std::vector<Logica
         {
             tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
         }
+        else if (joinStrategy == StreamJoinStrategy::SORT_MERGE_JOIN)
+        {
+            if (canUseSortMergeJoin(*joinOperator.value()))
+            {
+                tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::SORT_MERGE_JOIN});
+            }
+            else
+            {
+                tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
+                NES_WARNING(
+                    "Operator {} has not the SortMergeJoinTrait, as the join condition contains no range predicate on integral fields of "
+                    "both sides. Therefore, we fall-back to the NLJ!",
+                    logicalOperator);
+            }
+        }
         else if (shallUseHashJoin(joinOperator.value()->getJoinFunction()))
         {
             tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::HASH_JOIN});
         }
+        else if (joinStrategy == StreamJoinStrategy::OPTIMIZER_CHOOSES and shallUseSortMergeJoin(*joinOperator.value()))
+        {
+            tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::SORT_MERGE_JOIN});
+        }
         else
         {
             tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
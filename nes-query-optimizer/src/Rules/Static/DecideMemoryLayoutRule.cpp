@@ -13,22 +13,40 @@
 */
 #include <Rules/Static/DecideMemoryLayoutRule.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <optional>
 #include <ranges>
 #include <set>
 #include <string_view>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
+#include <Identifiers/Identifier.hpp>
 #include <Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Iterators/BFSIterator.hpp>
+#include <Operators/EventTimeWatermarkAssignerLogicalOperator.hpp>
+#include <Operators/IngestionTimeWatermarkAssignerLogicalOperator.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/LogicalOperatorFwd.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/Sinks/SinkLogicalOperator.hpp>
+#include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <Rules/Barriers/FixedPlanStructureBarrier.hpp>
 #include <Rules/PlanVisitor.hpp>
 #include <Traits/MemoryLayoutTypeTrait.hpp>
 #include <Traits/TraitSet.hpp>
+#include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <ErrorHandling.hpp>
 #include <PlanRuleRegistry.hpp>
 
@@ -37,11 +55,146 @@ namespace NES
 
 namespace
 {
-PlanVisitor<>::UpResult decideMemoryLayout(const LogicalOperator& op, const std::vector<LogicalOperator>& children)
+/// Names of the fields of a child's output that its parent accesses, either itself or on behalf of its own parents.
+/// std::nullopt if the parent accesses every field, or if the access pattern of the parent is unknown.
+using AccessedFields = std::optional<std::unordered_set<Identifier>>;
+
+using Visitor = PlanVisitor<MemoryLayoutType, AccessedFields>;
+
+std::unordered_set<Identifier> getAccessedFieldNames(const LogicalFunction& logicalFunction)
+{
+    return BFSRange(logicalFunction)
+        | std::views::filter([](const LogicalFunction& function) { return function.tryGetAs<FieldAccessLogicalFunction>().has_value(); })
+        | std::views::transform([](const LogicalFunction& function)
+                                { return function.getAs<FieldAccessLogicalFunction>()->getField().getLastName(); })
+        | std::ranges::to<std::unordered_set>();
+}
+
+/// Fields of an operator's output that any of its parents accesses.
+AccessedFields merge(const std::vector<AccessedFields>& accessedByParents)
+{
+    if (accessedByParents.empty())
+    {
+        return std::nullopt;
+    }
+    std::unordered_set<Identifier> merged;
+    for (const auto& accessed : accessedByParents)
+    {
+        if (not accessed.has_value())
+        {
+            return std::nullopt;
+        }
+        merged.insert(accessed->begin(), accessed->end());
+    }
+    return merged;
+}
+
+/// Fields of the child's output the operator accesses, for operators with a single child. Operators that forward their input, e.g.,
+/// selections, additionally access all fields their parents access. Unknown operators access every field.
+AccessedFields getAccessedInputFields(const LogicalOperator& op, const std::vector<AccessedFields>& accessedByParents)
+{
+    const auto withForwardedFields = [&](std::unordered_set<Identifier> accessed) -> AccessedFields
+    {
+        auto forwarded = merge(accessedByParents);
+        if (not forwarded)
+        {
+            return std::nullopt;
+        }
+        accessed.insert(forwarded->begin(), forwarded->end());
+        return accessed;
+    };
+
+    if (const auto selection = op.tryGetAs<SelectionLogicalOperator>())
+    {
+        return withForwardedFields(getAccessedFieldNames(selection.value()->getPredicate()));
+    }
+    if (const auto assigner = op.tryGetAs<EventTimeWatermarkAssignerLogicalOperator>())
+    {
+        return withForwardedFields(getAccessedFieldNames(assigner.value()->getOnField()));
+    }
+    if (op.tryGetAs<IngestionTimeWatermarkAssignerLogicalOperator>())
+    {
+        return withForwardedFields({});
+    }
+    if (const auto projection = op.tryGetAs<ProjectionLogicalOperator>())
+    {
+        if (projection.value()->hasAsterisk())
+        {
+            return std::nullopt;
+        }
+        return projection.value()->getAccessedFields() | std::views::transform([](const auto& field) { return field.getLastName(); })
+            | std::ranges::to<std::unordered_set>();
+    }
+    if (const auto aggregation = op.tryGetAs<WindowedAggregationLogicalOperator>())
+    {
+        std::unordered_set<Identifier> accessed;
+        for (const auto& groupingKey : aggregation.value()->getGroupingKeys())
+        {
+            accessed.merge(getAccessedFieldNames(groupingKey));
+        }
+        for (const auto& projectedAggregation : aggregation.value()->getWindowAggregation())
+        {
+            const auto inputFunction = projectedAggregation.function.getInputFunction();
+            if (not std::holds_alternative<TypedLogicalFunction<FieldAccessLogicalFunction>>(inputFunction))
+            {
+                return std::nullopt;
+            }
+            accessed.merge(getAccessedFieldNames(std::get<TypedLogicalFunction<FieldAccessLogicalFunction>>(inputFunction)));
+        }
+        const auto characteristic = aggregation.value()->getCharacteristic();
+        if (not std::holds_alternative<Windowing::BoundTimeCharacteristic>(characteristic))
+        {
+            return std::nullopt;
+        }
+        const auto& boundCharacteristic = std::get<Windowing::BoundTimeCharacteristic>(characteristic);
+        if (std::holds_alternative<Windowing::BoundEventTimeCharacteristic>(boundCharacteristic))
+        {
+            accessed.insert(std::get<Windowing::BoundEventTimeCharacteristic>(boundCharacteristic).field->getField().getLastName());
+        }
+        return accessed;
+    }
+    return std::nullopt;
+}
+
+/// The layout of the buffers an operator emits, which its parents scan.
+MemoryLayoutType decideOutputLayout(const LogicalOperator& op, const std::vector<AccessedFields>& accessedByParents)
+{
+    /// Sources and sinks exchange buffers with the outside world, which expects rows. A scan of a source parses its raw input directly
+    /// into records, so no intermediate buffer exists whose layout could benefit a narrow scan of a wide source.
+    if (op.tryGetAs<SourceDescriptorLogicalOperator>() or op.tryGetAs<SinkLogicalOperator>() or accessedByParents.empty())
+    {
+        return MemoryLayoutType::ROW_LAYOUT;
+    }
+    const auto numberOfFields = op.getOutputSchema().size();
+    const auto scansFewColumns = [numberOfFields](const AccessedFields& accessed)
+    {
+        return accessed.has_value()
+            and accessed->size() * DecideMemoryLayoutRule::MAX_ACCESSED_FIELDS_DIVISOR_FOR_COLUMNAR_LAYOUT <= numberOfFields;
+    };
+    if (numberOfFields >= DecideMemoryLayoutRule::MIN_FIELDS_FOR_COLUMNAR_LAYOUT
+        and std::ranges::all_of(accessedByParents, scansFewColumns))
+    {
+        return MemoryLayoutType::COLUMNAR_LAYOUT;
+    }
+    return MemoryLayoutType::ROW_LAYOUT;
+}
+
+Visitor::DownResult decideLayoutTopDown(const LogicalOperator& op, const std::vector<AccessedFields>& accessedByParents)
+{
+    std::unordered_map<LogicalOperator, AccessedFields> accessedOfChildren;
+    if (op.getChildren().size() == 1)
+    {
+        accessedOfChildren.emplace(op.getChildren().front(), getAccessedInputFields(op, accessedByParents));
+    }
+    /// Children of binary operators keep the default, every field is accessed. Hence, all inputs of an operator share the row layout.
+    return {.operatorContext = decideOutputLayout(op, accessedByParents), .downContexts = std::move(accessedOfChildren)};
+}
+
+Visitor::UpResult stampMemoryLayout(const LogicalOperator& op, std::vector<LogicalOperator> children, const MemoryLayoutType memoryLayout)
 {
     auto traitSet = op.getTraitSet();
-    tryInsert(traitSet, MemoryLayoutTypeTrait{MemoryLayoutType::ROW_LAYOUT});
-    return op.withChildren(children).withTraitSet(std::move(traitSet));
+    tryInsert(traitSet, MemoryLayoutTypeTrait{memoryLayout});
+    return op.withChildren(std::move(children)).withTraitSet(std::move(traitSet));
 }
 }
 
@@ -54,7 +207,7 @@ std::set<std::type_index> DecideMemoryLayoutRule::needs() const
 /// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 LogicalPlan DecideMemoryLayoutRule::apply(const LogicalPlan& queryPlan) const
 {
-    PlanVisitor<> visitor{decideMemoryLayout};
+    Visitor visitor{decideLayoutTopDown, stampMemoryLayout};
     return visitor.apply(queryPlan);
 }
 
@@ -14,7 +14,9 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -36,9 +38,14 @@
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/DataTypeProvider.hpp>
 #include <Functions/ArithmeticalFunctions/AddLogicalFunction.hpp>
+#include <Functions/ArithmeticalFunctions/SubLogicalFunction.hpp>
 #include <Functions/BooleanFunctions/AndLogicalFunction.hpp>
 #include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/GreaterEqualsLogicalFunction.hpp>
+#include <Functions/ComparisonFunctions/LessEqualsLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
 #include <Functions/FieldAccessLogicalFunction.hpp>
+#include <Functions/LogicalFunction.hpp>
 #include <Iterators/BFSIterator.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/SelectionLogicalOperator.hpp>
@@ -57,6 +64,7 @@
 
 #include <Operators/LogicalOperatorFwd.hpp>
 #include <Util/UUID.hpp>
+#include <BandJoinPredicate.hpp>
 #include <DistributedQuery.hpp>
 #include <ErrorHandling.hpp>
 #include <QueryId.hpp>
@@ -74,11 +82,12 @@ public:
 
     static constexpr uint64_t TUMBLING_WINDOW_SIZE_MS = 1000;
 
-    static Schema<UnqualifiedUnboundField, Ordered> createSchema(const std::string& prefix)
+    static Schema<UnqualifiedUnboundField, Ordered>
+    createSchema(const std::string& prefix, const DataType::Type valueType = DataType::Type::UINT64)
     {
         return Schema<UnqualifiedUnboundField, Ordered>{
             {Identifier::parse(prefix + "_id"), DataTypeProvider::provideDataType(DataType::Type::UINT64)},
-            {Identifier::parse(prefix + "_value"), DataTypeProvider::provideDataType(DataType::Type::UINT64)},
+            {Identifier::parse(prefix + "_value"), DataTypeProvider::provideDataType(valueType)},
             {Identifier::parse(prefix + "_ts"), DataTypeProvider::provideDataType(DataType::Type::UINT64)}};
     }
 
@@ -111,23 +120,65 @@ public:
 
     /// Build the expected join output schema for a left/right (prefix "left"/"right") join. For outer joins the fields of the side that may
     /// be unmatched become nullable, mirroring JoinLogicalOperator::inferLocalSchema; the window START/END fields are never nullable.
-    static Schema<UnqualifiedUnboundField, Ordered> createJoinOutputSchema(const bool leftNullable, const bool rightNullable)
+    static Schema<UnqualifiedUnboundField, Ordered>
+    createJoinOutputSchema(const bool leftNullable, const bool rightNullable, const DataType::Type valueType = DataType::Type::UINT64)
     {
         const auto u64 = DataTypeProvider::provideDataType(DataType::Type::UINT64);
         const auto leftType
             = leftNullable ? DataTypeProvider::provideDataType(DataType::Type::UINT64, DataType::NULLABLE::IS_NULLABLE) : u64;
         const auto rightType
             = rightNullable ? DataTypeProvider::provideDataType(DataType::Type::UINT64, DataType::NULLABLE::IS_NULLABLE) : u64;
+        const auto leftValueType = DataTypeProvider::provideDataType(
+            valueType, leftNullable ? DataType::NULLABLE::IS_NULLABLE : DataType::NULLABLE::NOT_NULLABLE);
+        const auto rightValueType = DataTypeProvider::provideDataType(
+            valueType, rightNullable ? DataType::NULLABLE::IS_NULLABLE : DataType::NULLABLE::NOT_NULLABLE);
         return Schema<UnqualifiedUnboundField, Ordered>{
             {Identifier::parse("left_id"), leftType},
-            {Identifier::parse("left_value"), leftType},
+            {Identifier::parse("left_value"), leftValueType},
             {Identifier::parse("left_ts"), leftType},
             {Identifier::parse("right_id"), rightType},
-            {Identifier::parse("right_value"), rightType},
+            {Identifier::parse("right_value"), rightValueType},
             {Identifier::parse("right_ts"), rightType},
             {Identifier::parse("START"), u64},
             {Identifier::parse("END"), u64}};
     }
+
+    /// Plans an inner join of two sources on the join function that `createJoinFunction` builds from their `_value` fields
+    static LogicalPlan createInnerJoinPlan(
+        SourceCatalog& sourceCatalog,
+        SinkCatalog& sinkCatalog,
+        const DataType::Type valueType,
+        const std::function<LogicalFunction(const FieldAccessLogicalFunction&, const FieldAccessLogicalFunction&)>& createJoinFunction)
+    {
+        auto leftLogicalSource = createLogicalSource(sourceCatalog, Identifier::parse("LEFT_TEST"), createSchema("left", valueType));
+        auto leftSourceDescriptor = createSourceDescriptor(sourceCatalog, leftLogicalSource);
+
+        auto rightLogicalSource = createLogicalSource(sourceCatalog, Identifier::parse("RIGHT_TEST"), createSchema("right", valueType));
+        auto rightSourceDescriptor = createSourceDescriptor(sourceCatalog, rightLogicalSource);
+
+        const auto leftSourceOp = SourceDescriptorLogicalOperator::create(leftSourceDescriptor);
+        const auto rightSourceOp = SourceDescriptorLogicalOperator::create(rightSourceDescriptor);
+
+        const FieldAccessLogicalFunction leftValue{leftSourceOp->getOutputSchema().getFieldByName(Identifier::parse("left_value")).value()};
+        const FieldAccessLogicalFunction rightValue{
+            rightSourceOp->getOutputSchema().getFieldByName(Identifier::parse("right_value")).value()};
+
+        auto characteristics = JoinLogicalOperator::createJoinTimeCharacteristic(
+            {Windowing::BoundTimeCharacteristic{Windowing::IngestionTimeCharacteristic{}},
+             Windowing::BoundTimeCharacteristic{Windowing::IngestionTimeCharacteristic{}}});
+
+        auto joinOp = JoinLogicalOperator::create(
+            std::array<LogicalOperator, 2>{leftSourceOp, rightSourceOp},
+            createJoinFunction(leftValue, rightValue),
+            createTumblingWindow(),
+            JoinLogicalOperator::JoinType::INNER_JOIN,
+            characteristics.value());
+
+        auto sinkDescriptor
+            = createSinkDescriptor(sinkCatalog, Identifier::parse("test_sink"), createJoinOutputSchema(false, false, valueType));
+        auto sinkOp = SinkLogicalOperator::create(joinOp, sinkDescriptor);
+        return LogicalPlan{QueryId::create(LocalQueryId{generateUUID()}, getNextDistributedQueryId()), {sinkOp->withInferredSchema()}};
+    }
 };
 
 /// A simple Selection → AnonymousSource plan. Verify all operators get CHOICELESS.
@@ -633,6 +684,142 @@ TEST_F(DecideJoinTypesTest, OuterJoinWithNonEquiPredicateIsRejected)
 }
 
 
+/// Band condition `left_value >= right_value - 5 AND left_value <= right_value + 5` on UINT64 keys. The NLJ evaluates `right_value - 5`
+/// with wrap around, which the sort-merge probe does not. Verify that only the SORT_MERGE_JOIN strategy chooses the sort-merge probe.
+TEST_F(DecideJoinTypesTest, BandConditionWithUnsignedOffsetsKeepsNLJUnlessSortMergeJoinIsForced)
+{
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    const auto plan = createInnerJoinPlan(
+        sourceCatalog,
+        sinkCatalog,
+        DataType::Type::UINT64,
+        [](const FieldAccessLogicalFunction& leftValue, const FieldAccessLogicalFunction& rightValue) -> LogicalFunction
+        {
+            const ConstantValueLogicalFunction five{DataTypeProvider::provideDataType(DataType::Type::UINT64), "5"};
+            return AndLogicalFunction{
+                GreaterEqualsLogicalFunction{leftValue, SubLogicalFunction{rightValue, five}},
+                LessEqualsLogicalFunction{leftValue, AddLogicalFunction{rightValue, five}}};
+        });
+
+    const auto joins = getOperatorByType<JoinLogicalOperator>(DecideJoinTypesRule(StreamJoinStrategy::OPTIMIZER_CHOOSES).apply(plan));
+    ASSERT_EQ(joins.size(), 1);
+    EXPECT_TRUE(joins[0]->getTraitSet().get<JoinImplementationTypeTrait>()->implementationType == JoinImplementation::NESTED_LOOP_JOIN);
+
+    const auto bandPredicate = extractBandJoinPredicate(*joins[0]);
+    ASSERT_TRUE(bandPredicate.has_value());
+    EXPECT_TRUE(bandPredicate->leftKey.getLastName() == Identifier::parse("left_value"));
+    EXPECT_TRUE(bandPredicate->rightKey.getLastName() == Identifier::parse("right_value"));
+    EXPECT_TRUE(bandPredicate->keyEncoding == BandJoinPredicate::KeyEncoding::BIASED_UNSIGNED);
+    EXPECT_EQ(bandPredicate->minDistance, -5);
+    EXPECT_EQ(bandPredicate->maxDistance, 5);
+    EXPECT_TRUE(bandPredicate->hasOffsets);
+    EXPECT_TRUE(bandPredicate->offsetsCanWrap());
+
+    const auto forcedJoins = getOperatorByType<JoinLogicalOperator>(DecideJoinTypesRule(StreamJoinStrategy::SORT_MERGE_JOIN).apply(plan));
+    ASSERT_EQ(forcedJoins.size(), 1);
+    EXPECT_TRUE(
+        forcedJoins[0]->getTraitSet().get<JoinImplementationTypeTrait>()->implementationType == JoinImplementation::SORT_MERGE_JOIN);
+}
+
+/// Band condition `left_value >= right_value - 5 AND left_value <= right_value + 5` on INT64 keys under OPTIMIZER_CHOOSES.
+/// Signed offsets do not wrap around, so verify SORT_MERGE_JOIN.
+TEST_F(DecideJoinTypesTest, BandConditionWithSignedOffsetsProducesSortMergeJoinTrait)
+{
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    const auto plan = createInnerJoinPlan(
+        sourceCatalog,
+        sinkCatalog,
+        DataType::Type::INT64,
+        [](const FieldAccessLogicalFunction& leftValue, const FieldAccessLogicalFunction& rightValue) -> LogicalFunction
+        {
+            const ConstantValueLogicalFunction five{DataTypeProvider::provideDataType(DataType::Type::INT64), "5"};
+            return AndLogicalFunction{
+                GreaterEqualsLogicalFunction{leftValue, SubLogicalFunction{rightValue, five}},
+                LessEqualsLogicalFunction{leftValue, AddLogicalFunction{rightValue, five}}};
+        });
+
+    const auto joins = getOperatorByType<JoinLogicalOperator>(DecideJoinTypesRule(StreamJoinStrategy::OPTIMIZER_CHOOSES).apply(plan));
+    ASSERT_EQ(joins.size(), 1);
+    EXPECT_TRUE(joins[0]->getTraitSet().get<JoinImplementationTypeTrait>()->implementationType == JoinImplementation::SORT_MERGE_JOIN);
+
+    const auto bandPredicate = extractBandJoinPredicate(*joins[0]);
+    ASSERT_TRUE(bandPredicate.has_value());
+    EXPECT_TRUE(bandPredicate->keyEncoding == BandJoinPredicate::KeyEncoding::SIGNED);
+    EXPECT_TRUE(bandPredicate->hasOffsets);
+    EXPECT_FALSE(bandPredicate->offsetsCanWrap());
+}
+
+/// Range condition `left_value <= right_value` on UINT64 keys under OPTIMIZER_CHOOSES. Without offsets, nothing can wrap around, so
+/// verify SORT_MERGE_JOIN.
+TEST_F(DecideJoinTypesTest, RangeConditionWithoutOffsetsProducesSortMergeJoinTrait)
+{
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+    const auto plan = createInnerJoinPlan(
+        sourceCatalog,
+        sinkCatalog,
+        DataType::Type::UINT64,
+        [](const FieldAccessLogicalFunction& leftValue, const FieldAccessLogicalFunction& rightValue) -> LogicalFunction
+        { return LessEqualsLogicalFunction{leftValue, rightValue}; });
+
+    const auto joins = getOperatorByType<JoinLogicalOperator>(DecideJoinTypesRule(StreamJoinStrategy::OPTIMIZER_CHOOSES).apply(plan));
+    ASSERT_EQ(joins.size(), 1);
+    EXPECT_TRUE(joins[0]->getTraitSet().get<JoinImplementationTypeTrait>()->implementationType == JoinImplementation::SORT_MERGE_JOIN);
+
+    const auto bandPredicate = extractBandJoinPredicate(*joins[0]);
+    ASSERT_TRUE(bandPredicate.has_value());
+    EXPECT_EQ(bandPredicate->minDistance, 0);
+    EXPECT_EQ(bandPredicate->maxDistance, std::nullopt);
+    EXPECT_FALSE(bandPredicate->hasOffsets);
+    EXPECT_FALSE(bandPredicate->offsetsCanWrap());
+}
+
+/// Equi-join condition with the SORT_MERGE_JOIN strategy. Verify fallback to NLJ, as there is no range condition to sort on.
+TEST_F(DecideJoinTypesTest, ForcedSortMergeJoinWithoutRangeConditionFallsBackToNLJ)
+{
+    SourceCatalog sourceCatalog;
+    SinkCatalog sinkCatalog;
+
+    auto leftLogicalSource = createLogicalSource(sourceCatalog, Identifier::parse("LEFT_TEST"), createSchema("left"));
+    auto leftSourceDescriptor = createSourceDescriptor(sourceCatalog, leftLogicalSource);
+
+    auto rightLogicalSource = createLogicalSource(sourceCatalog, Identifier::parse("RIGHT_TEST"), createSchema("right"));
+    auto rightSourceDescriptor = createSourceDescriptor(sourceCatalog, rightLogicalSource);
+
+    const auto leftSourceOp = SourceDescriptorLogicalOperator::create(leftSourceDescriptor);
+    const auto rightSourceOp = SourceDescriptorLogicalOperator::create(rightSourceDescriptor);
+
+    auto joinFunction = EqualsLogicalFunction{
+        FieldAccessLogicalFunction{leftSourceOp->getOutputSchema().getFieldByName(Identifier::parse("left_id")).value()},
+        FieldAccessLogicalFunction{rightSourceOp->getOutputSchema().getFieldByName(Identifier::parse("right_id")).value()}};
+
+    auto characteristics = JoinLogicalOperator::createJoinTimeCharacteristic(
+        {Windowing::BoundTimeCharacteristic{Windowing::IngestionTimeCharacteristic{}},
+         Windowing::BoundTimeCharacteristic{Windowing::IngestionTimeCharacteristic{}}});
+
+    auto joinOp = JoinLogicalOperator::create(
+        std::array<LogicalOperator, 2>{leftSourceOp, rightSourceOp},
+        joinFunction,
+        createTumblingWindow(),
+        JoinLogicalOperator::JoinType::INNER_JOIN,
+        characteristics.value());
+
+    auto sinkDescriptor = createSinkDescriptor(sinkCatalog, Identifier::parse("test_sink"), createJoinOutputSchema(false, false));
+    auto sinkOp = SinkLogicalOperator::create(joinOp, sinkDescriptor);
+    const LogicalPlan plan{QueryId::create(LocalQueryId{generateUUID()}, getNextDistributedQueryId()), {sinkOp->withInferredSchema()}};
+
+    const DecideJoinTypesRule rule(StreamJoinStrategy::SORT_MERGE_JOIN);
+    auto result = rule.apply(plan);
+
+    auto joins = getOperatorByType<JoinLogicalOperator>(result);
+    ASSERT_EQ(joins.size(), 1);
+    auto trait = joins[0]->getTraitSet().get<JoinImplementationTypeTrait>();
+    EXPECT_TRUE(trait->implementationType == JoinImplementation::NESTED_LOOP_JOIN);
+}
+
+
 }
 }
 
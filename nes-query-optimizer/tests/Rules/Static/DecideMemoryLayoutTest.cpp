@@ -13,17 +13,20 @@
 */
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/UnboundField.hpp>
 #include <Functions/BooleanFunctions/EqualsLogicalFunction.hpp>
+#include <Functions/ConstantValueLogicalFunction.hpp>
 #include <Functions/FieldAccessLogicalFunction.hpp>
 #include <Functions/LogicalFunction.hpp>
 #include <Identifiers/Identifier.hpp>
@@ -31,8 +34,11 @@
 #include <Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Iterators/BFSIterator.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
 #include <Operators/Sinks/SinkLogicalOperator.hpp>
 #include <Operators/Sources/SourceDescriptorLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <Rules/Static/DecideMemoryLayoutRule.hpp>
@@ -60,6 +66,7 @@ namespace NES
 namespace
 {
 constexpr uint64_t TUMBLING_WINDOW_SIZE_MS = 1000;
+constexpr size_t WIDE_SCHEMA_FIELDS = 12;
 
 LogicalSource createLogicalTestSource(SourceCatalog& sourceCatalog, const std::string& name)
 {
@@ -70,6 +77,23 @@ LogicalSource createLogicalTestSource(SourceCatalog& sourceCatalog, const std::s
     return sourceCatalog.addLogicalSource(Identifier::parse(name), schema).value();
 }
 
+/// Schema with the fields <fieldPrefix>_0 to <fieldPrefix>_<numberOfFields - 1>.
+LogicalSource createWideLogicalTestSource(
+    SourceCatalog& sourceCatalog, const std::string& name, const std::string& fieldPrefix, const size_t numberOfFields)
+{
+    std::vector<UnqualifiedUnboundField> fields;
+    for (size_t field = 0; field < numberOfFields; ++field)
+    {
+        fields.emplace_back(Identifier::parse(fieldPrefix + "_" + std::to_string(field)), DataType::Type::UINT64);
+    }
+    return sourceCatalog.addLogicalSource(Identifier::parse(name), Schema<UnqualifiedUnboundField, Ordered>(fields)).value();
+}
+
+MemoryLayoutType getMemoryLayout(const LogicalOperator& op)
+{
+    return op.getTraitSet().get<MemoryLayoutTypeTrait>()->memoryLayout;
+}
+
 SourceDescriptor createTestSourceDescriptor(SourceCatalog& sourceCatalog, const LogicalSource& logicalSource)
 {
     const std::unordered_map<Identifier, std::string> sourceConfig{{Identifier::parse("file_path"), "/dev/null"}};
@@ -154,6 +178,68 @@ TEST_F(DecideMemoryLayoutTest, BinaryPlanAllGetRowLayout)
         EXPECT_TRUE(trait->memoryLayout == MemoryLayoutType::ROW_LAYOUT);
     }
 }
+
+/// Source → Selection → Union ← Selection ← Source, Union → Projection → Sink over a wide schema. The union starts a new pipeline, which
+/// scans the buffers that the pipelines of both selections emit in the union's layout. As the projection accesses only two of twelve
+/// fields, the union's output is columnar. The union accesses every field of the selections, which keep the row layout like the sources.
+TEST_F(DecideMemoryLayoutTest, NarrowProjectionOfWideUnionGetsColumnarLayout)
+{
+    const auto createSelection = [this](const std::string& sourceName)
+    {
+        const auto wideSource = createWideLogicalTestSource(sourceCatalog, sourceName, "wide", WIDE_SCHEMA_FIELDS);
+        const auto sourceOp = SourceDescriptorLogicalOperator::create(createTestSourceDescriptor(sourceCatalog, wideSource));
+        return SelectionLogicalOperator::create(
+            sourceOp,
+            EqualsLogicalFunction{
+                FieldAccessLogicalFunction{sourceOp->getOutputSchema()[Identifier::parse("wide_0")].value()},
+                ConstantValueLogicalFunction{DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}, "0"}});
+    };
+    const auto unionOp = UnionLogicalOperator::create(std::vector<LogicalOperator>{createSelection("wide"), createSelection("wide2")});
+    const std::vector<ProjectionLogicalOperator::UnboundProjection> projections{
+        {Identifier::parse("wide_0"), FieldAccessLogicalFunction{unionOp->getOutputSchema()[Identifier::parse("wide_0")].value()}},
+        {Identifier::parse("wide_1"), FieldAccessLogicalFunction{unionOp->getOutputSchema()[Identifier::parse("wide_1")].value()}}};
+    const auto projectionOp = ProjectionLogicalOperator::create(unionOp, projections, ProjectionLogicalOperator::Asterisk(false));
+    const auto sinkOp = SinkLogicalOperator::create(projectionOp, sinkDescriptor);
+    const LogicalPlan plan{QueryId::create(LocalQueryId{generateUUID()}, getNextDistributedQueryId()), {sinkOp}};
+
+    const auto result = DecideMemoryLayoutRule{}.apply(plan);
+
+    const auto sink = result.getRootOperators()[0];
+    const auto projection = sink.getChildren()[0];
+    const auto unionResult = projection.getChildren()[0];
+    EXPECT_EQ(getMemoryLayout(sink), MemoryLayoutType::ROW_LAYOUT);
+    EXPECT_EQ(getMemoryLayout(projection), MemoryLayoutType::ROW_LAYOUT);
+    EXPECT_EQ(getMemoryLayout(unionResult), MemoryLayoutType::COLUMNAR_LAYOUT);
+    ASSERT_EQ(unionResult.getChildren().size(), 2);
+    for (const auto& selection : unionResult.getChildren())
+    {
+        EXPECT_EQ(getMemoryLayout(selection), MemoryLayoutType::ROW_LAYOUT);
+        EXPECT_EQ(getMemoryLayout(selection.getChildren()[0]), MemoryLayoutType::ROW_LAYOUT);
+    }
+}
+
+/// Source → Selection → Projection → Sink over a narrow schema. All operators keep the row layout.
+TEST_F(DecideMemoryLayoutTest, NarrowSchemaKeepsRowLayout)
+{
+    const auto sourceOp = SourceDescriptorLogicalOperator::create(leftSourceDescriptor);
+    const auto selectionOp = SelectionLogicalOperator::create(
+        sourceOp,
+        EqualsLogicalFunction{
+            FieldAccessLogicalFunction{sourceOp->getOutputSchema()[Identifier::parse("left_id")].value()},
+            ConstantValueLogicalFunction{DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}, "0"}});
+    const std::vector<ProjectionLogicalOperator::UnboundProjection> projections{
+        {Identifier::parse("left_id"), FieldAccessLogicalFunction{selectionOp->getOutputSchema()[Identifier::parse("left_id")].value()}}};
+    const auto projectionOp = ProjectionLogicalOperator::create(selectionOp, projections, ProjectionLogicalOperator::Asterisk(false));
+    const auto sinkOp = SinkLogicalOperator::create(projectionOp, sinkDescriptor);
+    const LogicalPlan plan{QueryId::create(LocalQueryId{generateUUID()}, getNextDistributedQueryId()), {sinkOp}};
+
+    const auto result = DecideMemoryLayoutRule{}.apply(plan);
+
+    for (const auto& op : BFSRange(result.getRootOperators()[0]))
+    {
+        EXPECT_EQ(getMemoryLayout(op), MemoryLayoutType::ROW_LAYOUT);
+    }
+}
 }
 
 /// NOLINTEND(bugprone-unchecked-optional-access)
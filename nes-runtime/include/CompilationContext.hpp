@@ -13,10 +13,11 @@
 */
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -39,6 +40,8 @@ class CompilationContext;
 /// Copies share the resolution state. The contained ModuleFunction co-owns the compiled executable
 /// (nautilus shares the module state via shared_ptr), so the handle remains valid even after the
 /// CompiledExecutablePipelineStage and its CompiledModule are destroyed.
+/// A tiered pipeline resolves its handles twice: first against the interpreted module, and later, while other threads may invoke
+/// the handle, against the compiled module. Every resolution keeps its function alive and publishes it atomically.
 template <typename Signature>
 class PipelineFunction;
 
@@ -48,7 +51,8 @@ class PipelineFunction<R(Args...)>
     struct SharedState
     {
         std::string name;
-        std::optional<nautilus::engine::ModuleFunction<R(Args...)>> function;
+        std::vector<std::unique_ptr<nautilus::engine::ModuleFunction<R(Args...)>>> resolvedFunctions;
+        std::atomic<nautilus::engine::ModuleFunction<R(Args...)>*> function{nullptr};
     };
 
     explicit PipelineFunction(std::shared_ptr<SharedState> state) : state(std::move(state)) { }
@@ -60,8 +64,9 @@ class PipelineFunction<R(Args...)>
 public:
     R operator()(Args... args) const
     {
-        INVARIANT(state->function.has_value(), "Nautilus function '{}' was invoked before its pipeline module was compiled", state->name);
-        return (*state->function)(std::forward<Args>(args)...);
+        auto* const function = state->function.load(std::memory_order_acquire);
+        INVARIANT(function != nullptr, "Nautilus function '{}' was invoked before its pipeline module was compiled", state->name);
+        return (*function)(std::forward<Args>(args)...);
     }
 };
 
@@ -73,7 +78,8 @@ class CompilationContext
 {
     /// We assume that a compilation context never outlives the module; both live in CompiledExecutablePipelineStage::start()
     nautilus::engine::NautilusModule& module; /// NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-    std::vector<std::function<void(nautilus::engine::CompiledModule&)>> pendingResolvers;
+    std::vector<std::function<void(nautilus::engine::NautilusModule&)>> registrations;
+    std::vector<std::function<void(nautilus::engine::CompiledModule&)>> resolvers;
     uint64_t functionNameCounter = 0;
     /// Set once resolveAfterCompilation() has run; registering further functions afterwards would append a resolver
     /// that never runs, leaving its handle permanently unresolved, so it is a precondition violation.
@@ -93,9 +99,17 @@ public:
         /// main pipeline function, which carries no counter suffix.
         auto state = std::make_shared<typename Handle::SharedState>();
         state->name = fmt::format("{}_{}", namePrefix, functionNameCounter++);
-        module.registerFunction(state->name, std::move(func));
-        pendingResolvers.emplace_back([state](nautilus::engine::CompiledModule& compiledModule)
-                                      { state->function = compiledModule.getFunction<RawR(FunctionArguments...)>(state->name); });
+        module.registerFunction(state->name, func);
+        registrations.emplace_back([name = state->name, func = std::move(func)](nautilus::engine::NautilusModule& otherModule)
+                                   { otherModule.registerFunction(name, func); });
+        resolvers.emplace_back(
+            [state](nautilus::engine::CompiledModule& compiledModule)
+            {
+                auto& function = state->resolvedFunctions.emplace_back(
+                    std::make_unique<nautilus::engine::ModuleFunction<RawR(FunctionArguments...)>>(
+                        compiledModule.getFunction<RawR(FunctionArguments...)>(state->name)));
+                state->function.store(function.get(), std::memory_order_release);
+            });
         return Handle(std::move(state));
     }
 
@@ -120,12 +134,30 @@ public:
     /// Called by CompiledExecutablePipelineStage once, directly after compiling the pipeline's module.
     void resolveAfterCompilation(nautilus::engine::CompiledModule& compiledModule)
     {
-        for (const auto& resolver : pendingResolvers)
+        for (const auto& resolver : resolvers)
         {
             resolver(compiledModule);
         }
-        pendingResolvers.clear();
         compiled = true;
     }
+
+    [[nodiscard]] size_t getNumberOfRegisteredFunctions() const { return registrations.size(); }
+
+    /// Registers all functions in a second module, which a tiered pipeline compiles in the background. The returned resolver
+    /// switches all handles to the functions of that module once it is compiled, and remains valid after this context is gone.
+    std::function<void(nautilus::engine::CompiledModule&)> registerFunctionsIn(nautilus::engine::NautilusModule& otherModule) const
+    {
+        for (const auto& registration : registrations)
+        {
+            registration(otherModule);
+        }
+        return [resolvers = resolvers](nautilus::engine::CompiledModule& compiledModule)
+        {
+            for (const auto& resolver : resolvers)
+            {
+                resolver(compiledModule);
+            }
+        };
+    }
 };
 }
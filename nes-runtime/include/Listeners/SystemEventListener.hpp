@@ -58,7 +58,28 @@ struct StopQuerySystemEvent : BaseSystemEvent
     QueryId queryId = INVALID_QUERY_ID;
 };
 
-using SystemEvent = std::variant<SubmitQuerySystemEvent, StartQuerySystemEvent, StopQuerySystemEvent>;
+/// Emitted for every pipeline that the query compiler compiled before the query started. The timestamp is the start of the compilation.
+struct CompilePipelineSystemEvent : BaseSystemEvent
+{
+    CompilePipelineSystemEvent(
+        QueryId queryId,
+        PipelineId pipelineId,
+        ChronoClock::time_point start,
+        std::chrono::nanoseconds duration,
+        bool reusedCompiledCode)
+        : queryId(queryId), pipelineId(pipelineId), duration(duration), reusedCompiledCode(reusedCompiledCode)
+    {
+        timestamp = start;
+    }
+
+    CompilePipelineSystemEvent() = default;
+    QueryId queryId = INVALID_QUERY_ID;
+    PipelineId pipelineId = INVALID<PipelineId>;
+    std::chrono::nanoseconds duration{0};
+    bool reusedCompiledCode = false;
+};
+
+using SystemEvent = std::variant<SubmitQuerySystemEvent, StartQuerySystemEvent, StopQuerySystemEvent, CompilePipelineSystemEvent>;
 static_assert(std::is_default_constructible_v<SystemEvent>, "Events should be default constructible");
 
 struct SystemEventListener
@@ -0,0 +1,56 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+#include <Thread.hpp>
+
+namespace NES
+{
+
+/// Compiles pipelines on dedicated threads: all pipelines of a query concurrently before the query starts, or, in the TIERED execution
+/// mode, while the worker threads keep processing data with the interpreted pipelines. Jobs are started in submission order. Jobs that
+/// did not start before the compiler is destroyed are dropped.
+class BackgroundCompiler
+{
+public:
+    using Job = std::function<void()>;
+
+    explicit BackgroundCompiler(size_t numberOfThreads);
+    ~BackgroundCompiler();
+
+    BackgroundCompiler(const BackgroundCompiler&) = delete;
+    BackgroundCompiler& operator=(const BackgroundCompiler&) = delete;
+    BackgroundCompiler(BackgroundCompiler&&) = delete;
+    BackgroundCompiler& operator=(BackgroundCompiler&&) = delete;
+
+    void submit(Job job);
+
+private:
+    void run(const std::stop_token& stopToken);
+
+    std::mutex mutex;
+    std::condition_variable_any jobAvailable;
+    std::deque<Job> jobs;
+    /// Declared last, the threads have to stop before the queue is destroyed.
+    std::vector<Thread> threads;
+};
+
+}
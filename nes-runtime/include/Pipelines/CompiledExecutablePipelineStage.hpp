@@ -13,12 +13,21 @@
 */
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <new>
 #include <optional>
 #include <string_view>
 #include <unordered_map>
 #include <vector>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <nautilus/Engine.hpp>
@@ -29,38 +38,117 @@
 
 namespace NES
 {
+class CompilationContext;
 class DumpHelper;
 
 /// A compiled executable pipeline stage uses nautilus-lib to compile a pipeline to a code snippet.
 /// Each pipeline compiles into exactly one nautilus module that contains the main pipeline function
 /// alongside all functions that operators registered during setup().
+/// With a CompiledPipelineCache, a pipeline whose fingerprint equals the one of a previously compiled pipeline reuses its module.
+/// With a BackgroundCompiler (the TIERED execution mode), start() only prepares an interpreted module, and the stage executes the
+/// interpreted pipeline until the background compiler has compiled the pipeline, at which point it atomically switches over.
+/// Otherwise, the query compiler may compile the pipeline before start() via compileAheadOfTime().
 class CompiledExecutablePipelineStage final : public ExecutablePipelineStage
 {
 public:
     CompiledExecutablePipelineStage(
         std::shared_ptr<Pipeline> pipeline,
         std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandler,
-        nautilus::engine::Options options);
+        nautilus::engine::Options options,
+        std::shared_ptr<CompiledPipelineCache> compiledPipelineCache = nullptr,
+        std::shared_ptr<BackgroundCompiler> backgroundCompiler = nullptr);
+    /// Waits for an in-flight background compilation, as it traces this stage's pipeline.
+    ~CompiledExecutablePipelineStage() override;
+
+    CompiledExecutablePipelineStage(const CompiledExecutablePipelineStage&) = delete;
+    CompiledExecutablePipelineStage& operator=(const CompiledExecutablePipelineStage&) = delete;
+    CompiledExecutablePipelineStage(CompiledExecutablePipelineStage&&) = delete;
+    CompiledExecutablePipelineStage& operator=(CompiledExecutablePipelineStage&&) = delete;
+
+    /// Traces and compiles the pipeline before start(), which allows the query compiler to compile all pipelines of a query
+    /// concurrently. start() then only sets up the operators, unless they register functions during setup() that the module lacks.
+    /// Returns true if the module of a structurally equal pipeline was reused. Tiered stages compile in the background instead.
+    bool compileAheadOfTime();
+
     void start(PipelineExecutionContext& pipelineExecutionContext) override;
     void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
     void stop(PipelineExecutionContext& pipelineExecutionContext) override;
 
+    /// Returns true if execute() runs the compiled pipeline. A tiered stage runs the interpreted pipeline until the background
+    /// compiler has compiled it.
+    [[nodiscard]] bool executesCompiledPipeline() const;
+
 protected:
     std::ostream& toString(std::ostream& os) const override;
 
 private:
     using PipelineSignature = void(PipelineExecutionContext*, const TupleBuffer*, const Arena*);
+    using PipelineFunction = nautilus::engine::ModuleFunction<PipelineSignature>;
     static constexpr std::string_view PIPELINE_FUNCTION_NAME = "execute";
+    /// Together, the worker arenas of a stage retain at most 1/RETAINED_BUFFERS_POOL_DIVISOR of the buffer pool.
+    static constexpr size_t RETAINED_BUFFERS_POOL_DIVISOR = 64;
+
+    /// Each worker thread executes the pipeline with its own arena, which it resets after every invocation. Aligned to a cache line,
+    /// as the arenas of different worker threads are adjacent in memory.
+    struct alignas(std::hardware_destructive_interference_size) WorkerArena
+    {
+        Arena arena;
+    };
+
+    /// Lifecycle of the background compilation of a tiered stage. A queued compilation is cancelled if the stage stops first.
+    class BackgroundCompilation
+    {
+    public:
+        /// Returns false if the compilation was cancelled before it started.
+        bool begin();
+        void finish();
+        /// Cancels a queued compilation, or waits until a running one has finished.
+        void cancelOrAwait();
+
+    private:
+        enum class State : uint8_t
+        {
+            QUEUED,
+            RUNNING,
+            FINISHED,
+            CANCELLED
+        };
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        State state = State::QUEUED;
+    };
 
     /// Registers the pipeline's main traced function in the pipeline's module.
     void registerPipelineFunction(nautilus::engine::NautilusModule& module) const;
 
+    /// Reuses the module of a structurally equal pipeline from the cache. Returns false if there is none.
+    bool reuseCachedModule(CompilationContext& compilationCtx);
+    /// Traces and compiles the pipeline, and publishes the compiled pipeline function.
+    void compile(
+        nautilus::engine::NautilusModule& module,
+        const std::function<void(nautilus::engine::CompiledModule&)>& resolveRegisteredFunctions,
+        size_t numberOfRegisteredFunctions);
+    /// Publishes the interpreted pipeline function and submits the compilation of the pipeline to the background compiler.
+    void interpretAndCompileInBackground(CompilationContext& compilationCtx, nautilus::engine::NautilusModule& moduleToInterpret);
+
     nautilus::engine::NautilusEngine engine;
-    /// Both are created lazily in start(); neither type is default-constructible.
-    std::optional<nautilus::engine::CompiledModule> compiledModule;
-    std::optional<nautilus::engine::ModuleFunction<PipelineSignature>> compiledPipelineFunction;
+    /// Only set for tiered stages.
+    std::optional<nautilus::engine::NautilusEngine> interpretingEngine;
+    /// All modules and functions are created lazily in start() or compileAheadOfTime(). The compiled module may be shared with other
+    /// stages via the CompiledPipelineCache. A tiered stage keeps its interpreted function alive after switching, as a concurrent
+    /// execute() may still be running it.
+    std::shared_ptr<nautilus::engine::CompiledModule> interpretedModule;
+    std::shared_ptr<nautilus::engine::CompiledModule> compiledModule;
+    std::optional<PipelineFunction> interpretedPipelineFunction;
+    std::optional<PipelineFunction> compiledPipelineFunction;
+    std::atomic<PipelineFunction*> activePipelineFunction{nullptr};
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    /// Created in start() and released in stop(), indexed by the worker thread id.
+    std::vector<WorkerArena> workerArenas;
     std::shared_ptr<Pipeline> pipeline;
+    std::shared_ptr<CompiledPipelineCache> compiledPipelineCache;
+    std::shared_ptr<BackgroundCompiler> backgroundCompiler;
+    std::shared_ptr<BackgroundCompilation> backgroundCompilation;
 };
-
 }
@@ -0,0 +1,93 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <nautilus/Module.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineFingerprint.hpp>
+
+namespace NES
+{
+
+/// Keeps the compiled nautilus modules of pipelines, so that a structurally equal pipeline of a later query skips tracing and
+/// compilation. The cache lives as long as its query compiler, which implies that all entries were compiled under the same
+/// QueryExecutionConfiguration and the same nautilus options. Once the capacity is reached, the least recently used entry is evicted.
+class CompiledPipelineCache
+{
+public:
+    struct Entry
+    {
+        Entry(
+            std::shared_ptr<nautilus::engine::CompiledModule> compiledModule,
+            PhysicalOperator rootOperator,
+            std::vector<OperatorHandlerId> operatorHandlerIds,
+            size_t numberOfRegisteredFunctions,
+            std::chrono::nanoseconds compilationTime);
+
+        std::shared_ptr<nautilus::engine::CompiledModule> compiledModule;
+        /// The compiled code may reference the state of the operators it was traced from by address, e.g., the data of var-sized
+        /// constants. Keeps these operators alive for as long as the code can be handed out.
+        PhysicalOperator rootOperator;
+        /// The operator handler ids that the compiled code looks up, in the order of the operators of the fingerprint.
+        std::vector<OperatorHandlerId> operatorHandlerIds;
+        /// The number of functions that the operators registered during setup(). A module that was compiled ahead of setup() lacks
+        /// them, so a stage whose operators register functions must not reuse it.
+        size_t numberOfRegisteredFunctions;
+        std::chrono::nanoseconds compilationTime;
+        /// Serializes the lookup of functions in the compiled module by pipeline stages that start concurrently.
+        std::mutex resolutionMutex;
+    };
+
+    struct Statistics
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        std::chrono::nanoseconds savedCompilationTime{0};
+    };
+
+    explicit CompiledPipelineCache(size_t capacity);
+
+    /// Returns nullptr and counts a miss if no pipeline with an equal fingerprint was compiled before, or if its module lacks some
+    /// of the functions that the operators registered during setup().
+    std::shared_ptr<Entry> find(const PipelineFingerprint& fingerprint, size_t numberOfRegisteredFunctions);
+
+    /// Keeps an existing entry if another stage compiled an equal pipeline concurrently, unless the new entry's module contains
+    /// functions registered during setup() that the existing one lacks.
+    void insert(const PipelineFingerprint& fingerprint, std::shared_ptr<Entry> entry);
+
+    [[nodiscard]] Statistics getStatistics() const;
+
+private:
+    struct Slot
+    {
+        std::shared_ptr<Entry> entry;
+        uint64_t lastUsed;
+    };
+
+    size_t capacity;
+    mutable std::mutex mutex;
+    uint64_t useCounter = 0;
+    std::unordered_map<PipelineFingerprint, Slot> slots;
+    Statistics statistics;
+};
+
+}
@@ -61,6 +61,20 @@ public:
            "Fraction (0.0-1.0) of total memory reserved for unpooled buffers.",
            {std::make_shared<FloatValidation>(0, 1)}};
 
+    /// Directory in which unpooled buffers that exceed the unpooled memory share are backed by files. Instead of failing the query,
+    /// operator state then spills to disk: the kernel writes cold pages to the files and faults them back in on access.
+    StringOption spillDirectory
+        = {"spill_directory",
+           "",
+           "Directory for spilling unpooled buffers that exceed the unpooled memory share to disk (empty disables spilling)."};
+
+    /// Upper bound on the bytes that spill to disk. On breach, the requesting query fails with CannotAllocateBuffer.
+    UIntOption spillCapacityInBytes
+        = {"spill_capacity_in_bytes",
+           "17179869184",
+           "Maximum number of bytes of unpooled buffers that spill to disk.",
+           {std::make_shared<NumberValidation>()}};
+
     /// Byte alignment of every pooled and unpooled buffer. Must be a power of two and at most the page size;
     /// the default is a cache line (64 B).
     UIntOption bufferAlignmentInBytes
@@ -69,6 +83,18 @@ public:
            "Byte alignment of every buffer (power of two, <= page size).",
            {std::make_shared<PowerOfTwoValidation>()}};
 
+    /// Splits the pooled buffers into one sub-pool per NUMA node, whose memory is bound to the node. Worker and source threads prefer
+    /// buffers of the node they are running on.
+    BoolOption numaAwareBufferPools
+        = {"numa_aware_buffer_pools", "false", "Split the pooled buffers into one sub-pool per NUMA node, bound to the node's memory."};
+
+    /// Number of recycled buffers every thread keeps in a local cache in front of the shared buffer pool. Zero disables the caches.
+    UIntOption bufferThreadCacheSize
+        = {"buffer_thread_cache_size",
+           "0",
+           "Number of recycled buffers each thread keeps in a local cache in front of the buffer pool (0 disables the cache).",
+           {std::make_shared<NumberValidation>()}};
+
     /// Indicates how many buffers a single data source can allocate. This property controls the backpressure mechanism as a data source that can't allocate new records can't ingest more data.
     UIntOption defaultMaxInflightBuffers
         = {"default_max_inflight_buffers",
@@ -77,6 +103,13 @@ public:
            "SourceDescriptor).",
            {std::make_shared<NumberValidation>()}};
 
+    /// Number of shared I/O threads that read file and socket sources via io_uring. Zero keeps one blocking thread per source.
+    UIntOption ioUringIngestionThreads
+        = {"io_uring_ingestion_threads",
+           "0",
+           "Number of shared I/O threads that drive file and socket sources via io_uring (0 keeps one thread per source).",
+           {std::make_shared<NumberValidation>()}};
+
     EnumOption<DumpMode::Options> dumpQueryCompilationIR
         = {"dump_compilation_result",
            DumpMode::Options::NONE,
@@ -94,8 +127,13 @@ private:
             &network,
             &totalMemoryInBytes,
             &unpooledMemoryFraction,
+            &spillDirectory,
+            &spillCapacityInBytes,
             &bufferAlignmentInBytes,
+            &numaAwareBufferPools,
+            &bufferThreadCacheSize,
             &defaultMaxInflightBuffers,
+            &ioUringIngestionThreads,
             &dumpQueryCompilationIR,
             &dumpGraph};
     }
@@ -0,0 +1,74 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Pipelines/BackgroundCompiler.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <utility>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <Thread.hpp>
+
+namespace NES
+{
+
+BackgroundCompiler::BackgroundCompiler(const size_t numberOfThreads)
+{
+    PRECONDITION(numberOfThreads > 0, "The background compiler requires at least one thread");
+    threads.reserve(numberOfThreads);
+    for (size_t index = 0; index < numberOfThreads; ++index)
+    {
+        threads.emplace_back(fmt::format("compiler-{}", index), &BackgroundCompiler::run, this);
+    }
+}
+
+BackgroundCompiler::~BackgroundCompiler()
+{
+    for (auto& thread : threads)
+    {
+        thread.requestStop();
+    }
+    threads.clear();
+}
+
+void BackgroundCompiler::submit(Job job)
+{
+    {
+        const std::scoped_lock lock(mutex);
+        jobs.emplace_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+void BackgroundCompiler::run(const std::stop_token& stopToken)
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock lock(mutex);
+            /// The wait also returns true on a stop request if jobs are queued, which are dropped nonetheless.
+            if (not jobAvailable.wait(lock, stopToken, [this] { return not jobs.empty(); }) or stopToken.stop_requested())
+            {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+    }
+}
+
+}
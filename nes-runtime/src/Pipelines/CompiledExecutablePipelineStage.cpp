@@ -13,19 +13,28 @@
 */
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <ranges>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <Interface/RecordBuffer.hpp>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <cpptrace/from_current.hpp>
 #include <cpptrace/from_current_macros.hpp>
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <nautilus/val_ptr.hpp>
 #include <CompilationContext.hpp>
@@ -36,6 +45,7 @@
 #include <Pipeline.hpp>
 #include <function.hpp>
 #include <options.hpp>
+#include <scope_guard.hpp>
 
 namespace NES
 {
@@ -43,24 +53,99 @@ namespace NES
 CompiledExecutablePipelineStage::CompiledExecutablePipelineStage(
     std::shared_ptr<Pipeline> pipeline,
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers,
-    nautilus::engine::Options options)
-    : engine(options), operatorHandlers(std::move(operatorHandlers)), pipeline(std::move(pipeline))
+    nautilus::engine::Options options,
+    std::shared_ptr<CompiledPipelineCache> compiledPipelineCache,
+    std::shared_ptr<BackgroundCompiler> backgroundCompiler)
+    : engine(options)
+    , operatorHandlers(std::move(operatorHandlers))
+    , pipeline(std::move(pipeline))
+    , compiledPipelineCache(std::move(compiledPipelineCache))
+    , backgroundCompiler(std::move(backgroundCompiler))
 {
+    if (this->backgroundCompiler)
+    {
+        options.setOption("engine.Compilation", false);
+        interpretingEngine.emplace(options);
+    }
+}
+
+CompiledExecutablePipelineStage::~CompiledExecutablePipelineStage()
+{
+    if (backgroundCompilation)
+    {
+        backgroundCompilation->cancelOrAwait();
+    }
+}
+
+bool CompiledExecutablePipelineStage::BackgroundCompilation::begin()
+{
+    const std::scoped_lock lock(mutex);
+    if (state == State::CANCELLED)
+    {
+        return false;
+    }
+    state = State::RUNNING;
+    return true;
+}
+
+void CompiledExecutablePipelineStage::BackgroundCompilation::finish()
+{
+    {
+        const std::scoped_lock lock(mutex);
+        state = State::FINISHED;
+    }
+    finished.notify_all();
+}
+
+void CompiledExecutablePipelineStage::BackgroundCompilation::cancelOrAwait()
+{
+    std::unique_lock lock(mutex);
+    if (state == State::QUEUED)
+    {
+        state = State::CANCELLED;
+        return;
+    }
+    finished.wait(lock, [this] { return state != State::RUNNING; });
 }
 
 void CompiledExecutablePipelineStage::execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
-    INVARIANT(compiledPipelineFunction.has_value(), "execute() was called before start() compiled the pipeline");
+    /// A tiered stage switches from the interpreted to the compiled function while other worker threads execute the pipeline.
+    auto* const pipelineFunction = activePipelineFunction.load(std::memory_order_acquire);
+    INVARIANT(pipelineFunction != nullptr, "execute() was called before start() compiled the pipeline");
     /// we call the compiled pipeline function with an input buffer and the execution context
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
+    /// A pipeline never executes itself inline, so a worker thread's arena is not in use by another invocation.
+    if (const auto workerThreadId = pipelineExecutionContext.getWorkerThreadId().getRawValue(); workerThreadId < workerArenas.size())
+    {
+        auto& arena = workerArenas[workerThreadId].arena;
+        SCOPE_EXIT
+        {
+            arena.reset();
+        };
+        (*pipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+        return;
+    }
     Arena arena(pipelineExecutionContext.getBufferManager());
-    (*compiledPipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+    (*pipelineFunction)(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+}
+
+bool CompiledExecutablePipelineStage::executesCompiledPipeline() const
+{
+    /// The interpreted function is published in start() before the background compilation is submitted, so reading it does not race.
+    const auto* const pipelineFunction = activePipelineFunction.load(std::memory_order_acquire);
+    if (pipelineFunction == nullptr)
+    {
+        return false;
+    }
+    return not interpretedPipelineFunction.has_value() or pipelineFunction != std::addressof(*interpretedPipelineFunction);
 }
 
 void CompiledExecutablePipelineStage::registerPipelineFunction(nautilus::engine::NautilusModule& module) const
 {
     /// Capture the stage by pointer rather than the pipeline shared_ptr: this compiled function is only ever invoked
     /// through execute()/start()/stop() on the owning stage, so the stage (and thus its pipeline) outlives every call.
+    /// The background compilation of a tiered stage traces it as well, which the destructor of the stage awaits.
     /// Capturing the pipeline shared_ptr by value instead makes the compiled module co-own the pipeline, and because
     /// cached slices keep that module alive through their cleanup handle, it retains the pipeline (and its slice
     /// buffers) past teardown -- which leaks buffers in the sliceCache systests.
@@ -102,6 +187,153 @@ void CompiledExecutablePipelineStage::stop(PipelineExecutionContext& pipelineExe
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
     pipeline->getRootOperator().terminate(ctx);
+    /// Returns the buffers retained by the worker arenas to the pool, as no invocation of the pipeline follows.
+    workerArenas.clear();
+}
+
+bool CompiledExecutablePipelineStage::reuseCachedModule(CompilationContext& compilationCtx)
+{
+    if (not compiledPipelineCache)
+    {
+        return false;
+    }
+    const auto& fingerprint = pipeline->getFingerprint();
+    const auto entry = compiledPipelineCache->find(fingerprint, compilationCtx.getNumberOfRegisteredFunctions());
+    if (not entry)
+    {
+        return false;
+    }
+    /// The reused code looks up the operator handlers by the ids of the pipeline it was traced from, which map one-to-one
+    /// onto the ids of this pipeline.
+    for (const auto& [cachedId, ownId] : std::views::zip(entry->operatorHandlerIds, fingerprint.getOperatorHandlerIds()))
+    {
+        if (const auto handler = operatorHandlers.find(ownId); handler != operatorHandlers.end())
+        {
+            operatorHandlers.try_emplace(cachedId, handler->second);
+        }
+    }
+    /// The functions that the operators registered during setup() carry the same names as in the cached module.
+    const std::scoped_lock lock(entry->resolutionMutex);
+    compiledModule = entry->compiledModule;
+    compilationCtx.resolveAfterCompilation(*compiledModule);
+    compiledPipelineFunction = compiledModule->getFunction<PipelineSignature>(std::string{PIPELINE_FUNCTION_NAME});
+    activePipelineFunction.store(std::addressof(*compiledPipelineFunction), std::memory_order_release);
+    return true;
+}
+
+void CompiledExecutablePipelineStage::compile(
+    nautilus::engine::NautilusModule& module,
+    const std::function<void(nautilus::engine::CompiledModule&)>& resolveRegisteredFunctions,
+    const size_t numberOfRegisteredFunctions)
+{
+    const auto compilationStart = std::chrono::steady_clock::now();
+    auto newModule = std::make_shared<nautilus::engine::CompiledModule>(module.compile());
+    const auto compilationTime = std::chrono::steady_clock::now() - compilationStart;
+    resolveRegisteredFunctions(*newModule);
+    compiledPipelineFunction = newModule->getFunction<PipelineSignature>(std::string{PIPELINE_FUNCTION_NAME});
+    compiledModule = std::move(newModule);
+    activePipelineFunction.store(std::addressof(*compiledPipelineFunction), std::memory_order_release);
+
+    const auto& fingerprint = pipeline->getFingerprint();
+    if (compiledPipelineCache)
+    {
+        compiledPipelineCache->insert(
+            fingerprint,
+            std::make_shared<CompiledPipelineCache::Entry>(
+                compiledModule,
+                pipeline->getRootOperator(),
+                fingerprint.getOperatorHandlerIds(),
+                numberOfRegisteredFunctions,
+                compilationTime));
+    }
+
+    /// Surface nautilus' per-compilation statistics (tracing/IR/backend timings, generated code size).
+    /// getStatistics() is null in interpreted mode; the report is only formatted when debug logging is on.
+    if (const auto statistics = compiledModule->getStatistics())
+    {
+        NES_DEBUG(
+            "Nautilus compilation statistics for pipeline {}:\n{}",
+            pipeline->getPipelineId(),
+            statistics->formatReport(fmt::format("pipeline-{}", pipeline->getPipelineId()), engine.getNameOfBackend()));
+    }
+    if (compiledPipelineCache)
+    {
+        const auto cacheStatistics = compiledPipelineCache->getStatistics();
+        NES_DEBUG(
+            "Compiled pipeline cache after pipeline {}: {} hits, {} misses, {} of compilation saved",
+            pipeline->getPipelineId(),
+            cacheStatistics.hits,
+            cacheStatistics.misses,
+            std::chrono::duration_cast<std::chrono::milliseconds>(cacheStatistics.savedCompilationTime));
+    }
+}
+
+void CompiledExecutablePipelineStage::interpretAndCompileInBackground(
+    CompilationContext& compilationCtx, nautilus::engine::NautilusModule& moduleToInterpret)
+{
+    registerPipelineFunction(moduleToInterpret);
+    interpretedModule = std::make_shared<nautilus::engine::CompiledModule>(moduleToInterpret.compile());
+    compilationCtx.resolveAfterCompilation(*interpretedModule);
+    interpretedPipelineFunction = interpretedModule->getFunction<PipelineSignature>(std::string{PIPELINE_FUNCTION_NAME});
+    activePipelineFunction.store(std::addressof(*interpretedPipelineFunction), std::memory_order_release);
+
+    /// The background module contains the same functions as the interpreted one. The registered functions only trace the
+    /// operators, so the background thread does not interfere with worker threads executing the interpreted pipeline.
+    auto module = std::make_shared<nautilus::engine::NautilusModule>(engine.createModule());
+    auto resolveRegisteredFunctions = compilationCtx.registerFunctionsIn(*module);
+    const auto numberOfRegisteredFunctions = compilationCtx.getNumberOfRegisteredFunctions();
+    registerPipelineFunction(*module);
+    backgroundCompilation = std::make_shared<BackgroundCompilation>();
+    backgroundCompiler->submit(
+        [this,
+         compilation = backgroundCompilation,
+         module = std::move(module),
+         resolve = std::move(resolveRegisteredFunctions),
+         numberOfRegisteredFunctions]
+        {
+            if (not compilation->begin())
+            {
+                return;
+            }
+            CPPTRACE_TRY
+            {
+                compile(*module, resolve, numberOfRegisteredFunctions);
+                NES_DEBUG("Pipeline {} switched from interpreted to compiled execution", pipeline->getPipelineId());
+            }
+            CPPTRACE_CATCH(...)
+            {
+                NES_ERROR(
+                    "Could not compile pipeline {} in the background, it keeps running interpreted: {}",
+                    pipeline->getPipelineId(),
+                    wrapExternalException().what());
+            }
+            compilation->finish();
+        });
+}
+
+bool CompiledExecutablePipelineStage::compileAheadOfTime()
+{
+    PRECONDITION(not backgroundCompiler, "A tiered stage compiles its pipeline in the background");
+    PRECONDITION(not compiledModule, "The pipeline was already compiled");
+    CPPTRACE_TRY
+    {
+        /// The operators register their functions during setup(), which requires the pipeline execution context of start().
+        /// Until then, the context is empty, and a cached module contains at least the main pipeline function.
+        auto module = engine.createModule();
+        CompilationContext compilationCtx{module};
+        if (reuseCachedModule(compilationCtx))
+        {
+            return true;
+        }
+        registerPipelineFunction(module);
+        compile(module, [](nautilus::engine::CompiledModule&) { }, 0);
+        return false;
+    }
+    CPPTRACE_CATCH(...)
+    {
+        throw wrapExternalException(fmt::format("Could not query compile pipeline: {}", *pipeline));
+    }
+    std::unreachable();
 }
 
 std::ostream& CompiledExecutablePipelineStage::toString(std::ostream& os) const
@@ -112,30 +344,50 @@ std::ostream& CompiledExecutablePipelineStage::toString(std::ostream& os) const
 void CompiledExecutablePipelineStage::start(PipelineExecutionContext& pipelineExecutionContext)
 {
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
+    /// Every buffer retained by a worker arena is missing from the pool until the stage stops. With many worker threads and a small
+    /// pool, each arena retains fewer buffers, so that the arenas of all pipelines together do not drain the pool.
+    const auto numberOfWorkerThreads = pipelineExecutionContext.getNumberOfWorkerThreads();
+    const auto bufferManager = pipelineExecutionContext.getBufferManager();
+    const auto maxRetainedBuffers = std::min<size_t>(
+        Arena::DEFAULT_MAX_RETAINED_BUFFERS,
+        bufferManager->getNumOfPooledBuffers() / (RETAINED_BUFFERS_POOL_DIVISOR * std::max<size_t>(numberOfWorkerThreads, 1)));
+    workerArenas.reserve(numberOfWorkerThreads);
+    for (uint64_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+    {
+        workerArenas.emplace_back(Arena(bufferManager, maxRetainedBuffers));
+    }
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
     /// Each pipeline compiles into exactly one module: operators register named helper functions during setup(),
     /// the main pipeline function is added to the same module, and a single compile() call traces and compiles
     /// all of them together. Only afterwards do the handles handed out during setup() become invocable.
+    /// A tiered stage compiles the module in interpreted mode, which skips tracing, and compiles a second module in the background.
     CPPTRACE_TRY
     {
-        auto module = engine.createModule();
+        auto module = interpretingEngine ? interpretingEngine->createModule() : engine.createModule();
         CompilationContext compilationCtx{module};
         pipeline->getRootOperator().setup(ctx, compilationCtx);
-        registerPipelineFunction(module);
-        compiledModule = module.compile();
-        compilationCtx.resolveAfterCompilation(*compiledModule);
-        compiledPipelineFunction = compiledModule->getFunction<PipelineSignature>(std::string{PIPELINE_FUNCTION_NAME});
-
-        /// Surface nautilus' per-compilation statistics (tracing/IR/backend timings, generated code size).
-        /// getStatistics() is null in interpreted mode; the report is only formatted when debug logging is on.
-        if (const auto statistics = compiledModule->getStatistics())
+        /// A module compiled ahead of time only lacks the functions registered during setup(). If there are any, the cache may
+        /// still hold a module that contains them, otherwise the pipeline is compiled once more.
+        if (compiledModule and compilationCtx.getNumberOfRegisteredFunctions() == 0)
         {
-            NES_DEBUG(
-                "Nautilus compilation statistics for pipeline {}:\n{}",
-                pipeline->getPipelineId(),
-                statistics->formatReport(fmt::format("pipeline-{}", pipeline->getPipelineId()), engine.getNameOfBackend()));
+            compilationCtx.resolveAfterCompilation(*compiledModule);
+            return;
         }
+        if (reuseCachedModule(compilationCtx))
+        {
+            return;
+        }
+        if (backgroundCompiler)
+        {
+            interpretAndCompileInBackground(compilationCtx, module);
+            return;
+        }
+        registerPipelineFunction(module);
+        compile(
+            module,
+            [&compilationCtx](nautilus::engine::CompiledModule& compiled) { compilationCtx.resolveAfterCompilation(compiled); },
+            compilationCtx.getNumberOfRegisteredFunctions());
     }
     CPPTRACE_CATCH(...)
     {
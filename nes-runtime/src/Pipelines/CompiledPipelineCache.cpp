@@ -0,0 +1,92 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+#include <Pipelines/CompiledPipelineCache.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <nautilus/Module.hpp>
+#include <ErrorHandling.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineFingerprint.hpp>
+
+namespace NES
+{
+
+CompiledPipelineCache::Entry::Entry(
+    std::shared_ptr<nautilus::engine::CompiledModule> compiledModule,
+    PhysicalOperator rootOperator,
+    std::vector<OperatorHandlerId> operatorHandlerIds,
+    const size_t numberOfRegisteredFunctions,
+    const std::chrono::nanoseconds compilationTime)
+    : compiledModule(std::move(compiledModule))
+    , rootOperator(std::move(rootOperator))
+    , operatorHandlerIds(std::move(operatorHandlerIds))
+    , numberOfRegisteredFunctions(numberOfRegisteredFunctions)
+    , compilationTime(compilationTime)
+{
+}
+
+CompiledPipelineCache::CompiledPipelineCache(const size_t capacity) : capacity(capacity)
+{
+    PRECONDITION(capacity > 0, "The compiled pipeline cache requires a capacity of at least one pipeline");
+}
+
+std::shared_ptr<CompiledPipelineCache::Entry>
+CompiledPipelineCache::find(const PipelineFingerprint& fingerprint, const size_t numberOfRegisteredFunctions)
+{
+    const std::scoped_lock lock(mutex);
+    const auto slot = slots.find(fingerprint);
+    if (slot == slots.end() or slot->second.entry->numberOfRegisteredFunctions < numberOfRegisteredFunctions)
+    {
+        ++statistics.misses;
+        return nullptr;
+    }
+    ++statistics.hits;
+    statistics.savedCompilationTime += slot->second.entry->compilationTime;
+    slot->second.lastUsed = ++useCounter;
+    return slot->second.entry;
+}
+
+void CompiledPipelineCache::insert(const PipelineFingerprint& fingerprint, std::shared_ptr<Entry> entry)
+{
+    const std::scoped_lock lock(mutex);
+    if (const auto slot = slots.find(fingerprint); slot != slots.end())
+    {
+        if (slot->second.entry->numberOfRegisteredFunctions < entry->numberOfRegisteredFunctions)
+        {
+            slot->second = Slot{.entry = std::move(entry), .lastUsed = ++useCounter};
+        }
+        return;
+    }
+    if (slots.size() == capacity)
+    {
+        /// Stages that obtained the evicted entry keep its module alive.
+        slots.erase(std::ranges::min_element(slots, {}, [](const auto& slot) { return slot.second.lastUsed; }));
+    }
+    slots.emplace(fingerprint, Slot{.entry = std::move(entry), .lastUsed = ++useCounter});
+}
+
+CompiledPipelineCache::Statistics CompiledPipelineCache::getStatistics() const
+{
+    const std::scoped_lock lock(mutex);
+    return statistics;
+}
+
+}
@@ -16,11 +16,15 @@
 
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <utility>
+#include <vector>
 #include <Configuration/WorkerConfiguration.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Listeners/QueryLog.hpp>
+#include <Runtime/Allocator/FileBackedMemoryAllocator.hpp>
 #include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/Allocator/NumaMemoryAllocator.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/NodeEngine.hpp>
 #include <Sources/SourceProvider.hpp>
@@ -37,17 +41,37 @@ NodeEngineBuilder::NodeEngineBuilder(const WorkerConfiguration& workerConfigurat
 
 std::unique_ptr<NodeEngine> NodeEngineBuilder::build(const Host& host)
 {
+    std::vector<NumaNodeMemoryResource> pooledMemoryResources;
+    if (workerConfiguration.numaAwareBufferPools.getValue())
+    {
+        for (const auto numaNode : NumaMemoryAllocator::getOnlineNumaNodes())
+        {
+            pooledMemoryResources.emplace_back(numaNode, std::make_shared<NumaMemoryAllocator>(numaNode));
+        }
+    }
+
+    std::shared_ptr<std::pmr::memory_resource> spillMemoryResource;
+    if (not workerConfiguration.spillDirectory.getValue().empty())
+    {
+        spillMemoryResource = std::make_shared<FileBackedMemoryAllocator>(
+            workerConfiguration.spillDirectory.getValue(), workerConfiguration.spillCapacityInBytes.getValue());
+    }
+
     auto bufferManager = BufferManager::create(
         workerConfiguration.totalMemoryInBytes.getValue(),
         workerConfiguration.unpooledMemoryFraction.getValue(),
         NES::BufferAlignment{static_cast<uint32_t>(workerConfiguration.bufferAlignmentInBytes.getValue())},
         static_cast<uint32_t>(workerConfiguration.defaultQueryExecution.operatorBufferSize.getValue()),
-        std::make_shared<NesDefaultMemoryAllocator>());
+        std::make_shared<NesDefaultMemoryAllocator>(),
+        std::move(pooledMemoryResources),
+        workerConfiguration.bufferThreadCacheSize.getValue(),
+        std::move(spillMemoryResource));
     auto queryLog = std::make_shared<QueryLog>();
 
     auto queryEngine = std::make_unique<QueryEngine>(workerConfiguration.queryEngine, statisticsListener, queryLog, bufferManager, host);
 
-    auto sourceProvider = std::make_unique<SourceProvider>(workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager);
+    auto sourceProvider = std::make_unique<SourceProvider>(
+        workerConfiguration.defaultMaxInflightBuffers.getValue(), bufferManager, workerConfiguration.ioUringIngestionThreads.getValue());
 
     return std::make_unique<NodeEngine>(
         std::move(bufferManager), statisticsListener, std::move(queryLog), std::move(queryEngine), std::move(sourceProvider));
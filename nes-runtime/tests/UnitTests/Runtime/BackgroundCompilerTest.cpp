@@ -0,0 +1,60 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Pipelines/BackgroundCompiler.hpp>
+
+namespace NES
+{
+
+/// NOLINTBEGIN(readability-magic-numbers)
+TEST(BackgroundCompilerTest, SingleThreadRunsJobsInSubmissionOrder)
+{
+    constexpr size_t numberOfJobs = 100;
+    std::mutex mutex;
+    std::vector<size_t> executionOrder;
+    std::promise<void> allJobsDone;
+    {
+        BackgroundCompiler compiler(1);
+        for (size_t job = 0; job < numberOfJobs; ++job)
+        {
+            compiler.submit(
+                [&, job]
+                {
+                    const std::scoped_lock lock(mutex);
+                    executionOrder.emplace_back(job);
+                    if (executionOrder.size() == numberOfJobs)
+                    {
+                        allJobsDone.set_value();
+                    }
+                });
+        }
+        allJobsDone.get_future().wait();
+    }
+    ASSERT_EQ(executionOrder.size(), numberOfJobs);
+    for (size_t job = 0; job < numberOfJobs; ++job)
+    {
+        EXPECT_EQ(executionOrder[job], job);
+    }
+}
+
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -0,0 +1,401 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/UnboundField.hpp>
+#include <Identifiers/Identifier.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Identifiers/NESStrongType.hpp>
+#include <Identifiers/QualifiedIdentifier.hpp>
+#include <Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Interface/RecordBuffer.hpp>
+#include <Pipelines/BackgroundCompiler.hpp>
+#include <Pipelines/CompiledExecutablePipelineStage.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <folly/Synchronized.h>
+#include <gtest/gtest.h>
+#include <nautilus/val.hpp>
+#include <Arena.hpp>
+#include <BaseUnitTest.hpp>
+#include <EmitOperatorHandler.hpp>
+#include <EmitPhysicalOperator.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <Pipeline.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <PipelineFingerprint.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <TestTupleBuffer.hpp>
+#include <options.hpp>
+
+namespace NES
+{
+
+/// NOLINTBEGIN(readability-magic-numbers)
+constexpr uint32_t BUFFER_SIZE = 4096;
+constexpr uint32_t NUMBER_OF_POOLED_BUFFERS = 1000;
+constexpr NES::BufferAlignment BUFFER_ALIGNMENT{64};
+constexpr double UNPOOLED_MEMORY_FRACTION = 0.5;
+constexpr size_t TOTAL_MEMORY_IN_BYTES = 2 * static_cast<size_t>(NUMBER_OF_POOLED_BUFFERS) * BUFFER_SIZE;
+constexpr size_t NUMBER_OF_TUPLES = 100;
+
+/// Fills one more fixed-size arena buffer per invocation than an arena retains by default, before it opens its child.
+class ArenaAllocatingPhysicalOperator final : public PhysicalOperatorConcept
+{
+public:
+    static constexpr size_t NUMBER_OF_ALLOCATIONS = Arena::DEFAULT_MAX_RETAINED_BUFFERS + 1;
+
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override
+    {
+        for (size_t allocation = 0; allocation < NUMBER_OF_ALLOCATIONS; ++allocation)
+        {
+            [[maybe_unused]] const auto memory = executionCtx.allocateMemory(nautilus::val<size_t>(BUFFER_SIZE));
+        }
+        openChild(executionCtx, recordBuffer);
+    }
+
+    [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return child; }
+
+    void setChild(PhysicalOperator child) override { this->child = std::move(child); }
+
+private:
+    std::optional<PhysicalOperator> child;
+};
+
+class CompiledExecutablePipelineStageTest : public Testing::BaseUnitTest
+{
+protected:
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer& buffer, ContinuationPolicy) override
+        {
+            buffers.wlock()->emplace_back(buffer);
+            return true;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getWorkerThreadId() const override { return threadId; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return numberOfWorkerThreads; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override
+        {
+            return *operatorHandlers;
+        }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = &opHandlers;
+        }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        TupleBuffer& pinBuffer(TupleBuffer&& tupleBuffer) override
+        {
+            pinnedBuffers.emplace_back(std::make_unique<TupleBuffer>(std::move(tupleBuffer)));
+            return *pinnedBuffers.back();
+        }
+
+        MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager, const uint64_t numberOfWorkerThreads)
+            : bufferManager(std::move(bufferManager)), numberOfWorkerThreads(numberOfWorkerThreads)
+        {
+        }
+
+        folly::Synchronized<std::vector<TupleBuffer>> buffers;
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>* operatorHandlers = nullptr;
+        std::vector<std::unique_ptr<TupleBuffer>> pinnedBuffers;
+        WorkerThreadId threadId = INITIAL<WorkerThreadId>;
+        uint64_t numberOfWorkerThreads;
+    };
+
+public:
+    static void SetUpTestSuite() { Logger::setupLogging("CompiledExecutablePipelineStageTest.log", LogLevel::LOG_DEBUG); }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create(
+            TOTAL_MEMORY_IN_BYTES, UNPOOLED_MEMORY_FRACTION, BUFFER_ALIGNMENT, BUFFER_SIZE, std::make_shared<NesDefaultMemoryAllocator>());
+    }
+
+    static Testing::TestSchema testSchema()
+    {
+        return Testing::TestSchema{
+            {Identifier::parse("id"), DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}},
+            {Identifier::parse("value"), DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}}};
+    }
+
+    static nautilus::engine::Options compilerOptions()
+    {
+        nautilus::engine::Options options;
+        options.setOption("engine.Compilation", true);
+        options.setOption("engine.backend", std::string("mlir"));
+        options.setOption("engine.compilationStrategy", std::string("legacy"));
+        return options;
+    }
+
+    /// Creates a Scan -> Emit pipeline, whose fingerprint is recorded like the pipelining phase does.
+    static std::shared_ptr<Pipeline> createScanEmitPipeline(const OperatorHandlerId emitHandlerId)
+    {
+        const auto schema = testSchema();
+        const auto bufferRef = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, schema, MemoryLayoutType::ROW_LAYOUT);
+        const PhysicalOperator emit = EmitPhysicalOperator(emitHandlerId, bufferRef);
+        ScanPhysicalOperator scan(
+            bufferRef,
+            schema
+                | std::views::transform([](const UnqualifiedUnboundField& field)
+                                        { return static_cast<QualifiedIdentifier>(field.getFullyQualifiedName()); })
+                | std::ranges::to<std::vector>());
+        scan.setChild(emit);
+
+        auto pipeline = std::make_shared<Pipeline>(PhysicalOperator(scan));
+        pipeline->getOperatorHandlers().emplace(emitHandlerId, std::make_shared<EmitOperatorHandler>());
+        pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+            .physicalOperator = PhysicalOperator(scan).toString(),
+            .loweredFrom = std::nullopt,
+            .inputSchema = std::nullopt,
+            .outputSchema = std::nullopt,
+            .inputMemoryLayoutType = std::nullopt,
+            .outputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+            .parameters = fmt::format("bufferSize: {}", BUFFER_SIZE),
+            .operatorHandlerId = std::nullopt});
+        pipeline->getFingerprint().append(PipelineFingerprint::Operator{
+            .physicalOperator = emit.toString(),
+            .loweredFrom = std::nullopt,
+            .inputSchema = std::nullopt,
+            .outputSchema = std::nullopt,
+            .inputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+            .outputMemoryLayoutType = std::nullopt,
+            .parameters = fmt::format("bufferSize: {}", BUFFER_SIZE),
+            .operatorHandlerId = emitHandlerId});
+        return pipeline;
+    }
+
+    /// Creates a Scan -> ArenaAllocating -> Emit pipeline.
+    static std::shared_ptr<Pipeline> createArenaAllocatingPipeline(const OperatorHandlerId emitHandlerId)
+    {
+        const auto schema = testSchema();
+        const auto bufferRef = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, schema, MemoryLayoutType::ROW_LAYOUT);
+        ArenaAllocatingPhysicalOperator arenaAllocating;
+        arenaAllocating.setChild(EmitPhysicalOperator(emitHandlerId, bufferRef));
+        ScanPhysicalOperator scan(
+            bufferRef,
+            schema
+                | std::views::transform([](const UnqualifiedUnboundField& field)
+                                        { return static_cast<QualifiedIdentifier>(field.getFullyQualifiedName()); })
+                | std::ranges::to<std::vector>());
+        scan.setChild(arenaAllocating);
+
+        auto pipeline = std::make_shared<Pipeline>(PhysicalOperator(scan));
+        pipeline->getOperatorHandlers().emplace(emitHandlerId, std::make_shared<EmitOperatorHandler>());
+        return pipeline;
+    }
+
+    static std::unique_ptr<CompiledExecutablePipelineStage> createStage(
+        const std::shared_ptr<Pipeline>& pipeline,
+        const std::shared_ptr<CompiledPipelineCache>& compiledPipelineCache = nullptr,
+        const std::shared_ptr<BackgroundCompiler>& backgroundCompiler = nullptr)
+    {
+        return std::make_unique<CompiledExecutablePipelineStage>(
+            pipeline, pipeline->getOperatorHandlers(), compilerOptions(), compiledPipelineCache, backgroundCompiler);
+    }
+
+    /// Creates a buffer holding the tuples (firstId + i, 10 * (firstId + i)).
+    TupleBuffer createInputBuffer(const uint64_t firstId, const SequenceNumber sequenceNumber)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        buffer.setSequenceNumber(sequenceNumber);
+        buffer.setChunkNumber(ChunkNumber(1));
+        buffer.setLastChunk(true);
+        buffer.setOriginId(INITIAL<OriginId>);
+        Testing::TestTupleBuffer testBuffer(testSchema());
+        auto view = testBuffer.open(buffer, bufferManager.get());
+        for (uint64_t id = firstId; id < firstId + NUMBER_OF_TUPLES; ++id)
+        {
+            view.append(id, 10 * id);
+        }
+        return buffer;
+    }
+
+    /// Checks that the emitted buffers hold exactly the tuples of createInputBuffer(firstId, ...) and clears them.
+    static void expectEmittedTuples(MockedPipelineContext& pec, const uint64_t firstId)
+    {
+        std::vector<uint64_t> ids;
+        for (auto& buffer : *pec.buffers.wlock())
+        {
+            Testing::TestTupleBuffer testBuffer(testSchema());
+            auto view = testBuffer.open(buffer);
+            for (size_t row = 0; row < view.getNumberOfTuples(); ++row)
+            {
+                const auto id = view[row]["id"].as<uint64_t>();
+                EXPECT_EQ(view[row]["value"].as<uint64_t>(), 10 * id);
+                ids.emplace_back(id);
+            }
+        }
+        std::ranges::sort(ids);
+        EXPECT_EQ(ids, std::views::iota(firstId, firstId + NUMBER_OF_TUPLES) | std::ranges::to<std::vector>());
+        pec.buffers.wlock()->clear();
+    }
+
+    std::shared_ptr<BufferManager> bufferManager;
+};
+
+TEST_F(CompiledExecutablePipelineStageTest, ReusedModuleLooksUpTheOperatorHandlersOfTheReusingStage)
+{
+    const auto compiledPipelineCache = std::make_shared<CompiledPipelineCache>(4);
+
+    const auto firstPipeline = createScanEmitPipeline(OperatorHandlerId(1));
+    const auto firstStage = createStage(firstPipeline, compiledPipelineCache);
+    MockedPipelineContext firstPec(bufferManager, 1);
+    firstStage->start(firstPec);
+    firstStage->execute(createInputBuffer(0, SequenceNumber(1)), firstPec);
+    firstStage->stop(firstPec);
+    expectEmittedTuples(firstPec, 0);
+    EXPECT_EQ(compiledPipelineCache->getStatistics().hits, 0);
+
+    /// The second pipeline is structurally equal, but its emit uses another operator handler.
+    const auto secondPipeline = createScanEmitPipeline(OperatorHandlerId(2));
+    const auto secondHandler = secondPipeline->getOperatorHandlers().at(OperatorHandlerId(2));
+    const auto secondStage = createStage(secondPipeline, compiledPipelineCache);
+    MockedPipelineContext secondPec(bufferManager, 1);
+    secondStage->start(secondPec);
+    EXPECT_EQ(compiledPipelineCache->getStatistics().hits, 1);
+
+    /// The reused code looks up the handler by the id of the first pipeline, which has to resolve to the second stage's handler.
+    ASSERT_TRUE(secondPec.operatorHandlers->contains(OperatorHandlerId(1)));
+    EXPECT_EQ(secondPec.operatorHandlers->at(OperatorHandlerId(1)), secondHandler);
+    EXPECT_EQ(secondPec.operatorHandlers->at(OperatorHandlerId(2)), secondHandler);
+    EXPECT_NE(secondHandler, firstPipeline->getOperatorHandlers().at(OperatorHandlerId(1)));
+
+    secondStage->execute(createInputBuffer(1000, SequenceNumber(1)), secondPec);
+    secondStage->stop(secondPec);
+    expectEmittedTuples(secondPec, 1000);
+}
+
+TEST_F(CompiledExecutablePipelineStageTest, TieredStageSwitchesFromInterpretedToCompiledExecution)
+{
+    /// The single compiler thread starts its jobs in submission order. The first job occupies the thread until the test releases it,
+    /// which keeps the compilation of the stage queued.
+    const auto backgroundCompiler = std::make_shared<BackgroundCompiler>(1);
+    std::promise<void> releaseCompiler;
+    backgroundCompiler->submit([released = releaseCompiler.get_future().share()] { released.wait(); });
+
+    const auto stage = createStage(createScanEmitPipeline(OperatorHandlerId(1)), nullptr, backgroundCompiler);
+    MockedPipelineContext pec(bufferManager, 1);
+    stage->start(pec);
+    EXPECT_FALSE(stage->executesCompiledPipeline());
+    stage->execute(createInputBuffer(0, SequenceNumber(1)), pec);
+    expectEmittedTuples(pec, 0);
+
+    /// A job submitted after the compilation of the stage starts once the compilation has finished.
+    const auto compilationFinished = std::make_shared<std::promise<void>>();
+    backgroundCompiler->submit([compilationFinished] { compilationFinished->set_value(); });
+    releaseCompiler.set_value();
+    ASSERT_EQ(compilationFinished->get_future().wait_for(std::chrono::minutes(1)), std::future_status::ready);
+
+    EXPECT_TRUE(stage->executesCompiledPipeline());
+    stage->execute(createInputBuffer(1000, SequenceNumber(2)), pec);
+    stage->stop(pec);
+    expectEmittedTuples(pec, 1000);
+}
+
+TEST_F(CompiledExecutablePipelineStageTest, StageWithoutBackgroundCompilerExecutesCompiledPipeline)
+{
+    const auto stage = createStage(createScanEmitPipeline(OperatorHandlerId(1)));
+    MockedPipelineContext pec(bufferManager, 1);
+    EXPECT_FALSE(stage->executesCompiledPipeline());
+    stage->start(pec);
+    EXPECT_TRUE(stage->executesCompiledPipeline());
+    stage->execute(createInputBuffer(0, SequenceNumber(1)), pec);
+    stage->stop(pec);
+    expectEmittedTuples(pec, 0);
+}
+
+TEST_F(CompiledExecutablePipelineStageTest, WorkerArenasReturnTheirRetainedBuffersOnStop)
+{
+    const auto stage = createStage(createArenaAllocatingPipeline(OperatorHandlerId(1)));
+    MockedPipelineContext pec(bufferManager, 2);
+    const auto availableBuffersBeforeStart = bufferManager->getNumberOfAvailableBuffers();
+    stage->start(pec);
+
+    pec.threadId = WorkerThreadId(0);
+    stage->execute(createInputBuffer(0, SequenceNumber(1)), pec);
+    expectEmittedTuples(pec, 0);
+    pec.threadId = WorkerThreadId(1);
+    stage->execute(createInputBuffer(1000, SequenceNumber(2)), pec);
+    expectEmittedTuples(pec, 1000);
+
+    /// The arena of each worker thread keeps buffers for its next invocation, but only while the stage runs.
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffersBeforeStart - (2 * Arena::DEFAULT_MAX_RETAINED_BUFFERS));
+    stage->stop(pec);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffersBeforeStart);
+}
+
+TEST_F(CompiledExecutablePipelineStageTest, WorkerArenasRetainFewerBuffersWithManyWorkerThreads)
+{
+    /// The arenas of a stage retain at most 1/64 of the pool, which leaves a single buffer per arena for 8 worker threads.
+    constexpr uint64_t numberOfWorkerThreads = 8;
+    ASSERT_EQ(NUMBER_OF_POOLED_BUFFERS / (64 * numberOfWorkerThreads), 1U);
+
+    const auto stage = createStage(createArenaAllocatingPipeline(OperatorHandlerId(1)));
+    MockedPipelineContext pec(bufferManager, numberOfWorkerThreads);
+    const auto availableBuffersBeforeStart = bufferManager->getNumberOfAvailableBuffers();
+    stage->start(pec);
+
+    for (uint32_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+    {
+        pec.threadId = WorkerThreadId(workerThread);
+        stage->execute(createInputBuffer(1000 * workerThread, SequenceNumber(workerThread + 1)), pec);
+        expectEmittedTuples(pec, 1000 * workerThread);
+    }
+
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffersBeforeStart - numberOfWorkerThreads);
+    stage->stop(pec);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), availableBuffersBeforeStart);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+
+}
@@ -0,0 +1,212 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/UnboundField.hpp>
+#include <Identifiers/Identifier.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Pipelines/CompiledPipelineCache.hpp>
+#include <Schema/Schema.hpp>
+#include <Schema/SchemaFwd.hpp>
+#include <EmitPhysicalOperator.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineFingerprint.hpp>
+
+namespace NES
+{
+namespace
+{
+
+/// NOLINTBEGIN(readability-magic-numbers)
+constexpr size_t BUFFER_SIZE = 4096;
+
+Schema<UnqualifiedUnboundField, Ordered> testSchema()
+{
+    return Schema<UnqualifiedUnboundField, Ordered>{
+        {Identifier::parse("id"), DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}},
+        {Identifier::parse("value"), DataType{DataType::Type::UINT64, DataType::NULLABLE::NOT_NULLABLE}}};
+}
+
+PipelineFingerprint::Operator scanFingerprint(const size_t bufferSize = BUFFER_SIZE)
+{
+    return PipelineFingerprint::Operator{
+        .physicalOperator = "PhysicalOperator(NES::ScanPhysicalOperator)",
+        .loweredFrom = std::nullopt,
+        .inputSchema = std::nullopt,
+        .outputSchema = std::nullopt,
+        .inputMemoryLayoutType = std::nullopt,
+        .outputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+        .parameters = fmt::format("bufferSize: {}", bufferSize),
+        .operatorHandlerId = std::nullopt};
+}
+
+PipelineFingerprint::Operator handlerFingerprint(const std::string& physicalOperator, const OperatorHandlerId operatorHandlerId)
+{
+    return PipelineFingerprint::Operator{
+        .physicalOperator = physicalOperator,
+        .loweredFrom = std::nullopt,
+        .inputSchema = std::nullopt,
+        .outputSchema = std::nullopt,
+        .inputMemoryLayoutType = MemoryLayoutType::ROW_LAYOUT,
+        .outputMemoryLayoutType = std::nullopt,
+        .parameters = fmt::format("bufferSize: {}", BUFFER_SIZE),
+        .operatorHandlerId = operatorHandlerId};
+}
+
+/// Scan -> Emit, the emit using the given operator handler.
+PipelineFingerprint scanEmit(const OperatorHandlerId emitHandlerId, const size_t bufferSize = BUFFER_SIZE)
+{
+    PipelineFingerprint fingerprint;
+    fingerprint.append(scanFingerprint(bufferSize));
+    fingerprint.append(handlerFingerprint("PhysicalOperator(NES::EmitPhysicalOperator)", emitHandlerId));
+    return fingerprint;
+}
+
+std::shared_ptr<CompiledPipelineCache::Entry>
+makeEntry(const PipelineFingerprint& fingerprint, const size_t numberOfRegisteredFunctions = 0)
+{
+    const auto bufferRef = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, testSchema(), MemoryLayoutType::ROW_LAYOUT);
+    return std::make_shared<CompiledPipelineCache::Entry>(
+        nullptr,
+        PhysicalOperator(EmitPhysicalOperator(OperatorHandlerId(1), bufferRef)),
+        fingerprint.getOperatorHandlerIds(),
+        numberOfRegisteredFunctions,
+        std::chrono::milliseconds(10));
+}
+}
+
+TEST(PipelineFingerprintTest, StructurallyEqualPipelinesHaveEqualFingerprints)
+{
+    const auto fingerprint = scanEmit(OperatorHandlerId(1));
+    const auto otherHandlerIds = scanEmit(OperatorHandlerId(42));
+    EXPECT_EQ(fingerprint, scanEmit(OperatorHandlerId(1)));
+    EXPECT_EQ(fingerprint, otherHandlerIds);
+    EXPECT_EQ(fingerprint.hash(), otherHandlerIds.hash());
+}
+
+TEST(PipelineFingerprintTest, AnyOperatorDifferenceChangesTheFingerprint)
+{
+    const auto fingerprint = scanEmit(OperatorHandlerId(1));
+
+    auto otherOperator = scanEmit(OperatorHandlerId(1));
+    otherOperator.append(handlerFingerprint("PhysicalOperator(NES::SelectionPhysicalOperator)", OperatorHandlerId(2)));
+    EXPECT_NE(fingerprint, otherOperator);
+
+    PipelineFingerprint otherType;
+    otherType.append(scanFingerprint());
+    otherType.append(handlerFingerprint("PhysicalOperator(NES::AggregationBuildPhysicalOperator)", OperatorHandlerId(1)));
+    EXPECT_NE(fingerprint, otherType);
+
+    PipelineFingerprint otherLayout;
+    auto columnarScan = scanFingerprint();
+    columnarScan.outputMemoryLayoutType = MemoryLayoutType::COLUMNAR_LAYOUT;
+    otherLayout.append(std::move(columnarScan));
+    otherLayout.append(handlerFingerprint("PhysicalOperator(NES::EmitPhysicalOperator)", OperatorHandlerId(1)));
+    EXPECT_NE(fingerprint, otherLayout);
+
+    PipelineFingerprint otherSchema;
+    auto scanWithSchema = scanFingerprint();
+    scanWithSchema.outputSchema = testSchema() | std::ranges::to<Schema<QualifiedUnboundField, Ordered>>();
+    otherSchema.append(std::move(scanWithSchema));
+    otherSchema.append(handlerFingerprint("PhysicalOperator(NES::EmitPhysicalOperator)", OperatorHandlerId(1)));
+    EXPECT_NE(fingerprint, otherSchema);
+}
+
+TEST(PipelineFingerprintTest, ConfigurationDifferenceChangesTheFingerprint)
+{
+    /// The pipelining phase records the configured buffer size in the parameters of the scans and emits it adds.
+    EXPECT_NE(scanEmit(OperatorHandlerId(1), BUFFER_SIZE), scanEmit(OperatorHandlerId(1), 2 * BUFFER_SIZE));
+}
+
+TEST(PipelineFingerprintTest, OperatorHandlerIdsMustMapOneToOne)
+{
+    /// The build and the probe of a join share an operator handler, which must hold for both pipelines.
+    const auto sharedHandler = [](const OperatorHandlerId first, const OperatorHandlerId second)
+    {
+        PipelineFingerprint fingerprint;
+        fingerprint.append(scanFingerprint());
+        fingerprint.append(handlerFingerprint("PhysicalOperator(NES::NLJBuildPhysicalOperator)", first));
+        fingerprint.append(handlerFingerprint("PhysicalOperator(NES::NLJProbePhysicalOperator)", second));
+        return fingerprint;
+    };
+    EXPECT_EQ(sharedHandler(OperatorHandlerId(1), OperatorHandlerId(1)), sharedHandler(OperatorHandlerId(7), OperatorHandlerId(7)));
+    EXPECT_EQ(sharedHandler(OperatorHandlerId(1), OperatorHandlerId(2)), sharedHandler(OperatorHandlerId(8), OperatorHandlerId(7)));
+    EXPECT_NE(sharedHandler(OperatorHandlerId(1), OperatorHandlerId(1)), sharedHandler(OperatorHandlerId(7), OperatorHandlerId(8)));
+    EXPECT_NE(sharedHandler(OperatorHandlerId(1), OperatorHandlerId(2)), sharedHandler(OperatorHandlerId(7), OperatorHandlerId(7)));
+}
+
+TEST(CompiledPipelineCacheTest, FindsStructurallyEqualPipelines)
+{
+    CompiledPipelineCache cache(4);
+    const auto entry = makeEntry(scanEmit(OperatorHandlerId(1)));
+    cache.insert(scanEmit(OperatorHandlerId(1)), entry);
+
+    EXPECT_EQ(cache.find(scanEmit(OperatorHandlerId(5)), 0), entry);
+    EXPECT_EQ(cache.find(scanEmit(OperatorHandlerId(1), 2 * BUFFER_SIZE), 0), nullptr);
+
+    const auto statistics = cache.getStatistics();
+    EXPECT_EQ(statistics.hits, 1);
+    EXPECT_EQ(statistics.misses, 1);
+    EXPECT_EQ(statistics.savedCompilationTime, std::chrono::milliseconds(10));
+}
+
+TEST(CompiledPipelineCacheTest, MissesModulesThatLackRegisteredFunctions)
+{
+    CompiledPipelineCache cache(4);
+    const auto fingerprint = scanEmit(OperatorHandlerId(1));
+    cache.insert(fingerprint, makeEntry(fingerprint, 0));
+    EXPECT_EQ(cache.find(fingerprint, 2), nullptr);
+
+    /// A module that contains the registered functions replaces one compiled ahead of setup(), but not the other way around.
+    const auto complete = makeEntry(fingerprint, 2);
+    cache.insert(fingerprint, complete);
+    cache.insert(fingerprint, makeEntry(fingerprint, 0));
+    EXPECT_EQ(cache.find(fingerprint, 2), complete);
+    EXPECT_EQ(cache.find(fingerprint, 0), complete);
+}
+
+TEST(CompiledPipelineCacheTest, EvictsTheLeastRecentlyUsedPipeline)
+{
+    CompiledPipelineCache cache(2);
+    const auto first = scanEmit(OperatorHandlerId(1), 1024);
+    const auto second = scanEmit(OperatorHandlerId(1), 2048);
+    const auto third = scanEmit(OperatorHandlerId(1), 4096);
+    cache.insert(first, makeEntry(first));
+    cache.insert(second, makeEntry(second));
+
+    /// Using the first pipeline makes the second the least recently used one.
+    ASSERT_NE(cache.find(first, 0), nullptr);
+    cache.insert(third, makeEntry(third));
+
+    EXPECT_NE(cache.find(first, 0), nullptr);
+    EXPECT_EQ(cache.find(second, 0), nullptr);
+    EXPECT_NE(cache.find(third, 0), nullptr);
+}
+
+/// NOLINTEND(readability-magic-numbers)
+
+}
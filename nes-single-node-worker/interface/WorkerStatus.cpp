@@ -67,6 +67,13 @@ void serializeWorkerStatus(const WorkerStatus& status, WorkerStatusResponse* res
                 exception.where().transform([](const auto& where) { return where.line.value_or(-1); }).value_or(-1)));
         }
     }
+    for (const auto& bufferPool : status.bufferPools)
+    {
+        auto* bufferPoolGRPC = response->add_buffer_pools();
+        bufferPoolGRPC->set_numa_node(bufferPool.numaNode);
+        bufferPoolGRPC->set_pooled_buffers(bufferPool.numberOfPooledBuffers);
+        bufferPoolGRPC->set_available_buffers(bufferPool.numberOfAvailableBuffers);
+    }
     response->set_after_unix_timestamp_in_milli_seconds(
         std::chrono::duration_cast<std::chrono::milliseconds>(status.after.time_since_epoch()).count());
     response->set_until_unix_timestamp_in_milli_seconds(
@@ -106,6 +113,16 @@ WorkerStatus deserializeWorkerStatus(const WorkerStatusResponse* response)
                             ? std::make_optional(Exception(terminatedQuery.error().message(), terminatedQuery.error().code()))
                             : std::nullopt};
                 })
+            | std::ranges::to<std::vector>(),
+        .bufferPools = response->buffer_pools()
+            | std::views::transform(
+                           [](const auto& bufferPool)
+                           {
+                               return WorkerStatus::BufferPool{
+                                   .numaNode = bufferPool.numa_node(),
+                                   .numberOfPooledBuffers = bufferPool.pooled_buffers(),
+                                   .numberOfAvailableBuffers = bufferPool.available_buffers()};
+                           })
             | std::ranges::to<std::vector>()};
 }
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
@@ -45,12 +46,21 @@ struct WorkerStatus
         std::optional<Exception> error;
     };
 
+    /// Occupancy of the pooled buffers allocated on a single NUMA node at the time the status was requested
+    struct BufferPool
+    {
+        size_t numaNode = 0;
+        size_t numberOfPooledBuffers = 0;
+        size_t numberOfAvailableBuffers = 0;
+    };
+
     /// Currently we will not store all historical data on the WorkerNode.
     /// This timestamp indicates which events are captured by the WorkerStatus
     std::chrono::system_clock::time_point after;
     std::chrono::system_clock::time_point until;
     std::vector<ActiveQuery> activeQueries;
     std::vector<TerminatedQuery> terminatedQueries;
+    std::vector<BufferPool> bufferPools;
 };
 
 void serializeWorkerStatus(const WorkerStatus& status, WorkerStatusResponse* response);
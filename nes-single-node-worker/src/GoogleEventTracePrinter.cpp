@@ -151,6 +151,21 @@ void GoogleEventTracePrinter::threadRoutine(const std::stop_token& token)
                         SYSTEM_THREAD,
                         timestampToMicroseconds(stopEvent.timestamp));
                 },
+                [&](const CompilePipelineSystemEvent& compileEvent)
+                {
+                    printComma();
+                    fmt::print(
+                        file,
+                        R"x(    {{"args":{{"pipeline_id":{},"reused_compiled_code":{}}},"cat":"system","dur":{},"name":"Compile Pipeline {} (Query {})","ph":"X","pid":{},"tid":{},"ts":{}}})x",
+                        compileEvent.pipelineId.getRawValue(),
+                        compileEvent.reusedCompiledCode,
+                        std::chrono::duration_cast<std::chrono::microseconds>(compileEvent.duration).count(),
+                        compileEvent.pipelineId,
+                        compileEvent.queryId,
+                        pid,
+                        SYSTEM_THREAD,
+                        timestampToMicroseconds(compileEvent.timestamp));
+                },
                 [&](const QueryStart& queryStart)
                 {
                     printComma();
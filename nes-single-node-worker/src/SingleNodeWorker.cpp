@@ -28,7 +28,9 @@
 #include <Identifiers/NESStrongType.hpp>
 #include <Identifiers/NESStrongTypeFormat.hpp>
 #include <Listeners/QueryLog.hpp>
+#include <Listeners/SystemEventListener.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Runtime/BufferManager.hpp>
 #include <Runtime/NodeEngineBuilder.hpp>
 
 #include <Util/Logger/Logger.hpp>
@@ -36,6 +38,7 @@
 #include <Util/Pointers.hpp>
 #include <Util/UUID.hpp>
 #include <cpptrace/from_current.hpp>
+#include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <CompositeStatisticListener.hpp>
 #include <ErrorHandling.hpp>
@@ -122,6 +125,16 @@ std::expected<QueryId, Exception> SingleNodeWorker::startQuery(LogicalPlan plan)
         request->dumpCompilationResult = dumpMode;
         auto result = compiler->compileQuery(std::move(request));
         INVARIANT(result, "expected successful query compilation or exception, but got nothing");
+        for (const auto& compilation : result->pipelineCompilations)
+        {
+            NES_DEBUG(
+                "Compiled pipeline {} in {}{}",
+                compilation.pipelineId,
+                std::chrono::duration_cast<std::chrono::microseconds>(compilation.duration),
+                compilation.reusedCompiledCode ? " (reused compiled code)" : "");
+            listener->onEvent(CompilePipelineSystemEvent{
+                plan.getQueryId(), compilation.pipelineId, compilation.start, compilation.duration, compilation.reusedCompiledCode});
+        }
         nodeEngine->startQuery(plan.getQueryId(), std::move(result));
         return plan.getQueryId();
     }
@@ -213,6 +226,10 @@ WorkerStatus SingleNodeWorker::getWorkerStatus(std::chrono::system_clock::time_p
             }
         }
     }
+    for (const auto& [numaNode, numberOfPooledBuffers, numberOfAvailableBuffers] : nodeEngine->getBufferManager()->getPoolStatistics())
+    {
+        status.bufferPools.emplace_back(numaNode, numberOfPooledBuffers, numberOfAvailableBuffers);
+    }
     return status;
 }
 
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <variant>
@@ -58,6 +60,16 @@ public:
         [[nodiscard]] size_t getNumberOfBytes() const { return std::get<Data>(result).sizeInBytes; }
     };
 
+    /// Describes how the io_uring ingestion backend reads from a source that opted into it.
+    struct AsyncReadTarget
+    {
+        int fileDescriptor;
+        /// Positional reads track the offset in the backend (files). Otherwise, reads consume from the descriptor (sockets, pipes).
+        bool positional;
+        /// A partially filled buffer is emitted once this interval passed since its first read. Zero only emits full buffers.
+        std::chrono::milliseconds flushInterval{0};
+    };
+
     Source() = default;
     virtual ~Source() = default;
 
@@ -74,6 +86,11 @@ public:
 
     [[nodiscard]] virtual bool addsMetadata() const { return false; }
 
+    /// Called once after 'open()', if the worker runs the io_uring ingestion backend. Sources that return a target are not asked
+    /// to fill buffers. Instead, the backend reads from the descriptor directly into pooled buffers. Only 'close()' is called
+    /// afterward, and the descriptor must remain valid until then.
+    [[nodiscard]] virtual std::optional<AsyncReadTarget> getAsyncReadTarget() { return std::nullopt; }
+
 protected:
     /// Implemented by children of Source. Called by '<<'. Allows to use '<<' on abstract Source.
     [[nodiscard]] virtual std::ostream& toString(std::ostream& str) const = 0;
@@ -30,6 +30,7 @@ namespace NES
 
 /// Hides SourceThread implementation.
 class SourceThread;
+class IoUringIngestion;
 
 struct SourceRuntimeConfiguration
 {
@@ -49,7 +50,8 @@ public:
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         SourceRuntimeConfiguration configuration,
         std::shared_ptr<AbstractBufferProvider> bufferPool,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<IoUringIngestion> ingestion = nullptr);
 
     ~SourceHandle();
 
@@ -24,6 +24,7 @@
 
 namespace NES
 {
+class IoUringIngestion;
 
 /// Takes a SourceDescriptor and in exchange returns a SourceHandle.
 /// The SourceThread spawns an independent thread for data ingestion and it manages the pipeline and task logic.
@@ -32,10 +33,15 @@ class SourceProvider
 {
     size_t defaultMaxInflightBuffers;
     std::shared_ptr<AbstractBufferProvider> bufferPool;
+    /// Shared by all sources of this provider, nullptr if sources are driven by their own threads.
+    std::shared_ptr<IoUringIngestion> ingestion;
 
 public:
     /// Constructor that can be configured with various options
-    SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool);
+    /// If `numberOfIoUringThreads` is non-zero and the kernel supports io_uring, sources that read from a file descriptor are
+    /// driven by that many shared I/O threads instead of one thread per source.
+    SourceProvider(
+        size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool, size_t numberOfIoUringThreads = 0);
 
     /// Returning a shared pointer, because sources may be shared by multiple executable query plans (qeps).
     [[nodiscard]] std::unique_ptr<SourceHandle>
@@ -56,6 +56,9 @@ public:
     /// Close file socket.
     void close() override;
 
+    /// Lets the io_uring ingestion read the file via positional reads. Memory-mapped sources keep handing out their mapping.
+    [[nodiscard]] std::optional<AsyncReadTarget> getAsyncReadTarget() override;
+
     /// validates and formats a string to string configuration
     static DescriptorConfig::Config validateAndFormat(std::unordered_map<std::string, std::string> config);
 
@@ -66,8 +69,21 @@ public:
     [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
 
 private:
+    /// Read-only view of the complete input file. Buffers handed out in memory-mapped mode share ownership of the mapping,
+    /// because the query engine may still hold them after the source was closed.
+    struct MappedFile;
+
+    static std::shared_ptr<MappedFile> mapFile(const char* path);
+
+    /// Hands out the next region of the mapped file as a wrapped TupleBuffer instead of copying it into `tupleBuffer`.
+    FillTupleBufferResult fillTupleBufferFromMapping(TupleBuffer& tupleBuffer);
+
     std::ifstream inputFile;
     std::string filePath;
+    bool memoryMapped;
+    std::shared_ptr<MappedFile> mappedFile;
+    size_t mappedFileOffset = 0;
+    int asyncFileDescriptor = -1;
     std::atomic<size_t> totalNumBytesRead;
 };
 
@@ -78,8 +94,15 @@ struct ConfigParametersCSV
         std::nullopt,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
 
+    /// Maps the file into memory and emits regions of the mapping as buffers, so that the input formatter reads directly
+    /// from the page cache instead of from a copy.
+    static inline const DescriptorConfig::ConfigParameter<bool> MEMORY_MAPPED{
+        "MEMORY_MAPPED",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MEMORY_MAPPED, config); }};
+
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH);
+        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH, MEMORY_MAPPED);
 };
 
 }
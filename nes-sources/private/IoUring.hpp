@@ -0,0 +1,103 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <linux/io_uring.h>
+#include <linux/time_types.h>
+
+namespace NES
+{
+
+/// Minimal wrapper around a single io_uring instance, driven via the raw io_uring_setup/io_uring_enter system calls.
+/// An IoUring is not thread-safe, it is owned and driven by exactly one thread.
+/// Requests are queued via the prepare* functions, which return false if the submission queue is full. `submitAndWait` submits
+/// all queued requests and blocks until at least one completion is available, which `drainCompletions` hands to the caller.
+class IoUring
+{
+public:
+    /// Offset value that makes a read use (and advance) the current file position, as required for sockets and pipes.
+    static constexpr uint64_t CURRENT_POSITION = static_cast<uint64_t>(-1);
+
+    /// Throws CannotOpenSource if the kernel does not provide io_uring, or if it is disabled.
+    explicit IoUring(uint32_t entries);
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+    IoUring(IoUring&&) = delete;
+    IoUring& operator=(IoUring&&) = delete;
+
+    /// Returns true if io_uring rings can be created in this process.
+    [[nodiscard]] static bool isSupported();
+
+    [[nodiscard]] uint32_t getNumberOfEntries() const { return submissionEntries; }
+
+    /// Reads up to `length` bytes of `fileDescriptor` at `offset` into `destination`.
+    [[nodiscard]] bool prepareRead(int fileDescriptor, uint8_t* destination, uint32_t length, uint64_t offset, uint64_t userData);
+    /// Cancels the in-flight request that was submitted with `targetUserData`. Its completion reports -ECANCELED.
+    [[nodiscard]] bool prepareCancel(uint64_t targetUserData, uint64_t userData);
+    /// Completes with -ETIME after `timeout`. Bounds the time `submitAndWait` blocks if no other request completes.
+    [[nodiscard]] bool prepareTimeout(std::chrono::nanoseconds timeout, uint64_t userData);
+
+    void submitAndWait();
+
+    /// Calls `onCompletion(userData, result)` for every available completion. `result` follows the convention of the corresponding
+    /// system call, but reports errors as negative errno values.
+    template <typename OnCompletion>
+    void drainCompletions(OnCompletion&& onCompletion)
+    {
+        auto head = *completionHead;
+        const auto tail = std::atomic_ref(*completionTail).load(std::memory_order_acquire);
+        while (head != tail)
+        {
+            const auto& completion = completions[head & *completionMask];
+            onCompletion(completion.user_data, completion.res);
+            ++head;
+        }
+        std::atomic_ref(*completionHead).store(head, std::memory_order_release);
+    }
+
+private:
+    io_uring_sqe* nextSubmission();
+
+    int ringFileDescriptor;
+    uint32_t submissionEntries;
+    uint32_t numberOfQueuedSubmissions = 0;
+
+    void* submissionRing;
+    size_t submissionRingSize;
+    void* completionRing;
+    size_t completionRingSize;
+    io_uring_sqe* submissions;
+    size_t submissionsSize;
+
+    uint32_t* submissionHead;
+    uint32_t* submissionTail;
+    uint32_t* submissionMask;
+    uint32_t* submissionArray;
+    uint32_t* completionHead;
+    uint32_t* completionTail;
+    uint32_t* completionMask;
+    io_uring_cqe* completions;
+
+    /// Timeout requests reference their timespec until they are submitted.
+    __kernel_timespec timeoutSpecification{};
+};
+
+}
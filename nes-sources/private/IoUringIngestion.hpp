@@ -0,0 +1,84 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stop_token>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <BackpressureChannel.hpp>
+#include <ErrorHandling.hpp>
+#include <SourceThread.hpp>
+
+namespace NES
+{
+
+/// Drives many sources from a few I/O threads via io_uring, instead of dedicating a blocking SourceThread to every source.
+/// The SourceThread opens its source and hands it over via 'attach' if the source exposes an AsyncReadTarget, then it exits.
+/// Every I/O thread owns one ring. It keeps at most one read in flight per attached source, which targets the memory of a pooled
+/// TupleBuffer, and emits the buffer once it is full, the flush interval of the source passed, or the source reached its end.
+/// Sources that wait for backpressure to be released or for a free buffer are revisited every POLL_INTERVAL.
+class IoUringIngestion
+{
+public:
+    struct AsyncSource
+    {
+        Source& source;
+        Source::AsyncReadTarget target;
+        BackpressureListener backpressureListener;
+        std::shared_ptr<AbstractBufferProvider> bufferProvider;
+        std::stop_token stopToken;
+        /// Emits a buffer of raw bytes, whose number of bytes is stored as its number of tuples.
+        std::function<void(TupleBuffer&&)> emitData;
+        /// Once the source was closed, exactly one of 'terminate' and 'fail' is called.
+        std::function<void(SourceImplementationTermination)> terminate;
+        std::function<void(Exception)> fail;
+    };
+
+    /// Throws CannotOpenSource if io_uring is not available.
+    explicit IoUringIngestion(size_t numberOfThreads);
+    ~IoUringIngestion();
+
+    IoUringIngestion(const IoUringIngestion&) = delete;
+    IoUringIngestion& operator=(const IoUringIngestion&) = delete;
+    IoUringIngestion(IoUringIngestion&&) = delete;
+    IoUringIngestion& operator=(IoUringIngestion&&) = delete;
+
+    static constexpr uint32_t RING_ENTRIES = 256;
+    /// Every attached source has at most a read and a cancel request in flight, and one entry is kept for the timeout of the I/O
+    /// thread. Thus, an I/O thread never runs out of entries, no matter how many of its sources keep their read in flight.
+    static constexpr size_t MAX_SOURCES_PER_THREAD = (RING_ENTRIES - 1) / 2;
+
+    /// Sources are distributed round-robin over the I/O threads. The source is driven until it ends, fails, or its stop token
+    /// is triggered. Returns false and leaves `source` untouched if every I/O thread already drives MAX_SOURCES_PER_THREAD sources,
+    /// then the caller has to drive the source itself. Otherwise, `source` is moved from.
+    [[nodiscard]] bool tryAttach(AsyncSource& source);
+
+private:
+    static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(10);
+
+    class IoThread;
+    std::vector<std::unique_ptr<IoThread>> ioThreads;
+    std::atomic<size_t> nextIoThread{0};
+};
+
+}
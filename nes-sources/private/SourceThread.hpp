@@ -34,6 +34,8 @@
 
 namespace NES
 {
+class IoUringIngestion;
+
 struct SourceImplementationTermination
 {
     enum : uint8_t
@@ -52,6 +54,8 @@ struct SourceImplementationTermination
 /// The runningRoutine orchestrates data ingestion until an end of stream (EOS) or a failure happens.
 /// The data source emits tasks into the TaskQueue when buffers are full, a timeout was hit, or a flush happens.
 /// The data source can call 'addEndOfStream()' from the QueryManager to stop a query via a reconfiguration message.
+/// If an io_uring ingestion is given, the thread only opens the source. Sources that expose an AsyncReadTarget are then handed
+/// over to the ingestion, which drives them until they terminate, and the thread exits.
 class SourceThread
 {
     static constexpr auto STOP_TIMEOUT_NOT_RUNNING = std::chrono::seconds(60);
@@ -62,7 +66,11 @@ public:
         BackpressureListener backpressureListener,
         OriginId originId, /// Todo #241: Rethink use of originId for sources, use new identifier for unique identification.
         std::shared_ptr<AbstractBufferProvider> bufferManager,
-        std::unique_ptr<Source> sourceImplementation);
+        std::unique_ptr<Source> sourceImplementation,
+        std::shared_ptr<IoUringIngestion> ingestion = nullptr);
+
+    /// Waits until a source that was handed over to the io_uring ingestion has been released by it.
+    ~SourceThread();
 
     SourceThread() = delete;
     SourceThread(const SourceThread& other) = delete;
@@ -94,6 +102,7 @@ protected:
     std::unique_ptr<Source> sourceImplementation;
     std::atomic_bool started;
     BackpressureListener backpressureListener;
+    std::shared_ptr<IoUringIngestion> ingestion;
 
     /// Order is important. Member destruction happens in reverse order. We first destroy the thread (which
     /// uses the terminationFuture), then the terminationFuture.
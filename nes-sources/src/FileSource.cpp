@@ -14,7 +14,10 @@
 
 #include <FileSource.hpp>
 
+#include <algorithm>
 #include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <format>
@@ -22,17 +25,22 @@
 #include <ios>
 #include <istream>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <stop_token>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <fcntl.h>
+#include <unistd.h>
 #include <Configurations/Descriptor.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sources/Source.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Util/Files.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <ErrorHandling.hpp>
 #include <FileDataRegistry.hpp>
 #include <InlineDataRegistry.hpp>
@@ -40,13 +48,95 @@
 namespace NES
 {
 
-FileSource::FileSource(const SourceDescriptor& sourceDescriptor) : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+struct FileSource::MappedFile
+{
+    MappedFile(uint8_t* data, const size_t size) : data(data), size(size) { }
+
+    ~MappedFile()
+    {
+        if (data != nullptr)
+        {
+            munmap(data, size);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// Advises the kernel about [offset, offset + length). madvise only accepts page-aligned ranges. If `onlyWholePages` is set,
+    /// the range shrinks to the pages that lie completely inside it, otherwise it grows to the pages it touches.
+    void advise(const size_t offset, const size_t length, const int advice, const bool onlyWholePages) const
+    {
+        static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const auto end = std::min(offset + length, size);
+        const auto alignedBegin = onlyWholePages ? (offset + pageSize - 1) / pageSize * pageSize : offset / pageSize * pageSize;
+        const auto alignedEnd = onlyWholePages ? end / pageSize * pageSize : std::min((end + pageSize - 1) / pageSize * pageSize, size);
+        if (alignedBegin < alignedEnd)
+        {
+            /// Advice is only a hint, a failure does not affect correctness.
+            madvise(data + alignedBegin, alignedEnd - alignedBegin, advice);
+        }
+    }
+
+    uint8_t* data;
+    size_t size;
+};
+
+std::shared_ptr<FileSource::MappedFile> FileSource::mapFile(const char* path)
+{
+    const int fileDescriptor = ::open(path, O_RDONLY | O_CLOEXEC); /// NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (fileDescriptor < 0)
+    {
+        throw CannotOpenSource("Could not open file {}: {}", path, getErrorMessageFromERRNO());
+    }
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        ::close(fileDescriptor);
+        throw CannotOpenSource("Could not determine the size of file {}: {}", path, getErrorMessageFromERRNO());
+    }
+    const auto fileSize = static_cast<size_t>(fileStatus.st_size);
+    if (fileSize == 0)
+    {
+        ::close(fileDescriptor);
+        return std::make_shared<MappedFile>(nullptr, 0);
+    }
+
+    /// The mapping is private and writable, so a consumer that modifies a raw buffer in place only copies the touched page,
+    /// and never writes through to the file.
+    void* mapping = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+    ::close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        throw CannotOpenSource("Could not memory-map file {}: {}", path, getErrorMessageFromERRNO());
+    }
+    auto mappedFile = std::make_shared<MappedFile>(static_cast<uint8_t*>(mapping), fileSize);
+    mappedFile->advise(0, fileSize, MADV_SEQUENTIAL, false);
+    return mappedFile;
+}
+
+FileSource::FileSource(const SourceDescriptor& sourceDescriptor)
+    : filePath(sourceDescriptor.getFromConfig(ConfigParametersCSV::FILEPATH))
+    , memoryMapped(sourceDescriptor.getFromConfig(ConfigParametersCSV::MEMORY_MAPPED))
 {
 }
 
 void FileSource::open(std::shared_ptr<AbstractBufferProvider>)
 {
     const auto realCSVPath = std::unique_ptr<char, decltype(std::free)*>{realpath(this->filePath.c_str(), nullptr), std::free};
+    if (this->memoryMapped)
+    {
+        if (realCSVPath == nullptr)
+        {
+            throw InvalidConfigParameter(
+                "Could not determine absolute pathname: {} - {}", this->filePath.c_str(), getErrorMessageFromERRNO());
+        }
+        this->mappedFile = mapFile(realCSVPath.get());
+        this->mappedFileOffset = 0;
+        return;
+    }
     this->inputFile = std::ifstream(realCSVPath.get(), std::ios::binary);
     if (not this->inputFile)
     {
@@ -56,11 +146,69 @@ void FileSource::open(std::shared_ptr<AbstractBufferProvider>)
 
 void FileSource::close()
 {
+    /// Buffers that are still in flight keep the mapping alive until they are released.
+    this->mappedFile.reset();
     this->inputFile.close();
+    if (this->asyncFileDescriptor >= 0)
+    {
+        ::close(this->asyncFileDescriptor);
+        this->asyncFileDescriptor = -1;
+    }
+}
+
+std::optional<Source::AsyncReadTarget> FileSource::getAsyncReadTarget()
+{
+    if (this->memoryMapped)
+    {
+        return std::nullopt;
+    }
+    const auto realCSVPath = std::unique_ptr<char, decltype(std::free)*>{realpath(this->filePath.c_str(), nullptr), std::free};
+    if (realCSVPath == nullptr)
+    {
+        throw InvalidConfigParameter("Could not determine absolute pathname: {} - {}", this->filePath.c_str(), getErrorMessageFromERRNO());
+    }
+    this->asyncFileDescriptor = ::open(realCSVPath.get(), O_RDONLY | O_CLOEXEC); /// NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (this->asyncFileDescriptor < 0)
+    {
+        throw CannotOpenSource("Could not open file {} for asynchronous reads: {}", realCSVPath.get(), getErrorMessageFromERRNO());
+    }
+    /// The backend reads from the start of the file, the stream opened by 'open()' is not used anymore.
+    this->inputFile.close();
+    return AsyncReadTarget{.fileDescriptor = this->asyncFileDescriptor, .positional = true};
+}
+
+Source::FillTupleBufferResult FileSource::fillTupleBufferFromMapping(TupleBuffer& tupleBuffer)
+{
+    const auto regionOffset = this->mappedFileOffset;
+    const auto numBytes = std::min<size_t>(tupleBuffer.getBufferSize(), this->mappedFile->size - regionOffset);
+    if (numBytes == 0)
+    {
+        return FillTupleBufferResult::eos();
+    }
+    this->mappedFileOffset += numBytes;
+    this->totalNumBytesRead += numBytes;
+
+    /// Read ahead the region of the next buffer while the input formatter processes this one.
+    this->mappedFile->advise(this->mappedFileOffset, numBytes, MADV_WILLNEED, false);
+
+    /// The wrapped buffer holds on to the pooled buffer it replaces, so every mapped region in flight still occupies a pooled buffer.
+    /// Thus, the source is throttled by the buffer pool just like without the mapping. Once the wrapped buffer is released, its
+    /// pages are dropped from the address space and the pooled buffer returns to the pool, which keeps the resident set of long
+    /// replays bounded by the buffers in flight.
+    tupleBuffer = TupleBuffer::wrapMemory(
+        this->mappedFile->data + regionOffset,
+        numBytes,
+        [mapping = this->mappedFile, regionOffset, pooledBuffer = tupleBuffer](uint8_t*, const size_t size)
+        { mapping->advise(regionOffset, size, MADV_DONTNEED, true); });
+    return FillTupleBufferResult::withBytes(numBytes);
 }
 
 Source::FillTupleBufferResult FileSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
 {
+    if (this->memoryMapped)
+    {
+        return fillTupleBufferFromMapping(tupleBuffer);
+    }
     this->inputFile.read(
         tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(), static_cast<std::streamsize>(tupleBuffer.getBufferSize()));
     const auto numBytesRead = this->inputFile.gcount();
@@ -0,0 +1,222 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <IoUring.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+#include <Util/Files.hpp>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+namespace
+{
+template <typename T>
+T* ringField(void* ring, const uint32_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(ring) + offset); /// NOLINT(cppcoreguidelines-pro-reinterpret-cast)
+}
+}
+
+IoUring::IoUring(const uint32_t entries)
+{
+    io_uring_params parameters{};
+    ringFileDescriptor = static_cast<int>(syscall(__NR_io_uring_setup, entries, &parameters));
+    if (ringFileDescriptor < 0)
+    {
+        throw CannotOpenSource("Could not set up an io_uring instance: {}", getErrorMessageFromERRNO());
+    }
+    submissionEntries = parameters.sq_entries;
+
+    submissionRingSize = parameters.sq_off.array + (parameters.sq_entries * sizeof(uint32_t));
+    completionRingSize = parameters.cq_off.cqes + (parameters.cq_entries * sizeof(io_uring_cqe));
+    const bool singleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMapping)
+    {
+        submissionRingSize = completionRingSize = std::max(submissionRingSize, completionRingSize);
+    }
+
+    submissionRing = mmap(
+        nullptr, submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFileDescriptor, IORING_OFF_SQ_RING);
+    completionRing = singleMapping ? submissionRing
+                                   : mmap(
+                                         nullptr,
+                                         completionRingSize,
+                                         PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE,
+                                         ringFileDescriptor,
+                                         IORING_OFF_CQ_RING);
+    submissionsSize = parameters.sq_entries * sizeof(io_uring_sqe);
+    submissions = static_cast<io_uring_sqe*>(
+        mmap(nullptr, submissionsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFileDescriptor, IORING_OFF_SQES));
+    if (submissionRing == MAP_FAILED or completionRing == MAP_FAILED or submissions == MAP_FAILED)
+    {
+        const auto error = getErrorMessageFromERRNO();
+        if (submissions != MAP_FAILED)
+        {
+            munmap(submissions, submissionsSize);
+        }
+        if (not singleMapping and completionRing != MAP_FAILED)
+        {
+            munmap(completionRing, completionRingSize);
+        }
+        if (submissionRing != MAP_FAILED)
+        {
+            munmap(submissionRing, submissionRingSize);
+        }
+        close(ringFileDescriptor);
+        throw CannotOpenSource("Could not map the io_uring queues: {}", error);
+    }
+
+    submissionHead = ringField<uint32_t>(submissionRing, parameters.sq_off.head);
+    submissionTail = ringField<uint32_t>(submissionRing, parameters.sq_off.tail);
+    submissionMask = ringField<uint32_t>(submissionRing, parameters.sq_off.ring_mask);
+    submissionArray = ringField<uint32_t>(submissionRing, parameters.sq_off.array);
+    completionHead = ringField<uint32_t>(completionRing, parameters.cq_off.head);
+    completionTail = ringField<uint32_t>(completionRing, parameters.cq_off.tail);
+    completionMask = ringField<uint32_t>(completionRing, parameters.cq_off.ring_mask);
+    completions = ringField<io_uring_cqe>(completionRing, parameters.cq_off.cqes);
+}
+
+IoUring::~IoUring()
+{
+    munmap(submissions, submissionsSize);
+    if (completionRing != submissionRing)
+    {
+        munmap(completionRing, completionRingSize);
+    }
+    munmap(submissionRing, submissionRingSize);
+    close(ringFileDescriptor);
+}
+
+bool IoUring::isSupported()
+{
+    static const bool supported = []
+    {
+        io_uring_params parameters{};
+        const auto ringFileDescriptor = static_cast<int>(syscall(__NR_io_uring_setup, 1, &parameters));
+        if (ringFileDescriptor < 0)
+        {
+            return false;
+        }
+        close(ringFileDescriptor);
+        return true;
+    }();
+    return supported;
+}
+
+io_uring_sqe* IoUring::nextSubmission()
+{
+    const auto tail = *submissionTail;
+    const auto head = std::atomic_ref(*submissionHead).load(std::memory_order_acquire);
+    if (tail - head >= submissionEntries)
+    {
+        return nullptr;
+    }
+    const auto index = tail & *submissionMask;
+    auto* submission = &submissions[index];
+    std::memset(submission, 0, sizeof(io_uring_sqe));
+    submissionArray[index] = index;
+    return submission;
+}
+
+bool IoUring::prepareRead(
+    const int fileDescriptor, uint8_t* destination, const uint32_t length, const uint64_t offset, const uint64_t userData)
+{
+    auto* submission = nextSubmission();
+    if (submission == nullptr)
+    {
+        return false;
+    }
+    submission->opcode = IORING_OP_READ;
+    submission->fd = fileDescriptor;
+    submission->addr = reinterpret_cast<uint64_t>(destination); /// NOLINT(cppcoreguidelines-pro-reinterpret-cast)
+    submission->len = length;
+    submission->off = offset;
+    submission->user_data = userData;
+    std::atomic_ref(*submissionTail).store(*submissionTail + 1, std::memory_order_release);
+    ++numberOfQueuedSubmissions;
+    return true;
+}
+
+bool IoUring::prepareCancel(const uint64_t targetUserData, const uint64_t userData)
+{
+    auto* submission = nextSubmission();
+    if (submission == nullptr)
+    {
+        return false;
+    }
+    submission->opcode = IORING_OP_ASYNC_CANCEL;
+    submission->fd = -1;
+    submission->addr = targetUserData;
+    submission->user_data = userData;
+    std::atomic_ref(*submissionTail).store(*submissionTail + 1, std::memory_order_release);
+    ++numberOfQueuedSubmissions;
+    return true;
+}
+
+bool IoUring::prepareTimeout(const std::chrono::nanoseconds timeout, const uint64_t userData)
+{
+    auto* submission = nextSubmission();
+    if (submission == nullptr)
+    {
+        return false;
+    }
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    timeoutSpecification.tv_sec = seconds.count();
+    timeoutSpecification.tv_nsec = (timeout - seconds).count();
+    submission->opcode = IORING_OP_TIMEOUT;
+    submission->fd = -1;
+    submission->addr = reinterpret_cast<uint64_t>(&timeoutSpecification); /// NOLINT(cppcoreguidelines-pro-reinterpret-cast)
+    submission->len = 1;
+    submission->off = 0; /// Only complete on expiry, not after a number of other completions
+    submission->user_data = userData;
+    std::atomic_ref(*submissionTail).store(*submissionTail + 1, std::memory_order_release);
+    ++numberOfQueuedSubmissions;
+    return true;
+}
+
+void IoUring::submitAndWait()
+{
+    while (true)
+    {
+        const auto submitted
+            = syscall(__NR_io_uring_enter, ringFileDescriptor, numberOfQueuedSubmissions, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (submitted >= 0)
+        {
+            numberOfQueuedSubmissions -= static_cast<uint32_t>(submitted);
+            return;
+        }
+        /// EINTR: interrupted by a signal before any completion arrived. EBUSY: the completion queue is full, the caller has
+        /// to drain it first, which it does after every call.
+        if (errno == EBUSY)
+        {
+            return;
+        }
+        INVARIANT(errno == EINTR, "io_uring_enter failed: {}", getErrorMessageFromERRNO());
+    }
+}
+
+}
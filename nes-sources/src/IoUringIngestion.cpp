@@ -0,0 +1,346 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <IoUringIngestion.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <utility>
+#include <vector>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <IoUring.hpp>
+#include <SourceThread.hpp>
+#include <Thread.hpp>
+
+namespace NES
+{
+
+namespace
+{
+/// User data of requests that do not belong to a source. Source requests carry the address of their AttachedSource.
+constexpr uint64_t TIMEOUT_REQUEST = 0;
+constexpr uint64_t CANCEL_REQUEST = 1;
+
+struct AttachedSource
+{
+    explicit AttachedSource(IoUringIngestion::AsyncSource handle) : handle(std::move(handle)) { }
+
+    IoUringIngestion::AsyncSource handle;
+    std::optional<TupleBuffer> buffer;
+    size_t bytesInBuffer = 0;
+    std::chrono::steady_clock::time_point bufferAcquired;
+    uint64_t fileOffset = 0;
+    bool readInFlight = false;
+    bool cancelInFlight = false;
+    bool finished = false;
+};
+
+uint64_t toUserData(AttachedSource& source)
+{
+    return reinterpret_cast<uint64_t>(&source); /// NOLINT(cppcoreguidelines-pro-reinterpret-cast)
+}
+
+void emitBuffer(AttachedSource& source)
+{
+    source.buffer->setNumberOfTuples(source.bytesInBuffer);
+    auto buffer = std::move(*source.buffer);
+    source.buffer.reset();
+    source.bytesInBuffer = 0;
+    source.handle.emitData(std::move(buffer));
+}
+
+void fail(AttachedSource& source, Exception exception)
+{
+    source.buffer.reset();
+    source.finished = true;
+    try
+    {
+        source.handle.source.close();
+    }
+    catch (...)
+    {
+        NES_ERROR("Source threw during failure shutdown: {}", wrapExternalException().what());
+    }
+    source.handle.fail(std::move(exception));
+}
+
+void finish(AttachedSource& source, const SourceImplementationTermination termination)
+{
+    source.buffer.reset();
+    source.finished = true;
+    try
+    {
+        source.handle.source.close();
+    }
+    catch (...)
+    {
+        source.handle.fail(wrapExternalException());
+        return;
+    }
+    source.handle.terminate(termination);
+}
+
+void complete(AttachedSource& source, const int32_t result)
+{
+    source.readInFlight = false;
+    if (result == -ECANCELED)
+    {
+        finish(source, {SourceImplementationTermination::StopRequested});
+        return;
+    }
+    if (result == -EAGAIN or result == -EINTR)
+    {
+        /// The read is resubmitted by the next round of the I/O thread.
+        return;
+    }
+    if (result < 0)
+    {
+        fail(source, RunningRoutineFailure("Reading from the source failed: {}", std::strerror(-result)));
+        return;
+    }
+    if (result == 0)
+    {
+        if (source.bytesInBuffer > 0)
+        {
+            emitBuffer(source);
+        }
+        const auto stopRequested = source.handle.stopToken.stop_requested();
+        finish(source, {stopRequested ? SourceImplementationTermination::StopRequested : SourceImplementationTermination::EndOfStream});
+        return;
+    }
+
+    source.bytesInBuffer += static_cast<size_t>(result);
+    source.fileOffset += static_cast<uint64_t>(result);
+    const auto flushInterval = source.handle.target.flushInterval;
+    const auto bufferIsFull = source.bytesInBuffer == source.buffer->getBufferSize();
+    const auto flushIntervalPassed
+        = flushInterval.count() > 0 and std::chrono::steady_clock::now() - source.bufferAcquired >= flushInterval;
+    if (bufferIsFull or flushIntervalPassed)
+    {
+        emitBuffer(source);
+    }
+}
+}
+
+class IoUringIngestion::IoThread
+{
+public:
+    explicit IoThread(const size_t index)
+        : ring(std::make_unique<IoUring>(RING_ENTRIES)), thread(fmt::format("IoUring-{}", index), &IoThread::run, this)
+    {
+    }
+
+    bool tryAttach(AsyncSource& source)
+    {
+        auto attached = numberOfSources.load(std::memory_order_relaxed);
+        do
+        {
+            if (attached >= MAX_SOURCES_PER_THREAD)
+            {
+                return false;
+            }
+        } while (not numberOfSources.compare_exchange_weak(attached, attached + 1, std::memory_order_relaxed));
+
+        const std::scoped_lock lock(mutex);
+        inbox.emplace_back(std::make_unique<AttachedSource>(std::move(source)));
+        return true;
+    }
+
+private:
+    /// Submits the next request of every source, then blocks until a request completed or POLL_INTERVAL passed.
+    void run(const std::stop_token& stopToken)
+    {
+        std::vector<std::unique_ptr<AttachedSource>> sources;
+        size_t requestsInFlight = 0;
+        bool timeoutInFlight = false;
+        size_t firstSource = 0;
+        while (true)
+        {
+            {
+                const std::scoped_lock lock(mutex);
+                for (auto& source : inbox)
+                {
+                    sources.emplace_back(std::move(source));
+                }
+                inbox.clear();
+            }
+            const auto shutdown = stopToken.stop_requested();
+            if (shutdown and sources.empty())
+            {
+                return;
+            }
+
+            /// The round starts at a different source every time, such that no source is always the last to get a free entry.
+            /// Sources that were stopped are finished even if no entry is free, because finishing them does not need a request.
+            firstSource = sources.empty() ? 0 : (firstSource + 1) % sources.size();
+            for (size_t offset = 0; offset < sources.size(); ++offset)
+            {
+                auto& source = sources[(firstSource + offset) % sources.size()];
+                /// Keep one submission free for the timeout, and the requests in flight below the size of the completion queue.
+                const auto canSubmit = requestsInFlight + 2 <= ring->getNumberOfEntries();
+                try
+                {
+                    requestsInFlight += submitNextRequest(*source, shutdown, canSubmit) ? 1 : 0;
+                }
+                catch (Exception& exception)
+                {
+                    fail(*source, std::move(exception));
+                }
+                catch (...)
+                {
+                    fail(*source, wrapExternalException());
+                }
+            }
+            if (not timeoutInFlight and ring->prepareTimeout(POLL_INTERVAL, TIMEOUT_REQUEST))
+            {
+                timeoutInFlight = true;
+                ++requestsInFlight;
+            }
+
+            ring->submitAndWait();
+            ring->drainCompletions(
+                [&](const uint64_t userData, const int32_t result)
+                {
+                    --requestsInFlight;
+                    if (userData == TIMEOUT_REQUEST)
+                    {
+                        timeoutInFlight = false;
+                        return;
+                    }
+                    if (userData == CANCEL_REQUEST)
+                    {
+                        return;
+                    }
+                    auto& source = *reinterpret_cast<AttachedSource*>(userData); /// NOLINT(performance-no-int-to-ptr)
+                    if (source.finished)
+                    {
+                        /// The source failed while its read was in flight. It is erased once the read completed.
+                        source.readInFlight = false;
+                        return;
+                    }
+                    try
+                    {
+                        complete(source, result);
+                    }
+                    catch (Exception& exception)
+                    {
+                        fail(source, std::move(exception));
+                    }
+                    catch (...)
+                    {
+                        fail(source, wrapExternalException());
+                    }
+                });
+            numberOfSources.fetch_sub(
+                std::erase_if(sources, [](const auto& source) { return source->finished and not source->readInFlight; }),
+                std::memory_order_relaxed);
+        }
+    }
+
+    /// Returns true if a request was queued. If `canSubmit` is false, the source is only finished if it was stopped.
+    bool submitNextRequest(AttachedSource& source, const bool shutdown, const bool canSubmit)
+    {
+        if (source.finished)
+        {
+            return false;
+        }
+        if (shutdown or source.handle.stopToken.stop_requested())
+        {
+            if (not source.readInFlight)
+            {
+                finish(source, {SourceImplementationTermination::StopRequested});
+                return false;
+            }
+            if (canSubmit and not source.cancelInFlight and ring->prepareCancel(toUserData(source), CANCEL_REQUEST))
+            {
+                source.cancelInFlight = true;
+                return true;
+            }
+            return false;
+        }
+        if (not canSubmit or source.readInFlight or source.handle.backpressureListener.hasBackpressure())
+        {
+            return false;
+        }
+        if (not source.buffer)
+        {
+            source.buffer = source.handle.bufferProvider->getBufferNoBlocking();
+            if (not source.buffer)
+            {
+                return false;
+            }
+            source.bufferAcquired = std::chrono::steady_clock::now();
+        }
+
+        const auto& target = source.handle.target;
+        auto memory = source.buffer->getAvailableMemoryArea<uint8_t>();
+        if (ring->prepareRead(
+                target.fileDescriptor,
+                memory.data() + source.bytesInBuffer,
+                static_cast<uint32_t>(memory.size() - source.bytesInBuffer),
+                target.positional ? source.fileOffset : IoUring::CURRENT_POSITION,
+                toUserData(source)))
+        {
+            source.readInFlight = true;
+            return true;
+        }
+        return false;
+    }
+
+    /// Counts the sources in the inbox and the sources driven by the I/O thread.
+    std::atomic<size_t> numberOfSources{0};
+    std::mutex mutex;
+    std::vector<std::unique_ptr<AttachedSource>> inbox;
+    std::unique_ptr<IoUring> ring;
+    /// Declared last, the thread has to stop before the ring and the inbox are destroyed.
+    Thread thread;
+};
+
+IoUringIngestion::IoUringIngestion(const size_t numberOfThreads)
+{
+    PRECONDITION(numberOfThreads > 0, "The io_uring ingestion requires at least one I/O thread");
+    ioThreads.reserve(numberOfThreads);
+    for (size_t index = 0; index < numberOfThreads; ++index)
+    {
+        ioThreads.emplace_back(std::make_unique<IoThread>(index));
+    }
+}
+
+IoUringIngestion::~IoUringIngestion() = default;
+
+bool IoUringIngestion::tryAttach(AsyncSource& source)
+{
+    const auto first = nextIoThread.fetch_add(1, std::memory_order_relaxed);
+    for (size_t offset = 0; offset < ioThreads.size(); ++offset)
+    {
+        if (ioThreads[(first + offset) % ioThreads.size()]->tryAttach(source))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+}
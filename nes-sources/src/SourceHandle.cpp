@@ -24,6 +24,7 @@
 #include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <BackpressureChannel.hpp>
+#include <IoUringIngestion.hpp>
 #include <SourceThread.hpp>
 
 namespace NES
@@ -33,11 +34,16 @@ SourceHandle::SourceHandle(
     OriginId originId,
     SourceRuntimeConfiguration configuration,
     std::shared_ptr<AbstractBufferProvider> bufferPool,
-    std::unique_ptr<Source> sourceImplementation)
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<IoUringIngestion> ingestion)
     : configuration(std::move(configuration))
 {
     this->sourceThread = std::make_unique<SourceThread>(
-        std::move(backpressureListener), std::move(originId), std::move(bufferPool), std::move(sourceImplementation));
+        std::move(backpressureListener),
+        std::move(originId),
+        std::move(bufferPool),
+        std::move(sourceImplementation),
+        std::move(ingestion));
 }
 
 SourceHandle::~SourceHandle() = default;
@@ -14,6 +14,7 @@
 
 #include <Sources/SourceProvider.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -21,16 +22,31 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Sources/SourceHandle.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <BackpressureChannel.hpp>
 #include <ErrorHandling.hpp>
+#include <IoUring.hpp>
+#include <IoUringIngestion.hpp>
 #include <SourceRegistry.hpp>
 
 namespace NES
 {
 
-SourceProvider::SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool)
+SourceProvider::SourceProvider(
+    size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool, const size_t numberOfIoUringThreads)
     : defaultMaxInflightBuffers(defaultMaxInflightBuffers), bufferPool(std::move(bufferPool))
 {
+    if (numberOfIoUringThreads > 0)
+    {
+        if (IoUring::isSupported())
+        {
+            ingestion = std::make_shared<IoUringIngestion>(numberOfIoUringThreads);
+        }
+        else
+        {
+            NES_WARNING("io_uring is not available, sources fall back to one ingestion thread per source");
+        }
+    }
 }
 
 std::unique_ptr<SourceHandle>
@@ -48,7 +64,7 @@ SourceProvider::lower(OriginId originId, BackpressureListener backpressureListen
         SourceRuntimeConfiguration runtimeConfig{maxInflightBuffers};
 
         return std::make_unique<SourceHandle>(
-            std::move(backpressureListener), std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source));
+            std::move(backpressureListener), std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source), ingestion);
     }
     throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
 }
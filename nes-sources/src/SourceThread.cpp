@@ -34,6 +34,7 @@
 #include <cpptrace/from_current.hpp>
 #include <fmt/format.h>
 #include <ErrorHandling.hpp>
+#include <IoUringIngestion.hpp>
 #include <Thread.hpp>
 #include <scope_guard.hpp>
 
@@ -44,15 +45,27 @@ SourceThread::SourceThread(
     BackpressureListener backpressureListener,
     OriginId originId,
     std::shared_ptr<AbstractBufferProvider> poolProvider,
-    std::unique_ptr<Source> sourceImplementation)
+    std::unique_ptr<Source> sourceImplementation,
+    std::shared_ptr<IoUringIngestion> ingestion)
     : originId(originId)
     , localBufferManager(std::move(poolProvider))
     , sourceImplementation(std::move(sourceImplementation))
     , backpressureListener(std::move(backpressureListener))
+    , ingestion(std::move(ingestion))
 {
     PRECONDITION(this->localBufferManager, "Invalid buffer manager");
 }
 
+SourceThread::~SourceThread()
+{
+    /// The thread of a source that was handed over has already exited, thus joining it does not wait for the source.
+    thread.requestStop();
+    if (terminationFuture.valid())
+    {
+        terminationFuture.wait();
+    }
+}
+
 namespace
 {
 void addBufferMetaData(OriginId originId, SequenceNumber sequenceNumber, TupleBuffer& buffer)
@@ -83,9 +96,13 @@ SourceImplementationTermination dataSourceThreadRoutine(
     BackpressureListener backpressureListener,
     Source& source,
     std::shared_ptr<AbstractBufferProvider> bufferProvider,
-    const EmitFn& emit)
+    const EmitFn& emit,
+    const bool sourceIsOpen)
 {
-    source.open(bufferProvider);
+    if (not sourceIsOpen)
+    {
+        source.open(bufferProvider);
+    }
     SCOPE_SUCCESS
     {
         source.close();
@@ -144,6 +161,77 @@ SourceImplementationTermination dataSourceThreadRoutine(
     return {SourceImplementationTermination::StopRequested};
 }
 
+/// Hands an opened source over to the io_uring ingestion, which then owns the termination promise and closes the source.
+/// Returns false if the source does not support asynchronous reads or every I/O thread is at capacity. Then, the source has to be
+/// driven by the calling thread, which still owns the backpressure listener and the termination promise.
+bool handOverToIngestion(
+    IoUringIngestion& ingestion,
+    const std::stop_token& stopToken,
+    BackpressureListener& backpressureListener,
+    std::promise<SourceImplementationTermination>& result,
+    Source& source,
+    const SourceReturnType::EmitFunction& emit,
+    const OriginId originId,
+    const std::shared_ptr<AbstractBufferProvider>& bufferProvider)
+{
+    SCOPE_FAIL
+    {
+        cpptrace::try_catch(
+            [&]() { source.close(); }, []() { NES_ERROR("Source threw during failure shutdown: ", wrapExternalException().what()); });
+    };
+
+    const auto target = source.getAsyncReadTarget();
+    if (not target)
+    {
+        return false;
+    }
+
+    auto termination = std::make_shared<std::promise<SourceImplementationTermination>>(std::move(result));
+    IoUringIngestion::AsyncSource asyncSource{
+        .source = source,
+        .target = *target,
+        .backpressureListener = std::move(backpressureListener),
+        .bufferProvider = bufferProvider,
+        .stopToken = stopToken,
+        .emitData =
+            [originId,
+             emit,
+             stopToken,
+             requiresMetadata = !source.addsMetadata(),
+             sequenceNumberGenerator = static_cast<size_t>(SequenceNumber::INITIAL)](TupleBuffer&& buffer) mutable
+        {
+            if (requiresMetadata)
+            {
+                addBufferMetaData(originId, SequenceNumber(sequenceNumberGenerator++), buffer);
+            }
+            emit(originId, SourceReturnType::Data{std::move(buffer)}, stopToken);
+        },
+        .terminate =
+            [termination, originId, emit, stopToken](const SourceImplementationTermination terminationReason)
+        {
+            if (!stopToken.stop_requested())
+            {
+                emit(originId, SourceReturnType::EoS{}, stopToken);
+            }
+            termination->set_value(terminationReason);
+        },
+        .fail =
+            [termination, originId, emit, stopToken](Exception exception)
+        {
+            auto exceptionPointer = std::make_exception_ptr(exception);
+            emit(originId, SourceReturnType::Error{std::move(exception)}, stopToken);
+            termination->set_exception(std::move(exceptionPointer));
+        }};
+    if (not ingestion.tryAttach(asyncSource))
+    {
+        NES_DEBUG("Every io_uring thread is at capacity, source {} is driven by its own thread", originId);
+        backpressureListener = std::move(asyncSource.backpressureListener);
+        result = std::move(*termination);
+        return false;
+    }
+    return true;
+}
+
 void dataSourceThread(
     const std::stop_token& stopToken,
     BackpressureListener backpressureListener,
@@ -152,7 +240,9 @@ void dataSourceThread(
     SourceReturnType::EmitFunction emit,
     const OriginId originId,
     ///NOLINTNEXTLINE(performance-unnecessary-value-param) `jthread` does not allow references
-    std::shared_ptr<AbstractBufferProvider> bufferProvider)
+    std::shared_ptr<AbstractBufferProvider> bufferProvider,
+    ///NOLINTNEXTLINE(performance-unnecessary-value-param) `jthread` does not allow references
+    std::shared_ptr<IoUringIngestion> ingestion)
 {
     size_t sequenceNumberGenerator = SequenceNumber::INITIAL;
     const EmitFn dataEmit = [&](TupleBuffer&& buffer, bool shouldAddMetadata)
@@ -168,8 +258,18 @@ void dataSourceThread(
     cpptrace::try_catch(
         [&]()
         {
-            result.set_value_at_thread_exit(
-                dataSourceThreadRoutine(stopToken, std::move(backpressureListener), *source, std::move(bufferProvider), dataEmit));
+            bool sourceIsOpen = false;
+            if (ingestion)
+            {
+                source->open(bufferProvider);
+                sourceIsOpen = true;
+                if (handOverToIngestion(*ingestion, stopToken, backpressureListener, result, *source, emit, originId, bufferProvider))
+                {
+                    return;
+                }
+            }
+            result.set_value_at_thread_exit(dataSourceThreadRoutine(
+                stopToken, std::move(backpressureListener), *source, std::move(bufferProvider), dataEmit, sourceIsOpen));
             if (!stopToken.stop_requested())
             {
                 emit(originId, SourceReturnType::EoS{}, stopToken);
@@ -210,7 +310,8 @@ bool SourceThread::start(SourceReturnType::EmitFunction&& emitFunction)
         sourceImplementation.get(),
         std::move(emitFunction),
         originId,
-        localBufferManager);
+        localBufferManager,
+        ingestion);
     thread = std::move(sourceThread);
     return true;
 }
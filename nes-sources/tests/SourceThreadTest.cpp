@@ -14,6 +14,8 @@
 
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <concepts>
 #include <cstddef>
@@ -21,8 +23,11 @@
 #include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <ostream>
 #include <ranges>
 #include <source_location>
+#include <stop_token>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -33,6 +38,8 @@
 #include <Runtime/Allocator/NesDefaultMemoryAllocator.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/MemoryUtils.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
 #include <Sources/SourceReturnType.hpp>
 #include <Util/Logger/LogLevel.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -42,6 +49,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <BaseUnitTest.hpp>
+#include <IoUring.hpp>
+#include <IoUringIngestion.hpp>
 #include <SourceThread.hpp>
 #include <TestSource.hpp>
 #include <nameof.hpp>
@@ -448,5 +457,226 @@ TEST_F(SourceThreadTest, StopDuringBackpressure)
     EXPECT_TRUE(control->wasDestroyed());
 }
 
+/// Exposes the read end of a pipe to the io_uring ingestion. Buffers are never filled by the SourceThread.
+class PipeSource final : public Source
+{
+public:
+    explicit PipeSource(const int readFileDescriptor, std::shared_ptr<std::atomic_bool> closed)
+        : readFileDescriptor(readFileDescriptor), closed(std::move(closed))
+    {
+    }
+
+    FillTupleBufferResult fillTupleBuffer(TupleBuffer&, const std::stop_token&) override
+    {
+        ADD_FAILURE() << "A source driven by the io_uring ingestion should not be asked to fill buffers";
+        return FillTupleBufferResult::eos();
+    }
+
+    void open(std::shared_ptr<AbstractBufferProvider>) override { }
+
+    void close() override
+    {
+        ::close(readFileDescriptor);
+        *closed = true;
+    }
+
+    [[nodiscard]] std::optional<AsyncReadTarget> getAsyncReadTarget() override
+    {
+        return AsyncReadTarget{.fileDescriptor = readFileDescriptor, .positional = false};
+    }
+
+protected:
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override { return str << "PipeSource"; }
+
+private:
+    int readFileDescriptor;
+    std::shared_ptr<std::atomic_bool> closed;
+};
+
+TEST_F(SourceThreadTest, IoUringIngestionReadsUntilEndOfStream)
+{
+    if (not IoUring::isSupported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    auto bm = BufferManager::create(
+        TOTAL_MEMORY_IN_BYTES,
+        UNPOOLED_MEMORY_FRACTION,
+        BUFFER_ALIGNMENT,
+        POOLED_BUFFER_SIZE,
+        std::make_shared<NesDefaultMemoryAllocator>());
+    auto [backpressureController, backpressureListener] = createBackpressureChannel();
+    RecordingEmitFunction recorder(*bm);
+
+    /// Two full buffers and a partial one, which is emitted when the write end is closed.
+    std::vector<uint8_t> input((2 * POOLED_BUFFER_SIZE) + (POOLED_BUFFER_SIZE / 2));
+    std::ranges::generate(input, [value = uint8_t(0)]() mutable { return value++; });
+    std::array<int, 2> pipeFileDescriptors{};
+    ASSERT_EQ(pipe(pipeFileDescriptors.data()), 0);
+    ASSERT_EQ(write(pipeFileDescriptors[1], input.data(), input.size()), static_cast<ssize_t>(input.size()));
+    ::close(pipeFileDescriptors[1]);
+
+    auto closed = std::make_shared<std::atomic_bool>(false);
+    {
+        SourceThread sourceThread(
+            std::move(backpressureListener),
+            INITIAL<OriginId>,
+            bm,
+            std::make_unique<PipeSource>(pipeFileDescriptors[0], closed),
+            std::make_shared<IoUringIngestion>(1));
+        verify_non_blocking_start(
+            sourceThread,
+            [&](const OriginId originId, SourceReturnType::SourceReturnType ret, const std::stop_token&)
+            {
+                recorder(originId, std::move(ret));
+                return SourceReturnType::EmitResult::SUCCESS;
+            });
+        wait_for_emits(recorder, 4);
+        verify_non_blocking_stop(sourceThread);
+    }
+
+    verify_number_of_emits(recorder, 4);
+    verify_last_event<SourceReturnType::EoS>(recorder);
+    EXPECT_TRUE(*closed);
+
+    std::vector<uint8_t> output;
+    for (auto& emitted : *recorder.recordedEmits.lock())
+    {
+        if (auto* data = std::get_if<SourceReturnType::Data>(&emitted))
+        {
+            const auto memory = data->buffer.getAvailableMemoryArea<uint8_t>();
+            output.insert(output.end(), memory.begin(), memory.begin() + data->buffer.getNumberOfTuples());
+        }
+    }
+    EXPECT_THAT(output, ::testing::ContainerEq(input));
+}
+
+TEST_F(SourceThreadTest, IoUringIngestionCancelsPendingReadOnStop)
+{
+    if (not IoUring::isSupported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    auto bm = BufferManager::create(
+        TOTAL_MEMORY_IN_BYTES,
+        UNPOOLED_MEMORY_FRACTION,
+        BUFFER_ALIGNMENT,
+        POOLED_BUFFER_SIZE,
+        std::make_shared<NesDefaultMemoryAllocator>());
+    auto [backpressureController, backpressureListener] = createBackpressureChannel();
+    RecordingEmitFunction recorder(*bm);
+
+    /// The write end stays open, thus the read of the source only completes once it is cancelled.
+    std::array<int, 2> pipeFileDescriptors{};
+    ASSERT_EQ(pipe(pipeFileDescriptors.data()), 0);
+    auto closed = std::make_shared<std::atomic_bool>(false);
+    {
+        SourceThread sourceThread(
+            std::move(backpressureListener),
+            INITIAL<OriginId>,
+            bm,
+            std::make_unique<PipeSource>(pipeFileDescriptors[0], closed),
+            std::make_shared<IoUringIngestion>(1));
+        verify_non_blocking_start(
+            sourceThread,
+            [&](const OriginId originId, SourceReturnType::SourceReturnType ret, const std::stop_token&)
+            {
+                recorder(originId, std::move(ret));
+                return SourceReturnType::EmitResult::SUCCESS;
+            });
+        std::this_thread::sleep_for(DEFAULT_TIMEOUT);
+        verify_non_blocking_stop(sourceThread);
+    }
+    ::close(pipeFileDescriptors[1]);
+
+    verify_no_events(recorder);
+    EXPECT_TRUE(*closed);
+}
+
+TEST_F(SourceThreadTest, IoUringIngestionRejectsSourcesBeyondRingCapacity)
+{
+    if (not IoUring::isSupported())
+    {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+    auto bm = BufferManager::create(
+        TOTAL_MEMORY_IN_BYTES,
+        UNPOOLED_MEMORY_FRACTION,
+        BUFFER_ALIGNMENT,
+        POOLED_BUFFER_SIZE,
+        std::make_shared<NesDefaultMemoryAllocator>());
+    auto [backpressureController, backpressureListener] = createBackpressureChannel();
+
+    /// All write ends stay open, thus every attached source keeps its read in flight until it is stopped.
+    constexpr size_t numberOfSources = IoUringIngestion::MAX_SOURCES_PER_THREAD + 1;
+    std::vector<std::array<int, 2>> pipes(numberOfSources);
+    std::vector<std::shared_ptr<std::atomic_bool>> closed;
+    std::vector<std::unique_ptr<PipeSource>> sources;
+    std::vector<std::stop_source> stopSources(numberOfSources);
+    std::atomic<size_t> terminated{0};
+    /// Declared after the state of the sources, the I/O thread has to stop before it is destroyed.
+    IoUringIngestion ingestion(1);
+    const auto createAsyncSource = [&](const size_t index)
+    {
+        return IoUringIngestion::AsyncSource{
+            .source = *sources[index],
+            .target = *sources[index]->getAsyncReadTarget(),
+            .backpressureListener = backpressureListener,
+            .bufferProvider = bm,
+            .stopToken = stopSources[index].get_token(),
+            .emitData = [](TupleBuffer&&) { ADD_FAILURE() << "An idle source should not emit data"; },
+            .terminate = [&](SourceImplementationTermination) { ++terminated; },
+            .fail = [](Exception exception) { ADD_FAILURE() << "An idle source should not fail: " << exception.what(); }};
+    };
+    for (size_t index = 0; index < numberOfSources; ++index)
+    {
+        ASSERT_EQ(pipe(pipes[index].data()), 0);
+        closed.emplace_back(std::make_shared<std::atomic_bool>(false));
+        sources.emplace_back(std::make_unique<PipeSource>(pipes[index][0], closed.back()));
+    }
+
+    for (size_t index = 0; index + 1 < numberOfSources; ++index)
+    {
+        auto asyncSource = createAsyncSource(index);
+        ASSERT_TRUE(ingestion.tryAttach(asyncSource));
+    }
+    auto rejectedSource = createAsyncSource(numberOfSources - 1);
+    EXPECT_FALSE(ingestion.tryAttach(rejectedSource));
+    std::this_thread::sleep_for(DEFAULT_TIMEOUT);
+
+    /// A full ring must not keep the I/O thread from stopping any of its sources.
+    for (size_t index = 0; index + 1 < numberOfSources; ++index)
+    {
+        stopSources[index].request_stop();
+    }
+    const auto deadline = std::chrono::steady_clock::now() + DEFAULT_LONG_TIMEOUT;
+    while (terminated < numberOfSources - 1 and std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(DEFAULT_TIMEOUT / 10);
+    }
+    EXPECT_EQ(terminated, numberOfSources - 1);
+    EXPECT_TRUE(std::ranges::all_of(closed | std::views::take(numberOfSources - 1), [](const auto& isClosed) { return isClosed->load(); }));
+    EXPECT_FALSE(*closed.back());
+
+    /// Once the stopped sources were released, the rejected source fits into the ring.
+    bool attached = false;
+    while (not attached and std::chrono::steady_clock::now() < deadline)
+    {
+        attached = ingestion.tryAttach(rejectedSource);
+        std::this_thread::sleep_for(DEFAULT_TIMEOUT / 10);
+    }
+    ASSERT_TRUE(attached);
+    stopSources.back().request_stop();
+    while (terminated < numberOfSources and std::chrono::steady_clock::now() < deadline + DEFAULT_LONG_TIMEOUT)
+    {
+        std::this_thread::sleep_for(DEFAULT_TIMEOUT / 10);
+    }
+    EXPECT_EQ(terminated, numberOfSources);
+    EXPECT_TRUE(*closed.back());
+    for (const auto& pipeFileDescriptors : pipes)
+    {
+        ::close(pipeFileDescriptors[1]);
+    }
+}
 
 }
@@ -347,7 +347,7 @@ timeUnit: MS
         ;
 
 
-functionName:  IDENTIFIER | AVG | MAX | MIN | SUM | COUNT | MEDIAN;
+functionName:  IDENTIFIER | AVG | MAX | MIN | SUM | COUNT | MEDIAN | APPROX_MEDIAN | APPROX_QUANTILE | APPROX_COUNT_DISTINCT | TOP_K;
 
 sinkClause: INTO sink (',' sink)*;
 
@@ -544,6 +544,10 @@ AVG: 'AVG' | 'avg';
 SUM: 'SUM' | 'sum';
 COUNT: 'COUNT' | 'count';
 MEDIAN: 'MEDIAN' | 'median';
+APPROX_MEDIAN: 'APPROX_MEDIAN' | 'approx_median';
+APPROX_QUANTILE: 'APPROX_QUANTILE' | 'approx_quantile';
+APPROX_COUNT_DISTINCT: 'APPROX_COUNT_DISTINCT' | 'approx_count_distinct';
+TOP_K: 'TOP_K' | 'top_k';
 WATERMARK: 'WATERMARK' | 'watermark';
 OFFSET: 'OFFSET' | 'offset';
 CSV_FORMAT : 'CSV_FORMAT';
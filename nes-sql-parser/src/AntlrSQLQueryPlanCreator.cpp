@@ -16,12 +16,14 @@
 
 #include <array>
 #include <cctype>
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <ranges>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -56,12 +58,15 @@
 #include <Functions/UnboundFieldAccessLogicalFunction.hpp>
 #include <Identifiers/Identifier.hpp>
 #include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/Windows/Aggregations/ApproxCountDistinctAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/ApproxQuantileAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/AvgAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/CountAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MaxAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MedianAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/MinAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/SumAggregationLogicalFunction.hpp>
+#include <Operators/Windows/Aggregations/TopKAggregationLogicalFunction.hpp>
 #include <Operators/Windows/Aggregations/WindowAggregationLogicalFunction.hpp>
 #include <Operators/Windows/JoinLogicalOperator.hpp>
 #include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
@@ -192,6 +197,42 @@ LogicalFunction createRawLiteralFunction(std::string literal)
     return ConstantValueLogicalFunction(DataTypeProvider::provideDataType(DataType::Type::UNDEFINED), std::move(literal));
 }
 
+/// The quantile of APPROX_QUANTILE configures the aggregation, so it has to be a numeric literal in [0, 1] rather than an expression
+double parseQuantileArgument(const LogicalFunction& argument, const std::string& functionCall)
+{
+    const auto constantFunction = argument.tryGetAs<ConstantValueLogicalFunction>();
+    if (not constantFunction.has_value())
+    {
+        throw InvalidQuerySyntax("The quantile of APPROX_QUANTILE must be a numeric literal at {}", functionCall);
+    }
+    const auto literal = constantFunction->get().getConstantValue();
+    double quantile = 0;
+    const auto [end, error] = std::from_chars(literal.data(), literal.data() + literal.size(), quantile);
+    if (error != std::errc{} or end != literal.data() + literal.size() or quantile < 0 or quantile > 1)
+    {
+        throw InvalidQuerySyntax("The quantile of APPROX_QUANTILE must lie in [0, 1], got {} at {}", literal, functionCall);
+    }
+    return quantile;
+}
+
+/// The k of TOP_K configures the size of the aggregation state, so it has to be a positive integer literal rather than an expression
+uint64_t parseTopKArgument(const LogicalFunction& argument, const std::string& functionCall)
+{
+    const auto constantFunction = argument.tryGetAs<ConstantValueLogicalFunction>();
+    if (not constantFunction.has_value())
+    {
+        throw InvalidQuerySyntax("The k of TOP_K must be an integer literal at {}", functionCall);
+    }
+    const auto literal = constantFunction->get().getConstantValue();
+    uint64_t k = 0;
+    const auto [end, error] = std::from_chars(literal.data(), literal.data() + literal.size(), k);
+    if (error != std::errc{} or end != literal.data() + literal.size() or k == 0)
+    {
+        throw InvalidQuerySyntax("The k of TOP_K must be a positive integer, got {} at {}", literal, functionCall);
+    }
+    return k;
+}
+
 LogicalFunction createNegatedNumericLiteralFunction(const ConstantValueLogicalFunction& constantFunction)
 {
     auto constantValue = constantFunction.getConstantValue();
@@ -1274,6 +1315,51 @@ void AntlrSQLQueryPlanCreator::exitFunctionCall(AntlrSQLParser::FunctionCallCont
                 std::nullopt);
             isAggregation = true;
             break;
+        case AntlrSQLLexer::APPROX_COUNT_DISTINCT:
+            ensureFieldAccessArgument();
+            helpers.top().windowAggs.emplace_back(
+                ApproxCountDistinctAggregationLogicalFunction{
+                    helpers.top().functionBuilder.back().getAs<UnboundFieldAccessLogicalFunction>()},
+                std::nullopt);
+            isAggregation = true;
+            break;
+        case AntlrSQLLexer::APPROX_MEDIAN:
+            ensureFieldAccessArgument();
+            helpers.top().windowAggs.emplace_back(
+                ApproxQuantileAggregationLogicalFunction{
+                    helpers.top().functionBuilder.back().getAs<UnboundFieldAccessLogicalFunction>(), 0.5},
+                std::nullopt);
+            isAggregation = true;
+            break;
+        case AntlrSQLLexer::APPROX_QUANTILE: {
+            if (context->argument.size() != 2 or helpers.top().functionBuilder.size() < 2)
+            {
+                throw InvalidQuerySyntax("APPROX_QUANTILE expects a field and a quantile at {}", context->getText());
+            }
+            const auto quantile = parseQuantileArgument(helpers.top().functionBuilder.back(), context->getText());
+            helpers.top().functionBuilder.pop_back();
+            ensureFieldAccessArgument();
+            helpers.top().windowAggs.emplace_back(
+                ApproxQuantileAggregationLogicalFunction{
+                    helpers.top().functionBuilder.back().getAs<UnboundFieldAccessLogicalFunction>(), quantile},
+                std::nullopt);
+            isAggregation = true;
+            break;
+        }
+        case AntlrSQLLexer::TOP_K: {
+            if (context->argument.size() != 2 or helpers.top().functionBuilder.size() < 2)
+            {
+                throw InvalidQuerySyntax("TOP_K expects a field and the number of reported values at {}", context->getText());
+            }
+            const auto k = parseTopKArgument(helpers.top().functionBuilder.back(), context->getText());
+            helpers.top().functionBuilder.pop_back();
+            ensureFieldAccessArgument();
+            helpers.top().windowAggs.emplace_back(
+                TopKAggregationLogicalFunction{helpers.top().functionBuilder.back().getAs<UnboundFieldAccessLogicalFunction>(), k},
+                std::nullopt);
+            isAggregation = true;
+            break;
+        }
         default:
             helpers.top().hasUnnamedAggregation = false;
             /// Check if the function is a constructor for a datatype